@@ -25,6 +25,8 @@
 #include "AppDelegate.h"
 #include "Scene/GameScene.h"
 #include "Scene/MainMenuScene.h" 
+#include "Utils/ScopeProfiler.h"
+#include "Utils/GameLog.h"
 #define USE_AUDIO_ENGINE 1
 
 #if USE_AUDIO_ENGINE
@@ -44,8 +46,14 @@ AppDelegate::AppDelegate()
 
 AppDelegate::~AppDelegate() 
 {
-    // AudioEngine::end()  Director ֮Զ
-    // Ҫֶãᵼ·ͷڴ
+    // 退出时导出性能记录（仅在启用性能计时的构建中有数据）
+    ScopeProfiler::getInstance()->dumpAtExit();
+
+    // 写完异步日志队列并停止后台线程
+    GameLog::getInstance()->shutdown();
+
+    // AudioEngine::end() 会在 Director 清理之后自动调用
+    // 不要在这里手动调用，否则会导致访问已释放内存
 }
 
 // if you want a different context, modify the value of glContextAttrs
@@ -105,6 +113,15 @@ bool AppDelegate::applicationDidFinishLaunching() {
 
     register_all_packages();
 
+    // 异步日志输出到 cocos 日志（各平台控制台 / logcat）
+    GameLog::getInstance()->setSink([](const char* line) {
+        cocos2d::log("%s", line);
+    });
+
+#if CIV_PROFILER_ENABLED
+    ScopeProfiler::getInstance()->setExitDumpPath(FileUtils::getInstance()->getWritablePath() + "civ_trace.json");
+#endif
+
     // create a scene. it's an autorelease object
     auto scene = MainMenuScene::createScene();
     director->runWithScene(scene);
@@ -5,10 +5,10 @@
 
 USING_NS_CC;
 
-// ̬Աʼ
+// 静态成员初始化
 MusicManager* MusicManager::_instance = nullptr;
 
-// ļ·
+// 音乐文件夹路径定义
 const std::string MusicManager::MUSIC_FOLDER_BASE = "Private/music/";
 const std::string MusicManager::MUSIC_FOLDER_THEME = "Private/music/Theme/";
 const std::string MusicManager::MUSIC_FOLDER_CHINA = "Private/music/China/";
@@ -10,74 +10,74 @@
 
 
 /**
- * @brief ֹ
- * @details Ϸеı֣˵ֺ͸ר
+ * @brief 音乐管理器单例类
+ * @details 负责管理游戏中的背景音乐，包括主菜单音乐和各文明专属音乐
  */
 class MusicManager
 {
 public:
     /**
-     * @brief ȡʵ
+     * @brief 获取单例实例
      */
     static MusicManager* getInstance();
 
     /**
-     * @brief ٵʵ
+     * @brief 销毁单例实例
      */
     static void destroyInstance();
 
     /**
-     * @brief ˵
+     * @brief 播放主菜单背景音乐
      */
     void playMainMenuMusic();
 
     /**
-     * @brief ָı֣ѡһף
+     * @brief 播放指定文明的背景音乐（随机选择一首）
      */
     void playCivilizationMusic(CivilizationType civType);
 
     /**
-     * @brief һ׵ǰ
+     * @brief 播放下一首当前文明的音乐
      */
     void playNextTrack();
 
     /**
-     * @brief ֹͣǰŵı
+     * @brief 停止当前播放的背景音乐
      */
     void stopMusic();
 
     /**
-     * @brief ͣǰŵı
+     * @brief 暂停当前播放的背景音乐
      */
     void pauseMusic();
 
     /**
-     * @brief ָű
+     * @brief 恢复播放背景音乐
      */
     void resumeMusic();
 
     /**
-     * @brief 
+     * @brief 设置音乐音量
      */
     void setMusicVolume(float volume);
 
     /**
-     * @brief ȡǰ
+     * @brief 获取当前音乐音量
      */
     float getMusicVolume() const;
 
     /**
-     * @brief Ƿڲ
+     * @brief 检查是否正在播放音乐
      */
     bool isPlaying() const;
 
     /**
-     * @brief Ԥļ
+     * @brief 预加载所有音乐文件
      */
     void preloadAllMusic();
 
     /**
-     * @brief лԴ
+     * @brief 清理所有缓存的音乐资源
      */
     void uncacheAllMusic();
 
@@ -2,37 +2,49 @@
 #include "BaseCity.h"
 #include "District/Building/Building.h"
 #include "Core/GameManager.h"
+#include "Core/GameRules.h"
 #include "Scene/GameScene.h"
 #include "Map/GameMapLayer.h"
 #include "AllKindsOfUnits.h"
 #include "UnitFactory.h"
 #include "DistrictFactory.h"
+#include "UI/FloatingTextPool.h"
+#include "Utils/ScopeProfiler.h"
+#include <algorithm>
 #include <cmath>
 #include <unordered_set>
 
-#define RADIUS 50.0f // ΰ뾶
+#define RADIUS 50.0f // 六边形半径
+
+namespace {
+	// 每块领土提供的基础产出（原有规则，维持文化扩张与科技节奏）
+	const Yield kTerritoryBaseYield = { 1, 1, 1, 1, 1 };
+
+	const size_t kMaxTerritorySize = 36; // 领土数量上限
+	const int kExpandSourceRange = 5; // 只从距离中心小于该值的领土向外扩张
+
+	const Fixed kFoodCarryOver = Fixed::percent(75); // 盈余食物计入增长量的比例
+}
 
 USING_NS_CC;
 
 /**
- * ʾ˸
+ * 显示警告闪烁文字
  */
-void warningFlash(std::string)
+void warningFlash(std::string text)
 {
 	auto visibleSize = Director::getInstance()->getVisibleSize();
-	// ʾǩ
-	auto label = Label::createWithTTF("ʾ", "fonts/Marker Felt.ttf", 24);
+	// 提示标签从飘字对象池取用
+	auto pool = FloatingTextPool::getInstance();
+	auto label = pool->acquire(Director::getInstance()->getRunningScene(), text, 24, Color3B::WHITE, 500);
 	label->setPosition(Vec2(visibleSize.width / 2, visibleSize.height / 2));
-	Director::getInstance()->getRunningScene()->addChild(label, 500);
 
-	label->setOpacity(0); // ʼ͸
+	label->setOpacity(0); // 初始透明
 
-	// ˸
+	// 闪烁一次后归还
 	auto fadeIn = FadeIn::create(0.2f);
 	auto fadeOut = FadeOut::create(1.0f);
-	auto sequence = Sequence::create(fadeIn, fadeOut, nullptr);
-	auto repeatForever = RepeatForever::create(sequence);
-	label->runAction(repeatForever);
+	label->runAction(Sequence::create(fadeIn, fadeOut, pool->releaseAction(), nullptr));
 }
 
 BaseCity* BaseCity::create(int player, Hex pos, std::string name) {
@@ -45,21 +57,39 @@ BaseCity* BaseCity::create(int player, Hex pos, std::string name) {
 	return nullptr;
 }
 
+BaseCity::~BaseCity() {
+	// 从城市注册表注销，持有旧句柄的引用从此查询失败
+	GameManager::getInstance()->unregisterCity(_handle, gridPos);
+	// 释放区域对象
+	for (auto district : districts) {
+		delete district;
+	}
+	districts.clear();
+	ProductionProgram::recycle(currentProduction);
+	currentProduction = nullptr;
+	// 释放生产队列
+	for (auto program : suspendedProductions) {
+		ProductionProgram::recycle(program);
+	}
+	suspendedProductions.clear();
+}
+
 bool BaseCity::initCity(int player, Hex pos, std::string name) {
 	if (!Node::init())
 		return false;
 
-	// ʼ
+	// 初始化基础属性
 	this->ownerPlayer = player;
 	this->gridPos = pos;
 	this->cityName = name;
 	this->population = 1;
-	this->unallocated = population; // ʼʱ˿δ
+	this->unallocated = population; // 初始时所有人口未分配
 	this->maxHealth = 100;
 	this->currentHealth = maxHealth;
 	this->addedHealth = 0;
+	this->_handle = GameManager::getInstance()->registerCity(this);
 
-	// ʼΧڸӼڽӸ
+	// 初始化领土范围：城市所在格子及其六个邻接格子
 	this->addToTerritory(Hex(pos.q, pos.r));
 	this->addToTerritory(Hex(pos.q + 1, pos.r));
 	this->addToTerritory(Hex(pos.q, pos.r + 1));
@@ -72,17 +102,17 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 	this->turnsLeftToExpand = 999;
 	this->expandAccumulation = 0;
 
-	// ѡܵչؿ
+	// 更新领土后立即选择可能的扩展地块
 	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
 	if (gameScene) {
 		choosePossibleExpand();
 	}
 
-	// ڴչؿʱӻ
+	// 仅在存在扩展地块时创建可视化
 	if (nextTerritoryTile != Hex()) {
 		updateTerritory();
 
-		// չؿӻ
+		// 创建扩展地块可视化
 		auto draw = DrawNode::create();
 		auto layout = HexLayout(RADIUS);
 
@@ -91,10 +121,10 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 			auto gameLayout = mapLayer->getLayout();
 
 			if (gameLayout) {
-				// չؿ
+				// 计算扩展地块的世界坐标
 				Vec2 expandPos = gameLayout->hexToPixel(nextTerritoryTile);
 
-				// ζ
+				// 创建六边形顶点
 				Vec2 vertices[6];
 				float size = RADIUS;
 				for (int i = 0; i < 6; i++) {
@@ -104,10 +134,10 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 					vertices[i] = Vec2(x, y);
 				}
 
-				// ư͸
+				// 绘制半透明六边形
 				draw->drawSolidPoly(vertices, 6, Color4F(255 / 255.f, 51 / 255.f, 255 / 255.f, 0.3f));
 
-				// չʱǩ
+				// 添加扩展倒计时标签
 				std::string expandText = std::to_string(turnsLeftToExpand) + " turns";
 				auto leftTurnLabel = Label::createWithSystemFont(expandText, "Arial", 14);
 				leftTurnLabel->setPosition(Vec2(expandPos.x, expandPos.y));
@@ -115,7 +145,7 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 				leftTurnLabel->enableOutline(Color4B::BLACK, 1);
 				draw->addChild(leftTurnLabel);
 
-				// ӵͼ
+				// 添加到地图层
 				mapLayer->addChild(draw, 20);
 				_expandVisual = draw;
 			}
@@ -125,7 +155,7 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 		_expandVisual = nullptr;
 	}
 
-	// 
+	// 创建市中心区
 	Downtown* downtownDistrict = new Downtown(this->ownerPlayer, pos, "Downtown");
 	this->addDistrict(static_cast<District*>(downtownDistrict));
 
@@ -133,14 +163,14 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 	_visual->addChild(downtownDistrict->_downtownVisual);
 	this->addChild(_visual);
 
-	// Ʊǩɵ
+	// 城市名称标签（可点击）
 	_nameLabel = ui::Button::create();
 	_nameLabel->setTitleText(cityName);
 	_nameLabel->setTitleFontSize(20);
 	_nameLabel->setTitleColor(Color3B::WHITE);
 	_nameLabel->setPosition(Vec2(0, 25));
 	_nameLabel->addClickEventListener([=](Ref* sender) {
-		// ʾ
+		// 点击显示生产面板
 		dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene())->updateProductionPanel(this->ownerPlayer, this);
 		});
 
@@ -153,10 +183,10 @@ bool BaseCity::initCity(int player, Hex pos, std::string name) {
 }
 
 /**
- * Ƴ߽
+ * 绘制城市领土边界
  */
 void BaseCity::drawTerritory() {
-	// ɵĿӻ
+	// 清理旧的可视化
 	if (this->_boundaryVisual) {
 		_boundaryVisual->removeFromParent();
 		_boundaryVisual = nullptr;
@@ -164,11 +194,11 @@ void BaseCity::drawTerritory() {
 
 	auto draw = DrawNode::create();
 	for (auto& tile : territory) {
-		// ÿӵλ
+		// 计算每个格子的相对位置
 		HexLayout layout(RADIUS);
 		Vec2 center = layout.hexToPixel(tile) - layout.hexToPixel(this->gridPos);
 
-		// 
+		// 绘制六边形
 		Vec2 vertices[6];
 		for (int i = 0; i < 6; i++) {
 			float rad = CC_DEGREES_TO_RADIANS(60 * i - 30);
@@ -181,7 +211,7 @@ void BaseCity::drawTerritory() {
 }
 
 /**
- * ۳нȣȿ۳⽡ȣ
+ * 扣除城市健康度（优先扣除额外健康度）
  */
 void BaseCity::deduceHealth(int damage) {
 	if (addedHealth > 0) {
@@ -199,59 +229,199 @@ void BaseCity::deduceHealth(int damage) {
 }
 
 /**
- * ³ܲ
+ * 标记城市产出失效，并登记到所属玩家的待刷新列表
  */
-void BaseCity::updateYield() {
-	Yield totalYield = { 0, 0, 0, 0, 0 };
+void BaseCity::markYieldDirty() {
+	if (_yieldDirty)
+		return;
+	_yieldDirty = true;
+	if (_yieldOwner)
+		_yieldOwner->onCityYieldDirty(this);
+}
 
-	// ۼĲ
+/**
+ * 加入领土：读取一次地形产出并计入地块产出总和
+ */
+void BaseCity::addToTerritory(Hex tile) {
+	if (ownsTile(tile))
+		return;
+
+	TileSlot slot = { computeTileYield(tile), false };
+	_tileSlots[tile] = slot;
+	_tileYieldTotal += tileContribution(tile, slot);
+	territory.push_back(tile);
+	populationDistribution[tile] = 0;
+	markYieldDirty();
+	reconsiderTile(tile);
+
+	// 更新扩张边界：该地块不再是候选，其邻居成为候选
+	_frontierTiles.erase(tile);
+	pushFrontierNeighbors(tile);
+}
+
+/**
+ * 把新领土的邻居加入扩张边界（只在入队时读取一次地块产出）
+ */
+void BaseCity::pushFrontierNeighbors(Hex tile) {
+	if (tile.distance(gridPos) >= kExpandSourceRange)
+		return;
+
+	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
+	const GameMapLayer* mapLayer = gameScene ? gameScene->getMapLayer() : nullptr;
+	for (int dir = 0; dir < 6; dir++) {
+		Hex neighbor = tile.getNeighbor(dir);
+		if (ownsTile(neighbor) || !_frontierTiles.insert(neighbor).second)
+			continue;
+
+		// 直接读地图中的地块数据，不复制 TileData
+		const TileData* data = mapLayer ? mapLayer->findTileData(neighbor) : nullptr;
+		int score = data ? calculateTileYield(*data) : 0;
+		_frontier.push({ score, neighbor.distance(gridPos), neighbor });
+	}
+}
+
+/**
+ * 设置地块耕作状态，按差值更新地块产出总和
+ */
+void BaseCity::setTileWorked(Hex tile, bool worked) {
+	auto it = _tileSlots.find(tile);
+	if (it == _tileSlots.end())
+		return;
+
+	populationDistribution[tile] = worked ? 1 : 0;
+	if (it->second.worked == worked)
+		return;
+
+	_tileYieldTotal -= tileContribution(tile, it->second);
+	it->second.worked = worked;
+	_tileYieldTotal += tileContribution(tile, it->second);
+	markYieldDirty();
+}
+
+/**
+ * 城市易主：区域对象保持不变，只更新占用表中的控制者
+ */
+void BaseCity::setOwnerPlayer(int player) {
+	ownerPlayer = player;
+	DistrictGrid& grid = GameManager::getInstance()->getDistrictGrid();
 	for (auto district : districts) {
-		totalYield = totalYield + district->getYield();
+		grid.setOwner(district->getPos(), player);
 	}
+}
 
-	// ۼĻ
-	for (auto& tile : territory) {
-		totalYield.foodYield += 1;
-		totalYield.productionYield += 1;
-		totalYield.goldYield += 1;
-		totalYield.scienceYield += 1;
-		totalYield.cultureYield += 1;
+/**
+ * 地块产出失效：重新读取该地块产出，按差值更新
+ */
+void BaseCity::invalidateTileYield(Hex tile) {
+	auto it = _tileSlots.find(tile);
+	if (it == _tileSlots.end())
+		return;
+
+	_tileYieldTotal -= tileContribution(tile, it->second);
+	it->second.yield = computeTileYield(tile);
+	_tileYieldTotal += tileContribution(tile, it->second);
+	markYieldDirty();
+	reconsiderTile(tile);
+}
+
+/**
+ * 计算地块自身产出：地形产出，建有区域（市中心除外）的地块不再产出
+ */
+Yield BaseCity::computeTileYield(Hex tile) const {
+	Yield yield = { 0, 0, 0, 0, 0 };
+	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
+	if (!gameScene)
+		return yield;
+
+	if (tile != gridPos) {
+		for (auto district : districts) {
+			if (district->getPos() == tile)
+				return yield;
+		}
+	}
+
+	const TileData* data = gameScene->getMapLayer() ? gameScene->getMapLayer()->findTileData(tile) : nullptr;
+	if (!data)
+		return yield;
+	yield.foodYield = data->food;
+	yield.productionYield = data->production;
+	yield.scienceYield = data->science;
+	yield.goldYield = data->gold;
+	yield.cultureYield = data->culture;
+	return yield;
+}
+
+/**
+ * 地块对城市的贡献：领土基础产出，市中心与被耕作地块再加上地块自身产出
+ */
+Yield BaseCity::tileContribution(Hex tile, const TileSlot& slot) const {
+	Yield contribution = kTerritoryBaseYield;
+	if (slot.worked || tile == gridPos)
+		contribution += slot.yield;
+	return contribution;
+}
+
+/**
+ * 更新城市总产出（区域产出 + 领土地块产出）
+ * 产出未失效时直接返回；重新计算后把变化量汇报给所属玩家
+ */
+void BaseCity::updateYield() {
+	if (!_yieldDirty)
+		return;
+
+	// 领土地块产出已按差值维护，这里只在向量寄存器中累加区域与专家
+	YieldAccumulator acc(_tileYieldTotal);
+	for (auto district : districts) {
+		acc.add(district->getYield());
+	}
+	for (const auto& specialist : _specialists) {
+		acc.add(specialist.first->getCitizenBenefit(), specialist.second);
 	}
+	Yield totalYield = acc.result();
 
+	Yield oldYield = cityYield;
 	cityYield = totalYield;
+	_yieldDirty = false;
+
+	if (_yieldOwner)
+		_yieldOwner->onCityYieldChanged(totalYield - oldYield);
 }
 
 /**
- * ˿ڣʳӯ/֣
+ * 更新人口（基于食物盈余/赤字）
  */
 void BaseCity::updatePopulation() {
-	// ʳ
-	neededFoodToMultiply = 15 + 8 * (population - 1) + (float)(pow(population - 1, 1.5) + 0.5f);
+	updateYield(); // 确保食物产出为最新
+
+	// 计算增长所需食物
+	neededFoodToMultiply = GameRules::calculateGrowthFood(population);
 
-	// ʳ
-	float accumulationIncrease = (cityYield.foodYield - population * 2.f) * 0.75f;
+	// 计算食物积累
+	Fixed accumulationIncrease = Fixed::fromInt(cityYield.foodYield - population * 2) * kFoodCarryOver;
 	currentAccumulation += accumulationIncrease;
 
-	// Ƿﵽֵ
-	if (currentAccumulation >= neededFoodToMultiply) {
+	// 检查是否达到增长阈值
+	if (currentAccumulation >= Fixed::fromInt(neededFoodToMultiply)) {
 		population++;
 		unallocated++;
-		neededFoodToMultiply = 15 + 8 * (population - 1) + (float)(pow(population - 1, 1.5) + 0.5f);
-		currentAccumulation = 0;
+		markYieldDirty();
+		neededFoodToMultiply = GameRules::calculateGrowthFood(population);
+		currentAccumulation = Fixed();
 	}
-	else if (currentAccumulation < 0) {
-		// ʳֵ˿ڼ
+	else if (currentAccumulation < Fixed()) {
+		// 食物赤字导致人口减少
 		population--;
 		unallocated--;
-		neededFoodToMultiply = 15 + 8 * (population - 1) + (float)(pow(population - 1, 1.5) + 0.5f);
-		currentAccumulation += neededFoodToMultiply;
+		markYieldDirty();
+		neededFoodToMultiply = GameRules::calculateGrowthFood(population);
+		currentAccumulation += Fixed::fromInt(neededFoodToMultiply);
 	}
 
 	updateDistribution();
 }
 
 /**
- * µĿǰĿ
+ * 添加新的生产项目（如果当前有项目则挂起）
  */
 void BaseCity::addNewProduction(ProductionProgram* newProgram) {
 	if (this->currentProduction != nullptr)
@@ -262,9 +432,11 @@ void BaseCity::addNewProduction(ProductionProgram* newProgram) {
 }
 
 /**
- * 
+ * 更新生产进度
  */
 void BaseCity::updateProduction() {
+	updateYield(); // 确保生产力为最新
+
 	if (!currentProduction) {
 		if (suspendedProductions.empty())
 			return;
@@ -272,42 +444,47 @@ void BaseCity::updateProduction() {
 		suspendedProductions.pop_back();
 	}
 
-	// 
+	// 增加生产进度
 	currentProduction->addProgress(this->cityYield.productionYield);
 
-	// Ƿ
+	// 检查是否完成
 	if (currentProduction->isCompleted()) {
 		if (currentProduction->getType() == ProductionProgram::ProductionType::DISTRICT) {
-			// 
+			// 创建新区
 			Node* districtVisual = nullptr;
-			auto newDistrict = DistrictFactory::createDistrict(currentProduction->getName(), ownerPlayer, currentProduction->getPosOnCreated(), districtVisual);
-			districts.push_back(newDistrict);
+			auto newDistrict = DistrictFactory::createDistrict(currentProduction, ownerPlayer, currentProduction->getPosOnCreated(), districtVisual);
+			addDistrict(newDistrict);
 
-			// ӵͼ
+			// 添加到地图
 			auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
 			districtVisual->setPosition(gameScene->getMapLayer()->getLayout()->hexToPixel(currentProduction->getPosOnCreated()));
 			gameScene->getMapLayer()->addChild(districtVisual, 5);
 
-			delete currentProduction;
+			invalidateTileYield(currentProduction->getPosOnCreated());
+			markYieldDirty();
 		}
 		else if (currentProduction->getType() == ProductionProgram::ProductionType::BUILDING) {
-			// Ϊӽ
+			// 为所有区域添加建筑
 			for (auto district : districts) {
 				district->addBuilding(currentProduction->getName());
 			}
+			markYieldDirty();
+			rebalanceCitizens(); // 新建筑可能带来专家槽位
 		}
 		else if (currentProduction->getType() == ProductionProgram::ProductionType::UNIT) {
-			// λ
-			AbstractUnit* newUnit = UnitFactory::createUnit(currentProduction->getName(), this->ownerPlayer, this->gridPos);
+			// 创建单位
+			AbstractUnit* newUnit = UnitFactory::createUnit(currentProduction, this->ownerPlayer, this->gridPos);
 			if (newUnit) {
 				GameManager::getInstance()->getPlayer(ownerPlayer)->addUnit(newUnit);
 				GameManager::getInstance()->getPlayer(ownerPlayer)->addToMapFunc(newUnit);
 			}
 		}
 
+		// 完成的项目归还对象池
+		ProductionProgram::recycle(currentProduction);
 		currentProduction = nullptr;
 
-		// ǷйĿ
+		// 检查是否有挂起的项目
 		if (suspendedProductions.empty()) {
 			currentProduction = nullptr;
 		}
@@ -319,11 +496,14 @@ void BaseCity::updateProduction() {
 }
 
 /**
- * ֱӹĿʹýң
+ * 直接购买项目（使用金币）
  */
 void BaseCity::purchaseDirectly(ProductionProgram* newProgram) {
-	if (!newProgram->getCanPurchase())
+	// 项目所有权交给城市：购买失败时同样归还
+	if (!newProgram->getCanPurchase()) {
+		ProductionProgram::recycle(newProgram);
 		return;
+	}
 
 	int cost = newProgram->getPurchaseCost();
 	Player* player = GameManager::getInstance()->getPlayer(this->ownerPlayer);
@@ -334,168 +514,246 @@ void BaseCity::purchaseDirectly(ProductionProgram* newProgram) {
 
 		if (newProgram->getType() == ProductionProgram::ProductionType::DISTRICT) {
 			Node* districtVisual = nullptr;
-			auto newDistrict = DistrictFactory::createDistrict(newProgram->getName(), ownerPlayer, newProgram->getPosOnCreated(), districtVisual);
-			districts.push_back(newDistrict);
+			auto newDistrict = DistrictFactory::createDistrict(newProgram, ownerPlayer, newProgram->getPosOnCreated(), districtVisual);
+			addDistrict(newDistrict);
 
 			auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
-			districtVisual->setPosition(gameScene->getMapLayer()->getLayout()->hexToPixel(currentProduction->getPosOnCreated()));
+			districtVisual->setPosition(gameScene->getMapLayer()->getLayout()->hexToPixel(newProgram->getPosOnCreated()));
 			gameScene->getMapLayer()->addChild(districtVisual, 5);
 
-			delete newProgram;
+			invalidateTileYield(newProgram->getPosOnCreated());
+			ProductionProgram::recycle(newProgram);
+			markYieldDirty();
 		}
 		else if (newProgram->getType() == ProductionProgram::ProductionType::BUILDING) {
-			auto newBuilding = static_cast<Building*>(newProgram);
 			for (auto district : districts) {
-				district->addBuilding(newBuilding->getName());
+				district->addBuilding(newProgram->getName());
 			}
-			delete newProgram;
+			ProductionProgram::recycle(newProgram);
+			markYieldDirty();
+			rebalanceCitizens(); // 新建筑可能带来专家槽位
 		}
 		else if (newProgram->getType() == ProductionProgram::ProductionType::UNIT) {
-			AbstractUnit* newUnit = UnitFactory::createUnit(newProgram->getName(), this->ownerPlayer, this->gridPos);
+			AbstractUnit* newUnit = UnitFactory::createUnit(newProgram, this->ownerPlayer, this->gridPos);
 			if (newUnit) {
 				GameManager::getInstance()->getPlayer(ownerPlayer)->addUnit(newUnit);
 				GameManager::getInstance()->getPlayer(ownerPlayer)->addToMapFunc(newUnit);
 			}
-			delete newProgram;
+			ProductionProgram::recycle(newProgram);
 		}
 		newProgram = nullptr;
 	}
 	else {
+		ProductionProgram::recycle(newProgram);
 		warningFlash("CANNOT PURCHASE: GOLD SHORTAGE");
 	}
 }
 
 /**
- * ˿ڷ䣨ȷ˿ڶжӦؿ飩
+ * 更新人口分配：只为新增的市民找位置、为减少的市民腾位置，其余分配保持不变
  */
 void BaseCity::updateDistribution() {
-	// 쳣δ˿Ϊ
-	if (unallocated < 0) {
-		for (auto& tile : populationDistribution) {
-			populationDistribution[tile.first] = 0;
-		}
-		unallocated = population;
-	}
+	updateYield();
+	Yield total = cityYield;
+	FrameArenaScope scratch; // 市民分配在回合外也会频繁触发，工作位列表用完即退回
+	WorkplaceList places = collectWorkplaces();
+	CitizenAssignment solver(_focus, population * 2);
+
+	int assigned = 0;
+	for (const auto& place : places)
+		assigned += place.assigned;
+	while (assigned > population && solver.removeCitizen(places, total))
+		assigned--;
+	while (assigned < population && solver.addCitizen(places, total))
+		assigned++;
+	unallocated = population - assigned;
+
+	applyWorkplaces(places);
+	updateYield();
+}
 
-	// Ϊδ˿ڷؿ
-	for (auto& tile : populationDistribution) {
-		if (unallocated == 0)
-			break;
-		if (populationDistribution[tile.first] == 0) {
-			unallocated--;
-			populationDistribution[tile.first] = 1;
-		}
-	}
+/**
+ * 按专注方向重新求解全部市民分配（贪心 + 局部交换）
+ */
+void BaseCity::rebalanceCitizens() {
+	updateYield();
+	Yield total = cityYield;
+	FrameArenaScope scratch;
+	WorkplaceList places = collectWorkplaces();
+	CitizenAssignment solver(_focus, population * 2);
+	unallocated = population - solver.solve(places, total, population);
 
-	updateYield(); // 仯Ӱ
+	applyWorkplaces(places);
+	updateYield();
 }
 
 /**
- * 
+ * 设置专注方向
  */
-void BaseCity::updatePanel() {
-	dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene())->updateProductionPanel(ownerPlayer, this);
+void BaseCity::setFocus(CityFocus focus) {
+	if (_focus == focus)
+		return;
+	_focus = focus;
+	rebalanceCitizens();
 }
 
 /**
- * ѡܵչؿ飨߽͵ؿ
+ * 手动调动市民（只在两块领土地块之间调动）
  */
-void BaseCity::choosePossibleExpand() {
-	// 
-	if (territory.size() >= 36) {
-		nextTerritoryTile = Hex();
-		return;
-	}
+bool BaseCity::moveCitizen(Hex from, Hex to) {
+	auto fromSlot = _tileSlots.find(from);
+	auto toSlot = _tileSlots.find(to);
+	if (fromSlot == _tileSlots.end() || toSlot == _tileSlots.end() || to == gridPos)
+		return false;
+	if (!fromSlot->second.worked || toSlot->second.worked)
+		return false;
 
-	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
-	if (!gameScene)
+	setTileWorked(from, false);
+	setTileWorked(to, true);
+	updateYield();
+	return true;
+}
+
+/**
+ * 单个地块加入领土或产出变化：有空闲市民时补位，否则只尝试与该地块相关的交换
+ */
+void BaseCity::reconsiderTile(Hex tile) {
+	if (tile == gridPos || population <= 0)
 		return;
+	if (unallocated > 0) {
+		updateDistribution();
+		return;
+	}
 
-	std::unordered_set<Hex> possibleExpandSet;
+	updateYield();
+	Yield total = cityYield;
+	FrameArenaScope scratch;
+	WorkplaceList places = collectWorkplaces();
+	for (size_t i = 0; i < places.size(); i++) {
+		if (!places[i].district && places[i].tile == tile) {
+			CitizenAssignment solver(_focus, population * 2);
+			if (solver.improveWorkplace(places, total, static_cast<int>(i)))
+				applyWorkplaces(places);
+			break;
+		}
+	}
+}
 
-	// ǰÿؿ
+/**
+ * 收集工作位：除市中心外的领土地块，以及区域的专家槽位
+ */
+WorkplaceList BaseCity::collectWorkplaces() const {
+	WorkplaceList places;
+	places.reserve(territory.size() + districts.size());
 	for (const auto& tile : territory) {
-		// ֻǾĲ5ĵؿ
-		if (tile.distance(gridPos) >= 5)
+		if (tile == gridPos)
 			continue;
+		const TileSlot& slot = _tileSlots.at(tile);
+		places.push_back({ tile, nullptr, slot.yield, 1, slot.worked ? 1 : 0 });
+	}
+	for (auto district : districts) {
+		int slots = specialistSlots(district);
+		if (slots <= 0)
+			continue;
+		auto it = _specialists.find(district);
+		int assigned = it != _specialists.end() ? std::min(it->second, slots) : 0;
+		places.push_back({ district->getPos(), district, district->getCitizenBenefit(), slots, assigned });
+	}
+	return places;
+}
 
-		// չ
-		const std::vector<Hex> directions = {
-			Hex(1, 0),   // 
-			Hex(1, -1),  // 
-			Hex(0, -1),  // 
-			Hex(-1, 0),  // 
-			Hex(-1, 1),  // 
-			Hex(0, 1)    // 
-		};
-
-		for (const auto& dir : directions) {
-			Hex neighbor = tile + dir;
-
-			// Ƿ
-			bool alreadyInTerritory = false;
-			for (const auto& t : territory) {
-				if (t == neighbor) {
-					alreadyInTerritory = true;
-					break;
-				}
-			}
-			if (alreadyInTerritory)
-				continue;
-
-			// ؿǷ
-			if (!gameScene->isTileOccupied(neighbor)) {
-				possibleExpandSet.insert(neighbor);
+/**
+ * 把求解结果写回地块耕作状态与专家人数
+ */
+void BaseCity::applyWorkplaces(const WorkplaceList& places) {
+	for (const auto& place : places) {
+		if (place.district) {
+			int& count = _specialists[place.district];
+			if (count != place.assigned) {
+				count = place.assigned;
+				markYieldDirty();
 			}
 		}
+		else {
+			setTileWorked(place.tile, place.assigned > 0);
+		}
 	}
+}
+
+/**
+ * 专家槽位数：专业区域每座建筑提供一个槽位，市中心没有专家
+ */
+int BaseCity::specialistSlots(const District* district) const {
+	if (district->getType() == District::DistrictType::DOWNTOWN)
+		return 0;
+	return static_cast<int>(district->getBuildings().size());
+}
+
+/**
+ * 区域专家总数
+ */
+int BaseCity::getSpecialistCount() const {
+	int count = 0;
+	for (const auto& specialist : _specialists)
+		count += specialist.second;
+	return count;
+}
 
-	// תΪڴ
-	std::vector<Hex> possibleExpand(possibleExpandSet.begin(), possibleExpandSet.end());
+/**
+ * 更新生产面板
+ */
+void BaseCity::updatePanel() {
+	dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene())->updateProductionPanel(ownerPlayer, this);
+}
 
-	if (possibleExpand.empty()) {
+/**
+ * 选择可能的扩展地块（取扩张边界堆顶）
+ * 已被本城或其他城市占据的候选在这里丢弃，其余候选保持原有评分
+ */
+void BaseCity::choosePossibleExpand() {
+	// 检查领土数量上限
+	if (territory.size() >= kMaxTerritorySize) {
 		nextTerritoryTile = Hex();
 		return;
 	}
 
-	// Ѱŵؿ飨ڲ;룩
-	Hex optimalExpand = possibleExpand[0];
-	int optimalYield = calculateTileYield(gameScene->getTileData(optimalExpand));
+	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
+	if (!gameScene)
+		return;
 
-	for (const auto& possibleTile : possibleExpand) {
-		int thisYield = calculateTileYield(gameScene->getTileData(possibleTile));
-		if (thisYield > optimalYield) {
-			optimalExpand = possibleTile;
-			optimalYield = thisYield;
-		}
-		else if (thisYield == optimalYield) {
-			// ͬѡ
-			if (possibleTile.distance(gridPos) < optimalExpand.distance(gridPos)) {
-				optimalExpand = possibleTile;
-				optimalYield = thisYield;
-			}
+	while (!_frontier.empty()) {
+		const FrontierEntry& top = _frontier.top();
+		bool stale = _frontierTiles.count(top.tile) == 0;
+		if (!stale && !gameScene->isTileOccupied(top.tile)) {
+			this->nextTerritoryTile = top.tile;
+			return;
 		}
+		if (!stale)
+			_frontierTiles.erase(top.tile);
+		_frontier.pop();
 	}
 
-	this->nextTerritoryTile = optimalExpand;
+	nextTerritoryTile = Hex();
 }
 
 /**
- * ؿܲ
+ * 计算地块总产出（辅助函数）
  */
 int BaseCity::calculateTileYield(const TileData& data) {
 	return data.food + data.gold + data.culture + data.science + data.production;
 }
 
 /**
- * չ߼
+ * 更新领土扩展逻辑
  */
 void BaseCity::updateTerritory() {
-	// ûĿչؿ飬ѡһµ
+	updateYield(); // 确保文化产出为最新
+
+	// 如果没有目标扩展地块，选择一个新的
 	if (nextTerritoryTile == Hex()) {
 		choosePossibleExpand();
 		if (nextTerritoryTile == Hex()) {
-			// ޿չؿ飬ӻ
+			// 无可用扩展地块，清理可视化
 			if (_expandVisual) {
 				_expandVisual->removeFromParent();
 				_expandVisual = nullptr;
@@ -504,44 +762,44 @@ void BaseCity::updateTerritory() {
 		}
 	}
 
-	// չĻ
+	// 计算扩展所需的文化积累
 	int neededAccumulation = (20 + 10 * (territory.size() - 7));
 
 	if (cityYield.cultureYield <= 0) {
-		turnsLeftToExpand = 999; // ĻΪ0ʱ޷չ
+		turnsLeftToExpand = 999; // 文化产出为0时几乎无法扩展
 		return;
 	}
 
-	// Ļֵ
+	// 积累文化值
 	expandAccumulation += cityYield.cultureYield;
 	turnsLeftToExpand = (neededAccumulation - expandAccumulation + cityYield.cultureYield - 1) / cityYield.cultureYield;
 
-	// Ƿﵽչ
+	// 检查是否达到扩展条件
 	if (expandAccumulation >= neededAccumulation) {
-		// 
-		territory.push_back(nextTerritoryTile);
+		// 添加新领土
+		addToTerritory(nextTerritoryTile);
 
-		// չ״̬
+		// 重置扩展状态
 		nextTerritoryTile = Hex();
 		expandAccumulation = 0;
 
-		// ѡһչؿ
+		// 选择下一个扩展地块
 		choosePossibleExpand();
 
-		// ɵĿӻ
+		// 清理旧的可视化
 		if (_expandVisual) {
 			_expandVisual->removeFromParent();
 			_expandVisual = nullptr;
 		}
 
-		// µչӻڣ
+		// 创建新的扩展可视化（如果存在）
 		if (nextTerritoryTile != Hex()) {
 			turnsLeftToExpand = (neededAccumulation - expandAccumulation + cityYield.cultureYield - 1) / cityYield.cultureYield;
 			updateExpandVisualization();
 		}
 	}
 	else {
-		// չӻ
+		// 更新现有扩展可视化
 		updateExpandVisualization();
 	}
 
@@ -549,7 +807,7 @@ void BaseCity::updateTerritory() {
 }
 
 /**
- * չؿĿӻ
+ * 更新扩展地块的可视化
  */
 void BaseCity::updateExpandVisualization() {
 	if (nextTerritoryTile == Hex())
@@ -563,22 +821,22 @@ void BaseCity::updateExpandVisualization() {
 	if (!mapLayer)
 		return;
 
-	// ɵĿӻ
+	// 清理旧的可视化
 	if (_expandVisual) {
 		_expandVisual->removeFromParent();
 		_expandVisual = nullptr;
 	}
 
-	// µĿӻڵ
+	// 创建新的可视化节点
 	auto draw = DrawNode::create();
 	auto layout = mapLayer->getLayout();
 	if (!layout)
 		return;
 
-	// λ
+	// 计算中心位置
 	Vec2 center = layout->hexToPixel(nextTerritoryTile);
 
-	// ζ
+	// 生成六边形顶点
 	std::vector<Vec2> vertices;
 	float size = layout->size;
 	for (int i = 0; i < 6; i++) {
@@ -588,12 +846,12 @@ void BaseCity::updateExpandVisualization() {
 		vertices.push_back(Vec2(x, y));
 	}
 
-	// ư͸ͱ߿
+	// 绘制半透明填充和边框
 	Color4F expandColor(255 / 255.f, 51 / 255.f, 255 / 255.f, 0.3f);
 	draw->drawSolidPoly(&vertices[0], 6, expandColor);
 	draw->drawPoly(&vertices[0], 6, true, Color4F(1.0f, 0.2f, 1.0f, 0.8f));
 
-	// չʱǩ
+	// 添加扩展倒计时标签
 	std::string expandText = std::to_string(turnsLeftToExpand) + " turns";
 	auto leftTurnLabel = Label::createWithSystemFont(expandText, "Arial", 14);
 	leftTurnLabel->setPosition(center);
@@ -601,18 +859,19 @@ void BaseCity::updateExpandVisualization() {
 	leftTurnLabel->enableOutline(Color4B::BLACK, 1);
 	draw->addChild(leftTurnLabel);
 
-	// ӵͼ㣨z-orderȷɼ
+	// 添加到地图层（高z-order确保可见）
 	mapLayer->addChild(draw, 20);
 	_expandVisual = draw;
 }
 
 /**
- * غϽи߼
+ * 回合结束处理（城市所有更新逻辑）
  */
 void BaseCity::onTurnEnd() {
-	updateProduction();    // 
-	updatePopulation();    // ˿
-	updateDistribution();  // ˿ڷ
-	updateTerritory();     // չ
-	updatePanel();         // 
+	PROFILE_SCOPE("BaseCity::onTurnEnd");
+	updateProduction();    // 生产进度
+	updatePopulation();    // 人口增长
+	updateDistribution();  // 人口分配
+	updateTerritory();     // 领土扩展
+	updatePanel();         // 界面更新
 }
\ No newline at end of file
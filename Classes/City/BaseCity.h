@@ -1,5 +1,5 @@
 /*
-* л
+* 城市基础类
 */
 #ifndef __BASE_CITY_H__
 #define __BASE_CITY_H__
@@ -10,97 +10,141 @@
 #include "../UI/CityProductionPanel.h"
 #include "Development/ProductionProgram.h"
 #include "Yield.h"
+#include "CitizenAssignment.h"
+#include "Utils/Fixed.h"
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
 
 class District;
+class Player;
 
 class BaseCity : public cocos2d::Node {
 public:
     Hex gridPos;
 
     static BaseCity* create(int player, Hex pos, std::string name);
-	~BaseCity() {
-		// ͷ
-		for (auto district : districts) {
-			delete district;
-		}
-		districts.clear();
-		delete currentProduction;
-		currentProduction = nullptr;
-		// ͷ
-		for (auto program : suspendedProductions) {
-			delete program;
-		}
-		suspendedProductions.clear();
-	}
+	~BaseCity();
 
-	int								getOwnerPlayer() const { return ownerPlayer; } // ID
+	uint32_t						getHandle() const { return _handle; } // 城市注册表中的代际句柄
+	int								getOwnerPlayer() const { return ownerPlayer; } // 城市所属玩家ID
 	std::string						getCityName() const { return cityName; }
-	int								getPopulation() const { return population; } // ˿
+	int								getPopulation() const { return population; } // 城市人口
 	int 							getNeededFoodToMultiply() const { return neededFoodToMultiply; }
-	int								getWhenPopulationIncrease() const { return whenPopulationIncrease; } // ¸˿ڶٻغϺ
-	int								getUnallocated() const { return unallocated; } // δ˿
-	Yield							getCityYield() const { return cityYield; } // ܲ
-	ProductionProgram*				getCurrentProduction() const { return currentProduction; } // ǰĿ
-	std::vector<ProductionProgram*> getSuspendedProductions() const { return suspendedProductions; } // ͣĿб
-	int								getMaxHealth() const { return maxHealth; } // 󽡿
-	int								getCurrentHealth() const { return currentHealth; } // ǰ
-	int								getAddedHealth() const { return addedHealth; } // ⽡ȼӳ(ɳǽṩ)
-	std::list <District*>			getDistricts() const { return districts; } // ڵб
-	std::vector<Hex>				getTerritory() const { return territory; } // Χ(ڸ)
-	std::map<Hex, int>				getPopulationDistribution() const { return populationDistribution; } // ˿ڷ(ؿ -> ˿)
+	int								getWhenPopulationIncrease() const { return whenPopulationIncrease; } // 下个人口在多少回合后到来
+	int								getUnallocated() const { return unallocated; } // 未分配人口
+	Yield							getCityYield() const { return cityYield; } // 城市总产出
+	ProductionProgram*				getCurrentProduction() const { return currentProduction; } // 当前生产项目
+	const std::vector<ProductionProgram*>& getSuspendedProductions() const { return suspendedProductions; } // 暂停的生产项目列表
+	int								getMaxHealth() const { return maxHealth; } // 城市最大健康度
+	int								getCurrentHealth() const { return currentHealth; } // 当前健康度
+	int								getAddedHealth() const { return addedHealth; } // 额外健康度加成(由城墙等提供)
+	const std::list<District*>&		getDistricts() const { return districts; } // 城市内的区域列表
+	const std::vector<Hex>&			getTerritory() const { return territory; } // 城市领土范围(包含城市所在格子)
+	bool							ownsTile(Hex tile) const { return _tileSlots.count(tile) != 0; } // 地块是否属于本城
+	const std::map<Hex, int>&		getPopulationDistribution() const { return populationDistribution; } // 人口分配情况(地块坐标 -> 分配人口数)
+	CityFocus						getFocus() const { return _focus; } // 城市专注方向
+	int								getSpecialistCount() const; // 区域专家总数
 
 
 
 	bool initCity(int player, Hex pos, std::string name);
-	void drawTerritory(); // Ƴб߽
-	void updateYield(); // ³ܲ
-	void updatePopulation(); // ˿
-	void addNewProduction(ProductionProgram* newProgram); // µĿ
-	void updateProduction(); // 
-	void purchaseDirectly(ProductionProgram* newProgram); // Ŀ
-	void deduceHealth(int damage); // ۳
-    void updateDistribution(); // ·Ϣ
+	void drawTerritory(); // 绘制城市边界
+	void updateYield(); // 更新城市总产出（仅在标记为脏时重新计算）
+	void markYieldDirty(); // 标记产出需要重新计算（领土、区域、建筑、人口变化时调用）
+	void invalidateTileYield(Hex tile); // 地块产出失效（区域建成、地块改良等），按差值更新城市产出
+	bool isYieldDirty() const { return _yieldDirty; }
+	void setYieldOwner(Player* owner) { _yieldOwner = owner; } // 产出变化量汇报给该玩家
+	void setOwnerPlayer(int player); // 城市易主：更新所属玩家与区域占用表中的控制者
+	void updatePopulation(); // 更新人口增长情况
+	void addNewProduction(ProductionProgram* newProgram); // 添加新的生产项目
+	void updateProduction(); // 更新生产
+	void purchaseDirectly(ProductionProgram* newProgram); // 购买生产项目
+	void deduceHealth(int damage); // 扣除健康度
+    void updateDistribution(); // 更新分配信息（只为新增/减少的人口调整分配）
+	void rebalanceCitizens(); // 按专注方向重新求解全部市民分配
+	void setFocus(CityFocus focus); // 设置专注方向并重新分配
+	bool moveCitizen(Hex from, Hex to); // 手动把市民从一个地块调到另一个地块
 	void updateTerritory();
 	void updateExpandVisualization();
 
-	void updatePanel(); // Ϣ
+	void updatePanel(); // 更新生产面板信息
 	void choosePossibleExpand();
 	int calculateTileYield(const TileData& data);
 
-    // 
-	int ownerPlayer; // ID
+    // 城市属性
+	int ownerPlayer; // 城市所属玩家ID
     std::string cityName;
-	int population; // ˿
-	int neededFoodToMultiply; // ¸˿Ҫ
-	float currentAccumulation; // ǰ۵
-	int whenPopulationIncrease; // ¸˿ڶٻغϺ
-	int unallocated; // δ˿
-	Yield cityYield; // ܲ
-	ProductionProgram* currentProduction; // ǰĿ
-	std::vector<ProductionProgram*> suspendedProductions; // ͣĿб
-	int maxHealth; // 󽡿
-	int currentHealth; // ǰ
-	int addedHealth; // ⽡ȼӳ(ɳǽṩ)
-	std::list <District*> districts; // ڵб
-	std::vector<Hex> territory; // Χ(ڸ)
-	std::vector<Hex> vacantTiles; // и
-	std::map<Hex, int> populationDistribution; // ˿ڷ(ؿ -> ˿)
+	int population; // 城市人口
+	int neededFoodToMultiply; // 下个人口需要多少增长量
+	Fixed currentAccumulation; // 当前积累的增长量（定点，保留 0.75 倍率产生的小数）
+	int whenPopulationIncrease; // 下个人口在多少回合后到来
+	int unallocated; // 未分配人口
+	Yield cityYield; // 城市总产出
+	ProductionProgram* currentProduction; // 当前生产项目
+	std::vector<ProductionProgram*> suspendedProductions; // 暂停的生产项目列表
+	int maxHealth; // 城市最大健康度
+	int currentHealth; // 当前健康度
+	int addedHealth; // 额外健康度加成(由城墙等提供)
+	std::list <District*> districts; // 城市内的区域列表
+	std::vector<Hex> territory; // 城市领土范围(包含城市所在格子)
+	std::vector<Hex> vacantTiles; // 空闲格
+	std::map<Hex, int> populationDistribution; // 人口分配情况(地块坐标 -> 分配人口数)
 	Hex nextTerritoryTile;
-	int expandAccumulation; // 
+	int expandAccumulation; // 积累量
 	int turnsLeftToExpand;
 
     
-    // غϽ߼
+    // 回合结算逻辑
     void onTurnEnd();
 
 private:
     void addDistrict(District* district) {
         districts.push_back(district);
+        district->placeInCity(this); // 登记到地图并计算相邻加成
     }
-	void addToTerritory(Hex tile) {
-		territory.push_back(tile);
-		populationDistribution[tile] = 0;
-	}
+	// 领土地块：缓存地形产出与耕作状态，城市的地块产出按差值维护
+	struct TileSlot {
+		Yield yield; // 缓存的地块产出
+		bool worked; // 是否有市民耕作
+	};
+
+	void addToTerritory(Hex tile);
+	void setTileWorked(Hex tile, bool worked);
+	void reconsiderTile(Hex tile); // 单个地块变化后的增量调整
+	WorkplaceList collectWorkplaces() const;
+	void applyWorkplaces(const WorkplaceList& places);
+	int specialistSlots(const District* district) const;
+	Yield computeTileYield(Hex tile) const;
+	Yield tileContribution(Hex tile, const TileSlot& slot) const;
+
+	std::unordered_map<Hex, TileSlot> _tileSlots; // 领土地块 -> 缓存
+	Yield _tileYieldTotal = { 0, 0, 0, 0, 0 }; // 所有领土地块的产出之和
+	std::map<const District*, int> _specialists; // 区域 -> 专家人数
+	CityFocus _focus = CityFocus::BALANCED;
+
+	// 扩张边界：领土外一圈可扩张地块，评分在入队时算好，选择时只需取堆顶
+	struct FrontierEntry {
+		int yieldScore; // 地块总产出
+		int distance; // 到城市中心的距离
+		Hex tile;
+		// 产出高者优先，其次距离近者优先，最后按坐标保证结果确定
+		bool operator<(const FrontierEntry& other) const {
+			if (yieldScore != other.yieldScore)
+				return yieldScore < other.yieldScore;
+			if (distance != other.distance)
+				return distance > other.distance;
+			return other.tile < tile;
+		}
+	};
+
+	void pushFrontierNeighbors(Hex tile);
+	std::priority_queue<FrontierEntry> _frontier; // 候选堆（失效条目在取堆顶时丢弃）
+	std::unordered_set<Hex> _frontierTiles; // 当前有效的候选地块
+	bool _yieldDirty = true; // 产出缓存是否失效
+	Player* _yieldOwner = nullptr; // 汇总本城产出的玩家（未加入玩家时为空）
+	uint32_t _handle = 0xFFFFFFFFu; // 城市注册表中的代际句柄（未登记时为无效句柄）
+
     cocos2d::ui::Button * _nameLabel;
     cocos2d::Node* _visual;
 	cocos2d::Node* _boundaryVisual;
@@ -0,0 +1,176 @@
+#include "CitizenAssignment.h"
+
+namespace {
+	const Fixed kStarvationPenalty = Fixed::fromInt(3); // 食物每缺 1 点的惩罚
+	const Fixed kMinGain = Fixed::fromRaw(1); // 交换至少带来的收益（最小定点单位），避免来回交换
+
+	// 各专注方向的权重（百分比）：食物、生产力、科技、金币、文化
+	const int kFocusWeights[4][5] = {
+		{ 100, 100, 80, 60, 80 }, // BALANCED
+		{ 250, 80, 60, 50, 60 }, // FOOD
+		{ 80, 250, 60, 50, 60 }, // PRODUCTION
+		{ 80, 80, 250, 50, 60 }  // SCIENCE
+	};
+}
+
+CitizenAssignment::CitizenAssignment(CityFocus focus, int foodNeeded)
+	: _foodNeeded(foodNeeded)
+{
+	const int* weights = kFocusWeights[static_cast<int>(focus)];
+	for (int i = 0; i < 5; i++)
+		_weights[i] = Fixed::percent(weights[i]);
+}
+
+Fixed CitizenAssignment::value(const Yield& total) const
+{
+	Fixed score = _weights[0] * total.foodYield
+		+ _weights[1] * total.productionYield
+		+ _weights[2] * total.scienceYield
+		+ _weights[3] * total.goldYield
+		+ _weights[4] * total.cultureYield;
+	if (total.foodYield < _foodNeeded)
+		score -= kStarvationPenalty * (_foodNeeded - total.foodYield);
+	return score;
+}
+
+int CitizenAssignment::solve(WorkplaceList& places, Yield& total, int citizens) const
+{
+	for (auto& place : places) {
+		for (int i = 0; i < place.assigned; i++)
+			total -= place.yield;
+		place.assigned = 0;
+	}
+
+	int placed = 0;
+	while (placed < citizens && addCitizen(places, total))
+		placed++;
+
+	improveBySwaps(places, total, static_cast<int>(places.size()));
+	return placed;
+}
+
+bool CitizenAssignment::addCitizen(WorkplaceList& places, Yield& total) const
+{
+	int best = -1;
+	Fixed bestValue;
+	for (size_t i = 0; i < places.size(); i++) {
+		if (places[i].assigned >= places[i].capacity)
+			continue;
+		Yield candidate = total;
+		candidate += places[i].yield;
+		Fixed candidateValue = value(candidate);
+		if (best < 0 || candidateValue > bestValue) {
+			best = static_cast<int>(i);
+			bestValue = candidateValue;
+		}
+	}
+	if (best < 0)
+		return false;
+
+	places[best].assigned++;
+	total += places[best].yield;
+	return true;
+}
+
+bool CitizenAssignment::removeCitizen(WorkplaceList& places, Yield& total) const
+{
+	int best = -1;
+	Fixed bestValue;
+	for (size_t i = 0; i < places.size(); i++) {
+		if (places[i].assigned == 0)
+			continue;
+		Fixed candidateValue = value(total - places[i].yield);
+		if (best < 0 || candidateValue > bestValue) {
+			best = static_cast<int>(i);
+			bestValue = candidateValue;
+		}
+	}
+	if (best < 0)
+		return false;
+
+	places[best].assigned--;
+	total -= places[best].yield;
+	return true;
+}
+
+bool CitizenAssignment::trySwap(WorkplaceList& places, Yield& total, int from, int to) const
+{
+	if (from == to || places[from].assigned == 0 || places[to].assigned >= places[to].capacity)
+		return false;
+
+	Yield candidate = total - places[from].yield;
+	candidate += places[to].yield;
+	if (value(candidate) <= value(total) + kMinGain)
+		return false;
+
+	places[from].assigned--;
+	places[to].assigned++;
+	total = candidate;
+	return true;
+}
+
+bool CitizenAssignment::improveWorkplace(WorkplaceList& places, Yield& total, int index) const
+{
+	if (index < 0 || index >= static_cast<int>(places.size()))
+		return false;
+
+	// 变化的工作位可能变差（把人调出去）或变好（把人调进来），各取收益最大的一次交换
+	bool improved = false;
+	for (int pass = 0; pass < 2; pass++) {
+		int bestOther = -1;
+		Fixed bestValue = value(total) + kMinGain;
+		for (int other = 0; other < static_cast<int>(places.size()); other++) {
+			int from = pass == 0 ? index : other;
+			int to = pass == 0 ? other : index;
+			if (from == to || places[from].assigned == 0 || places[to].assigned >= places[to].capacity)
+				continue;
+			Yield candidate = total - places[from].yield;
+			candidate += places[to].yield;
+			Fixed candidateValue = value(candidate);
+			if (candidateValue > bestValue) {
+				bestOther = other;
+				bestValue = candidateValue;
+			}
+		}
+		if (bestOther >= 0) {
+			if (pass == 0)
+				trySwap(places, total, index, bestOther);
+			else
+				trySwap(places, total, bestOther, index);
+			improved = true;
+		}
+	}
+	return improved;
+}
+
+int CitizenAssignment::improveBySwaps(WorkplaceList& places, Yield& total, int maxRounds) const
+{
+	int swaps = 0;
+	for (int round = 0; round < maxRounds; round++) {
+		// 每轮执行收益最大的一次交换
+		int bestFrom = -1;
+		int bestTo = -1;
+		Fixed bestValue = value(total) + kMinGain;
+		for (int from = 0; from < static_cast<int>(places.size()); from++) {
+			if (places[from].assigned == 0)
+				continue;
+			Yield without = total - places[from].yield;
+			for (int to = 0; to < static_cast<int>(places.size()); to++) {
+				if (to == from || places[to].assigned >= places[to].capacity)
+					continue;
+				Yield candidate = without;
+				candidate += places[to].yield;
+				Fixed candidateValue = value(candidate);
+				if (candidateValue > bestValue) {
+					bestFrom = from;
+					bestTo = to;
+					bestValue = candidateValue;
+				}
+			}
+		}
+		if (bestFrom < 0 || !trySwap(places, total, bestFrom, bestTo))
+			break;
+		swaps++;
+	}
+	return swaps;
+}
@@ -0,0 +1,66 @@
+/*
+* 市民分配求解器
+*/
+#ifndef __CITIZEN_ASSIGNMENT_H__
+#define __CITIZEN_ASSIGNMENT_H__
+
+#include "Utils/FrameArena.h"
+#include "Utils/Fixed.h"
+#include "Utils/HexUtils.h"
+#include "Yield.h"
+#include <vector>
+
+class District;
+
+// 城市专注方向
+enum class CityFocus {
+	BALANCED, // 均衡
+	FOOD, // 食物
+	PRODUCTION, // 生产力
+	SCIENCE // 科技
+};
+
+// 市民工作位：领土地块（容量1）或区域专家槽位（容量为槽位数）
+struct Workplace {
+	Hex tile; // 地块坐标（专家槽位为区域所在地块）
+	District* district; // 专家槽位所属区域，地块为空
+	Yield yield; // 每名市民带来的产出
+	int capacity; // 可容纳市民数
+	int assigned; // 已分配市民数
+};
+
+// 工作位列表只在一次求解中使用，从回合临时内存分配
+typedef FrameVector<Workplace> WorkplaceList;
+
+/**
+ * 市民分配求解器
+ * 目标函数为按专注方向加权的城市产出，食物低于人口消耗时额外惩罚，避免饿死。
+ * 全量求解：贪心按边际收益逐个放置市民，再做局部交换直到无法改进。
+ * 增量接口只处理一名市民或一个工作位的变化，供人口增减、地块产出变化时调用。
+ * 所有接口直接修改 places 与 total（total 为城市当前总产出）。
+ */
+class CitizenAssignment {
+public:
+	CitizenAssignment(CityFocus focus, int foodNeeded);
+
+	Fixed value(const Yield& total) const; // 目标函数
+
+	// 清空后重新分配 citizens 名市民，返回实际分配人数
+	int solve(WorkplaceList& places, Yield& total, int citizens) const;
+	// 增加一名市民（放到边际收益最大的工作位），无空位时返回 false
+	bool addCitizen(WorkplaceList& places, Yield& total) const;
+	// 移除一名市民（损失最小者），无人可移时返回 false
+	bool removeCitizen(WorkplaceList& places, Yield& total) const;
+	// 某个工作位产出变化后，只尝试它与其他工作位之间的交换
+	bool improveWorkplace(WorkplaceList& places, Yield& total, int index) const;
+	// 全局局部交换，最多 maxRounds 轮，返回交换次数
+	int improveBySwaps(WorkplaceList& places, Yield& total, int maxRounds) const;
+
+private:
+	bool trySwap(WorkplaceList& places, Yield& total, int from, int to) const;
+
+	Fixed _weights[5]; // 食物、生产力、科技、金币、文化
+	int _foodNeeded; // 人口消耗的食物
+};
+
+#endif
@@ -2,53 +2,44 @@
 #define __DISTRICT_FACTORY_H__
 #include "Core/Player.h"
 #include "AllKindsOfDistricts.h"
+#include "District/Base/DistrictRegistry.h"
 
 class DistrictFactory {
 public:
-	static District* createDistrict(const std::string& name, int owner, const Hex& position, Node*& _visual) {
-		if (name == "Downtown") {
-			auto newDistrict = new Downtown(owner, position, name);
-			_visual = newDistrict->_downtownVisual;
-			return newDistrict;
-		}
-		else if (name == "Campus") {
-			auto newDistrict = new Campus(owner, position, name);
-			_visual = newDistrict->_campusVisual;
-			return newDistrict;
-		}
-		else if (name == "TheaterSquare") {
-			auto newDistrict = new TheaterSquare(owner, position, name);
-			_visual = newDistrict->_theaterSquareVisual;
-			return newDistrict;
-		}
-		else if (name == "CommercialHub")
-		{
-			auto newDistrict = new CommercialHub(owner, position, name);
-			_visual = newDistrict->_commercialHubVisual;
-			return newDistrict;
-		}
-		else if (name == "Harbor")
-		{
-			auto newDistrict = new Harbor(owner, position, name);
-			_visual = newDistrict->_harborVisual;
-			return newDistrict;
-		}
-		else if (name == "Spaceport")
-		{
-			auto newDistrict = new Spaceport(owner, position, name);
-			_visual = newDistrict->_spaceportVisual;
-			return newDistrict;
-		}
-		else if (name == "IndustryZone")
-		{
-			auto newDistrict = new IndustryZone(owner, position, name);
-			_visual = newDistrict->_industryZoneVisual;
-			return newDistrict;
-		}
-		else {
+	// 按类型ID创建：创建函数表按 DistrictType 下标
+	static District* createDistrict(District::DistrictType type, int owner, const Hex& position, Node*& _visual) {
+		if (type == District::DistrictType::TO_BE_DEFINED)
 			return nullptr;
-		}
+		typedef District* (*CreateFunc)(int, const Hex&, Node*&);
+		static const CreateFunc creators[kDistrictTypeCount] = {
+			&construct<Downtown, &Downtown::_downtownVisual, District::DistrictType::DOWNTOWN>,
+			&construct<Campus, &Campus::_campusVisual, District::DistrictType::CAMPUS>,
+			&construct<IndustryZone, &IndustryZone::_industryZoneVisual, District::DistrictType::INDUSTRY_ZONE>,
+			&construct<CommercialHub, &CommercialHub::_commercialHubVisual, District::DistrictType::COMMERCIAL_HUB>,
+			&construct<TheaterSquare, &TheaterSquare::_theaterSquareVisual, District::DistrictType::THEATER_SQUARE>,
+			&construct<Harbor, &Harbor::_harborVisual, District::DistrictType::HARBOR>,
+			&construct<Spaceport, &Spaceport::_spaceportVisual, District::DistrictType::SPACEPORT>
+		};
+		return creators[static_cast<int>(type)](owner, position, _visual);
+	}
+
+	// 按生产项目创建（生产完成时使用，项目ID直接反查类型）
+	static District* createDistrict(const ProductionProgram* program, int owner, const Hex& position, Node*& _visual) {
+		return createDistrict(DistrictRegistry::findByProgramId(program->getID()), owner, position, _visual);
+	}
+
+	// 按名称创建（仅用于存档等字符串边界）
+	static District* createDistrict(const std::string& name, int owner, const Hex& position, Node*& _visual) {
+		return createDistrict(DistrictRegistry::findByName(name), owner, position, _visual);
+	}
+
+private:
+	template <typename T, Node* T::*Visual, District::DistrictType Type>
+	static District* construct(int owner, const Hex& position, Node*& _visual) {
+		auto newDistrict = new T(owner, position, DistrictRegistry::info(Type).name);
+		_visual = newDistrict->*Visual;
+		return newDistrict;
 	}
 };
 
-#endif // __DISTRICT_FACTORY_H__
\ No newline at end of file
+#endif // __DISTRICT_FACTORY_H__
@@ -2,85 +2,52 @@
 #define __UNIT_FACTORY_H__
 #include "Core/Player.h"
 #include "AllKindsOfUnits.h"
+#include "Units/Base/UnitRegistry.h"
 
 // UnitFactory.h
 class UnitFactory {
 public:
+    // 按类型ID创建：创建函数表按 UnitName 下标
+    static AbstractUnit* createUnit(UnitName id, int owner, const Hex& position) {
+        typedef AbstractUnit* (*CreateFunc)();
+        static const CreateFunc creators[kUnitTypeCount] = {
+            &construct<Settler>,
+            &construct<Builder>,
+            &construct<Warrior>,
+            &construct<Swordsman>,
+            &construct<LineInfantry>,
+            &construct<Archer>,
+            &construct<Crossbowman>,
+            &construct<Musketeers>,
+            &construct<Catapult>,
+            &construct<Cannon>,
+            &construct<Biplane>,
+            &construct<JetFighter>
+        };
+        AbstractUnit* unit = creators[static_cast<int>(id)]();
+        unit->initUnit(owner, position);
+        return unit;
+    }
+
+    // 按生产项目创建（生产完成时使用，项目ID直接反查类型）
+    static AbstractUnit* createUnit(const ProductionProgram* program, int owner, const Hex& position) {
+        UnitName id;
+        if (!UnitRegistry::findByProgramId(program->getID(), id))
+            return nullptr;
+        return createUnit(id, owner, position);
+    }
+
+    // 按名称创建（仅用于存档等字符串边界）
     static AbstractUnit* createUnit(const std::string& name, int owner, const Hex& position) {
-        if (name == "Settler") {
-            Settler* unit = new Settler();
-            unit->initUnit(owner, position);
-            return unit;
-        }
-        else if (name == "Builder") {
-            Builder* unit = new Builder();
-            unit->initUnit(owner, position);
-            return unit;
-        }
-        else if (name == "Warrior") {
-            Warrior* unit = new Warrior();
-            unit->initUnit(owner, position);
-            return unit;
-        }
-		else if (name == "Swordsman")
-		{
-			Swordsman* unit = new Swordsman();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "LineInfantry")
-		{
-			LineInfantry* unit = new LineInfantry();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Archer")
-		{
-			Archer* unit = new Archer();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Crossbowman")
-		{
-			Crossbowman* unit = new Crossbowman();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Musketeers")
-		{
-			Musketeers* unit = new Musketeers();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Catapult")
-		{
-			Catapult* unit = new Catapult();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Cannon")
-		{
-			Cannon* unit = new Cannon();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "Biplane")
-		{
-			Biplane* unit = new Biplane();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-		else if (name == "JetFighter")
-		{
-			JetFighter* unit = new JetFighter();
-			unit->initUnit(owner, position);
-			return unit;
-		}
-        // ... λ
-        else {
+        UnitName id;
+        if (!UnitRegistry::findByName(name, id))
             return nullptr;
-        }
+        return createUnit(id, owner, position);
     }
+
+private:
+    template <typename T>
+    static AbstractUnit* construct() { return new T(); }
 };
 
-#endif // __UNIT_FACTORY__
\ No newline at end of file
+#endif // __UNIT_FACTORY__
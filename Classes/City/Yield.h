@@ -1,34 +1,260 @@
 #ifndef __YIELD_H__
 #define __YIELD_H__
 
-// ṹ: ʳ, , Ƽֵ, , Ļֵ
+#include <cstddef>
+#include <cstdint>
+#include "Utils/Fixed.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CIV_YIELD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CIV_YIELD_NEON 1
+#endif
+
+// 产出分量数：食物、生产力、科技值、金币、文化值、信仰、旅游、补齐位
+static const int kYieldLanes = 8;
+
+struct YieldScale;
+
+/**
+ * 区域产出结构体: 食物, 生产力, 科技值, 金币, 文化值
+ * 另有信仰、旅游两个预留分量，补齐到 8 个 int（两个 128 位向量），
+ * 加减、截断都按整个向量运算（SSE2 / NEON，其余平台退化为逐分量循环），
+ * 缩放按定点系数逐分量做整数乘除，不经过浮点。
+ * 向量读写一律用非对齐指令，结构体不要求 16 字节对齐：
+ * 32 位 Windows 下 new 出来的城市、区域以及 std::vector 只保证 8 字节对齐。
+ */
 struct Yield {
-    int foodYield; // ʳ
-    int productionYield; // 
-    int scienceYield; // Ƽֵ
-    int goldYield; // Ҳ
-    int cultureYield; // Ļֵ
+    int foodYield = 0; // 食物产出
+    int productionYield = 0; // 生产力产出
+    int scienceYield = 0; // 科技值产出
+    int goldYield = 0; // 金币产出
+    int cultureYield = 0; // 文化值产出
+    int faithYield = 0; // 信仰产出（预留）
+    int tourismYield = 0; // 旅游产出（预留）
+    int reservedYield = 0; // 补齐位，恒为 0
+
+    int* lanes() { return &foodYield; }
+    const int* lanes() const { return &foodYield; }
+
+    Yield operator+(const Yield& other) const;
+    Yield& operator+=(const Yield& other);
+    Yield operator-(const Yield& other) const;
+    Yield& operator-=(const Yield& other);
+    Yield operator*(int times) const; // 逐分量乘整数
+
+    bool operator==(const Yield& other) const;
+    bool operator!=(const Yield& other) const { return !(*this == other); }
+
+    // 逐分量乘定点系数后向零取整，与 Fixed::mulInt 一致
+    Yield scaled(const YieldScale& scale) const;
+    // 逐分量截断到 [lo, hi]
+    Yield clamped(const Yield& lo, const Yield& hi) const;
+};
+
+/**
+ * 逐分量的产出系数（文明特性、政策卡等百分比加成），默认全为 1
+ */
+struct YieldScale {
+    Fixed food = Fixed::one();
+    Fixed production = Fixed::one();
+    Fixed science = Fixed::one();
+    Fixed gold = Fixed::one();
+    Fixed culture = Fixed::one();
+    Fixed faith = Fixed::one();
+    Fixed tourism = Fixed::one();
+    Fixed reserved = Fixed::one();
+
+    const Fixed* lanes() const { return &food; }
+};
+
+static_assert(sizeof(Yield) == kYieldLanes * sizeof(int), "Yield lanes must be contiguous");
+static_assert(sizeof(YieldScale) == kYieldLanes * sizeof(Fixed), "YieldScale lanes must be contiguous");
+
+// 向量运算原语：一个 Yield 对应 lo / hi 两个 4 分量向量
+namespace YieldSimd {
+#if defined(CIV_YIELD_SSE2)
+    struct Vec { __m128i lo, hi; };
+
+    inline Vec load(const Yield& y) {
+        const __m128i* p = reinterpret_cast<const __m128i*>(y.lanes());
+        return { _mm_loadu_si128(p), _mm_loadu_si128(p + 1) };
+    }
+    inline void store(Yield& y, const Vec& v) {
+        __m128i* p = reinterpret_cast<__m128i*>(y.lanes());
+        _mm_storeu_si128(p, v.lo);
+        _mm_storeu_si128(p + 1, v.hi);
+    }
+    inline Vec zero() { return { _mm_setzero_si128(), _mm_setzero_si128() }; }
+    inline Vec add(const Vec& a, const Vec& b) { return { _mm_add_epi32(a.lo, b.lo), _mm_add_epi32(a.hi, b.hi) }; }
+    inline Vec sub(const Vec& a, const Vec& b) { return { _mm_sub_epi32(a.lo, b.lo), _mm_sub_epi32(a.hi, b.hi) }; }
+
+    inline __m128i select(__m128i mask, __m128i a, __m128i b) {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    inline Vec min(const Vec& a, const Vec& b) {
+        return { select(_mm_cmplt_epi32(a.lo, b.lo), a.lo, b.lo), select(_mm_cmplt_epi32(a.hi, b.hi), a.hi, b.hi) };
+    }
+    inline Vec max(const Vec& a, const Vec& b) {
+        return { select(_mm_cmpgt_epi32(a.lo, b.lo), a.lo, b.lo), select(_mm_cmpgt_epi32(a.hi, b.hi), a.hi, b.hi) };
+    }
+#elif defined(CIV_YIELD_NEON)
+    struct Vec { int32x4_t lo, hi; };
+
+    inline Vec load(const Yield& y) { return { vld1q_s32(y.lanes()), vld1q_s32(y.lanes() + 4) }; }
+    inline void store(Yield& y, const Vec& v) {
+        vst1q_s32(y.lanes(), v.lo);
+        vst1q_s32(y.lanes() + 4, v.hi);
+    }
+    inline Vec zero() { return { vdupq_n_s32(0), vdupq_n_s32(0) }; }
+    inline Vec add(const Vec& a, const Vec& b) { return { vaddq_s32(a.lo, b.lo), vaddq_s32(a.hi, b.hi) }; }
+    inline Vec sub(const Vec& a, const Vec& b) { return { vsubq_s32(a.lo, b.lo), vsubq_s32(a.hi, b.hi) }; }
+    inline Vec min(const Vec& a, const Vec& b) { return { vminq_s32(a.lo, b.lo), vminq_s32(a.hi, b.hi) }; }
+    inline Vec max(const Vec& a, const Vec& b) { return { vmaxq_s32(a.lo, b.lo), vmaxq_s32(a.hi, b.hi) }; }
+#else
+    struct Vec { int lane[kYieldLanes]; };
+
+    inline Vec load(const Yield& y) {
+        Vec v;
+        for (int i = 0; i < kYieldLanes; i++) v.lane[i] = y.lanes()[i];
+        return v;
+    }
+    inline void store(Yield& y, const Vec& v) {
+        for (int i = 0; i < kYieldLanes; i++) y.lanes()[i] = v.lane[i];
+    }
+    inline Vec zero() { return Vec{}; }
+    inline Vec add(const Vec& a, const Vec& b) {
+        Vec r;
+        for (int i = 0; i < kYieldLanes; i++) r.lane[i] = a.lane[i] + b.lane[i];
+        return r;
+    }
+    inline Vec sub(const Vec& a, const Vec& b) {
+        Vec r;
+        for (int i = 0; i < kYieldLanes; i++) r.lane[i] = a.lane[i] - b.lane[i];
+        return r;
+    }
+    inline Vec min(const Vec& a, const Vec& b) {
+        Vec r;
+        for (int i = 0; i < kYieldLanes; i++) r.lane[i] = a.lane[i] < b.lane[i] ? a.lane[i] : b.lane[i];
+        return r;
+    }
+    inline Vec max(const Vec& a, const Vec& b) {
+        Vec r;
+        for (int i = 0; i < kYieldLanes; i++) r.lane[i] = a.lane[i] > b.lane[i] ? a.lane[i] : b.lane[i];
+        return r;
+    }
+#endif
+}
+
+inline Yield Yield::operator+(const Yield& other) const
+{
+    Yield ret;
+    YieldSimd::store(ret, YieldSimd::add(YieldSimd::load(*this), YieldSimd::load(other)));
+    return ret;
+}
+
+inline Yield& Yield::operator+=(const Yield& other)
+{
+    YieldSimd::store(*this, YieldSimd::add(YieldSimd::load(*this), YieldSimd::load(other)));
+    return *this;
+}
+
+inline Yield Yield::operator-(const Yield& other) const
+{
+    Yield ret;
+    YieldSimd::store(ret, YieldSimd::sub(YieldSimd::load(*this), YieldSimd::load(other)));
+    return ret;
+}
+
+inline Yield& Yield::operator-=(const Yield& other)
+{
+    YieldSimd::store(*this, YieldSimd::sub(YieldSimd::load(*this), YieldSimd::load(other)));
+    return *this;
+}
+
+inline Yield Yield::operator*(int times) const
+{
+    // SSE2 没有 32 位逐分量整数乘法，固定 8 次的循环交给编译器展开
+    Yield ret;
+    for (int i = 0; i < kYieldLanes; i++)
+        ret.lanes()[i] = lanes()[i] * times;
+    return ret;
+}
+
+inline bool Yield::operator==(const Yield& other) const
+{
+    for (int i = 0; i < kYieldLanes; i++) {
+        if (lanes()[i] != other.lanes()[i])
+            return false;
+    }
+    return true;
+}
+
+inline Yield Yield::scaled(const YieldScale& scale) const
+{
+    // 系数不超过几倍，int64 中间值不会溢出
+    Yield ret;
+    const Fixed* factor = scale.lanes();
+    for (int i = 0; i < kYieldLanes; i++)
+        ret.lanes()[i] = factor[i].mulInt(lanes()[i]);
+    return ret;
+}
 
-    Yield operator+(const Yield& other)
+inline Yield Yield::clamped(const Yield& lo, const Yield& hi) const
+{
+    Yield ret;
+    YieldSimd::store(ret, YieldSimd::min(YieldSimd::max(YieldSimd::load(*this), YieldSimd::load(lo)), YieldSimd::load(hi)));
+    return ret;
+}
+
+/**
+ * 产出累加器：累加过程中和保持在向量寄存器中，只在 result 时写回内存
+ * 用于城市、区域、玩家逐项汇总产出
+ */
+class YieldAccumulator {
+public:
+    YieldAccumulator() : _sum(YieldSimd::zero()) {}
+    explicit YieldAccumulator(const Yield& start) : _sum(YieldSimd::load(start)) {}
+
+    void add(const Yield& value) { _sum = YieldSimd::add(_sum, YieldSimd::load(value)); }
+    void add(const Yield& value, int times) { add(value * times); }
+
+    Yield result() const
     {
         Yield ret;
-        ret.foodYield = foodYield + other.foodYield;
-        ret.productionYield = productionYield + other.productionYield;
-        ret.scienceYield = scienceYield + other.scienceYield;
-        ret.goldYield = goldYield + other.goldYield;
-        ret.cultureYield = cultureYield + other.cultureYield;
+        YieldSimd::store(ret, _sum);
         return ret;
     }
 
-    Yield& operator+=(const Yield& other)
+private:
+    YieldSimd::Vec _sum;
+};
+
+// 整段 Yield 数组的批量运算
+namespace YieldBatch {
+    inline Yield sum(const Yield* values, size_t count)
     {
-		foodYield += other.foodYield;
-		productionYield += other.productionYield;
-		scienceYield += other.scienceYield;
-		goldYield += other.goldYield;
-		cultureYield += other.cultureYield;
-		return *this;
+        YieldAccumulator acc;
+        for (size_t i = 0; i < count; i++)
+            acc.add(values[i]);
+        return acc.result();
     }
-};
 
-#endif
\ No newline at end of file
+    inline void scale(Yield* values, size_t count, const YieldScale& scale)
+    {
+        for (size_t i = 0; i < count; i++)
+            values[i] = values[i].scaled(scale);
+    }
+
+    inline void clamp(Yield* values, size_t count, const Yield& lo, const Yield& hi)
+    {
+        YieldSimd::Vec vlo = YieldSimd::load(lo);
+        YieldSimd::Vec vhi = YieldSimd::load(hi);
+        for (size_t i = 0; i < count; i++)
+            YieldSimd::store(values[i], YieldSimd::min(YieldSimd::max(YieldSimd::load(values[i]), vlo), vhi));
+    }
+}
+
+#endif
@@ -1,29 +1,30 @@
 // BaseCiv.cpp
 #include "BaseCiv.h"
 #include "District/Base/District.h"
+#include "Core/GameRules.h"
 
 bool BaseCiv::init() {
-    // ʼĬ
+    // 初始化默认特性
     m_traits.name = "Default Civilization";
     m_traits.description = "Standard civilization with no special bonuses";
     m_traits.initialTiles = 3;
-    m_traits.eurekaBoost = 0.5f;
-    m_traits.inspirationBoost = 0.5f;
-    m_traits.scienceBonus = 1.0f;
-    m_traits.cultureBonus = 1.0f;
-    m_traits.productionBonus = 1.0f;
-    m_traits.goldBonus = 1.0f;
-    m_traits.faithBonus = 1.0f;
+    m_traits.eurekaBoost = Fixed::percent(50);
+    m_traits.inspirationBoost = Fixed::percent(50);
+    m_traits.scienceBonus = Fixed::one();
+    m_traits.cultureBonus = Fixed::one();
+    m_traits.productionBonus = Fixed::one();
+    m_traits.goldBonus = Fixed::one();
+    m_traits.faithBonus = Fixed::one();
     m_traits.halfCostIndustrial = false;
     m_traits.extraDistrictSlot = false;
-    m_traits.militaryProductionBonus = 1.0f;
+    m_traits.militaryProductionBonus = Fixed::one();
     m_traits.builderCharges = 3;
 
     return true;
 }
 
 Yield BaseCiv::calculateDistrictBonus(const District* district) const {
-    // Ĭûӳ
+    // 默认文明没有区域加成
     Yield bonus;
     bonus.foodYield = 0;
     bonus.productionYield = 0;
@@ -34,7 +35,7 @@ Yield BaseCiv::calculateDistrictBonus(const District* district) const {
 }
 
 int BaseCiv::calculateMaxDistricts(int population) const {
-    // ĬϹʽ˿ڳ3ȡټ1
+    // 默认公式：人口除以3（向下取整）再加1
     if (population <= 0) return 0;
     return std::max(1, population / 3 + 1);
 }
@@ -42,9 +43,7 @@ int BaseCiv::calculateMaxDistricts(int population) const {
 int BaseCiv::applyEurekaBonus(int techId, const TechTree* techTree) const {
     const TechNode* techNode = techTree->getTechInfo(techId);
     if (techNode) {
-        int baseBonus = techNode->cost / 2; // Ĭ50%
-        float boostFactor = getEurekaBoost() / 0.5f; // Ĭ50%ı
-        return static_cast<int>(baseBonus * boostFactor);
+        return GameRules::calculateBoostProgress(techNode->cost, getEurekaBoost());
     }
     return 0;
 }
@@ -52,9 +51,7 @@ int BaseCiv::applyEurekaBonus(int techId, const TechTree* techTree) const {
 int BaseCiv::applyInspirationBonus(int cultureId, const CultureTree* cultureTree) const {
     const CultureNode* cultureNode = cultureTree->getCultureInfo(cultureId);
     if (cultureNode) {
-        int baseBonus = cultureNode->cost / 2; // Ĭ50%
-        float boostFactor = getInspirationBoost() / 0.5f; // Ĭ50%ı
-        return static_cast<int>(baseBonus * boostFactor);
+        return GameRules::calculateBoostProgress(cultureNode->cost, getInspirationBoost());
     }
     return 0;
 }
\ No newline at end of file
@@ -5,45 +5,46 @@
 #include "cocos2d.h"
 #include "../Development/TechSystem.h"
 #include "../Development/CultureSystem.h"
-#include "../City/Yield.h"  // Ŀе Yield 
+#include "../City/Yield.h"  // 包含项目中的 Yield 定义
+#include "../Utils/Fixed.h"
 
-// ǰ
+// 前向声明
 class District;
 namespace DistrictType {
     struct DistrictTypeInfo;
 }
 
-// Խṹ
+// 文明特性结构体
 struct CivilizationTrait {
     std::string name;
     std::string description;
 
-    // ͨüӳ
-    int initialTiles = 3;             // ʼؿ
-    float eurekaBoost = 0.5f;         // ￨ӳϵĬ50%
-    float inspirationBoost = 0.5f;    // мӳϵĬ50%
+    // 通用加成
+    int initialTiles = 3;             // 初始地块数
+    Fixed eurekaBoost = Fixed::percent(50);         // 尤里卡加成系数（默认50%）
+    Fixed inspirationBoost = Fixed::percent(50);    // 灵感加成系数（默认50%）
 
-    // Դӳ
-    float scienceBonus = 1.0f;        // мӳϵ
-    float cultureBonus = 1.0f;        // Ļӳϵ
-    float productionBonus = 1.0f;     // ӳϵ
-    float goldBonus = 1.0f;           // Ҽӳϵ
-    float faithBonus = 1.0f;          // ӳϵ
+    // 资源加成
+    Fixed scienceBonus = Fixed::one();        // 科研加成系数
+    Fixed cultureBonus = Fixed::one();        // 文化加成系数
+    Fixed productionBonus = Fixed::one();     // 生产力加成系数
+    Fixed goldBonus = Fixed::one();           // 金币加成系数
+    Fixed faithBonus = Fixed::one();          // 信仰加成系数
 
-    // 
-    bool halfCostIndustrial = false;  // ҵ
-    bool extraDistrictSlot = false;   // λ
-    float militaryProductionBonus = 1.0f; // µλɱϵ
+    // 区域相关
+    bool halfCostIndustrial = false;  // 工业区半价
+    bool extraDistrictSlot = false;   // 额外区域槽位
+    Fixed militaryProductionBonus = Fixed::one(); // 军事单位生产力成本系数
 
-    // λ
-    int builderCharges = 3;           // ʹô
+    // 单位相关
+    int builderCharges = 3;           // 建造者使用次数
 
     CivilizationTrait() = default;
 };
 
 class BaseCiv : public cocos2d::Ref {
 public:
-    // 
+    // 创建方法
     static BaseCiv* create() {
         BaseCiv* pRet = new(std::nothrow) BaseCiv();
         if (pRet && pRet->init()) {
@@ -54,60 +55,60 @@ public:
         return nullptr;
     }
 
-    // ʼ
+    // 初始化
     virtual bool init();
 
     virtual ~BaseCiv() {}
 
-    // ==================== Իȡ ====================
+    // ==================== 文明特性获取 ====================
     virtual CivilizationTrait getTraits() const { return m_traits; }
 
-    // ==================== ͨüӳɽӿ ====================
+    // ==================== 通用加成接口 ====================
     virtual int getInitialTiles() const { return m_traits.initialTiles; }
-    virtual float getEurekaBoost() const { return m_traits.eurekaBoost; }
-    virtual float getInspirationBoost() const { return m_traits.inspirationBoost; }
+    virtual Fixed getEurekaBoost() const { return m_traits.eurekaBoost; }
+    virtual Fixed getInspirationBoost() const { return m_traits.inspirationBoost; }
     virtual int getBuilderCharges() const { return m_traits.builderCharges; }
 
-    // ==================== Դӳɽӿ ====================
-    virtual float getScienceBonus() const { return m_traits.scienceBonus; }
-    virtual float getCultureBonus() const { return m_traits.cultureBonus; }
-    virtual float getProductionBonus() const { return m_traits.productionBonus; }
-    virtual float getGoldBonus() const { return m_traits.goldBonus; }
-    virtual float getFaithBonus() const { return m_traits.faithBonus; }
-    virtual float getMilitaryProductionCost() const { return m_traits.militaryProductionBonus; }
+    // ==================== 资源加成接口 ====================
+    virtual Fixed getScienceBonus() const { return m_traits.scienceBonus; }
+    virtual Fixed getCultureBonus() const { return m_traits.cultureBonus; }
+    virtual Fixed getProductionBonus() const { return m_traits.productionBonus; }
+    virtual Fixed getGoldBonus() const { return m_traits.goldBonus; }
+    virtual Fixed getFaithBonus() const { return m_traits.faithBonus; }
+    virtual Fixed getMilitaryProductionCost() const { return m_traits.militaryProductionBonus; }
 
-    // ==================== ؽӿ ====================
+    // ==================== 区域相关接口 ====================
     virtual bool hasHalfCostIndustrial() const { return m_traits.halfCostIndustrial; }
     virtual bool hasExtraDistrictSlot() const { return m_traits.extraDistrictSlot; }
 
-    // ==================== ⵥλӿ ====================
+    // ==================== 特殊单位接口 ====================
     virtual bool hasUniqueUnit(const std::string& unitName) const { return false; }
     virtual bool isUniqueUnitUnlocked(const std::string& unitName) const { return false; }
     virtual cocos2d::Ref* createUniqueUnit(const std::string& unitName, void* position) { return nullptr; }
 
-    // ==================== ӳɼ ====================
+    // ==================== 区域加成计算 ====================
     virtual Yield calculateDistrictBonus(const District* district) const;
 
-    // ==================== ɱӿ ====================
-    virtual float calculateDistrictCost(const std::string& districtType) const { return 1.0f; }
-    virtual float calculateDistrictCost(const DistrictType::DistrictTypeInfo& type) const { return 1.0f; }
+    // ==================== 成本计算接口 ====================
+    virtual Fixed calculateDistrictCost(const std::string& districtType) const { return Fixed::one(); }
+    virtual Fixed calculateDistrictCost(const DistrictType::DistrictTypeInfo& type) const { return Fixed::one(); }
 
-    // ====================  ====================
+    // ==================== 区域容量计算 ====================
     virtual int calculateMaxDistricts(int population) const;
 
-    // ==================== Ƽ/ĻӳӦ ====================
+    // ==================== 科技/文化加成应用 ====================
     virtual int applyScienceBonus(int baseScience) const {
-        return static_cast<int>(baseScience * getScienceBonus());
+        return getScienceBonus().mulInt(baseScience);
     }
 
     virtual int applyCultureBonus(int baseCulture) const {
-        return static_cast<int>(baseCulture * getCultureBonus());
+        return getCultureBonus().mulInt(baseCulture);
     }
 
     virtual int applyEurekaBonus(int techId, const TechTree* techTree) const;
     virtual int applyInspirationBonus(int cultureId, const CultureTree* cultureTree) const;
 
-    // ==================== ¼ص ====================
+    // ==================== 事件回调 ====================
     virtual void onTechActivated(int techId) {}
     virtual void onCultureUnlocked(int cultureId) {}
     virtual void onCityFounded(void* city) {}
@@ -8,21 +8,21 @@ bool CivChina::init() {
         return false;
     }
 
-    // й
-    m_traits.name = "ʼʵ";
-    m_traits.description = "￨мӳ75%5ʹôӵⵥλ";
-    m_traits.eurekaBoost = 0.75f; // 75%￨ӳ
-    m_traits.inspirationBoost = 0.75f; // 75%мӳ
+    // 设置中国特性
+    m_traits.name = "始皇帝";
+    m_traits.description = "尤里卡和灵感加成提升75%，建造者有5次使用次数，拥有特殊单位虎蹲炮";
+    m_traits.eurekaBoost = Fixed::percent(75); // 75%尤里卡加成
+    m_traits.inspirationBoost = Fixed::percent(75); // 75%灵感加成
     m_traits.builderCharges = 5;
-    m_traits.initialTiles = 3; // Ĭֵ
-    m_traits.scienceBonus = 1.0f;
-    m_traits.cultureBonus = 1.0f;
+    m_traits.initialTiles = 3; // 默认值
+    m_traits.scienceBonus = Fixed::one();
+    m_traits.cultureBonus = Fixed::one();
     m_traits.halfCostIndustrial = false;
     m_traits.extraDistrictSlot = false;
-    m_traits.militaryProductionBonus = 1.0f;
+    m_traits.militaryProductionBonus = Fixed::one();
 
-    // ⵥλб
-    m_uniqueUnits.push_back("");
+    // 添加特殊单位到列表
+    m_uniqueUnits.push_back("虎蹲炮");
 
     return true;
 }
@@ -41,7 +41,7 @@ bool CivChina::hasUniqueUnit(const std::string& unitName) const {
 }
 
 bool CivChina::isUniqueUnitUnlocked(const std::string& unitName) const {
-    if (unitName != "") {
+    if (unitName != "虎蹲炮") {
         return false;
     }
 
@@ -49,13 +49,13 @@ bool CivChina::isUniqueUnitUnlocked(const std::string& unitName) const {
 }
 
 cocos2d::Ref* CivChina::createUniqueUnit(const std::string& unitName, void* position) {
-    if (unitName == "") {
+    if (unitName == "虎蹲炮") {
         return nullptr;
     }
     return nullptr;
 }
 
 Yield CivChina::calculateDistrictBonus(const District* district) const {
-    // йûӳɣʹûʵ
+    // 中国没有特殊区域加成，使用基类实现
     return BaseCiv::calculateDistrictBonus(district);
 }
\ No newline at end of file
@@ -6,12 +6,12 @@
 #include <vector>
 #include <string>
 
-// ǰ
+// 前向声明
 class TigerCannonUnit;
 
 class CivChina : public BaseCiv {
 public:
-    // 
+    // 创建方法
     static CivChina* create() {
         CivChina* pRet = new(std::nothrow) CivChina();
         if (pRet && pRet->init()) {
@@ -22,22 +22,22 @@ public:
         return nullptr;
     }
 
-    // ʼ
+    // 初始化
     virtual bool init() override;
 
-    // ==================== Իȡ ====================
+    // ==================== 文明特性获取 ====================
     virtual CivilizationTrait getTraits() const override;
 
-    // ==================== ͨüӳɽӿ ====================
-    virtual float getEurekaBoost() const override { return 0.75f; } // ￨75%
-    virtual int getBuilderCharges() const override { return 5; }    // 5
+    // ==================== 通用加成接口 ====================
+    virtual Fixed getEurekaBoost() const override { return Fixed::percent(75); } // 尤里卡75%
+    virtual int getBuilderCharges() const override { return 5; }    // 建造者5次
 
-    // ==================== ⵥλӿ ====================
+    // ==================== 特殊单位接口 ====================
     virtual bool hasUniqueUnit(const std::string& unitName) const override;
     virtual bool isUniqueUnitUnlocked(const std::string& unitName) const override;
     virtual cocos2d::Ref* createUniqueUnit(const std::string& unitName, void* position) override;
 
-    // ==================== ӳɼ ====================
+    // ==================== 区域加成计算 ====================
     virtual Yield calculateDistrictBonus(const District* district) const override;
 
 private:
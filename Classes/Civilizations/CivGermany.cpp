@@ -6,18 +6,18 @@ bool CivGermany::init() {
         return false;
     }
 
-    // õ¹
-    m_traits.name = "ʥʵ";
-    m_traits.description = "ҵɱ룬ÿпɽ+1";
+    // 设置德国特性
+    m_traits.name = "神圣罗马皇帝";
+    m_traits.description = "工业区建设成本减半，每个城市可建造的区域上限+1";
     m_traits.halfCostIndustrial = true;
     m_traits.extraDistrictSlot = true;
     m_traits.initialTiles = 3;
-    m_traits.eurekaBoost = 0.5f;
-    m_traits.inspirationBoost = 0.5f;
+    m_traits.eurekaBoost = Fixed::percent(50);
+    m_traits.inspirationBoost = Fixed::percent(50);
     m_traits.builderCharges = 3;
-    m_traits.scienceBonus = 1.0f;
-    m_traits.cultureBonus = 1.0f;
-    m_traits.militaryProductionBonus = 1.0f;
+    m_traits.scienceBonus = Fixed::one();
+    m_traits.cultureBonus = Fixed::one();
+    m_traits.militaryProductionBonus = Fixed::one();
 
     return true;
 }
@@ -26,18 +26,18 @@ CivilizationTrait CivGermany::getTraits() const {
     return m_traits;
 }
 
-float CivGermany::calculateDistrictCost(const std::string& districtType) const {
-    // ǷΪҵ
+Fixed CivGermany::calculateDistrictCost(const std::string& districtType) const {
+    // 检查是否为工业区
     if (districtType == "IndustryZone") {
-        return 0.5f; // 
+        return Fixed::percent(50); // 半价
     }
 
-    // ԭ
-    return 1.0f;
+    // 其他区域按原价
+    return Fixed::one();
 }
 
 int CivGermany::calculateMaxDistricts(int population) const {
-    // ¹+1
+    // 德国特殊能力：区域上限+1
     int baseDistricts = BaseCiv::calculateMaxDistricts(population);
-    return baseDistricts + 1; // ¹+1
+    return baseDistricts + 1; // 德国额外+1
 }
\ No newline at end of file
@@ -6,7 +6,7 @@
 
 class CivGermany : public BaseCiv {
 public:
-    // 
+    // 创建方法
     static CivGermany* create() {
         CivGermany* pRet = new(std::nothrow) CivGermany();
         if (pRet && pRet->init()) {
@@ -17,20 +17,20 @@ public:
         return nullptr;
     }
 
-    // ʼ
+    // 初始化
     virtual bool init() override;
 
-    // ==================== Իȡ ====================
+    // ==================== 文明特性获取 ====================
     virtual CivilizationTrait getTraits() const override;
 
-    // ==================== ؽӿ ====================
+    // ==================== 区域相关接口 ====================
     virtual bool hasHalfCostIndustrial() const override { return true; }
     virtual bool hasExtraDistrictSlot() const override { return true; }
 
-    // ==================== ɱӿ ====================
-    virtual float calculateDistrictCost(const std::string& districtType) const override;
+    // ==================== 成本计算接口 ====================
+    virtual Fixed calculateDistrictCost(const std::string& districtType) const override;
 
-    // ====================  ====================
+    // ==================== 区域容量计算 ====================
     virtual int calculateMaxDistricts(int population) const override;
 
 private:
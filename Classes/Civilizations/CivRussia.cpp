@@ -7,21 +7,21 @@ bool CivRussia::init() {
         return false;
     }
 
-    // ö˹
-    m_traits.name = "˵ô";
-    m_traits.description = "ʼ+8ؿ飩ѧԺ;Ժ㳡+20%µλɱ";
-    m_traits.initialTiles = 8;               // ʼؿ+8
-    m_traits.scienceBonus = 1.2f;           // мӳ20%
-    m_traits.cultureBonus = 1.2f;           // Ļӳ20%
-    m_traits.militaryProductionBonus = 0.8f; // ɱ20%
+    // 设置俄罗斯特性
+    m_traits.name = "彼得大帝";
+    m_traits.description = "初始领土扩大（+8地块），学院和剧院广场产出+20%，军事单位生产成本降低";
+    m_traits.initialTiles = 8;               // 初始地块+8
+    m_traits.scienceBonus = Fixed::percent(120);           // 科研加成20%
+    m_traits.cultureBonus = Fixed::percent(120);           // 文化加成20%
+    m_traits.militaryProductionBonus = Fixed::percent(80); // 军事生产力成本减少20%
     m_traits.halfCostIndustrial = false;
     m_traits.extraDistrictSlot = false;
-    m_traits.eurekaBoost = 0.5f;
-    m_traits.inspirationBoost = 0.5f;
+    m_traits.eurekaBoost = Fixed::percent(50);
+    m_traits.inspirationBoost = Fixed::percent(50);
     m_traits.builderCharges = 3;
-    m_traits.productionBonus = 1.0f;
-    m_traits.goldBonus = 1.0f;
-    m_traits.faithBonus = 1.0f;
+    m_traits.productionBonus = Fixed::one();
+    m_traits.goldBonus = Fixed::one();
+    m_traits.faithBonus = Fixed::one();
 
     return true;
 }
@@ -37,17 +37,17 @@ Yield CivRussia::calculateDistrictBonus(const District* district) const {
         return bonus;
     }
 
-    // ȡ
+    // 获取区域类型
     District::DistrictType districtType = district->getType();
 
-    // ѧԺṩĿмӳ
+    // 如果是学院区域，提供额外的科研加成
     if (districtType == District::DistrictType::CAMPUS) {
-        // ȡ
+        // 获取基础产出
         Yield baseYield = district->getYield();
         bonus.scienceYield = static_cast<int>(baseYield.scienceYield * 0.2f); // +20%
     }
 
-    // ǾԺ㳡ṩĻӳ
+    // 如果是剧院广场区域，提供额外的文化加成
     if (districtType == District::DistrictType::THEATER_SQUARE) {
         Yield baseYield = district->getYield();
         bonus.cultureYield = static_cast<int>(baseYield.cultureYield * 0.2f); // +20%
@@ -6,7 +6,7 @@
 
 class CivRussia : public BaseCiv {
 public:
-    // 
+    // 创建方法
     static CivRussia* create() {
         CivRussia* pRet = new(std::nothrow) CivRussia();
         if (pRet && pRet->init()) {
@@ -17,21 +17,21 @@ public:
         return nullptr;
     }
 
-    // ʼ
+    // 初始化
     virtual bool init() override;
 
-    // ==================== Իȡ ====================
+    // ==================== 文明特性获取 ====================
     virtual CivilizationTrait getTraits() const override;
 
-    // ==================== ͨüӳɽӿ ====================
-    virtual int getInitialTiles() const override { return 8; } // ʼؿ+8
-    virtual float getMilitaryProductionCost() const override { return 0.8f; } // µλɱ20%
+    // ==================== 通用加成接口 ====================
+    virtual int getInitialTiles() const override { return 8; } // 初始地块+8
+    virtual Fixed getMilitaryProductionCost() const override { return Fixed::percent(80); } // 军事单位成本减少20%
 
-    // ==================== Դӳɽӿ ====================
-    virtual float getScienceBonus() const override { return 1.2f; }
-    virtual float getCultureBonus() const override { return 1.2f; }
+    // ==================== 资源加成接口 ====================
+    virtual Fixed getScienceBonus() const override { return Fixed::percent(120); }
+    virtual Fixed getCultureBonus() const override { return Fixed::percent(120); }
 
-    // ==================== ӳɼ ====================
+    // ==================== 区域加成计算 ====================
     virtual Yield calculateDistrictBonus(const District* district) const override;
 
 private:
@@ -3,16 +3,21 @@
 #include "Player.h"
 #include "../City/BaseCity.h" 
 #include "../Units/Base/AbstractUnit.h"
+#include "../Units/Base/UnitActionLog.h"
+#include "../Units/Base/UnitStateTable.h"
+#include "../Utils/ScopeProfiler.h"
+#include "../Utils/PerfCounters.h"
+#include "../Utils/GameLog.h"
+#include "../Utils/FrameArena.h"
 #include <algorithm>
 #include "../Scene/GameScene.h" 
 #include "../Map/GameMapLayer.h" 
-#include <set>
 USING_NS_CC;
 
 GameManager* GameManager::s_instance = nullptr;
 
 /**
- * ȡϷʵ
+ * 获取游戏管理器单例实例
  */
 GameManager* GameManager::getInstance() {
     if (!s_instance) {
@@ -22,7 +27,7 @@ GameManager* GameManager::getInstance() {
 }
 
 /**
- * 캯
+ * 构造函数
  */
 GameManager::GameManager()
     : m_gameState(GameState::INITIALIZING) {
@@ -30,7 +35,7 @@ GameManager::GameManager()
 }
 
 /**
- * 
+ * 析构函数
  */
 GameManager::~GameManager() {
     cleanup();
@@ -38,7 +43,7 @@ GameManager::~GameManager() {
 }
 
 /**
- * ʼϷ
+ * 初始化游戏
  */
 bool GameManager::initialize(const GameConfig& config) {
     m_gameConfig = config;
@@ -48,13 +53,15 @@ bool GameManager::initialize(const GameConfig& config) {
 
     m_players.clear();
     m_playerOrder.clear();
+    m_playerSlots.clear();
+    m_playerHandleById.clear();
 
     CCLOG("GameManager initialized");
     return true;
 }
 
 /**
- * ҵϷ
+ * 添加玩家到游戏
  */
 void GameManager::addPlayer(Player* player) {
     if (!player) {
@@ -62,7 +69,7 @@ void GameManager::addPlayer(Player* player) {
         return;
     }
 
-    // ǷѴͬID
+    // 检查是否已存在相同ID的玩家
     for (auto existingPlayer : m_players) {
         if (existingPlayer->getPlayerId() == player->getPlayerId()) {
             CCLOG("Player with ID %d already exists", player->getPlayerId());
@@ -70,18 +77,24 @@ void GameManager::addPlayer(Player* player) {
         }
     }
 
-    // üֹԶͷ
+    // 增加引用计数，防止被自动释放
     player->retain();
 
     m_players.push_back(player);
     m_playerOrder.push_back(player->getPlayerId());
 
-    // ǵһϷδʼΪǰ
+    int playerId = player->getPlayerId();
+    if (playerId >= (int)m_playerHandleById.size()) {
+        m_playerHandleById.resize(playerId + 1, EntityHandles::kInvalid);
+    }
+    m_playerHandleById[playerId] = m_playerSlots.insert(player);
+
+    // 如果是第一个玩家且游戏未开始，设置为当前玩家
     if (m_players.size() == 1 && m_gameState == GameState::INITIALIZING) {
         m_currentPlayerIndex = 0;
     }
 
-    // Ϸͳ
+    // 更新游戏统计
     m_gameStats.totalPlayers = m_players.size();
     m_gameStats.activePlayers = m_players.size();
 
@@ -90,7 +103,7 @@ void GameManager::addPlayer(Player* player) {
 }
 
 /**
- * ϷƳ
+ * 从游戏中移除玩家
  */
 void GameManager::removePlayer(int playerId) {
     auto it = std::find_if(m_players.begin(), m_players.end(),
@@ -99,23 +112,27 @@ void GameManager::removePlayer(int playerId) {
         });
 
     if (it != m_players.end()) {
-        // ˳Ƴ
+        // 从玩家顺序中移除
         auto orderIt = std::find(m_playerOrder.begin(), m_playerOrder.end(), playerId);
         if (orderIt != m_playerOrder.end()) {
             m_playerOrder.erase(orderIt);
 
-            // ǰ
+            // 调整当前玩家索引
             if (m_currentPlayerIndex >= m_playerOrder.size()) {
                 m_currentPlayerIndex = 0;
             }
         }
 
-        // üӦretain
+        // 注销句柄，持有旧句柄的引用从此查询失败
+        m_playerSlots.erase(m_playerHandleById[playerId]);
+        m_playerHandleById[playerId] = EntityHandles::kInvalid;
+
+        // 减少引用计数，对应上面的retain
         (*it)->release();
 
         m_players.erase(it);
 
-        // Ϸͳ
+        // 更新游戏统计
         m_gameStats.totalPlayers = m_players.size();
 
         CCLOG("Player %d removed from game. Remaining players: %d",
@@ -127,19 +144,56 @@ void GameManager::removePlayer(int playerId) {
 }
 
 /**
- * ȡָID
+ * 获取指定ID的玩家
  */
 Player* GameManager::getPlayer(int playerId) const {
-    for (auto player : m_players) {
-        if (player->getPlayerId() == playerId) {
-            return player;
-        }
+    return getPlayerByHandle(getPlayerHandle(playerId));
+}
+
+EntityHandle GameManager::getPlayerHandle(int playerId) const {
+    if (playerId < 0 || playerId >= (int)m_playerHandleById.size()) {
+        return EntityHandles::kInvalid;
     }
-    return nullptr;
+    return m_playerHandleById[playerId];
+}
+
+Player* GameManager::getPlayerByHandle(EntityHandle handle) const {
+    Player* const* player = m_playerSlots.get(handle);
+    return player ? *player : nullptr;
 }
 
 /**
- * ȡǰغϵ
+ * 登记城市
+ */
+EntityHandle GameManager::registerCity(BaseCity* city) {
+    EntityHandle handle = m_citySlots.insert(city);
+    m_cityByHex[city->gridPos] = handle;
+    return handle;
+}
+
+/**
+ * 注销城市（句柄已失效时忽略）
+ */
+void GameManager::unregisterCity(EntityHandle handle, const Hex& pos) {
+    if (!m_citySlots.erase(handle)) return;
+    auto it = m_cityByHex.find(pos);
+    if (it != m_cityByHex.end() && it->second == handle) {
+        m_cityByHex.erase(it);
+    }
+}
+
+BaseCity* GameManager::getCity(EntityHandle handle) const {
+    BaseCity* const* city = m_citySlots.get(handle);
+    return city ? *city : nullptr;
+}
+
+BaseCity* GameManager::getCityAt(const Hex& pos) const {
+    auto it = m_cityByHex.find(pos);
+    return it == m_cityByHex.end() ? nullptr : getCity(it->second);
+}
+
+/**
+ * 获取当前回合的玩家
  */
 Player* GameManager::getCurrentPlayer() const {
     if (m_playerOrder.empty() || m_currentPlayerIndex >= m_playerOrder.size()) {
@@ -151,7 +205,7 @@ Player* GameManager::getCurrentPlayer() const {
 }
 
 /**
- * õǰ
+ * 设置当前玩家索引
  */
 void GameManager::setCurrentPlayer(int index)
 {
@@ -159,7 +213,7 @@ void GameManager::setCurrentPlayer(int index)
 }
 
 /**
- * ȡһ
+ * 获取下一个玩家
  */
 Player* GameManager::getNextPlayer() const {
     if (m_playerOrder.empty()) {
@@ -172,58 +226,54 @@ Player* GameManager::getNextPlayer() const {
 }
 
 /**
- * ǰһغϣлһ
+ * 结束当前玩家回合，切换到下一个玩家
  */
 void GameManager::endTurn() {
+    PROFILE_SCOPE("GameManager::endTurn");
     Player* currentPlayer = getCurrentPlayer();
     if (!currentPlayer) return;
 
-    CCLOG("=== Ending turn for Player %d ===", currentPlayer->getPlayerId());
+    GLOG_VERBOSE(CORE, "=== Ending turn for Player %d ===", currentPlayer->getPlayerId());
 
-    // 1. ǰһغϽ
+    // 1. 重算相邻加成失效的区域（受影响城市的产出随之失效），再做当前玩家回合结束结算
+    District::processAdjacencyQueue();
     currentPlayer->onTurnEnd();
     notifyTurnEnd(currentPlayer->getPlayerId());
 
-    // 2. лһ
+    // 2. 切换到下一个玩家
     advanceToNextPlayer();
 
-    // 3. һֽӻغ
+    // 3. 如果一轮结束，增加回合数
     if (m_currentPlayerIndex == 0) {
         beginNewTurn();
     }
 
-    // 4. һغϿʼʼ
+    // 4. 新玩家回合开始初始化
     Player* nextPlayer = getCurrentPlayer();
     if (nextPlayer) {
-        CCLOG("=== Beginning turn for Player %d ===", nextPlayer->getPlayerId());
+        GLOG_VERBOSE(CORE, "=== Beginning turn for Player %d ===", nextPlayer->getPlayerId());
 
-        // Դ
+        // 计算资源产出
         nextPlayer->onTurnBegin();
         notifyTurnStart(nextPlayer->getPlayerId());
 
-        //  UI ¼
-        ValueMap resourceData;
-        resourceData["player_id"] = nextPlayer->getPlayerId();
-        resourceData["gold"] = nextPlayer->getGold();
-        resourceData["science"] = nextPlayer->getSciencePerTurn();
-        resourceData["culture"] = nextPlayer->getCulturePerTurn();
-        resourceData["turn"] = m_gameStats.currentTurn;
-        Director::getInstance()->getEventDispatcher()->dispatchCustomEvent(
-            "player_turn_resource_update", &resourceData
-        );
-
-        // AIһغϴ
+        // UI 资源快照已由 onTurnBegin 通过 EventBus 发布
+
+        // AI玩家回合处理
         if (!nextPlayer->getIsHuman()) {
-            // AI
+            // 调用AI处理函数
             this->processAITurn(nextPlayer);
         }
         else {
-            // ңȴUIťһendTurn()
-            CCLOG("Waiting for Human Player...");
+            // 人类玩家：等待UI按钮触发下一次endTurn()
+            GLOG_VERBOSE(CORE, "Waiting for Human Player...");
         }
     }
 
-    // 5. ʤ
+    // 本回合的临时数据（寻路表、AI 占用集合、工作位列表等）到此全部失效
+    FrameArena::getInstance()->reset();
+
+    // 5. 检查胜利条件
     VictoryType victoryType = checkVictoryConditions();
     if (victoryType != VictoryType::NONE) {
         int winnerId = -1;
@@ -239,7 +289,7 @@ void GameManager::endTurn() {
 }
 
 /**
- * ʼʼλ
+ * 初始化玩家起始单位
  */
 void GameManager::initializePlayerStartingUnits(cocos2d::Node* parentNode,
     std::function<Hex(int)> getStartHexForPlayerFunc,
@@ -259,19 +309,19 @@ void GameManager::initializePlayerStartingUnits(cocos2d::Node* parentNode,
             continue;
         }
 
-        // ΪÿҴʼκ
+        // 为每个玩家创建起始六边形函数
         auto getStartHexFunc = [getStartHexForPlayerFunc, player]() -> Hex {
             if (getStartHexForPlayerFunc) {
                 return getStartHexForPlayerFunc(player->getPlayerId());
             }
-            // ĬϷصͼ
+            // 默认返回地图中心
             return Hex(55, 15);
             };
 
-        // һص
+        // 设置玩家回调函数
         player->setMapCallbacks(getStartHexFunc, addToMapFunc, checkCityFunc, getTerrainCostFunc);
 
-        // ʼ
+        // 创建起始开拓者
         auto settler = player->createStartingSettler(parentNode, getStartHexFunc, addToMapFunc, checkCityFunc);
 
         if (settler) {
@@ -284,14 +334,14 @@ void GameManager::initializePlayerStartingUnits(cocos2d::Node* parentNode,
 }
 
 /**
- * ǰһ
+ * 前进到下一个玩家
  */
 void GameManager::advanceToNextPlayer() {
     if (m_playerOrder.empty()) {
         return;
     }
 
-    // ҵһԾ
+    // 找到下一个活跃玩家
     int attempts = 0;
     int nextIndex;
 
@@ -300,7 +350,7 @@ void GameManager::advanceToNextPlayer() {
         attempts++;
 
         if (attempts > m_playerOrder.size()) {
-            // ҶԾ
+            // 所有玩家都不活跃
             CCLOG("All players are inactive or defeated");
             m_gameState = GameState::GAME_OVER;
             return;
@@ -317,85 +367,88 @@ void GameManager::advanceToNextPlayer() {
 }
 
 /**
- * ʼ»غ
+ * 开始新回合
  */
 void GameManager::beginNewTurn() {
     m_gameStats.currentTurn++;
-    CCLOG("=== Beginning Turn %d ===", m_gameStats.currentTurn);
+    PerfCounters::getInstance()->onNewTurn();
+    GLOG_INFO(CORE, "=== Beginning Turn %d ===", m_gameStats.currentTurn);
 
-    // غ
+    // 检查回合限制
     if (m_gameConfig.maxTurns > 0 && m_gameStats.currentTurn > m_gameConfig.maxTurns) {
-        CCLOG("Maximum turns reached (%d). Game over!", m_gameConfig.maxTurns);
+        GLOG_INFO(CORE, "Maximum turns reached (%d). Game over!", m_gameConfig.maxTurns);
         m_gameState = GameState::GAME_OVER;
     }
 }
 
 /**
- * Ƿд
+ * 检查玩家是否有待处理决策
  */
 bool GameManager::hasPendingDecisions(int playerId) const {
     Player* player = getPlayer(playerId);
     if (!player) return false;
 
-    // 1. Ƽ
+    // 1. 科技检查
     bool techNeedsAttention = false;
     if (player->getCurrentResearchTechId() == -1) {
-        // ƼǷ"о"Ŀ
-        auto researchableTechs = player->getTechTree()->getResearchableTechList();
-        if (!researchableTechs.empty()) {
+        // 检查科技树是否还有"可研究"的项目
+        if (player->getTechTree()->hasResearchableTech()) {
             techNeedsAttention = true;
         }
     }
 
-    // 2. Ļ
+    // 2. 文化检查
     bool cultureNeedsAttention = false;
     if (player->getCurrentResearchCivicId() == -1) {
-        // ĻǷ"ɽ"Ŀ
-        auto unlockableCultures = player->getCultureTree()->getUnlockableCultureList();
-        if (!unlockableCultures.empty()) {
+        // 检查文化树是否还有"可解锁"的项目
+        if (player->getCultureTree()->hasUnlockableCulture()) {
             cultureNeedsAttention = true;
         }
     }
 
-    // 3. 
+    // 3. 城市生产检查
     bool productionNeedsAttention = false;
     for (auto city : player->getCities()) {
-        // еǰûĿûб
+        // 如果城市当前没有生产项目，且没有被挂起的生产
         if (city->getCurrentProduction() == nullptr && city->getSuspendedProductions().empty()) {
             productionNeedsAttention = true;
             break;
         }
     }
 
-    // ֻеƼĻһҪʱŷtrue
+    // 只有当科技、文化、生产中任意一个需要处理时，才返回true
     return (techNeedsAttention || cultureNeedsAttention || productionNeedsAttention);
 }
 
 /**
- * AIһغ
+ * 处理AI玩家回合
  */
 void GameManager::processAITurn(Player* aiPlayer) {
+    PROFILE_SCOPE("GameManager::processAITurn");
     if (!aiPlayer || aiPlayer->getIsHuman()) {
         return;
     }
 
-    CCLOG("=== AI Player %d Turn Start ===", aiPlayer->getPlayerId());
+    GLOG_VERBOSE(AI, "=== AI Player %d Turn Start ===", aiPlayer->getPlayerId());
 
-    // 1. ȡҪĻ
+    // 1. 获取必要的环境对象
     auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
     if (!gameScene || !gameScene->getMapLayer()) {
         endTurnWithDelay();
         return;
     }
 
-    // ȡHexLayoutڵλƶ͹ת
+    // 获取HexLayout，用于单位移动和攻击的坐标转换
     HexLayout* layout = gameScene->getMapLayer()->getLayout();
     if (!layout) {
         endTurnWithDelay();
         return;
     }
 
-    // 2. ѰҹĿ꣨ң
+    // 单位行动立即结算，动画统一收集到回合末播放
+    UnitActionLog::getInstance()->beginBatch();
+
+    // 2. 寻找攻击目标（人类玩家）
     Player* humanPlayer = nullptr;
     for (auto p : m_players) {
         if (p->getIsHuman()) {
@@ -404,44 +457,44 @@ void GameManager::processAITurn(Player* aiPlayer) {
         }
     }
 
-    // 3. AIֽ߼
+    // 3. AI开局建城逻辑
     if (aiPlayer->getCityCount() == 0) {
-        // ȡλб
-        std::vector<AbstractUnit*> units = aiPlayer->getUnits();
+        // 建城后立即跳出循环，遍历期间不会修改列表，无需复制
+        const std::vector<AbstractUnit*>& units = aiPlayer->getUnits();
 
         for (auto unit : units) {
-            // ҵλ
+            // 找到移民单位
             if (unit && unit->canFoundCity()) {
                 Hex unitPos = unit->getGridPos();
 
-                // 򵥵ĺϷԼ
+                // 简单的合法性检查
                 bool canSettle = true;
                 if (aiPlayer->m_checkCityFunc) {
                     if (aiPlayer->m_checkCityFunc(unitPos)) canSettle = false;
                 }
 
                 if (canSettle) {
-                    CCLOG("AI Player %d founding Capital at (%d, %d)", aiPlayer->getPlayerId(), unitPos.q, unitPos.r);
+                    GLOG_INFO(AI, "AI Player %d founding Capital at (%d, %d)", aiPlayer->getPlayerId(), unitPos.q, unitPos.r);
 
-                    // 
+                    // 创建城市
                     std::string cityName = "City " + std::to_string(aiPlayer->getPlayerId());
                     BaseCity* newCity = BaseCity::create(aiPlayer->getPlayerId(), unitPos, cityName);
 
                     if (newCity) {
-                        // ӻλòӵͼ
+                        // 可视化：设置位置并添加到地图层
                         Vec2 pixelPos = layout->hexToPixel(unitPos);
                         newCity->setPosition(pixelPos);
                         gameScene->getMapLayer()->addChild(newCity, 10); // Z-Order 10
 
-                        // ߼ע
+                        // 逻辑注册
                         this->registerCapital(aiPlayer->getPlayerId(), newCity);
                         aiPlayer->addCity(newCity);
 
-                        // Ƴ
+                        // 移除移民
                         aiPlayer->removeUnit(unit);
                         unit->removeFromParent();
 
-                        // ǺλѭָֹʧЧ
+                        // 建城后跳出单位循环，防止指针失效
                         break;
                     }
                 }
@@ -449,108 +502,90 @@ void GameManager::processAITurn(Player* aiPlayer) {
         }
     }
 
-    // 4. AIλսƶ߼
+    // 4. AI单位战斗与移动逻辑
 
-    // 4.1 Ԥص
-    std::set<Hex> occupiedOrReservedHexes;
+    // 4.1 预备防重叠集合（回合内临时数据，从 FrameArena 分配）
+    FrameSet<Hex> occupiedOrReservedHexes;
+    UnitStateTable* unitTable = UnitStateTable::getInstance();
 
-    // лŵĵλͳλüռб
+    // 将所有活着的单位和城市位置加入占用列表（单位坐标直接从状态表线性读取）
+    FrameVector<Hex> unitPositions;
+    unitTable->collectPositions(unitPositions);
+    occupiedOrReservedHexes.insert(unitPositions.begin(), unitPositions.end());
     for (auto p : m_players) {
-        for (auto u : p->getUnits()) {
-            if (u->isAlive()) occupiedOrReservedHexes.insert(u->getGridPos());
-        }
         for (auto c : p->getCities()) {
             occupiedOrReservedHexes.insert(c->gridPos);
         }
     }
 
-    // 4.2 Ԥ
-    std::set<AbstractUnit*> dyingUnits;
-
-    // 4.3 AIλִж
-    std::vector<AbstractUnit*> myUnits = aiPlayer->getUnits();
+    // 4.2 遍历AI单位执行行动
+    const std::vector<AbstractUnit*>& units = aiPlayer->getUnits();
+    FrameVector<AbstractUnit*> myUnits(units.begin(), units.end());
 
     for (auto unit : myUnits) {
-        // Чλλ
+        // 跳过无效单位、死单位、和移民
         if (!unit || !unit->isAlive() || unit->canFoundCity()) {
             if (unit && unit->isAlive()) occupiedOrReservedHexes.insert(unit->getGridPos());
             continue;
         }
 
         Hex currentPos = unit->getGridPos();
-        // ǰλôռñƳ
+        // 将当前位置从占用表中移除
         occupiedOrReservedHexes.erase(currentPos);
 
-        // ûңAIʹԭ
+        // 如果没有人类玩家，AI就呆在原地
         if (!humanPlayer) {
             occupiedOrReservedHexes.insert(currentPos);
             continue;
         }
 
-        // A. Ѱһŵĵ
-        AbstractUnit* targetEnemy = nullptr;
+        // A. 寻找最近的且活着的敌人
         int minDistance = 9999;
+        AbstractUnit* targetEnemy = unitTable->findNearest(humanPlayer->getPlayerId(), currentPos, minDistance);
 
-        for (auto enemyUnit : humanPlayer->getUnits()) {
-            // 򼴽ĵ
-            if (!enemyUnit->isAlive() || dyingUnits.count(enemyUnit)) continue;
-
-            int dist = currentPos.distance(enemyUnit->getGridPos());
-            if (dist < minDistance) {
-                minDistance = dist;
-                targetEnemy = enemyUnit;
-            }
-        }
-
-        // B. ߣƶ
+        // B. 决策：攻击还是移动
         int attackRange = unit->getAttackRange();
-        if (attackRange <= 0) attackRange = 1; // 
+        if (attackRange <= 0) attackRange = 1; // 保底
 
-        // 1:  -> 
+        // 情况1: 敌人在射程内 -> 发动攻击
         if (targetEnemy && minDistance <= attackRange) {
-            CCLOG("AI Unit %s ATTACK -> %s", unit->getUnitName().c_str(), targetEnemy->getUnitName().c_str());
+            GLOG_TRACE(AI, "AI Unit %s ATTACK -> %s", unit->getUnitName().c_str(), targetEnemy->getUnitName().c_str());
 
-            // ִйlayoutԱ㲥Ŷ
+            // 执行攻击（传入layout以便记录动画方向）
             unit->attack(targetEnemy, layout);
 
-            // ˺Ԥֹʬ
-            int predictedDamage = unit->getCombatPower();
-            if (targetEnemy->getCurrentHp() - predictedDamage <= 0) {
-                dyingUnits.insert(targetEnemy);
-            }
-
-            // ԭ
-            occupiedOrReservedHexes.insert(currentPos);
+            // 攻击后留在原地（被反击阵亡则让出格子）
+            if (unit->isAlive()) occupiedOrReservedHexes.insert(currentPos);
         }
-        // 2: Զ -> ƶӽ
+        // 情况2: 敌人在远处 -> 移动接近
         else if (targetEnemy) {
             Hex targetPos = targetEnemy->getGridPos();
             Hex bestMove = currentPos;
             int bestDist = minDistance;
-            int bestCost = 999;  // ¼ƶĵ
+            int bestCost = 999;  // 记录最佳移动的地形消耗
 
-            // Χ6Ѱƶ
+            // 遍历周围6个格子寻找最佳移动点
             for (int i = 0; i < 6; i++) {
                 Hex neighbor = currentPos.getNeighbor(i);
 
-                // ǷռûԤ
+                // 检查格子是否被占用或预定
                 if (occupiedOrReservedHexes.count(neighbor)) continue;
 
-                // ޸Ƿͨ
+                // 【修复】检查地形是否可通行
                 int terrainCost = -1;
                 if (aiPlayer->m_getTerrainCostFunc) {
                     terrainCost = aiPlayer->m_getTerrainCostFunc(neighbor);
                 }
                 
-                // βͨУɽȣcost < 0
+                // 地形不可通行（海洋、山脉等，cost < 0）则跳过
                 if (terrainCost < 0) continue;
 
-                // 鵥λǷ㹻ƶ
+                // 检查单位是否有足够移动力
                 if (terrainCost > unit->getCurrentMoves()) continue;
 
                 int dist = neighbor.distance(targetPos);
                 
-                // ѡģͬѡĸ͵
+                // 优先选择距离更近的，距离相同则选择消耗更低的
                 if (dist < bestDist || (dist == bestDist && terrainCost < bestCost)) {
                     bestDist = dist;
                     bestMove = neighbor;
@@ -558,70 +593,64 @@ void GameManager::processAITurn(Player* aiPlayer) {
                 }
             }
 
-            // ҵ˺ϷƶĿ
+            // 如果找到了合法的移动目标
             if (bestMove != currentPos) {
-                CCLOG("AI Unit %s MOVE -> (%d, %d), cost: %d", 
+                GLOG_TRACE(AI, "AI Unit %s MOVE -> (%d, %d), cost: %d", 
                       unit->getUnitName().c_str(), bestMove.q, bestMove.r, bestCost);
 
-                // ִƶʹʵʵģ
+                // 执行移动（使用实际地形消耗）
                 unit->moveTo(bestMove, layout, bestCost);
 
-                // λãֹλص
+                // 锁定新位置，防止后续单位重叠
                 occupiedOrReservedHexes.insert(bestMove);
             }
             else {
-                // ·ߣԭ
+                // 无路可走，留在原地
                 occupiedOrReservedHexes.insert(currentPos);
             }
         }
-        // 3: ûеˣȻǰcheckhumanPlayerеλˣ
+        // 情况3: 没有敌人（虽然前面check了humanPlayer，但可能所有单位都死了）
         else {
             occupiedOrReservedHexes.insert(currentPos);
         }
     }
 
-    // 5. AI߼
+    // 5. AI城市生产逻辑
     const std::vector<BaseCity*>& cities = aiPlayer->getCities();
     
-    // AIλ
+    // 限制AI单位数量
     int maxUnitsPerCity = 3;
-    int currentMilitaryUnits = 0;
-    
-    for (auto unit : aiPlayer->getUnits()) {
-        if (unit && unit->ismilitary()) {
-            currentMilitaryUnits++;
-        }
-    }
+    int currentMilitaryUnits = UnitStateTable::getInstance()->countMilitary(aiPlayer->getPlayerId());
     
     int maxTotalUnits = cities.size() * maxUnitsPerCity;
     
-    // ÿ5غϲʼµĵλ
+    // 生产间隔：每5回合才允许开始新的单位生产
     int productionInterval = 5;
     bool canStartNewProduction = (m_gameStats.currentTurn % productionInterval == 0);
     
     for (BaseCity* city : cities) {
         if (!city) continue;
 
-        // 
+        // 如果城市闲置
         if (city->getCurrentProduction() == nullptr) {
-            // ǷѴﵽλ
+            // 检查是否已达到单位上限
             if (currentMilitaryUnits >= maxTotalUnits) {
-                CCLOG("AI: City %s skipping production - unit cap reached (%d/%d)", 
+                GLOG_TRACE(AI, "AI: City %s skipping production - unit cap reached (%d/%d)", 
                       city->getCityName().c_str(), currentMilitaryUnits, maxTotalUnits);
                 continue;
             }
             
-            // 
+            // 检查生产间隔
             if (!canStartNewProduction) {
-                CCLOG("AI: City %s waiting for production interval (turn %d)", 
+                GLOG_TRACE(AI, "AI: City %s waiting for production interval (turn %d)", 
                       city->getCityName().c_str(), m_gameStats.currentTurn);
                 continue;
             }
             
-            CCLOG("AI: City %s starting production of Warrior", city->getCityName().c_str());
+            GLOG_VERBOSE(AI, "AI: City %s starting production of Warrior", city->getCityName().c_str());
 
-            // Ŀ
-            ProductionProgram* warriorProd = new ProductionProgram(
+            // 创建生产项目（从对象池取用，完成后由城市归还）
+            ProductionProgram* warriorProd = ProductionProgram::acquire(
                 ProductionProgram::ProductionType::UNIT,
                 "Warrior",
                 Hex(),
@@ -632,38 +661,40 @@ void GameManager::processAITurn(Player* aiPlayer) {
 
             city->addNewProduction(warriorProd);
             currentMilitaryUnits++;
-            canStartNewProduction = false; // غֻһпʼ
+            canStartNewProduction = false; // 本回合只允许一个城市开始生产
         }
     }
 
-    // 6. غ
-    endTurnWithDelay();
+    // 6. 播放本回合动画，等待播放完毕后结束回合
+    float animationTime = UnitActionLog::getInstance()->endBatch(
+        m_gameConfig.quickAITurns, m_gameConfig.aiAnimationSpeed);
+    endTurnWithDelay(m_gameConfig.quickAITurns ? 0.0f : animationTime);
 }
 
 /**
- * ӳٽغϣöһ
+ * 延迟结束回合，让动画飞一会儿
  */
-void GameManager::endTurnWithDelay() {
-    // ʹscheduleOnceֹظ
+void GameManager::endTurnWithDelay(float delay) {
+    // 使用scheduleOnce防止重复触发
     std::string key = "ai_turn_end_" + std::to_string(m_currentPlayerIndex);
 
     Director::getInstance()->getScheduler()->schedule([this](float dt) {
-        // ֻϷвƽ
+        // 只有在游戏进行中才推进
         if (this->m_gameState == GameState::PLAYING) {
             this->endTurn();
         }
-        }, this, 0, 0, 1.2f, false, key);
+        }, this, 0, 0, delay, false, key);
 }
 
 /**
- * ʤ
+ * 检查胜利条件
  */
 VictoryType GameManager::checkVictoryConditions() {
     if (m_gameState != GameState::PLAYING) {
         return VictoryType::NONE;
     }
 
-    // Ƽʤ
+    // 检查科技胜利
     if (m_gameConfig.enableScienceVictory) {
         for (auto player : m_players) {
             if (player && player->checkScienceVictory()) {
@@ -673,7 +704,7 @@ VictoryType GameManager::checkVictoryConditions() {
         }
     }
 
-    // ͳʤ
+    // 检查统治胜利
     if (m_gameConfig.enableDominationVictory && checkDominationVictory()) {
         return VictoryType::DOMINATION;
     }
@@ -682,7 +713,7 @@ VictoryType GameManager::checkVictoryConditions() {
 }
 
 /**
- * Ƽʤ
+ * 检查科技胜利条件
  */
 bool GameManager::checkScienceVictory() const {
     if (m_gameState != GameState::PLAYING) {
@@ -698,27 +729,19 @@ bool GameManager::checkScienceVictory() const {
 }
 
 /**
- * ʤ
+ * 检查征服胜利条件
  */
 bool GameManager::checkDominationVictory() const {
-    // ڣǰ5غϲжʤĳǵʱ
+    // 保护期：前5回合不判定征服胜利，给所有玩家拍城的时间
     if (m_gameStats.currentTurn < 5) return false;
 
     int activePlayersCount = 0;
     Player* lastStandPlayer = nullptr;
 
     for (auto player : m_players) {
-        // ж׼ӵг OR ӵп
+        // 判定准则：拥有城市 OR 拥有开拓者
         bool hasCity = !player->getCities().empty();
-        bool hasSettler = false;
-
-        // λǷп
-        for (auto unit : player->getUnits()) {
-            if (unit->getUnitName() == "Settler") {
-                hasSettler = true;
-                break;
-            }
-        }
+        bool hasSettler = UnitStateTable::getInstance()->countOfType(player->getPlayerId(), UnitName::SETTLER) > 0;
 
         if (hasCity || hasSettler) {
             activePlayersCount++;
@@ -726,7 +749,7 @@ bool GameManager::checkDominationVictory() const {
         }
     }
 
-    // ֻʣһ1жʤ
+    // 如果存活玩家只剩一个，且总玩家数大于1，则判定胜利
     if (activePlayersCount == 1 && m_players.size() > 1) {
         CCLOG("Domination Victory: Player %d is the sole survivor!", lastStandPlayer->getPlayerId());
         return true;
@@ -736,7 +759,7 @@ bool GameManager::checkDominationVictory() const {
 }
 
 /**
- * ע׶Ϣ
+ * 注册首都信息
  */
 void GameManager::registerCapital(int playerId, BaseCity* capitalCity) {
     if (!capitalCity) {
@@ -749,7 +772,7 @@ void GameManager::registerCapital(int playerId, BaseCity* capitalCity) {
 }
 
 /**
- * ׶Ȩ
+ * 更新首都控制权
  */
 void GameManager::updateCapitalControl(int capitalOwnerId, int newControllerId) {
     auto it = m_capitalInfo.find(capitalOwnerId);
@@ -760,7 +783,7 @@ void GameManager::updateCapitalControl(int capitalOwnerId, int newControllerId)
         info.currentControllerId = newControllerId;
         info.isCaptured = (newControllerId != capitalOwnerId);
 
-        // ҿƵ׶б
+        // 更新玩家控制的首都列表
         Player* oldControllerPlayer = getPlayer(oldController);
         Player* newControllerPlayer = getPlayer(newControllerId);
 
@@ -775,7 +798,7 @@ void GameManager::updateCapitalControl(int capitalOwnerId, int newControllerId)
         CCLOG("Capital of player %d is now controlled by player %d",
             capitalOwnerId, newControllerId);
 
-        // Ƿʤ
+        // 检查是否达成征服胜利
         checkDominationVictory();
     }
     else {
@@ -784,7 +807,7 @@ void GameManager::updateCapitalControl(int capitalOwnerId, int newControllerId)
 }
 
 /**
- * ȡָҵ׶Ϣ
+ * 获取指定玩家的首都信息
  */
 CapitalInfo GameManager::getCapitalInfoForPlayer(int playerId) const {
     auto it = m_capitalInfo.find(playerId);
@@ -795,7 +818,7 @@ CapitalInfo GameManager::getCapitalInfoForPlayer(int playerId) const {
 }
 
 /**
- * ֪ͨغϿʼ
+ * 通知回合开始
  */
 void GameManager::notifyTurnStart(int playerId) {
     if (m_onTurnStartCallback) {
@@ -804,7 +827,7 @@ void GameManager::notifyTurnStart(int playerId) {
 }
 
 /**
- * ֪ͨغϽ
+ * 通知回合结束
  */
 void GameManager::notifyTurnEnd(int playerId) {
     if (m_onTurnEndCallback) {
@@ -813,7 +836,7 @@ void GameManager::notifyTurnEnd(int playerId) {
 }
 
 /**
- * ֪ͨʤ
+ * 通知胜利
  */
 void GameManager::notifyVictory(VictoryType victoryType, int winnerPlayerId) {
     if (m_onVictoryCallback) {
@@ -828,7 +851,7 @@ void GameManager::notifyVictory(VictoryType victoryType, int winnerPlayerId) {
 }
 
 /**
- * Ϸ״̬лΪValueMap
+ * 将游戏状态序列化为ValueMap
  */
 ValueMap GameManager::toValueMap() const {
     ValueMap data;
@@ -839,14 +862,14 @@ ValueMap GameManager::toValueMap() const {
     data["victoryPlayerId"] = m_gameStats.victoryPlayerId;
     data["currentPlayerIndex"] = m_currentPlayerIndex;
 
-    // ˳
+    // 玩家顺序
     ValueVector playerOrderVec;
     for (int playerId : m_playerOrder) {
         playerOrderVec.push_back(Value(playerId));
     }
     data["playerOrder"] = playerOrderVec;
 
-    // Ϸ
+    // 游戏配置
     ValueMap configData;
     configData["maxTurns"] = m_gameConfig.maxTurns;
     configData["enableScienceVictory"] = m_gameConfig.enableScienceVictory;
@@ -857,7 +880,7 @@ ValueMap GameManager::toValueMap() const {
 }
 
 /**
- * ValueMapлϷ״̬
+ * 从ValueMap反序列化游戏状态
  */
 bool GameManager::fromValueMap(const ValueMap& data) {
     if (data.find("gameState") != data.end()) {
@@ -880,7 +903,7 @@ bool GameManager::fromValueMap(const ValueMap& data) {
         m_currentPlayerIndex = data.at("currentPlayerIndex").asInt();
     }
 
-    // ָ˳
+    // 恢复玩家顺序
     if (data.find("playerOrder") != data.end()) {
         m_playerOrder.clear();
         const ValueVector& playerOrderVec = data.at("playerOrder").asValueVector();
@@ -889,7 +912,7 @@ bool GameManager::fromValueMap(const ValueMap& data) {
         }
     }
 
-    // ָϷ
+    // 恢复游戏配置
     if (data.find("gameConfig") != data.end()) {
         const ValueMap& configData = data.at("gameConfig").asValueMap();
 
@@ -908,7 +931,7 @@ bool GameManager::fromValueMap(const ValueMap& data) {
 }
 
 /**
- * Ϸ״̬
+ * 调试输出游戏状态
  */
 void GameManager::debugPrintGameState() const {
     CCLOG("=== GameManager State ===");
@@ -938,11 +961,11 @@ void GameManager::debugPrintGameState() const {
             info.isCaptured ? "Yes" : "No");
     }
 
-    // 鵱ǰ״̬
+    // 检查当前控制状态
     CCLOG("Capital Control Status:");
     for (auto player : m_players) {
         if (player) {
-            std::vector<int> controlled = player->getControlledCapitals();
+            const std::vector<int>& controlled = player->getControlledCapitals();
             CCLOG("  Player %d controls %zu capitals: ",
                 player->getPlayerId(), controlled.size());
             for (int capitalOwner : controlled) {
@@ -961,20 +984,25 @@ void GameManager::debugPrintGameState() const {
 }
 
 /**
- * ϷԴ
+ * 清理游戏管理器资源
  */
 void GameManager::cleanup() {
     CCLOG("GameManager cleanup started");
 
-    // ɾҶɴ߹
+    // 不删除玩家对象，由创建者管理
     m_players.clear();
     m_playerOrder.clear();
+    m_playerSlots.clear();
+    m_playerHandleById.clear();
+    m_citySlots.clear();
+    m_cityByHex.clear();
+    m_districtGrid.clear();
 
     m_gameState = GameState::INITIALIZING;
     m_currentPlayerIndex = 0;
     m_gameStats = GameStats();
 
-    // ûص
+    // 重置回调
     m_onTurnStartCallback = nullptr;
     m_onTurnEndCallback = nullptr;
     m_onVictoryCallback = nullptr;
@@ -983,7 +1011,7 @@ void GameManager::cleanup() {
 }
 
 /**
- * Ϸ״̬
+ * 设置游戏状态
  */
 void GameManager::setGameState(GameState state) {
     m_gameState = state;
@@ -4,56 +4,61 @@
 
 #include "cocos2d.h"
 #include "Player.h"
+#include "../Map/DistrictGrid.h"
+#include "../Utils/SlotMap.h"
 #include <vector>
 #include <map>
+#include <unordered_map>
 
-const int MAX_AI_PLAYERS = 6;   // AIϷģ
-const int MIN_AI_PLAYERS = 1;   // СAI
+const int MAX_AI_PLAYERS = 6;   // 最大AI玩家数量，基于游戏规模
+const int MIN_AI_PLAYERS = 1;   // 最小AI玩家数量
 
-// Ϸ״̬ö
+// 游戏状态枚举
 enum class GameState {
-    INITIALIZING,      // ʼ
-    PLAYING,           // 
-    PAUSED,            // ͣ
-    GAME_OVER          // Ϸ
+    INITIALIZING,      // 初始化中
+    PLAYING,           // 进行中
+    PAUSED,            // 暂停
+    GAME_OVER          // 游戏结束
 };
 
-// ʤö
+// 胜利类型枚举
 enum class VictoryType {
-    NONE,              // ʤ
-    SCIENCE,           // Ƽʤ
-    DOMINATION         // ʤ
+    NONE,              // 无胜利
+    SCIENCE,           // 科技胜利
+    DOMINATION         // 征服胜利
 };
 
-// Ϸýṹ
+// 游戏配置结构
 struct GameConfig {
-    int maxTurns = 500;               // غ
-    bool enableScienceVictory = true; // ÿƼʤ
-    bool enableDominationVictory = true; // ʤ
+    int maxTurns = 500;               // 最大回合数
+    bool enableScienceVictory = true; // 启用科技胜利
+    bool enableDominationVictory = true; // 启用征服胜利
+    bool quickAITurns = false;        // 快速AI回合：跳过AI单位动画，不等待动画播放
+    float aiAnimationSpeed = 1.0f;    // AI回合动画播放倍速
 
     GameConfig() {}
 };
 
-// Ϸͳƽṹ
+// 游戏统计结构
 struct GameStats {
-    int currentTurn = 1;           // ǰغ
-    int totalPlayers = 0;          // 
-    int activePlayers = 0;         // Ծ
-    VictoryType victoryType = VictoryType::NONE; // ʤ
-    int victoryPlayerId = -1;      // ʤID
+    int currentTurn = 1;           // 当前回合
+    int totalPlayers = 0;          // 总玩家数
+    int activePlayers = 0;         // 活跃玩家数
+    VictoryType victoryType = VictoryType::NONE; // 胜利类型
+    int victoryPlayerId = -1;      // 胜利玩家ID
 
     GameStats() {}
 };
 
-// ׶Ϣṹ
+// 首都信息结构
 struct CapitalInfo {
-    int ownerPlayerId;           // ԭʼID
-    int currentControllerId;     // ǰIDܱռ죩
-    BaseCity* capitalCity;       // ׶ָ
-    bool isCaptured;             // Ƿռ
+    int ownerPlayerId;           // 原始所有者玩家ID
+    int currentControllerId;     // 当前控制者玩家ID（可能被占领）
+    BaseCity* capitalCity;       // 首都城市指针
+    bool isCaptured;             // 是否被占领
 
     /**
-     * ĬϹ캯ʼֶΪĬֵ
+     * 默认构造函数，初始化所有字段为默认值
      */
     CapitalInfo()
         : ownerPlayerId(-1), currentControllerId(-1),
@@ -61,9 +66,9 @@ struct CapitalInfo {
     }
 
     /**
-     * 캯
-     * @param ownerId ID
-     * @param city ׶ж
+     * 参数化构造函数
+     * @param ownerId 所有者玩家ID
+     * @param city 首都城市对象
      */
     CapitalInfo(int ownerId, BaseCity* city)
         : ownerPlayerId(ownerId), currentControllerId(ownerId),
@@ -72,79 +77,85 @@ struct CapitalInfo {
 };
 
 /**
- * Ϸ
- * Ϸ״̬ҡغ̡ʤȺϷ߼
+ * 游戏管理器类
+ * 负责管理游戏状态、玩家、回合流程、胜利条件等核心游戏逻辑
  */
 class GameManager {
 public:
     /**
-     * ȡϷʵ
-     * @return Ϸָ
+     * 获取游戏管理器单例实例
+     * @return 游戏管理器单例指针
      */
     static GameManager* getInstance();
 
     /**
-     * ʼϷ
-     * @param config Ϸò
-     * @return ʼɹtrueʧܷfalse
+     * 初始化游戏
+     * @param config 游戏配置参数
+     * @return 初始化成功返回true，失败返回false
      */
     bool initialize(const GameConfig& config);
 
     /**
-     * ҵϷ
-     * @param player Ҷָ
+     * 添加玩家到游戏
+     * @param player 玩家对象指针
      */
     void addPlayer(Player* player);
 
     /**
-     * ϷƳ
-     * @param playerId ID
+     * 从游戏中移除玩家
+     * @param playerId 玩家ID
      */
     void removePlayer(int playerId);
 
     /**
-     * ȡָID
-     * @param playerId ID
-     * @return Ҷָ룬δҵnullptr
+     * 获取指定ID的玩家（按ID下标取句柄，O(1)）
+     * @param playerId 玩家ID
+     * @return 玩家对象指针，未找到返回nullptr
      */
     Player* getPlayer(int playerId) const;
 
     /**
-     * ȡб
-     * @return Ҷָб
+     * 玩家的代际句柄：玩家被移除后旧句柄查询返回 nullptr
+     */
+    EntityHandle getPlayerHandle(int playerId) const;
+    Player* getPlayerByHandle(EntityHandle handle) const;
+
+    /**
+     * 获取所有玩家列表
+     * @return 玩家对象指针列表
      */
     const std::vector<Player*>& getAllPlayers() const { return m_players; }
 
     /**
-     * ȡǰغϵ
-     * @return ǰҶָ
+     * 获取当前回合的玩家
+     * @return 当前玩家对象指针
      */
     Player* getCurrentPlayer() const;
 
     /**
-     * õǰ
-     * @param index 
+     * 设置当前玩家索引
+     * @param index 玩家索引
      */
     void setCurrentPlayer(int index);
 
     /**
-     * ȡһ
-     * @return һҶָ
+     * 获取下一个玩家
+     * @return 下一个玩家对象指针
      */
     Player* getNextPlayer() const;
 
     /**
-     * ǰһغϣлһ
+     * 结束当前玩家回合，切换到下一个玩家
      */
     void endTurn();
 
     /**
-     * ʼʼλ
-     * @param parentNode ڵʾ
-     * @param getStartHexForPlayerFunc ȡʼλú
-     * @param addToMapFunc ӵͼ
-     * @param checkCityFunc к
-     * @param getTerrainCostFunc ȡĺ
+     * 初始化玩家起始单位
+     * @param parentNode 父节点用于显示
+     * @param getStartHexForPlayerFunc 获取玩家起始位置函数
+     * @param addToMapFunc 添加到地图函数
+     * @param checkCityFunc 检查城市函数
+     * @param getTerrainCostFunc 获取地形消耗函数
      */
     void initializePlayerStartingUnits(cocos2d::Node* parentNode,
         std::function<Hex(int)> getStartHexForPlayerFunc,
@@ -153,191 +164,225 @@ public:
         std::function<int(Hex)> getTerrainCostFunc);
 
     /**
-     * ʤ
-     * @return ǰʤ
+     * 检查胜利条件
+     * @return 当前的胜利类型
      */
     VictoryType checkVictoryConditions();
 
     /**
-     * ȡϷ״̬
-     * @return ǰϷ״̬
+     * 获取游戏状态
+     * @return 当前游戏状态
      */
     GameState getGameState() const { return m_gameState; }
 
     /**
-     * ȡϷͳϢ
-     * @return Ϸͳƽṹ
+     * 获取游戏统计信息
+     * @return 游戏统计结构
      */
     const GameStats& getGameStats() const { return m_gameStats; }
 
     /**
-     * ȡϷ
-     * @return Ϸýṹ
+     * 获取游戏配置
+     * @return 游戏配置结构
      */
     const GameConfig& getGameConfig() const { return m_gameConfig; }
 
     /**
-     * Ϸ״̬лΪValueMap
-     * @return Ϸ״̬ValueMap
+     * 获取世界区域占用表
+     * @return 地块 -> 已建成区域
+     */
+    DistrictGrid& getDistrictGrid() { return m_districtGrid; }
+    const DistrictGrid& getDistrictGrid() const { return m_districtGrid; }
+
+    /**
+     * 城市注册表：城市创建时登记、析构时注销
+     * 按句柄或坐标查询均为 O(1)，城市被毁后旧句柄查询返回 nullptr
+     */
+    EntityHandle registerCity(BaseCity* city);
+    void unregisterCity(EntityHandle handle, const Hex& pos);
+    BaseCity* getCity(EntityHandle handle) const;
+    BaseCity* getCityAt(const Hex& pos) const;
+
+    /**
+     * 设置快速AI回合（可在游戏中随时切换）
+     * @param quick 为true时AI回合不播放动画，立即进入下一位玩家
+     */
+    void setQuickAITurns(bool quick) { m_gameConfig.quickAITurns = quick; }
+
+    /**
+     * 设置AI回合动画播放倍速
+     * @param speed 倍速，必须大于0
+     */
+    void setAIAnimationSpeed(float speed) { if (speed > 0.0f) m_gameConfig.aiAnimationSpeed = speed; }
+
+    /**
+     * 将游戏状态序列化为ValueMap
+     * @return 包含游戏状态的ValueMap
      */
     cocos2d::ValueMap toValueMap() const;
 
     /**
-     * ValueMapлϷ״̬
-     * @param data Ϸ״̬ValueMap
-     * @return лɹtrueʧܷfalse
+     * 从ValueMap反序列化游戏状态
+     * @param data 包含游戏状态的ValueMap
+     * @return 反序列化成功返回true，失败返回false
      */
     bool fromValueMap(const cocos2d::ValueMap& data);
 
     /**
-     * Ϸ״̬
+     * 调试输出游戏状态
      */
     void debugPrintGameState() const;
 
     /**
-     * Ƿд
-     * @param playerId ID
-     * @return д߷true򷵻false
+     * 检查玩家是否有待处理决策
+     * @param playerId 玩家ID
+     * @return 有待处理决策返回true，否则返回false
      */
     bool hasPendingDecisions(int playerId) const;
 
     /**
-     * ϷԴ
+     * 清理游戏管理器资源
      */
     void cleanup();
 
     /**
-     * Ϸ״̬
-     * @param state µϷ״̬
+     * 设置游戏状态
+     * @param state 新的游戏状态
      */
     void setGameState(GameState state);
 
     /**
-     * ûغϿʼص
-     * @param callback ص
+     * 设置回合开始回调
+     * @param callback 回调函数
      */
     void setOnTurnStartCallback(std::function<void(int)> callback) { m_onTurnStartCallback = callback; }
 
     /**
-     * ûغϽص
-     * @param callback ص
+     * 设置回合结束回调
+     * @param callback 回调函数
      */
     void setOnTurnEndCallback(std::function<void(int)> callback) { m_onTurnEndCallback = callback; }
 
     /**
-     * ʤص
-     * @param callback ص
+     * 设置胜利回调
+     * @param callback 回调函数
      */
     void setOnVictoryCallback(std::function<void(VictoryType, int)> callback) { m_onVictoryCallback = callback; }
 
 private:
     /**
-     * ˽й캯ģʽ
+     * 私有构造函数，单例模式
      */
     GameManager();
 
     /**
-     * 
+     * 析构函数
      */
     ~GameManager();
 
     /**
-     * ǰһ
+     * 前进到下一个玩家
      */
     void advanceToNextPlayer();
 
     /**
-     * ʼ»غ
+     * 开始新回合
      */
     void beginNewTurn();
 
     /**
-     * AIһغ
-     * @param aiPlayer AIҶ
+     * 处理AI玩家回合
+     * @param aiPlayer AI玩家对象
      */
     void processAITurn(Player* aiPlayer);
 
     /**
-     * Ƿ񱻻ܣĿǰΪʵ֣
+     * 检查玩家是否被击败（目前为空实现）
      */
     void checkDefeatedPlayers() {};
 
     /**
-     * ʤ
-     * @return ʤtrue򷵻false
+     * 检查征服胜利条件
+     * @return 满足征服胜利条件返回true，否则返回false
      */
     bool checkDominationVictory() const;
 
     /**
-     * ע׶Ϣ
-     * @param playerId ID
-     * @param capitalCity ׶
+     * 注册首都信息
+     * @param playerId 玩家ID
+     * @param capitalCity 首都城市
      */
     void registerCapital(int playerId, BaseCity* capitalCity);
 
     /**
-     * ׶Ȩ
-     * @param capitalOwnerId ׶ID
-     * @param newControllerId ¿ID
+     * 更新首都控制权
+     * @param capitalOwnerId 首都所有者ID
+     * @param newControllerId 新控制者ID
      */
     void updateCapitalControl(int capitalOwnerId, int newControllerId);
 
     /**
-     * ȡ׶Ϣӳ
-     * @return ׶Ϣӳ
+     * 获取首都信息映射表
+     * @return 首都信息映射表
      */
     const std::map<int, CapitalInfo>& getCapitalInfo() const { return m_capitalInfo; }
 
     /**
-     * ȡָҵ׶Ϣ
-     * @param playerId ID
-     * @return ׶Ϣṹ
+     * 获取指定玩家的首都信息
+     * @param playerId 玩家ID
+     * @return 首都信息结构
      */
     CapitalInfo getCapitalInfoForPlayer(int playerId) const;
 
     /**
-     * Ƽʤ
-     * @return Ƽʤtrue򷵻false
+     * 检查科技胜利条件
+     * @return 满足科技胜利条件返回true，否则返回false
      */
     bool checkScienceVictory() const;
 
     /**
-     * ֪ͨغϿʼ
-     * @param playerId ID
+     * 通知回合开始
+     * @param playerId 玩家ID
      */
     void notifyTurnStart(int playerId);
 
     /**
-     * ֪ͨغϽ
-     * @param playerId ID
+     * 通知回合结束
+     * @param playerId 玩家ID
      */
     void notifyTurnEnd(int playerId);
 
     /**
-     * ֪ͨʤ
-     * @param victoryType ʤ
-     * @param winnerPlayerId ʤID
+     * 通知胜利
+     * @param victoryType 胜利类型
+     * @param winnerPlayerId 胜利玩家ID
      */
     void notifyVictory(VictoryType victoryType, int winnerPlayerId);
 
     /**
-     * ӳٽغϣAIغϺȴ
+     * 延迟结束回合（用于AI回合后等待动画）
+     * @param delay 等待秒数，0表示下一帧立即结束
      */
-    void endTurnWithDelay();
+    void endTurnWithDelay(float delay = 0.0f);
 
 private:
-    static GameManager* s_instance;          // ʵ
-
-    GameState m_gameState;                   // Ϸ״̬
-    GameConfig m_gameConfig;                 // Ϸ
-    GameStats m_gameStats;                   // Ϸͳ
-    std::map<int, CapitalInfo> m_capitalInfo; // ID -> ׶Ϣ
-
-    std::vector<Player*> m_players;          // б
-    std::vector<int> m_playerOrder;          // ˳
-    int m_currentPlayerIndex = 0;            // ǰ
-
-    // ¼ص
+    static GameManager* s_instance;          // 单例实例
+
+    GameState m_gameState;                   // 游戏状态
+    GameConfig m_gameConfig;                 // 游戏配置
+    GameStats m_gameStats;                   // 游戏统计
+    std::map<int, CapitalInfo> m_capitalInfo; // 玩家ID -> 首都信息
+    DistrictGrid m_districtGrid;             // 区域占用表
+
+    std::vector<Player*> m_players;          // 玩家列表
+    SlotMap<Player*> m_playerSlots;          // 玩家注册表
+    std::vector<EntityHandle> m_playerHandleById; // 玩家ID -> 句柄
+    SlotMap<BaseCity*> m_citySlots;          // 城市注册表
+    std::unordered_map<Hex, EntityHandle> m_cityByHex; // 城市坐标 -> 句柄
+    std::vector<int> m_playerOrder;          // 玩家顺序
+    int m_currentPlayerIndex = 0;            // 当前玩家索引
+
+    // 事件回调函数
     std::function<void(int)> m_onTurnStartCallback;
     std::function<void(int)> m_onTurnEndCallback;
     std::function<void(VictoryType, int)> m_onVictoryCallback;
@@ -0,0 +1,35 @@
+// GameRules.h
+#ifndef __GAME_RULES_H__
+#define __GAME_RULES_H__
+
+#include "../Utils/Fixed.h"
+
+/**
+ * 规则公式：城市增长、战斗力、尤里卡/鼓舞进度
+ * 全部使用 Fixed 定点运算，不依赖 cocos，黄金值测试直接调用这些函数。
+ * （GameManager.h 中另有同名的 GameConfig 结构体，因此不放在 GameConfig 命名空间里）
+ */
+namespace GameRules {
+    const int BASE_GROWTH_FOOD = 15;      // 第一级人口增长所需食物
+    const int GROWTH_FOOD_PER_POP = 8;    // 每级人口线性增加的食物
+
+    // 计算人口 population 增长到下一级所需的食物：15 + 8(p-1) + (p-1)^1.5，四舍五入
+    inline int calculateGrowthFood(int population) {
+        Fixed n = Fixed::fromInt(population - 1);
+        return BASE_GROWTH_FOOD + GROWTH_FOOD_PER_POP * (population - 1) + (n * n.sqrt() + Fixed::percent(50)).toInt();
+    }
+
+    // 计算单位战斗力：攻击力 * (0.5 + 0.5 * 血量比例)，至少为 1
+    inline int calculateCombatPower(int baseAttack, int currentHp, int maxHp) {
+        // 0.5 + 0.5 * cur / max == (max + cur) / (2 * max)，整体按有理数一次取整
+        int power = Fixed::ratio(maxHp + currentHp, 2 * maxHp).mulInt(baseAttack);
+        return power > 1 ? power : 1;
+    }
+
+    // 计算尤里卡 / 鼓舞提供的研究进度：默认为成本的一半，按加成相对默认 50% 的比例缩放
+    inline int calculateBoostProgress(int cost, Fixed boost) {
+        return (boost / Fixed::percent(50)).mulInt(cost / 2);
+    }
+}
+
+#endif // __GAME_RULES_H__
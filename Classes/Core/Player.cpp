@@ -1,18 +1,21 @@
 #include "Player.h"
 #include "../City/BaseCity.h"
 #include "../Units/Base/AbstractUnit.h"
+#include "../Units/Base/UnitStateTable.h"
 #include "GameConfig.h"
 #include "Civilizations/CivChina.h"
 #include "Civilizations/CivGermany.h"
 #include "Civilizations/CivRussia.h"
 #include "Scene/GameScene.h"
 #include "../Units/Civilian/Settler.h"
+#include "../Utils/ScopeProfiler.h"
+#include "../Utils/GameLog.h"
 
 USING_NS_CC;
 
 /**
- * 캯 - ʼҶ
- * PolicyManagerҪCultureTreeָΪ
+ * 构造函数 - 初始化玩家对象
+ * PolicyManager需要CultureTree指针作为参数
  */
 Player::Player()
     : m_policyManager(&m_cultureTree)
@@ -22,7 +25,7 @@ Player::Player()
 }
 
 /**
- * Ҿ̬
+ * 创建玩家静态方法
  */
 Player* Player::create(int playerId, CivilizationType civType) {
     Player* player = new Player();
@@ -35,7 +38,7 @@ Player* Player::create(int playerId, CivilizationType civType) {
 }
 
 /**
- * ʼ
+ * 初始化玩家
  */
 bool Player::init(int playerId, CivilizationType civType) {
     m_playerId = playerId;
@@ -43,44 +46,42 @@ bool Player::init(int playerId, CivilizationType civType) {
     m_state = PlayerState::ACTIVE;
     m_isHuman = true;
 
-    // ɫ
+    // 设置玩家颜色
     static cocos2d::Color3B playerColors[] = {
-        cocos2d::Color3B(255, 0, 0),     // ɫ
-        cocos2d::Color3B(0, 0, 255),     // ɫ
-        cocos2d::Color3B(0, 255, 0),     // ɫ
-        cocos2d::Color3B(255, 255, 0),   // ɫ
-        cocos2d::Color3B(255, 0, 255),   // ɫ
-        cocos2d::Color3B(0, 255, 255)    // ɫ
+        cocos2d::Color3B(255, 0, 0),     // 红色
+        cocos2d::Color3B(0, 0, 255),     // 蓝色
+        cocos2d::Color3B(0, 255, 0),     // 绿色
+        cocos2d::Color3B(255, 255, 0),   // 黄色
+        cocos2d::Color3B(255, 0, 255),   // 紫色
+        cocos2d::Color3B(0, 255, 255)    // 青色
     };
 
     int colorIndex = playerId % (sizeof(playerColors) / sizeof(playerColors[0]));
     m_color = playerColors[colorIndex];
 
-    // 
+    // 创建文明
     createCivilization(civType);
 
-    // ʼԴ
+    // 初始化资源
     m_gold = GameConfig::STARTING_GOLD;
     m_scienceStock = 0;
     m_cultureStock = 0;
     m_amenities = GameConfig::STARTING_AMENITIES;
 
-    // ʼϵͳ
-    m_techTree.initializeTechTree();
-    m_cultureTree.initializeCultureTree();
+    // 注册事件监听器（只处理自己科技树/文化树发出的事件）
+    subscribeDevelopmentEvents();
 
-    // ע¼
-    m_techTree.addEventListener(this);
-    m_cultureTree.addEventListener(this);
+    // 无前置条件的生产项目
+    unlockPrograms(ProductionProgram::getInitialPrograms());
 
-    // ߹ڹ캯гʼ
+    // 政策管理器已在构造函数中初始化
     m_turnStats = TurnStats();
 
     CCLOG("Player %d (%s) initialized with civilization %s",
         m_playerId, m_playerName.c_str(),
         m_civilization ? typeid(*m_civilization).name() : "Unknown");
 
-    // ʼص
+    // 初始化回调函数
     m_getStartHexFunc = nullptr;
     m_addToMapFunc = nullptr;
     m_checkCityFunc = nullptr;
@@ -90,21 +91,20 @@ bool Player::init(int playerId, CivilizationType civType) {
 }
 
 /**
- * 
+ * 析构函数
  */
 Player::~Player() {
     CCLOG("Player %d destructor called", m_playerId);
 
-    // Ƴ¼
-    m_techTree.removeEventListener(this);
-    m_cultureTree.removeEventListener(this);
+    // 移除事件监听器
+    unsubscribeDevelopmentEvents();
 
-    // Դ
+    // 清理资源
     cleanupResources();
 }
 
 /**
- * 
+ * 创建文明对象
  */
 void Player::createCivilization(CivilizationType civType) {
     switch (civType) {
@@ -133,7 +133,7 @@ void Player::createCivilization(CivilizationType civType) {
 }
 
 /**
- * Դ
+ * 清理资源
  */
 void Player::cleanupResources() {
     if (m_civilization) {
@@ -141,38 +141,58 @@ void Player::cleanupResources() {
         m_civilization = nullptr;
     }
 
-    // 
+    // 清理城市
     for (auto city : m_cities) {
+        city->setYieldOwner(nullptr);
         city->release();
     }
     m_cities.clear();
+    m_dirtyYieldCities.clear();
+    m_cityYieldTotal = Yield{};
 
-    // λ
+    // 清理单位
     for (auto unit : m_units) {
         if (unit) {
+            UnitStateTable::getInstance()->setFlag(unit->getHandle(), UnitStateTable::FLAG_IN_PLAY, false);
             unit->release();
         }
     }
     m_units.clear();
+
+    // 清理生产项目原型
+    for (auto* program : unlockedUnits) ProductionProgram::recycle(program);
+    for (auto* program : unlockedDistricts) ProductionProgram::recycle(program);
+    for (auto* program : unlockedBuildings) ProductionProgram::recycle(program);
+    unlockedUnits.clear();
+    unlockedDistricts.clear();
+    unlockedBuildings.clear();
+    m_unlockedProgramIds.clear();
 }
 
 /**
- * غϿʼ
+ * 回合开始处理
  */
 void Player::onTurnBegin() {
+    PROFILE_SCOPE("Player::onTurnBegin");
     m_turnStats = TurnStats();
 
-    // µλ״̬
+    // 更新单位状态：移动力与回血在状态表中一次线性结算，再刷新表现
+    FrameArenaScope scratch;
+    FrameVector<std::pair<AbstractUnit*, int>> healed;
+    UnitStateTable::getInstance()->beginTurn(m_playerId, m_checkCityFunc, healed);
     for (auto unit : m_units) {
         if (unit == nullptr)
         {
             continue;
         }
-        unit->onTurnStart();
+        unit->updateVisualColor();
+    }
+    for (const auto& entry : healed) {
+        entry.first->playHealEffect(entry.second);
     }
 
     if (m_cities.empty()) {
-        CCLOG("Player %d has no cities!", m_playerId);
+        GLOG_VERBOSE(PLAYER, "Player %d has no cities!", m_playerId);
         int maintenance = calculateMaintenanceCost();
         m_gold -= maintenance;
         if (m_gold < 0) m_gold = 0;
@@ -180,93 +200,113 @@ void Player::onTurnBegin() {
         return;
     }
 
-    // 1. ռгв
+    // 1. 收集所有城市产出
     Yield totalYield = calculateTotalYield();
 
-    // ¼
+    // 记录基础产出
     m_turnStats.goldGenerated = totalYield.goldYield;
     m_turnStats.scienceGenerated = totalYield.scienceYield;
     m_turnStats.cultureGenerated = totalYield.cultureYield;
 
-    // 2. ӦԼӳ
-    totalYield.scienceYield = applyScienceBonus(totalYield.scienceYield);
-    totalYield.cultureYield = applyCultureBonus(totalYield.cultureYield);
-
-    if (m_civilization) {
-        totalYield.productionYield = static_cast<int>(totalYield.productionYield * m_civilization->getProductionBonus());
-        totalYield.goldYield = static_cast<int>(totalYield.goldYield * m_civilization->getGoldBonus());
-    }
-
-    // 3. Ӧ߿ӳ
-    float prodMod = m_policyManager.getYieldModifier(EffectType::MODIFIER_PRODUCTION);
-    float goldMod = m_policyManager.getYieldModifier(EffectType::MODIFIER_GOLD);
-    float sciMod = m_policyManager.getYieldModifier(EffectType::MODIFIER_SCIENCE);
-    float cultMod = m_policyManager.getYieldModifier(EffectType::MODIFIER_CULTURE);
+    // 2. 应用文明特性与政策卡加成
+    totalYield = applyYieldBonuses(totalYield);
 
-    // Ӧðٷֱȼӳ (base * (1 + mod/100))
-    totalYield.productionYield = static_cast<int>(totalYield.productionYield * (1.0f + prodMod / 100.0f));
-    totalYield.goldYield = static_cast<int>(totalYield.goldYield * (1.0f + goldMod / 100.0f));
-    totalYield.scienceYield = static_cast<int>(totalYield.scienceYield * (1.0f + sciMod / 100.0f));
-    totalYield.cultureYield = static_cast<int>(totalYield.cultureYield * (1.0f + cultMod / 100.0f));
-
-    // 4. Դ
+    // 3. 更新资源库存
     m_gold += totalYield.goldYield;
     addScience(totalYield.scienceYield);
     addCulture(totalYield.cultureYield);
 
-    // 5. о
+    // 4. 更新研究进度
     updateResearchProgress();
 
-    // 6. ά
+    // 5. 计算维护费
     int maintenance = calculateMaintenanceCost();
     m_gold -= maintenance;
     if (m_gold < 0) {
         m_gold = 0;
-        CCLOG("Player %d has negative gold after maintenance!", m_playerId);
+        GLOG_WARNING(PLAYER, "Player %d has negative gold after maintenance!", m_playerId);
     }
 
-    // 7. ¼
+    // 6. 发送事件
     dispatchResourceChangedEvent();
 
-    CCLOG("Player %d turn begin: Gold=%d(+%d-%d), Science=%d(+%d), Culture=%d(+%d)",
+    GLOG_VERBOSE(PLAYER, "Player %d turn begin: Gold=%d(+%d-%d), Science=%d(+%d), Culture=%d(+%d)",
         m_playerId, m_gold, totalYield.goldYield, maintenance,
         m_scienceStock, totalYield.scienceYield,
         m_cultureStock, totalYield.cultureYield);
 }
 
 /**
- * ַԴ仯¼
+ * 分发资源变化事件
  */
 void Player::dispatchResourceChangedEvent() {
-    ValueMap data;
-    data["player_id"] = m_playerId;
-    data["gold"] = m_gold;
-    data["gold_per_turn"] = calculateNetGoldPerTurn();
-    data["science_per_turn"] = getSciencePerTurn();
-    data["culture_per_turn"] = getCulturePerTurn();
-    data["science_stock"] = m_scienceStock;
-    data["culture_stock"] = m_cultureStock;
-
-    Director::getInstance()->getEventDispatcher()->dispatchCustomEvent(
-        "player_resource_changed", &data
-    );
-
-    Director::getInstance()->getEventDispatcher()->dispatchCustomEvent(
-        "hud_update_resources"
-    );
+    PlayerResourceEvent event;
+    event.playerId = m_playerId;
+    event.gold = m_gold;
+    event.goldPerTurn = calculateNetGoldPerTurn();
+    event.sciencePerTurn = getSciencePerTurn();
+    event.culturePerTurn = getCulturePerTurn();
+    event.scienceStock = m_scienceStock;
+    event.cultureStock = m_cultureStock;
+
+    // 同一帧内多次变化只派发最新快照
+    EventBus::getInstance()->publishCoalesced(m_playerId, event);
 }
 
 /**
- * о
+ * 订阅科技/文化事件
+ */
+void Player::subscribeDevelopmentEvents() {
+    EventBus* bus = EventBus::getInstance();
+
+    m_techActivatedListener = bus->subscribe<TechActivatedEvent>([this](const TechActivatedEvent& event) {
+        if (event.tree != &m_techTree) return;
+        const TechNode* node = m_techTree.getTechInfo(event.techId);
+        if (node) onTechActivated(event.techId, node->name, node->effectDescription);
+        });
+
+    m_eurekaListener = bus->subscribe<EurekaTriggeredEvent>([this](const EurekaTriggeredEvent& event) {
+        if (event.tree != &m_techTree) return;
+        const TechNode* node = m_techTree.getTechInfo(event.techId);
+        if (node) onEurekaTriggered(event.techId, node->name);
+        });
+
+    m_cultureUnlockedListener = bus->subscribe<CultureUnlockedEvent>([this](const CultureUnlockedEvent& event) {
+        if (event.tree != &m_cultureTree) return;
+        const CultureNode* node = m_cultureTree.getCultureInfo(event.cultureId);
+        if (node) onCultureUnlocked(event.cultureId, node->name, node->effectDescription);
+        });
+
+    m_inspirationListener = bus->subscribe<InspirationTriggeredEvent>([this](const InspirationTriggeredEvent& event) {
+        if (event.tree != &m_cultureTree) return;
+        const CultureNode* node = m_cultureTree.getCultureInfo(event.cultureId);
+        if (node) onInspirationTriggered(event.cultureId, node->name);
+        });
+}
+
+/**
+ * 注销科技/文化事件
+ */
+void Player::unsubscribeDevelopmentEvents() {
+    EventBus* bus = EventBus::getInstance();
+    bus->unsubscribe<TechActivatedEvent>(m_techActivatedListener);
+    bus->unsubscribe<EurekaTriggeredEvent>(m_eurekaListener);
+    bus->unsubscribe<CultureUnlockedEvent>(m_cultureUnlockedListener);
+    bus->unsubscribe<InspirationTriggeredEvent>(m_inspirationListener);
+    m_techActivatedListener = m_eurekaListener = m_cultureUnlockedListener = m_inspirationListener = 0;
+}
+
+/**
+ * 更新研究进度
  */
 void Player::updateResearchProgress() {
-    // Ƽо
+    // 科技研究
     int currentTechId = m_techTree.getCurrentResearch();
     if (currentTechId != -1 && m_scienceStock > 0) {
         const TechNode* techNode = m_techTree.getTechInfo(currentTechId);
-        if (techNode && !techNode->activated) {
+        if (techNode && !m_techTree.isActivated(currentTechId)) {
             int scienceToUse = m_scienceStock;
-            int remaining = techNode->cost - techNode->progress;
+            int remaining = techNode->cost - m_techTree.getTechProgress(currentTechId);
             if (scienceToUse > remaining) scienceToUse = remaining;
 
             if (scienceToUse > 0) {
@@ -276,20 +316,20 @@ void Player::updateResearchProgress() {
         }
     }
 
-    // Ļо
+    // 文化研究
     int currentCivicId = m_cultureTree.getCurrentResearch();
     if (currentCivicId != -1 && m_cultureStock > 0) {
         const CultureNode* cultureNode = m_cultureTree.getCultureInfo(currentCivicId);
-        if (cultureNode && !cultureNode->activated) {
+        if (cultureNode && !m_cultureTree.isActivated(currentCivicId)) {
             int cultureToUse = m_cultureStock;
-            int remaining = cultureNode->cost - cultureNode->progress;
+            int remaining = cultureNode->cost - m_cultureTree.getCultureProgress(currentCivicId);
             if (cultureToUse > remaining) cultureToUse = remaining;
 
             if (cultureToUse > 0) {
                 m_cultureTree.updateProgress(cultureToUse);
                 m_cultureStock -= cultureToUse;
 
-                // Ļʱ߲λ
+                // 文化完成时更新政策槽位
                 if (cultureToUse >= remaining) {
                     updatePolicySlots();
                 }
@@ -299,17 +339,17 @@ void Player::updateResearchProgress() {
 }
 
 /**
- * غϽ
+ * 回合结束处理
  */
 void Player::onTurnEnd() {
     for (auto city : m_cities) {
         city->onTurnEnd();
     }
-    CCLOG("Player %d turn end - Final Gold: %d", m_playerId, m_gold);
+    GLOG_VERBOSE(PLAYER, "Player %d turn end - Final Gold: %d", m_playerId, m_gold);
 }
 
 /**
- * ȡ׶
+ * 获取首都
  */
 BaseCity* Player::getCapital() const {
     if (m_cities.empty()) return nullptr;
@@ -317,20 +357,66 @@ BaseCity* Player::getCapital() const {
 }
 
 /**
- * геܲ
+ * 计算所有城市的总产出
  */
 Yield Player::calculateTotalYield() const {
-    Yield total{};
-    for (auto city : m_cities) {
-        if (city) {
-            total = total + city->cityYield;
-        }
+    refreshYieldCache();
+    return m_cityYieldTotal;
+}
+
+/**
+ * 刷新产出缓存
+ * 只有被标记为失效的城市会重新计算，变化量通过 onCityYieldChanged 累加到总产出
+ */
+void Player::refreshYieldCache() const {
+    for (size_t i = 0; i < m_dirtyYieldCities.size(); ++i) {
+        m_dirtyYieldCities[i]->updateYield();
+    }
+    m_dirtyYieldCities.clear();
+}
+
+/**
+ * 城市产出失效通知
+ */
+void Player::onCityYieldDirty(BaseCity* city) {
+    m_dirtyYieldCities.push_back(city);
+}
+
+/**
+ * 城市产出变化量通知
+ */
+void Player::onCityYieldChanged(const Yield& delta) {
+    m_cityYieldTotal += delta;
+}
+
+/**
+ * 应用文明特性与政策卡加成
+ */
+Yield Player::applyYieldBonuses(const Yield& base) const {
+    Yield yield = base;
+    // 文明特性加成
+    yield.scienceYield = applyScienceBonus(yield.scienceYield);
+    yield.cultureYield = applyCultureBonus(yield.cultureYield);
+
+    if (m_civilization) {
+        YieldScale civScale;
+        civScale.production = m_civilization->getProductionBonus();
+        civScale.gold = m_civilization->getGoldBonus();
+        yield = yield.scaled(civScale);
     }
-    return total;
+
+    // 政策卡加成（查表），百分比加成 (base * (1 + mod/100)) 按整个向量一次完成
+    YieldScale policyScale;
+    policyScale.production = Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_PRODUCTION));
+    policyScale.gold = Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_GOLD));
+    policyScale.science = Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_SCIENCE));
+    policyScale.culture = Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_CULTURE));
+    yield = yield.scaled(policyScale);
+    return yield;
 }
 
 /**
- * 
+ * 计算基础产出
  */
 Yield Player::calculateBaseYield() const {
     Yield base{};
@@ -347,11 +433,22 @@ Yield Player::calculateBaseYield() const {
 }
 
 /**
- * ӳ
+ * 添加城市
  */
 void Player::addCity(BaseCity* city) {
     if (city) {
         m_cities.push_back(city);
+
+        // 先在未绑定玩家时刷新一次，再把完整产出计入总量，之后只累加变化量
+        city->updateYield();
+        city->setYieldOwner(this);
+        m_cityYieldTotal += city->getCityYield();
+
+        // 城市易主（被占领）时同步所属玩家与区域占用表
+        if (city->getOwnerPlayer() != m_playerId) {
+            city->setOwnerPlayer(m_playerId);
+        }
+
         city->updatePanel();
         city->retain();
         if (m_cities.size() == 1) {
@@ -361,12 +458,20 @@ void Player::addCity(BaseCity* city) {
 }
 
 /**
- * Ƴ
+ * 移除城市
  */
 void Player::removeCity(BaseCity* city) {
     auto it = std::find(m_cities.begin(), m_cities.end(), city);
     if (it != m_cities.end()) {
         bool wasCapital = (city == getCapital());
+
+        // 从产出缓存中扣除
+        city->setYieldOwner(nullptr);
+        m_cityYieldTotal -= city->getCityYield();
+        m_dirtyYieldCities.erase(
+            std::remove(m_dirtyYieldCities.begin(), m_dirtyYieldCities.end(), city),
+            m_dirtyYieldCities.end());
+
         (*it)->release();
         m_cities.erase(it);
         if (wasCapital) removeControlledCapital(m_playerId);
@@ -376,7 +481,7 @@ void Player::removeCity(BaseCity* city) {
 }
 
 /**
- * Ƿ׶
+ * 检查城市是否是首都
  */
 bool Player::isCapital(BaseCity* city) const {
     if (m_cities.empty() || !city) return false;
@@ -384,7 +489,7 @@ bool Player::isCapital(BaseCity* city) const {
 }
 
 /**
- * ӿƵ׶ID
+ * 添加控制的玩家首都ID
  */
 void Player::addControlledCapital(int playerId) {
     auto it = std::find(m_vicprogress.controlledCapitals.begin(), m_vicprogress.controlledCapitals.end(), playerId);
@@ -394,7 +499,7 @@ void Player::addControlledCapital(int playerId) {
 }
 
 /**
- * ƳƵ׶ID
+ * 移除控制的玩家首都ID
  */
 void Player::removeControlledCapital(int playerId) {
     auto it = std::find(m_vicprogress.controlledCapitals.begin(), m_vicprogress.controlledCapitals.end(), playerId);
@@ -404,14 +509,7 @@ void Player::removeControlledCapital(int playerId) {
 }
 
 /**
- * ȡƵ׶б
- */
-std::vector<int> Player::getControlledCapitals() const {
-    return m_vicprogress.controlledCapitals;
-}
-
-/**
- * Ƿָҵ׶
+ * 检查是否控制指定玩家的首都
  */
 bool Player::controlsCapitalOf(int playerId) const {
     auto it = std::find(m_vicprogress.controlledCapitals.begin(), m_vicprogress.controlledCapitals.end(), playerId);
@@ -419,27 +517,41 @@ bool Player::controlsCapitalOf(int playerId) const {
 }
 
 /**
- * ӵλ
+ * 添加单位
  */
 void Player::addUnit(AbstractUnit* unit) {
     if (unit) {
+        UnitStateTable* table = UnitStateTable::getInstance();
+        table->listIndex(unit->getHandle()) = (int)m_units.size();
+        table->setFlag(unit->getHandle(), UnitStateTable::FLAG_IN_PLAY, true);
         m_units.push_back(unit);
         unit->retain();
     }
 }
 
 /**
- * Ƴλ
+ * 移除单位
  */
 void Player::removeUnit(AbstractUnit* unit) {
-    auto it = std::find(m_units.begin(), m_units.end(), unit);
-    if (it != m_units.end()) {
-        m_units.erase(it);
-    }
+    if (!unit) return;
+
+    // 状态表记录了单位在列表中的下标：与末尾交换后弹出，O(1)
+    UnitStateTable* table = UnitStateTable::getInstance();
+    int index = table->listIndex(unit->getHandle());
+    if (index < 0 || index >= (int)m_units.size() || m_units[index] != unit)
+        return;
+
+    AbstractUnit* last = m_units.back();
+    m_units[index] = last;
+    table->listIndex(last->getHandle()) = index;
+    m_units.pop_back();
+
+    table->listIndex(unit->getHandle()) = -1;
+    table->setFlag(unit->getHandle(), UnitStateTable::FLAG_IN_PLAY, false);
 }
 
 /**
- * õͼص
+ * 设置地图回调函数
  */
 void Player::setMapCallbacks(std::function<Hex()> getStartHexFunc,
     std::function<void(AbstractUnit*)> addToMapFunc,
@@ -454,19 +566,19 @@ void Player::setMapCallbacks(std::function<Hex()> getStartHexFunc,
 }
 
 /**
- * ʼߵλ
+ * 创建起始开拓者单位
  */
 AbstractUnit* Player::createStartingSettler(cocos2d::Node* parentNode,
     std::function<Hex()> getStartHexFunc,
     std::function<void(AbstractUnit*)> addToMapFunc,
     std::function<bool(Hex)> checkCityFunc) {
 
-    // »ص
+    // 更新回调函数
     if (getStartHexFunc) m_getStartHexFunc = getStartHexFunc;
     if (addToMapFunc) m_addToMapFunc = addToMapFunc;
     if (checkCityFunc) m_checkCityFunc = checkCityFunc;
 
-    // ҪĻص
+    // 检查必要的回调函数
     if (!m_getStartHexFunc) {
         CCLOG("Error: Player %d cannot create settler - no start hex function", m_playerId);
         return nullptr;
@@ -477,13 +589,13 @@ AbstractUnit* Player::createStartingSettler(cocos2d::Node* parentNode,
         return nullptr;
     }
 
-    // ȡʼλ
+    // 获取起始位置
     Hex startHex = m_getStartHexFunc();
 
-    // Ѱ½
+    // 寻找最近的陆地
     int safeGuard = 0;
     while (m_getTerrainCostFunc && m_getTerrainCostFunc(startHex) < 0 && safeGuard < 500) {
-        startHex.q++; // ƶ
+        startHex.q++; // 向右移动
 
         if (safeGuard % 20 == 0) {
             startHex.q -= 20;
@@ -494,19 +606,14 @@ AbstractUnit* Player::createStartingSettler(cocos2d::Node* parentNode,
 
     CCLOG("Player %d starting position: Hex(%d, %d)", m_playerId, startHex.q, startHex.r);
 
-    // ߵλ
+    // 创建开拓者单位
     auto unit = Settler::create();
     if (unit && unit->initUnit(m_playerId, startHex)) {
         unit->autorelease();
 
-        // óмص
-        if (m_checkCityFunc) {
-            unit->onCheckCity = m_checkCityFunc;
-        }
-
         m_startingSettler = unit;
 
-        // ͨصӵͼ
+        // 通过回调函数添加到地图
         m_addToMapFunc(unit);
 
         CCLOG("Player %d created starting settler at (%d, %d)",
@@ -520,131 +627,45 @@ AbstractUnit* Player::createStartingSettler(cocos2d::Node* parentNode,
 }
 
 /**
- * Ƽص
+ * 科技激活回调
  */
 void Player::onTechActivated(int techId, const std::string& techName, const std::string& effect) {
-    CCLOG("Player %d: Tech activated - %s (ID: %d)", m_playerId, techName.c_str(), techId);
+    GLOG_INFO(PLAYER, "Player %d: Tech activated - %s (ID: %d)", m_playerId, techName.c_str(), techId);
     if (techId == 22) m_vicprogress.hasSatelliteTech = true;
+    unlockPrograms(ProductionProgram::getProgramsUnlockedByTech(techId));
 }
 
 /**
- * оȻص
- */
-void Player::onResearchProgress(int techId, int currentProgress, int totalCost) {
-    // UI¼
-}
-
-/**
- * ￨ص
+ * 尤里卡触发回调
  */
 void Player::onEurekaTriggered(int techId, const std::string& techName) {
     applyEurekaBonus(techId);
 }
 
 /**
- * ½Ŀ
+ * 解锁生产项目：为每个新项目创建一份原型，供生产面板读取
  */
-void Player::updateUnlockedProduction()
+void Player::unlockPrograms(const std::vector<int>& programIds)
 {
-    // 1. ͷԭڴ
-    for (auto* building : unlockedBuildings) delete building;
-    for (auto* district : unlockedDistricts) delete district;
-    for (auto* unit : unlockedUnits) delete unit;
+    for (int id : programIds) {
+        if (!m_unlockedProgramIds.insert(id).second) continue;
 
-    // 2. б
-    unlockedBuildings.clear();
-    unlockedDistricts.clear();
-    unlockedUnits.clear();
+        auto it = ProductionProgram::programs.find(id);
+        if (it == ProductionProgram::programs.end()) continue;
 
-    // 3. Ƿѽ
-    auto addIfNotExists = [&](ProductionProgram* newProgram) {
-        auto& targetList = (newProgram->getType() == ProductionProgram::ProductionType::UNIT) ? unlockedUnits :
-            (newProgram->getType() == ProductionProgram::ProductionType::DISTRICT) ? unlockedDistricts :
-            unlockedBuildings;
+        ProductionProgram::ProductionType type = ProductionProgram::typeOfProgram(id);
+        bool canPurchase = type != ProductionProgram::ProductionType::DISTRICT;
+        auto* program = ProductionProgram::acquire(type, it->second.name, Hex(), 0, canPurchase, 0);
 
-        for (auto* existing : targetList) {
-            if (existing->getName() == newProgram->getName()) {
-                delete newProgram;  // ڴй©
-                return false;
-            }
-        }
-        targetList.push_back(newProgram);
-        return true;
-        };
-
-    // 4. 
-    auto processProgram = [&](const auto& programPair) {
-        ProductionProgram::ProductionType type;
-        int id = programPair.first;
-        ProductionProgram* newProgram = nullptr;
-        if (id < 100) {
-            type = ProductionProgram::ProductionType::UNIT;
-            newProgram = new ProductionProgram(
-                type,
-                programPair.second.name,
-                Hex(), 0, true, 0
-            );
-        }
-        else if (id % 10 == 0) {
-            type = ProductionProgram::ProductionType::DISTRICT;
-            newProgram = new ProductionProgram(
-                type,
-                programPair.second.name,
-                Hex(), 0, false, 0
-            );
-        }
-        else {
-            type = ProductionProgram::ProductionType::BUILDING;
-            newProgram = new ProductionProgram(
-                type,
-                programPair.second.name,
-                Hex(), 0, true, 0
-            );
-        }
-
-        addIfNotExists(newProgram);
-        };
-
-    // 5. ʼĿ
-    auto initialSearch = ProductionProgram::findProgram(-1, -1);
-    for (auto program : initialSearch) {
-        processProgram(program);
-    }
-
-    // 6. ƼӦĿ
-    auto activatedTech = m_techTree.getActivatedTechList();
-    for (int tech : activatedTech) {
-        auto search = ProductionProgram::findProgram(tech, -1);
-        for (auto program : search) {
-            processProgram(program);
-        }
-    }
-
-    // 7. ĻӦĿ
-    auto activatedCivic = m_cultureTree.getActivatedCultureList();
-    for (int civic : activatedCivic) {
-        auto search = ProductionProgram::findProgram(-1, civic);
-        for (auto program : search) {
-            processProgram(program);
-        }
+        auto& targetList = (type == ProductionProgram::ProductionType::UNIT) ? unlockedUnits :
+            (type == ProductionProgram::ProductionType::DISTRICT) ? unlockedDistricts :
+            unlockedBuildings;
+        targetList.push_back(program);
     }
 }
 
 /**
- * ȡĿ
- */
-void Player::getUnlockedProduction(std::vector<ProductionProgram*>& Units,
-    std::vector<ProductionProgram*>& Districts,
-    std::vector<ProductionProgram*>& Buildings)
-{
-    updateUnlockedProduction();
-    Units = unlockedUnits;
-    Districts = unlockedDistricts;
-    Buildings = unlockedBuildings;
-}
-
-/**
- * ӿƼֵ
+ * 添加科技值
  */
 void Player::addScience(int amount) {
     if (amount > 0) {
@@ -654,52 +675,41 @@ void Player::addScience(int amount) {
 }
 
 /**
- * ȡÿغϿƼ
+ * 获取每回合科技产出
  */
 int Player::getSciencePerTurn() const {
-    int total = 0;
-    for (auto city : m_cities) {
-        if (city) total += city->cityYield.scienceYield;
-    }
-    // ۼӰٷֱȼӳɺֵ
-    float mod = m_policyManager.getYieldModifier(EffectType::MODIFIER_SCIENCE);
-    total = static_cast<int>(total * (1.0f + mod / 100.0f));
-    return total;
+    refreshYieldCache();
+    // 累加百分比加成后的总值
+    return Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_SCIENCE)).mulInt(m_cityYieldTotal.scienceYield);
 }
 
 /**
- * õǰоƼ
+ * 设置当前研究科技
  */
 void Player::setCurrentResearch(int techId) {
     m_techTree.setCurrentResearch(techId);
 }
 
 /**
- * Ļص
+ * 文化解锁回调
  */
 void Player::onCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect) {
-    CCLOG("Player %d: Culture unlocked - %s", m_playerId, cultureName.c_str());
+    GLOG_INFO(PLAYER, "Player %d: Culture unlocked - %s", m_playerId, cultureName.c_str());
 
-    // PolicyManagerԶ߼
+    // PolicyManager会自动处理解锁逻辑
     updatePolicySlots();
+    unlockPrograms(ProductionProgram::getProgramsUnlockedByCivic(cultureId));
 }
 
 /**
- * ĻȻص
- */
-void Player::onCultureProgress(int cultureId, int currentProgress, int totalCost) {
-    // UI
-}
-
-/**
- * дص
+ * 灵感触发回调
  */
 void Player::onInspirationTriggered(int cultureId, const std::string& cultureName) {
     applyInspirationBonus(cultureId);
 }
 
 /**
- * Ļֵ
+ * 添加文化值
  */
 void Player::addCulture(int amount) {
     if (amount > 0) {
@@ -709,64 +719,57 @@ void Player::addCulture(int amount) {
 }
 
 /**
- * ȡÿغĻ
+ * 获取每回合文化产出
  */
 int Player::getCulturePerTurn() const {
-    int total = 0;
-    for (auto city : m_cities) {
-        if (city) total += city->cityYield.cultureYield;
-    }
-    float mod = m_policyManager.getYieldModifier(EffectType::MODIFIER_CULTURE);
-    total = static_cast<int>(total * (1.0f + mod / 100.0f));
-    return total;
+    refreshYieldCache();
+    return Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_CULTURE)).mulInt(m_cityYieldTotal.cultureYield);
 }
 
 /**
- * õǰо
+ * 设置当前研究市政
  */
 void Player::setCurrentCivic(int cultureId) {
     m_cultureTree.setCurrentResearch(cultureId);
 }
 
 /**
- * ߲λ
+ * 更新政策槽位
  */
 void Player::updatePolicySlots() {
     m_policyManager.updateGovernmentSlots();
 
-    // ȡǰ־
+    // 获取当前政体配置用于日志
     auto config = m_policyManager.getCurrentGovConfig();
-    CCLOG("Player %d policy slots updated: Mil=%d, Eco=%d, Wild=%d",
+    GLOG_VERBOSE(PLAYER, "Player %d policy slots updated: Mil=%d, Eco=%d, Wild=%d",
         m_playerId, config.militarySlots, config.economicSlots, config.wildcardSlots);
 }
 
 /**
- * ά
+ * 计算维护费用
  */
 int Player::calculateMaintenanceCost() const {
     int totalCost = 0;
-    totalCost += m_units.size(); // ά
+    totalCost += m_units.size(); // 基础维护费
 
-    // Ӧ߿
+    // 应用政策卡减免
     return totalCost;
 }
 
 /**
- * ÿغϾ
+ * 计算每回合净金币收入
  */
 int Player::calculateNetGoldPerTurn() const {
-    int income = 0;
-    for (auto city : m_cities) if (city) income += city->cityYield.goldYield;
+    refreshYieldCache();
 
-    // ӦýҼӳ
-    float goldMod = m_policyManager.getYieldModifier(EffectType::MODIFIER_GOLD);
-    income = static_cast<int>(income * (1.0f + goldMod / 100.0f));
+    // 应用金币加成
+    int income = Fixed::percent(100 + m_policyManager.getYieldModifier(EffectType::MODIFIER_GOLD)).mulInt(m_cityYieldTotal.goldYield);
 
     return income - calculateMaintenanceCost();
 }
 
 /**
- * ѽ
+ * 花费金币
  */
 void Player::spendGold(int amount) {
     if (amount > 0 && canAfford(amount)) {
@@ -775,7 +778,7 @@ void Player::spendGold(int amount) {
 }
 
 /**
- * ӦÿƼӳ
+ * 应用科技加成
  */
 int Player::applyScienceBonus(int baseScience) const {
     if (!m_civilization) return baseScience;
@@ -783,7 +786,7 @@ int Player::applyScienceBonus(int baseScience) const {
 }
 
 /**
- * ӦĻӳ
+ * 应用文化加成
  */
 int Player::applyCultureBonus(int baseCulture) const {
     if (!m_civilization) return baseCulture;
@@ -791,12 +794,11 @@ int Player::applyCultureBonus(int baseCulture) const {
 }
 
 /**
- * Ӧ￨ӳ
+ * 应用尤里卡加成
  */
 void Player::applyEurekaBonus(int techId) {
     if (!m_civilization) return;
-    const TechNode* node = m_techTree.getTechInfo(techId);
-    if (!node || node->activated) return;
+    if (!m_techTree.getTechInfo(techId) || m_techTree.isActivated(techId)) return;
 
     int boost = m_civilization->applyEurekaBonus(techId, const_cast<TechTree*>(&m_techTree));
     if (boost > 0) {
@@ -810,12 +812,11 @@ void Player::applyEurekaBonus(int techId) {
 }
 
 /**
- * Ӧмӳ
+ * 应用灵感加成
  */
 void Player::applyInspirationBonus(int cultureId) {
     if (!m_civilization) return;
-    const CultureNode* node = m_cultureTree.getCultureInfo(cultureId);
-    if (!node || node->activated) return;
+    if (!m_cultureTree.getCultureInfo(cultureId) || m_cultureTree.isActivated(cultureId)) return;
 
     int boost = m_civilization->applyInspirationBonus(cultureId, const_cast<CultureTree*>(&m_cultureTree));
     if (boost > 0) {
@@ -829,7 +830,7 @@ void Player::applyInspirationBonus(int cultureId) {
 }
 
 /**
- * ȡ
+ * 获取文明特性名称
  */
 std::string Player::getCivilizationTraitName() const {
     if (!m_civilization) return "Unknown";
@@ -837,7 +838,7 @@ std::string Player::getCivilizationTraitName() const {
 }
 
 /**
- * ȡ
+ * 获取文明特性描述
  */
 std::string Player::getCivilizationTraitDescription() const {
     if (!m_civilization) return "No traits";
@@ -845,54 +846,54 @@ std::string Player::getCivilizationTraitDescription() const {
 }
 
 /**
- * Ƿָӳ
+ * 检查是否有指定文明加成
  */
 bool Player::hasCivilizationBonus(const std::string& bonusName) const {
     if (!m_civilization) return false;
     auto traits = m_civilization->getTraits();
-    if (bonusName == "science_bonus") return traits.scienceBonus > 1.0f;
-    if (bonusName == "culture_bonus") return traits.cultureBonus > 1.0f;
+    if (bonusName == "science_bonus") return traits.scienceBonus > Fixed::one();
+    if (bonusName == "culture_bonus") return traits.cultureBonus > Fixed::one();
     return false;
 }
 
 /**
- * Ӧӳ
+ * 应用所有文明加成
  */
 void Player::applyAllCivilizationBonuses() {
     updateCivilizationBonusState();
 }
 
 /**
- * ӳ״̬
+ * 更新文明加成状态
  */
 void Player::updateCivilizationBonusState() {
     if (!m_civilization) return;
     if (dynamic_cast<CivChina*>(m_civilization)) {
-        // ض߼
+        // 特定文明逻辑
     }
 }
 
 /**
- * ǷɿƼʤ
+ * 检查是否达成科技胜利
  */
 bool Player::checkScienceVictory() const {
     return m_vicprogress.hasSatelliteTech && m_vicprogress.hasLaunchedSatellite;
 }
 
 /**
- * Ƿʤ
+ * 检查是否达成征服胜利
  */
 bool Player::checkDominationVictory() const {
     return m_vicprogress.hasDominationVictory;
 }
 
 /**
- * ״̬лΪValueMap
+ * 将玩家状态序列化为ValueMap
  */
 ValueMap Player::toValueMap() const {
     ValueMap data;
 
-    // 1. 
+    // 1. 基础属性
     data["playerId"] = m_playerId;
     data["playerName"] = m_playerName;
     data["state"] = (int)m_state;
@@ -902,18 +903,18 @@ ValueMap Player::toValueMap() const {
     data["amenities"] = m_amenities;
     data["isHuman"] = m_isHuman;
 
-    // ɫ
+    // 颜色
     data["color_r"] = (int)m_color.r;
     data["color_g"] = (int)m_color.g;
     data["color_b"] = (int)m_color.b;
 
-    // 
+    // 文明类型
     if (dynamic_cast<CivChina*>(m_civilization)) data["civilization"] = "China";
     else if (dynamic_cast<CivGermany*>(m_civilization)) data["civilization"] = "Germany";
     else if (dynamic_cast<CivRussia*>(m_civilization)) data["civilization"] = "Russia";
     else data["civilization"] = "Default";
 
-    // 2. Ƽ״̬
+    // 2. 科技树状态
     ValueMap techData;
     techData["currentResearch"] = m_techTree.getCurrentResearch();
 
@@ -924,7 +925,7 @@ ValueMap Player::toValueMap() const {
     techData["activatedTechs"] = activeTechs;
     data["techTree"] = techData;
 
-    // 3. Ļ״̬
+    // 3. 文化树状态
     ValueMap cultureData;
     cultureData["currentResearch"] = m_cultureTree.getCurrentResearch();
     cultureData["currentGovernment"] = (int)m_cultureTree.getCurrentGovernment();
@@ -936,7 +937,7 @@ ValueMap Player::toValueMap() const {
     cultureData["activatedCivics"] = activeCivics;
     data["cultureTree"] = cultureData;
 
-    // 4. ״̬
+    // 4. 政策状态
     ValueVector equippedPolicies;
     auto equippedList = m_policyManager.getEquippedPolicies();
     for (const auto& info : equippedList) {
@@ -948,7 +949,7 @@ ValueMap Player::toValueMap() const {
     }
     data["equippedPolicies"] = equippedPolicies;
 
-    // 5. ʤ
+    // 5. 胜利进度
     ValueMap vicData;
     vicData["hasSatellite"] = m_vicprogress.hasSatelliteTech;
     vicData["launched"] = m_vicprogress.hasLaunchedSatellite;
@@ -958,21 +959,21 @@ ValueMap Player::toValueMap() const {
 }
 
 /**
- * ValueMapл״̬
+ * 从ValueMap反序列化玩家状态
  */
 bool Player::fromValueMap(const ValueMap& data) {
-    // 1. 
+    // 1. 基础属性
     if (data.count("playerId")) m_playerId = data.at("playerId").asInt();
     if (data.count("gold")) m_gold = data.at("gold").asInt();
     if (data.count("scienceStock")) m_scienceStock = data.at("scienceStock").asInt();
     if (data.count("cultureStock")) m_cultureStock = data.at("cultureStock").asInt();
 
-    // ָɫ
+    // 恢复颜色
     if (data.count("color_r")) {
         m_color = Color3B(data.at("color_r").asInt(), data.at("color_g").asInt(), data.at("color_b").asInt());
     }
 
-    // ָ
+    // 恢复文明
     if (data.count("civilization")) {
         std::string civName = data.at("civilization").asString();
         CivilizationType type = CivilizationType::BASIC;
@@ -982,11 +983,11 @@ bool Player::fromValueMap(const ValueMap& data) {
         createCivilization(type);
     }
 
-    // 2. ָƼ
+    // 2. 恢复科技树
     if (data.count("techTree")) {
         auto techData = data.at("techTree").asValueMap();
 
-        // ָƼ
+        // 恢复激活科技
         if (techData.count("activatedTechs")) {
             auto vec = techData.at("activatedTechs").asValueVector();
             for (const auto& v : vec) {
@@ -995,22 +996,22 @@ bool Player::fromValueMap(const ValueMap& data) {
                 m_techTree.updateProgress(99999);
             }
         }
-        // ָǰо
+        // 恢复当前研究
         if (techData.count("currentResearch")) {
             m_techTree.setCurrentResearch(techData.at("currentResearch").asInt());
         }
     }
 
-    // 3. ָĻ
+    // 3. 恢复文化树
     if (data.count("cultureTree")) {
         auto cultureData = data.at("cultureTree").asValueMap();
 
-        // ָ
+        // 恢复政体
         if (cultureData.count("currentGovernment")) {
             m_cultureTree.switchGovernment((GovernmentType)cultureData.at("currentGovernment").asInt());
         }
 
-        // ָ
+        // 恢复激活市政
         if (cultureData.count("activatedCivics")) {
             auto vec = cultureData.at("activatedCivics").asValueVector();
             for (const auto& v : vec) {
@@ -1025,7 +1026,7 @@ bool Player::fromValueMap(const ValueMap& data) {
         }
     }
 
-    // 4. ָ
+    // 4. 恢复政策
     m_policyManager.updateGovernmentSlots();
 
     if (data.count("equippedPolicies")) {
@@ -1039,7 +1040,7 @@ bool Player::fromValueMap(const ValueMap& data) {
         }
     }
 
-    // 5. ʤ
+    // 5. 胜利进度
     if (data.count("victoryProgress")) {
         auto vicData = data.at("victoryProgress").asValueMap();
         m_vicprogress.hasSatelliteTech = vicData.at("hasSatellite").asBool();
@@ -1050,17 +1051,17 @@ bool Player::fromValueMap(const ValueMap& data) {
 }
 
 /**
- * ״̬
+ * 调试输出玩家状态
  */
 void Player::debugPrintStatus() const {
     CCLOG("--- Player %d Status ---", m_playerId);
     CCLOG("Gold: %d, Sci: %d, Cul: %d", m_gold, m_scienceStock, m_cultureStock);
 
-    // Ч
+    // 输出产出效率
     CCLOG("Yields per turn: Sci +%d, Cul +%d, Gold +%d",
         getSciencePerTurn(), getCulturePerTurn(), calculateNetGoldPerTurn());
 
-    // ״̬
+    // 输出政策状态
     auto gov = m_policyManager.getCurrentGovConfig();
     CCLOG("Gov: %s", gov.name.c_str());
 
@@ -9,48 +9,64 @@
 #include "../City/Yield.h"
 #include "../Units/Base/AbstractUnit.h"
 #include "Development/ProductionProgram.h"
+#include "Utils/EventBus.h"
 #include <vector>
+#include <set>
 #include <memory>
 #include <functional>
 
-// ö
+// 文明类型枚举
 enum class CivilizationType {
-    BASIC,      // 
-    GERMANY,    // ¹
-    CHINA,      // й
-    RUSSIA      // ˹
+    BASIC,      // 基本文明
+    GERMANY,    // 德国
+    CHINA,      // 中国
+    RUSSIA      // 俄罗斯
 };
 
-// ǰ
+// 前向声明
 class BaseCity;
 class AbstractUnit;
 
 /**
- *  - ϷеһңԴСλͿƼչ
+ * 玩家资源快照事件
+ * 通过 EventBus 按玩家ID合并发布，HUD 每帧只收到最新一次
  */
-class Player : public cocos2d::Ref, public TechEventListener, public CultureEventListener {
+struct PlayerResourceEvent {
+    int playerId;
+    int gold;
+    int goldPerTurn;
+    int sciencePerTurn;
+    int culturePerTurn;
+    int scienceStock;
+    int cultureStock;
+};
+
+/**
+ * 玩家类 - 代表游戏中的一个玩家，管理其资源、城市、单位和科技发展
+ */
+class Player : public cocos2d::Ref {
 public:
     /**
-     * ״̬ö
+     * 玩家状态枚举
      */
     enum class PlayerState {
-        ACTIVE,         // ״̬
-        DEFEATED,       // ѱ
-        VICTORIOUS,     // ѻʤ
-        AI_CONTROLLED   // AI
+        ACTIVE,         // 活动状态
+        DEFEATED,       // 已被击败
+        VICTORIOUS,     // 已获胜
+        AI_CONTROLLED   // AI控制
     };
 
     /**
-     * ʤ׷ٽṹ
+     * 胜利进度追踪结构
      */
     struct VictoryProgress {
-        bool hasSatelliteTech;         // ǷǿƼ
-        bool hasLaunchedSatellite;     // Ƿ
-        bool hasDominationVictory;     // Ƿͳʤ
-        std::vector<int> controlledCapitals; // Ƶ׶IDб
+        bool hasSatelliteTech;         // 是否解锁卫星科技
+        bool hasLaunchedSatellite;     // 是否发射卫星
+        bool hasDominationVictory;     // 是否达成统治胜利
+        std::vector<int> controlledCapitals; // 控制的玩家首都ID列表
 
         /**
-         * ĬϹ캯
+         * 默认构造函数
          */
         VictoryProgress()
             : hasSatelliteTech(false), hasLaunchedSatellite(false),
@@ -59,17 +75,17 @@ public:
     };
 
     /**
-     * غͳƽṹ
+     * 回合统计结构
      */
     struct TurnStats {
-        int scienceGenerated;     // غɵĿƼֵ
-        int cultureGenerated;     // غɵĻֵ
-        int goldGenerated;        // غɵĽ
-        int unitsTrained;         // غѵĵλ
-        int buildingsConstructed; // غϽĽ
+        int scienceGenerated;     // 本回合生成的科技值
+        int cultureGenerated;     // 本回合生成的文化值
+        int goldGenerated;        // 本回合生成的金币
+        int unitsTrained;         // 本回合训练的单位数
+        int buildingsConstructed; // 本回合建造的建筑数
 
         /**
-         * ĬϹ캯
+         * 默认构造函数
          */
         TurnStats()
             : scienceGenerated(0), cultureGenerated(0), goldGenerated(0),
@@ -78,214 +94,233 @@ public:
     };
 
     /**
-     * 캯 - ʼҶ
-     * ע⣺PolicyManagerҪCultureTreeָΪ
+     * 构造函数 - 初始化玩家对象
+     * 注意：PolicyManager需要CultureTree指针作为参数
      */
     Player();
 
     /**
-     * Ҿ̬
-     * @param playerId ID
-     * @param civType 
-     * @return Ҷʧܷnullptr
+     * 创建玩家静态方法
+     * @param playerId 玩家ID
+     * @param civType 文明类型
+     * @return 创建的玩家对象，失败返回nullptr
      */
     static Player* create(int playerId, CivilizationType civType);
 
     /**
-     * ʼ
-     * @param playerId ID
-     * @param civType 
-     * @return ʼɹtrueʧܷfalse
+     * 初始化玩家
+     * @param playerId 玩家ID
+     * @param civType 文明类型
+     * @return 初始化成功返回true，失败返回false
      */
     bool init(int playerId, CivilizationType civType);
 
     /**
-     * 
+     * 析构函数
      */
     virtual ~Player();
 
-    // ==================== غϹ ====================
+    // ==================== 回合管理 ====================
     /**
-     * غϿʼ
+     * 回合开始处理
      */
     void onTurnBegin();
 
     /**
-     * ַԴ仯¼
+     * 分发资源变化事件
      */
     void dispatchResourceChangedEvent();
 
     /**
-     * о
+     * 更新研究进度
      */
     void updateResearchProgress();
 
     /**
-     * غϽ
+     * 回合结束处理
      */
     void onTurnEnd();
 
-    // ==================== Է ====================
-    // 
+    // ==================== 属性访问器 ====================
+    // 基础属性
     CC_SYNTHESIZE(int, m_playerId, PlayerId);
     CC_SYNTHESIZE(std::string, m_playerName, PlayerName);
     CC_SYNTHESIZE(PlayerState, m_state, State);
     CC_SYNTHESIZE(cocos2d::Color3B, m_color, Color);
     CC_SYNTHESIZE(bool, m_isHuman, IsHuman);
 
-    // Դ
+    // 资源属性
     CC_SYNTHESIZE(int, m_gold, Gold);
     CC_SYNTHESIZE(int, m_amenities, Amenities);
 
-    // кĻ
-    CC_SYNTHESIZE(int, m_scienceStock, ScienceStock);     // Ƽֵδоģ
-    CC_SYNTHESIZE(int, m_cultureStock, CultureStock);     // Ļֵδоģ
+    // 科研和文化相关属性
+    CC_SYNTHESIZE(int, m_scienceStock, ScienceStock);     // 科技值储备（未用于研究的）
+    CC_SYNTHESIZE(int, m_cultureStock, CultureStock);     // 文化值储备（未用于研究的）
 
-    // ==================== ϵͳ ====================
+    // ==================== 子系统访问器 ====================
     /**
-     * ȡ
-     * @return ָ
+     * 获取文明对象
+     * @return 文明对象指针
      */
     BaseCiv* getCivilization() { return m_civilization; }
 
     /**
-     * ȡƼ
-     * @return Ƽ
+     * 获取科技树对象
+     * @return 科技树对象引用
      */
     TechTree* getTechTree() { return &m_techTree; }
 
     /**
-     * ȡĻ
-     * @return Ļ
+     * 获取文化树对象
+     * @return 文化树对象引用
      */
     CultureTree* getCultureTree() { return &m_cultureTree; }
 
     /**
-     * ȡ߹
-     * @return ߹
+     * 获取政策管理器对象
+     * @return 政策管理器对象引用
      */
     PolicyManager* getPolicyManager() { return &m_policyManager; }
 
     /**
-     * ȡǰغͳ
-     * @return غͳƽṹ
+     * 获取当前回合统计
+     * @return 回合统计结构引用
      */
     const TurnStats& getTurnStats() const { return m_turnStats; }
 
-    // ==================== й ====================
+    // ==================== 城市管理 ====================
     /**
-     * ӳ
-     * @param city ж
+     * 添加城市
+     * @param city 城市对象
      */
     void addCity(BaseCity* city);
 
     /**
-     * Ƴ
-     * @param city ж
+     * 移除城市
+     * @param city 城市对象
      */
     void removeCity(BaseCity* city);
 
     /**
-     * ȡг
-     * @return б
+     * 获取所有城市
+     * @return 城市列表
      */
     const std::vector<BaseCity*>& getCities() const { return m_cities; }
 
     /**
-     * ȡ׶
-     * @return ׶жû׶nullptr
+     * 获取首都
+     * @return 首都城市对象，没有首都返回nullptr
      */
     BaseCity* getCapital() const;
 
     /**
-     * ȡ
-     * @return 
+     * 获取城市数量
+     * @return 城市数量
      */
     int getCityCount() const { return m_cities.size(); }
 
     /**
-     * геܲ
-     * @return ܲṹ
+     * 城市产出失效通知（由 BaseCity::markYieldDirty 调用）
+     * @param city 产出失效的城市
+     */
+    void onCityYieldDirty(BaseCity* city);
+
+    /**
+     * 城市产出变化量通知（由 BaseCity::updateYield 调用）
+     * @param delta 新产出减旧产出
+     */
+    void onCityYieldChanged(const Yield& delta);
+
+    /**
+     * 计算所有城市的总产出
+     * @return 总产出结构
      */
     Yield calculateTotalYield() const;
 
     /**
-     * ޼ӳɣ
-     * @return ṹ
+     * 对城市总产出应用文明特性与政策卡加成
+     * @param base 城市总产出
+     * @return 加成后的产出
+     */
+    Yield applyYieldBonuses(const Yield& base) const;
+
+    /**
+     * 计算基础产出（无加成）
+     * @return 基础产出结构
      */
     Yield calculateBaseYield() const;
 
     /**
-     * Ƿ׶
-     * @param city ж
-     * @return ׶true򷵻false
+     * 检查城市是否是首都
+     * @param city 城市对象
+     * @return 是首都返回true，否则返回false
      */
     bool isCapital(BaseCity* city) const;
 
     /**
-     * ӿƵ׶ID
-     * @param playerId ID
+     * 添加控制的玩家首都ID
+     * @param playerId 玩家ID
      */
     void addControlledCapital(int playerId);
 
     /**
-     * ƳƵ׶ID
-     * @param playerId ID
+     * 移除控制的玩家首都ID
+     * @param playerId 玩家ID
      */
     void removeControlledCapital(int playerId);
 
     /**
-     * ȡƵ׶б
-     * @return Ƶ׶IDб
+     * 获取控制的首都列表
+     * @return 控制的玩家首都ID列表
      */
-    std::vector<int> getControlledCapitals() const;
+    const std::vector<int>& getControlledCapitals() const { return m_vicprogress.controlledCapitals; }
 
     /**
-     * Ƿָҵ׶
-     * @param playerId ID
-     * @return Ʒtrue򷵻false
+     * 检查是否控制指定玩家的首都
+     * @param playerId 玩家ID
+     * @return 控制返回true，否则返回false
      */
     bool controlsCapitalOf(int playerId) const;
 
     /**
-     * ȡ׶ID
-     * @return ID
+     * 获取首都玩家ID
+     * @return 玩家ID
      */
     int getCapitalPlayerId() const { return m_playerId; }
 
-    // ==================== λ ====================
+    // ==================== 单位管理 ====================
     /**
-     * ӵλ
-     * @param unit λ
+     * 添加单位
+     * @param unit 单位对象
      */
     void addUnit(AbstractUnit* unit);
 
     /**
-     * Ƴλ
-     * @param unit λ
+     * 移除单位
+     * @param unit 单位对象
      */
     void removeUnit(AbstractUnit* unit);
 
     /**
-     * ȡеλ
-     * @return λб
+     * 获取所有单位
+     * @return 单位列表
      */
     const std::vector<AbstractUnit*>& getUnits() const { return m_units; }
 
     /**
-     * ȡλ
-     * @return λ
+     * 获取单位数量
+     * @return 单位数量
      */
     int getUnitCount() const { return m_units.size(); }
 
-    // ==================== ʼλ ====================
+    // ==================== 起始单位管理 ====================
     /**
-     * ʼߵλ
-     * @param parentNode ڵ
-     * @param getStartHexFunc ȡʼλú
-     * @param addToMapFunc ӵͼ
-     * @param checkCityFunc к
-     * @return Ŀߵλʧܷnullptr
+     * 创建起始开拓者单位
+     * @param parentNode 父节点
+     * @param getStartHexFunc 获取起始位置函数
+     * @param addToMapFunc 添加到地图函数
+     * @param checkCityFunc 检查城市函数
+     * @return 创建的开拓者单位，失败返回nullptr
      */
     AbstractUnit* createStartingSettler(cocos2d::Node* parentNode,
         std::function<Hex()> getStartHexFunc,
@@ -293,11 +328,11 @@ public:
         std::function<bool(Hex)> checkCityFunc);
 
     /**
-     * õͼص
-     * @param getStartHexFunc ȡʼλú
-     * @param addToMapFunc ӵͼ
-     * @param checkCityFunc к
-     * @param getTerrainCostFunc ȡĺ
+     * 设置地图回调函数
+     * @param getStartHexFunc 获取起始位置函数
+     * @param addToMapFunc 添加到地图函数
+     * @param checkCityFunc 检查城市函数
+     * @param getTerrainCostFunc 获取地形消耗函数
      */
     void setMapCallbacks(std::function<Hex()> getStartHexFunc,
         std::function<void(AbstractUnit*)> addToMapFunc,
@@ -305,287 +340,290 @@ public:
         std::function<int(Hex)> getTerrainCostFunc);
 
     /**
-     * ӵλͼ
-     * @param unit λ
+     * 添加单位到地图
+     * @param unit 单位对象
      */
     void addToMapFunc(AbstractUnit* unit) { m_addToMapFunc(unit); }
 
-    // ==================== Ƽϵͳӿ ====================
+    // ==================== 科技系统接口 ====================
     /**
-     * Ƽص
-     * @param techId ƼID
-     * @param techName Ƽ
-     * @param effect Ч
+     * 科技激活事件处理
+     * @param techId 科技ID
+     * @param techName 科技名称
+     * @param effect 效果描述
      */
-    virtual void onTechActivated(int techId, const std::string& techName,
-        const std::string& effect) override;
+    void onTechActivated(int techId, const std::string& techName,
+        const std::string& effect);
 
     /**
-     * оȻص
-     * @param techId ƼID
-     * @param currentProgress ǰ
-     * @param totalCost ܳɱ
+     * 尤里卡触发事件处理
+     * @param techId 科技ID
+     * @param techName 科技名称
      */
-    virtual void onResearchProgress(int techId, int currentProgress,
-        int totalCost) override;
+    void onEurekaTriggered(int techId, const std::string& techName);
 
     /**
-     * ￨ص
-     * @param techId ƼID
-     * @param techName Ƽ
+     * 获取解锁的生产项目（科技/市政完成时增量维护，查询不分配内存）
      */
-    virtual void onEurekaTriggered(int techId, const std::string& techName) override;
+    const std::vector<ProductionProgram*>& getUnlockedUnits() const { return unlockedUnits; }
+    const std::vector<ProductionProgram*>& getUnlockedDistricts() const { return unlockedDistricts; }
+    const std::vector<ProductionProgram*>& getUnlockedBuildings() const { return unlockedBuildings; }
 
     /**
-     * ½Ŀ
-     */
-    void updateUnlockedProduction();
-
-    /**
-     * ȡĿ
-     * @param Units λб
-     * @param Districts б
-     * @param Buildings б
-     */
-    void getUnlockedProduction(std::vector<ProductionProgram*>& Units,
-        std::vector<ProductionProgram*>& Districts,
-        std::vector<ProductionProgram*>& Buildings);
-
-    /**
-     * ӿƼֵ
-     * @param amount Ƽֵ
+     * 添加科技值
+     * @param amount 科技值数量
      */
     void addScience(int amount);
 
     /**
-     * ȡÿغϿƼ
-     * @return ÿغϿƼֵ
+     * 获取每回合科技产出
+     * @return 每回合科技产出值
      */
     int getSciencePerTurn() const;
 
     /**
-     * õǰоƼ
-     * @param techId ƼID
+     * 设置当前研究科技
+     * @param techId 科技ID
      */
     void setCurrentResearch(int techId);
 
     /**
-     * ȡǰоƼID
-     * @return ƼIDо-1
+     * 获取当前研究科技ID
+     * @return 科技ID，无研究返回-1
      */
     int getCurrentResearchTechId() const { return m_techTree.getCurrentResearch(); }
 
-    // ==================== Ļϵͳӿ ====================
-    /**
-     * Ļص
-     * @param cultureId ĻID
-     * @param cultureName Ļ
-     * @param effect Ч
-     */
-    virtual void onCultureUnlocked(int cultureId, const std::string& cultureName,
-        const std::string& effect) override;
-
+    // ==================== 文化系统接口 ====================
     /**
-     * ĻȻص
-     * @param cultureId ĻID
-     * @param currentProgress ǰ
-     * @param totalCost ܳɱ
+     * 文化解锁事件处理
+     * @param cultureId 文化ID
+     * @param cultureName 文化名称
+     * @param effect 效果描述
      */
-    virtual void onCultureProgress(int cultureId, int currentProgress,
-        int totalCost) override;
+    void onCultureUnlocked(int cultureId, const std::string& cultureName,
+        const std::string& effect);
 
     /**
-     * дص
-     * @param cultureId ĻID
-     * @param cultureName Ļ
+     * 灵感触发事件处理
+     * @param cultureId 文化ID
+     * @param cultureName 文化名称
      */
-    virtual void onInspirationTriggered(int cultureId,
-        const std::string& cultureName) override;
+    void onInspirationTriggered(int cultureId,
+        const std::string& cultureName);
 
     /**
-     * Ļֵ
-     * @param amount Ļֵ
+     * 添加文化值
+     * @param amount 文化值数量
      */
     void addCulture(int amount);
 
     /**
-     * ȡÿغĻ
-     * @return ÿغĻֵ
+     * 获取每回合文化产出
+     * @return 每回合文化产出值
      */
     int getCulturePerTurn() const;
 
     /**
-     * õǰо
-     * @param cultureId ĻID
+     * 设置当前研究市政
+     * @param cultureId 文化ID
      */
     void setCurrentCivic(int cultureId);
 
     /**
-     * ȡǰоID
-     * @return IDо-1
+     * 获取当前研究市政ID
+     * @return 市政ID，无研究返回-1
      */
     int getCurrentResearchCivicId() const { return m_cultureTree.getCurrentResearch(); }
 
-    // ==================== ϵͳ ====================
+    // ==================== 经济系统 ====================
     /**
-     * ά
-     * @return ά
+     * 计算维护费用
+     * @return 维护费用
      */
     int calculateMaintenanceCost() const;
 
     /**
-     * ÿغϾ
-     * @return 
+     * 计算每回合净金币收入
+     * @return 净金币收入
      */
     int calculateNetGoldPerTurn() const;
 
     /**
-     * Ƿܹ֧
-     * @param goldCost ҳɱ
-     * @return ܹ֧true򷵻false
+     * 检查是否能够支付
+     * @param goldCost 金币成本
+     * @return 能够支付返回true，否则返回false
      */
     bool canAfford(int goldCost) const { return m_gold >= goldCost; }
 
     /**
-     * ѽ
-     * @param amount ѽ
+     * 花费金币
+     * @param amount 花费金额
      */
     void spendGold(int amount);
 
-    // ==================== ӳӦ÷ ====================
+    // ==================== 文明加成应用方法 ====================
     /**
-     * ӦÿƼӳ
-     * @param baseScience Ƽֵ
-     * @return ӳɺĿƼֵ
+     * 应用科技加成
+     * @param baseScience 基础科技值
+     * @return 加成后的科技值
      */
     int applyScienceBonus(int baseScience) const;
 
     /**
-     * ӦĻӳ
-     * @param baseCulture Ļֵ
-     * @return ӳɺĻֵ
+     * 应用文化加成
+     * @param baseCulture 基础文化值
+     * @return 加成后的文化值
      */
     int applyCultureBonus(int baseCulture) const;
 
     /**
-     * Ӧ￨ӳ
-     * @param techId ƼID
+     * 应用尤里卡加成
+     * @param techId 科技ID
      */
     void applyEurekaBonus(int techId);
 
     /**
-     * Ӧмӳ
-     * @param cultureId ĻID
+     * 应用灵感加成
+     * @param cultureId 文化ID
      */
     void applyInspirationBonus(int cultureId);
 
     /**
-     * ȡ
-     * @return 
+     * 获取文明特性名称
+     * @return 特性名称
      */
     std::string getCivilizationTraitName() const;
 
     /**
-     * ȡ
-     * @return 
+     * 获取文明特性描述
+     * @return 特性描述
      */
     std::string getCivilizationTraitDescription() const;
 
     /**
-     * Ƿָӳ
-     * @param bonusName ӳ
-     * @return мӳɷtrue򷵻false
+     * 检查是否有指定文明加成
+     * @param bonusName 加成名称
+     * @return 有加成返回true，否则返回false
      */
     bool hasCivilizationBonus(const std::string& bonusName) const;
 
-    // ==================== ʤ ====================
+    // ==================== 胜利条件 ====================
     /**
-     * ǷɿƼʤ
-     * @return ɷtrue򷵻false
+     * 检查是否达成科技胜利
+     * @return 达成返回true，否则返回false
      */
     bool checkScienceVictory() const;
 
     /**
-     * Ƿʤ
-     * @return ɷtrue򷵻false
+     * 检查是否达成征服胜利
+     * @return 达成返回true，否则返回false
      */
     bool checkDominationVictory() const;
 
-    // ==================== л ====================
+    // ==================== 序列化 ====================
     /**
-     * ״̬лΪValueMap
-     * @return ״̬ValueMap
+     * 将玩家状态序列化为ValueMap
+     * @return 包含玩家状态的ValueMap
      */
     cocos2d::ValueMap toValueMap() const;
 
     /**
-     * ValueMapл״̬
-     * @param data ״̬ValueMap
-     * @return лɹtrueʧܷfalse
+     * 从ValueMap反序列化玩家状态
+     * @param data 包含玩家状态的ValueMap
+     * @return 反序列化成功返回true，失败返回false
      */
     bool fromValueMap(const cocos2d::ValueMap& data);
 
-    // ==================== ԺͲ ====================
+    // ==================== 调试和测试 ====================
     /**
-     * ״̬
+     * 调试输出玩家状态
      */
     void debugPrintStatus() const;
 
 private:
     friend class GameManager;
 
-    // ==================== ϵͳ ====================
-    BaseCiv* m_civilization = nullptr;      // 
-    TechTree m_techTree;                    // Ƽ
-    CultureTree m_cultureTree;              // Ļ
-    PolicyManager m_policyManager;          // ߹
-    std::vector<ProductionProgram*> unlockedUnits;     // ĵλ
-    std::vector<ProductionProgram*> unlockedDistricts; // 
-    std::vector<ProductionProgram*> unlockedBuildings; // Ľ
+    // ==================== 核心子系统 ====================
+    BaseCiv* m_civilization = nullptr;      // 文明特性
+    TechTree m_techTree;                    // 科技树
+    CultureTree m_cultureTree;              // 文化树
+    PolicyManager m_policyManager;          // 政策管理器
+
+    // 科技/文化事件监听ID
+    EventBus::ListenerId m_techActivatedListener = 0;
+    EventBus::ListenerId m_eurekaListener = 0;
+    EventBus::ListenerId m_cultureUnlockedListener = 0;
+    EventBus::ListenerId m_inspirationListener = 0;
+    std::set<int> m_unlockedProgramIds;                // 已解锁的生产项目ID
+    std::vector<ProductionProgram*> unlockedUnits;     // 解锁的单位
+    std::vector<ProductionProgram*> unlockedDistricts; // 解锁的区域
+    std::vector<ProductionProgram*> unlockedBuildings; // 解锁的建筑
 
-    // ==================== Ϸʵ ====================
-    std::vector<BaseCity*> m_cities;        // б
-    std::vector<AbstractUnit*> m_units;     // λб
+    // ==================== 游戏实体 ====================
+    std::vector<BaseCity*> m_cities;        // 城市列表
+    std::vector<AbstractUnit*> m_units;     // 单位列表
 
-    // ʼλص
-    std::function<Hex()> m_getStartHexFunc;             // ȡʼλú
-    std::function<void(AbstractUnit*)> m_addToMapFunc;  // ӵͼ
-    std::function<bool(Hex)> m_checkCityFunc;           // к
-    std::function<int(Hex)> m_getTerrainCostFunc;       // ȡĺ
+    // 起始单位回调函数
+    std::function<Hex()> m_getStartHexFunc;             // 获取起始位置函数
+    std::function<void(AbstractUnit*)> m_addToMapFunc;  // 添加到地图函数
+    std::function<bool(Hex)> m_checkCityFunc;           // 检查城市函数
+    std::function<int(Hex)> m_getTerrainCostFunc;       // 获取地形消耗函数
 
-    // ʼλ
-    AbstractUnit* m_startingSettler = nullptr;          // ʼ
+    // 起始单位
+    AbstractUnit* m_startingSettler = nullptr;          // 起始开拓者
 
-    // ==================== غͳ ====================
-    TurnStats m_turnStats;                  // غͳ
+    // ==================== 回合统计 ====================
+    TurnStats m_turnStats;                  // 回合统计
 
-    // ==================== ʤ ====================
-    VictoryProgress m_vicprogress;          // ʤ
+    // ==================== 产出缓存 ====================
+    // 总产出按城市变化量增量维护，只重算失效的城市；政策加成直接查 PolicyManager 的加成表
+    mutable Yield m_cityYieldTotal{};                   // 所有城市产出之和
+    mutable std::vector<BaseCity*> m_dirtyYieldCities;  // 待刷新产出的城市
 
-    // ==================== ˽з ====================
+    // ==================== 胜利进度 ====================
+    VictoryProgress m_vicprogress;          // 胜利进度
+
+    // ==================== 私有方法 ====================
     /**
-     * ߲λ
+     * 更新政策槽位
      */
     void updatePolicySlots();
 
     /**
-     * 
-     * @param civType 
+     * 刷新产出缓存：重算失效的城市
+     */
+    void refreshYieldCache() const;
+
+    /**
+     * 订阅/注销科技树与文化树事件
+     */
+    void subscribeDevelopmentEvents();
+    void unsubscribeDevelopmentEvents();
+
+    /**
+     * 解锁生产项目（已解锁的ID直接跳过）
+     * @param programIds 生产项目ID列表
+     */
+    void unlockPrograms(const std::vector<int>& programIds);
+
+    /**
+     * 创建文明
+     * @param civType 文明类型
      */
     void createCivilization(CivilizationType civType);
 
     /**
-     * Դ
+     * 清理资源
      */
     void cleanupResources();
 
     /**
-     * Ӧӳ
+     * 应用所有文明加成
      */
     void applyAllCivilizationBonuses();
 
     /**
-     * ӳ״̬
+     * 更新文明加成状态
      */
     void updateCivilizationBonusState();
 };
@@ -0,0 +1,45 @@
+#ifndef CONST_SPAN_H
+#define CONST_SPAN_H
+
+#include <cstddef>
+#include <vector>
+
+// 只读连续区间：指向共享定义库中 CSR 数组的一段，用于前置/后继等邻接列表
+// 区间只在定义库存活期间有效（定义库为全局单例，生命周期覆盖整个游戏）
+template <typename T>
+struct ConstSpan {
+	const T* first = nullptr;
+	const T* last = nullptr;
+
+	const T* begin() const { return first; }
+	const T* end() const { return last; }
+	size_t size() const { return static_cast<size_t>(last - first); }
+	bool empty() const { return first == last; }
+	const T& operator[](size_t i) const { return first[i]; }
+};
+
+// CSR（压缩稀疏行）邻接表：offsets[i]..offsets[i+1] 为第 i 行在 values 中的范围
+template <typename T>
+struct CsrTable {
+	std::vector<int> offsets;
+	std::vector<T> values;
+
+	// 由逐行列表构建，构建完成后 values 不再改变，返回的区间保持有效
+	void build(const std::vector<std::vector<T>>& rows) {
+		offsets.assign(1, 0);
+		values.clear();
+		for (const auto& row : rows) {
+			values.insert(values.end(), row.begin(), row.end());
+			offsets.push_back(static_cast<int>(values.size()));
+		}
+	}
+
+	ConstSpan<T> row(int index) const {
+		ConstSpan<T> span;
+		span.first = values.data() + offsets[index];
+		span.last = values.data() + offsets[index + 1];
+		return span;
+	}
+};
+
+#endif // CONST_SPAN_H
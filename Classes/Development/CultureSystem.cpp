@@ -1,114 +1,194 @@
 #include "CultureSystem.h"
+#include "Utils/EventBus.h"
+#include <cassert>
 #include <iostream>
+#include <map>
+
+namespace {
+	// 市政原始定义
+	struct CultureDefinition {
+		int id;
+		const char* name;
+		int cost;
+		std::vector<int> prereqs;
+		const char* effect;
+		std::vector<GovernmentType> governments;
+		int policySlotCount[4];
+		std::vector<int> policyIds;
+
+		CultureDefinition(int id, const char* name, int cost, const std::vector<int>& prereqs, const char* effect)
+			: id(id), name(name), cost(cost), prereqs(prereqs), effect(effect) {
+			std::fill(policySlotCount, policySlotCount + 4, 0);
+		}
+	};
+}
+
+const CultureDatabase& CultureDatabase::getInstance() {
+	static CultureDatabase instance;
+	return instance;
+}
+
+// 编译市政定义库
+CultureDatabase::CultureDatabase() {
+	std::vector<CultureDefinition> definitions;
+	auto add = [&definitions](const CultureDefinition& definition) { definitions.push_back(definition); };
+
+	// 第1层：远古时代市政
+	add({ 101, u8"法典", 25, {}, u8"解锁基础法律系统，建立社会秩序" });
+	definitions.back().policySlotCount[0] = 1; // 1个军事政策槽
+	definitions.back().policyIds = { 1001, 2001 }; // 征兵, 城市规划
+
+	// 第2层：古典时代市政
+	add({ 102, u8"技艺", 50, { 101 }, u8"解锁艺术和手工艺，提升文化产出" });
+	definitions.back().policySlotCount[1] = 1; // 1个经济政策槽
+	definitions.back().policyIds = { 2002 }; // 贸易联盟
+
+	add({ 103, u8"政治哲学", 50, { 101 }, u8"建立政治理论，解锁新政府形式" });
+	definitions.back().governments = { GovernmentType::AUTOCRACY, GovernmentType::OLIGARCHY };
+	definitions.back().policySlotCount[3] = 1; // 1个通用政策槽
+	definitions.back().policyIds = { 3001, 4001 }; // 外交联盟, 启示录
+
+	// 第3层：中世纪市政
+	add({ 104, u8"公会", 80, { 102 }, u8"解锁行会制度，促进经济发展" });
+	definitions.back().policySlotCount[1] = 2; // 2个经济政策槽
+	definitions.back().policyIds = { 2003 }; // 市场经济
+
+	add({ 105, u8"封建主义", 80, { 103 }, u8"建立封建制度，强化地方统治" });
+	definitions.back().governments = { GovernmentType::MONARCHY };
+	definitions.back().policyIds = { 1002 }; // 军团
+
+	add({ 106, u8"历史记录", 80, { 103 }, u8"建立历史档案，提升文化传承" });
+	definitions.back().policyIds = { 4002 }; // 哲学
+
+	// 第4层：文艺复兴市政
+	add({ 107, u8"人文主义", 120, { 106 }, u8"强调人文价值，促进艺术发展" });
+	definitions.back().policySlotCount[2] = 1; // 1个外交政策槽
+	definitions.back().policyIds = { 3002 }; // 启蒙思想
+
+	// 第5层：工业时代市政
+	add({ 108, u8"启蒙运动", 200, { 107 }, u8"提倡理性主义，开启科学革命" });
+	definitions.back().policySlotCount[0] = 2; // 2个军事政策槽
+	definitions.back().policySlotCount[1] = 2; // 2个经济政策槽
+	definitions.back().policyIds = { 1004, 1005 }; // 纪律, 佣兵制
+
+	add({ 109, u8"意识形态", 200, { 107 }, u8"形成明确的政治意识形态" });
+	definitions.back().governments = { GovernmentType::DEMOCRACY, GovernmentType::COMMUNISM, GovernmentType::FASCISM };
+	definitions.back().policyIds = { 4003 }; // 黄金时代
+
+	// 第6层：现代市政
+	add({ 110, u8"城市化", 300, { 108 }, u8"促进城市发展，提高人口容量" });
+	definitions.back().policySlotCount[3] = 2; // 2个通用政策槽
+	definitions.back().policyIds = { 2004 }; // 工业革命
+
+	// 第7层：信息时代市政
+	add({ 111, u8"太空竞赛", 400, { 110 }, u8"开启太空探索，追求科技进步" });
+	definitions.back().governments = { GovernmentType::CORPORATE_LIBERTY };
+	definitions.back().policyIds = { 4004 }; // 科学革命
+
+	add({ 112, u8"极端主义", 400, { 109 }, u8"极端政治思想，激进行动" });
+	// 112不分配政策卡，代表负面效应
+
+	add({ 113, u8"全球化", 400, { 110 }, u8"促进全球合作，加强国际关系" });
+	definitions.back().policySlotCount[2] = 2; // 2个外交政策槽
+	definitions.back().governments = { GovernmentType::DIGITAL_DEMOCRACY };
+	definitions.back().policyIds = { 3003 }; // 国际合作
+
+	std::map<int, std::vector<int>> dependentLists;
+
+	// 设置解锁关系
+	// 第1层解锁第2层
+	dependentLists[101] = { 102, 103 };
+
+	// 第2层解锁第3层
+	dependentLists[102] = { 104 };
+	dependentLists[103] = { 105, 106 };
+
+	// 第3层解锁第4层
+	dependentLists[106] = { 107 };
+
+	// 第4层解锁第5层
+	dependentLists[107] = { 108, 109 };
+
+	// 第5层解锁第6层
+	dependentLists[108] = { 110 };
+	dependentLists[109] = { 112 };
+
+	// 第6层解锁第7层
+	dependentLists[110] = { 111, 113 };
+
+	// 添加一些额外的连接，让市政树更丰富
+	dependentLists[104].push_back(108); // 公会 -> 启蒙运动
+	dependentLists[105].push_back(109); // 封建主义 -> 意识形态
+
+	// 按 ID 升序排列并建立 ID -> 下标映射
+	std::sort(definitions.begin(), definitions.end(),
+		[](const CultureDefinition& a, const CultureDefinition& b) { return a.id < b.id; });
+
+	firstId = definitions.front().id;
+	indexById.assign(definitions.back().id - firstId + 1, -1);
+	std::vector<std::vector<int>> prereqRows, dependentRows, policyRows;
+	std::vector<std::vector<GovernmentType>> governmentRows;
+	for (size_t i = 0; i < definitions.size(); i++) {
+		indexById[definitions[i].id - firstId] = static_cast<int>(i);
+		prereqRows.push_back(definitions[i].prereqs);
+		dependentRows.push_back(dependentLists[definitions[i].id]);
+		governmentRows.push_back(definitions[i].governments);
+		policyRows.push_back(definitions[i].policyIds);
+	}
+	prereqs.build(prereqRows);
+	dependents.build(dependentRows);
+	governments.build(governmentRows);
+	policies.build(policyRows);
+
+	cultures.resize(definitions.size());
+	for (size_t i = 0; i < definitions.size(); i++) {
+		const CultureDefinition& definition = definitions[i];
+		CultureNode& node = cultures[i];
+		int index = static_cast<int>(i);
+		node.id = definition.id;
+		node.index = index;
+		node.name = definition.name;
+		node.cost = definition.cost;
+		node.srcCultureList = prereqs.row(index);
+		node.dstCultureList = dependents.row(index);
+		node.effectDescription = definition.effect;
+		node.unlockedGovernmentList = governments.row(index);
+		std::copy(definition.policySlotCount, definition.policySlotCount + 4, node.policySlotCount);
+		node.unlockedPolicyIds = policies.row(index);
+	}
 
-CultureNode::CultureNode(int id, const std::string& name, int cost, const std::vector<int>& prereqs, const std::string& effect)
-	: id(id), name(name), cost(cost), progress(0), activated(false), srcCultureList(prereqs),
-	effectDescription(effect) {
-	std::fill(policySlotCount, policySlotCount + 4, 0);
+	// 前置位集；后继位集由前置关系反推，不依赖手工维护的后继列表
+	assert(cultures.size() <= static_cast<size_t>(kMaxTreeNodes));
+	for (CultureNode& node : cultures) {
+		for (int srcId : node.srcCultureList) {
+			int prereqIndex = indexOf(srcId);
+			assert(prereqIndex >= 0);
+			if (prereqIndex < 0) continue;
+			node.prereqMask.set(prereqIndex);
+			cultures[prereqIndex].unlockMask.set(node.index);
+		}
+	}
 }
 
-// ʼ
+// 重置市政树：定义共享，只清空本玩家的进度
 void CultureTree::initializeCultureTree() {
-	// 
-	cultureList.clear();
+	cultureProgress.assign(database->getCultureCount(), 0);
+	activatedMask.reset();
+	unlockableMask.reset();
+	for (int i = 0; i < database->getCultureCount(); i++) {
+		if (database->getCultureAt(i).prereqMask.none()) {
+			unlockableMask.set(i);
+		}
+	}
+	newlyUnlockableMask = unlockableMask;
 	activatedCultureList.clear();
 	currentResearchCulture = -1;
-
-	// 1㣺Զʱ
-	cultureList.emplace(101, CultureNode(101, u8"", 25, {}, u8"ϵͳ"));
-	cultureList[101].policySlotCount[0] = 1; // 1߲
-	cultureList[101].unlockedPolicyIds = { 1001, 2001 }; // , й滮
-
-	// 2㣺ŵʱ
-	cultureList.emplace(102, CultureNode(102, u8"", 50, { 101 }, u8"ֹգĻ"));
-	cultureList[102].policySlotCount[1] = 1; // 1߲
-	cultureList[102].unlockedPolicyIds = { 2002 }; // ó
-
-	cultureList.emplace(103, CultureNode(103, u8"ѧ", 50, { 101 }, u8"ۣʽ"));
-	cultureList[103].unlockedGovernmentList = { GovernmentType::AUTOCRACY, GovernmentType::OLIGARCHY };
-	cultureList[103].policySlotCount[3] = 1; // 1߲ͨ
-	cultureList[103].unlockedPolicyIds = { 3001, 4001 }; // ⽻, ʾ¼
-
-	// 3㣺
-	cultureList.emplace(104, CultureNode(104, u8"", 80, { 102 }, u8"лƶȣٽ÷չ"));
-	cultureList[104].policySlotCount[1] = 2; // 2߲
-	cultureList[104].unlockedPolicyIds = { 2003 }; // г
-
-	cultureList.emplace(105, CultureNode(105, u8"⽨", 80, { 103 }, u8"⽨ƶȣǿطͳ"));
-	cultureList[105].unlockedGovernmentList = { GovernmentType::MONARCHY };
-	cultureList[105].unlockedPolicyIds = { 1002 }; // 
-
-	cultureList.emplace(106, CultureNode(106, u8"ʷ¼", 80, { 103 }, u8"ʷĻ"));
-	cultureList[106].unlockedPolicyIds = { 4002 }; // ѧ
-
-	// 4㣺ո
-	cultureList.emplace(107, CultureNode(107, u8"", 120, { 106 }, u8"ǿļֵٽչ"));
-	cultureList[107].policySlotCount[2] = 1; // 1⽻߲
-	cultureList[107].unlockedPolicyIds = { 3002 }; // ˼
-
-	// 5㣺ҵʱ
-	cultureList.emplace(108, CultureNode(108, u8"˶", 200, { 107 }, u8"ᳫ壬ѧ"));
-	cultureList[108].policySlotCount[0] = 2; // 2߲
-	cultureList[108].policySlotCount[1] = 2; // 2߲
-	cultureList[108].unlockedPolicyIds = { 1004, 1005 }; // , Ӷ
-
-	cultureList.emplace(109, CultureNode(109, u8"ʶ̬", 200, { 107 }, u8"γȷʶ̬"));
-	cultureList[109].unlockedGovernmentList = { GovernmentType::DEMOCRACY, GovernmentType::COMMUNISM, GovernmentType::FASCISM };
-	cultureList[109].unlockedPolicyIds = { 4003 }; // ƽʱ
-
-	// 6㣺ִ
-	cultureList.emplace(110, CultureNode(110, u8"л", 300, { 108 }, u8"ٽзչ˿"));
-	cultureList[110].policySlotCount[3] = 2; // 2߲ͨ
-	cultureList[110].unlockedPolicyIds = { 2004 }; // ҵ
-
-	// 7㣺Ϣʱ
-	cultureList.emplace(111, CultureNode(111, u8"̫վ", 400, { 110 }, u8"̫̽׷Ƽ"));
-	cultureList[111].unlockedGovernmentList = { GovernmentType::CORPORATE_LIBERTY };
-	cultureList[111].unlockedPolicyIds = { 4004 }; // ѧ
-
-	cultureList.emplace(112, CultureNode(112, u8"", 400, { 109 }, u8"˼룬ж"));
-	// 112߿ЧӦ
-
-	cultureList.emplace(113, CultureNode(113, u8"ȫ", 400, { 110 }, u8"ٽȫǿʹϵ"));
-	cultureList[113].policySlotCount[2] = 2; // 2⽻߲
-	cultureList[113].unlockedGovernmentList = { GovernmentType::DIGITAL_DEMOCRACY };
-	cultureList[113].unlockedPolicyIds = { 3003 }; // ʺ
-
-	// ýϵ
-	// 12
-	cultureList[101].dstCultureList = { 102, 103 };
-
-	// 23
-	cultureList[102].dstCultureList = { 104 };
-	cultureList[103].dstCultureList = { 105, 106 };
-
-	// 34
-	cultureList[106].dstCultureList = { 107 };
-
-	// 45
-	cultureList[107].dstCultureList = { 108, 109 };
-
-	// 56
-	cultureList[108].dstCultureList = { 110 };
-	cultureList[109].dstCultureList = { 112 };
-
-	// 67
-	cultureList[110].dstCultureList = { 111, 113 };
-
-	// һЩӣḻ
-	cultureList[104].dstCultureList.push_back(108); //  -> ˶
-	cultureList[105].dstCultureList.push_back(109); // ⽨ -> ʶ̬
 }
 
-// õǰо
+// 设置当前研究的市政
 bool CultureTree::setCurrentResearch(int cultureId) {
-	auto it = cultureList.find(cultureId);
-	if (it == cultureList.end()) {
-		return false;
-	}
-
-	// ǷѼɽ
-	if (it->second.activated || !isUnlockable(cultureId)) {
+	// 检查市政是否存在、已激活或可解锁
+	if (!isUnlockable(cultureId)) {
 		return false;
 	}
 
@@ -116,7 +196,7 @@ bool CultureTree::setCurrentResearch(int cultureId) {
 	return true;
 }
 
-// ĻƼӿһ£
+// 增加文化点数（与科技树接口一致）
 void CultureTree::updateProgress(int points) {
 	if (currentResearchCulture <= 0 || points <= 0) {
 		return;
@@ -125,200 +205,191 @@ void CultureTree::updateProgress(int points) {
 	addProgressToCulture(currentResearchCulture, points);
 }
 
-// УƼӿһ£
+// 触发灵感（与科技树接口一致）
 void CultureTree::updateProgress_Inspiration(int cultureId) {
-	auto it = cultureList.find(cultureId);
-	if (it == cultureList.end() || it->second.activated) {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (!node || isActivatedAt(node->index)) {
 		return;
 	}
 
-	// УӸ50%ɱĻֵƼ￨һ£
-	int inspirationPoints = it->second.cost / 2;
+	// 灵感：增加该市政50%成本的文化值（与科技树尤里卡一致）
+	int inspirationPoints = node->cost / 2;
 
-	// ֪ͨ
-	notifyInspirationTriggered(cultureId, it->second.name);
+	// 通知监听器
+	notifyInspirationTriggered(cultureId, node->name);
 
-	// ӽ
+	// 增加进度
 	addProgressToCulture(cultureId, inspirationPoints);
 }
 
-// ڲӽ
+// 内部函数：向市政添加进度
 void CultureTree::addProgressToCulture(int cultureId, int points) {
-	auto it = cultureList.find(cultureId);
-	if (it == cultureList.end() || it->second.activated) {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (!node || isActivatedAt(node->index)) {
 		return;
 	}
 
-	// ǰУǰ
-	if (!isUnlockable(cultureId)) {
+	// 检查前置条件（除非有灵感，否则必须有前置条件）
+	if (!prereqsMet(*node)) {
 		return;
 	}
 
-	// ӽȣܳɱ
-	int newProgress = it->second.progress + points;
-	if (newProgress > it->second.cost) {
-		newProgress = it->second.cost;
+	// 增加进度，但不能超过成本
+	int newProgress = cultureProgress[node->index] + points;
+	if (newProgress > node->cost) {
+		newProgress = node->cost;
 	}
 
-	it->second.progress = newProgress;
+	cultureProgress[node->index] = newProgress;
 
-	// ֪ͨȸ
-	notifyCultureProgress(cultureId, newProgress, it->second.cost);
+	// 通知进度更新
+	notifyCultureProgress(cultureId, newProgress, node->cost);
 
-	// Ƿɽ
-	if (newProgress >= it->second.cost) {
+	// 检查是否完成解锁
+	if (newProgress >= node->cost) {
 		activateCulture(cultureId);
 	}
 }
 
-// 
-void CultureTree::activateCulture(int cultureId) {
-	auto it = cultureList.find(cultureId);
-	if (it == cultureList.end() || it->second.activated) {
-		return;
+// 内部函数：标记解锁，增量更新可解锁集合并更新政策槽位
+void CultureTree::unlockAt(const CultureNode& node) {
+	activatedMask.set(node.index);
+	activatedCultureList.push_back(node.id);
+	unlockableMask.reset(node.index);
+
+	// 只检查以该市政为前置的节点
+	NodeMask candidates = node.unlockMask & ~activatedMask;
+	for (int i = 0; i < database->getCultureCount(); i++) {
+		if (candidates.test(i) && prereqsMet(database->getCultureAt(i))) {
+			unlockableMask.set(i);
+			newlyUnlockableMask.set(i);
+		}
 	}
 
-	it->second.activated = true;
-	activatedCultureList.push_back(cultureId);
-
-	// ߲λ
 	for (int i = 0; i < 4; i++) {
-		activePolicySlots[i] = std::max(activePolicySlots[i],
-			it->second.policySlotCount[i]);
+		activePolicySlots[i] = std::max(activePolicySlots[i], node.policySlotCount[i]);
 	}
 
-	if (currentResearchCulture == cultureId) {
+	if (currentResearchCulture == node.id) {
 		currentResearchCulture = -1;
 	}
+}
 
-	// ֪ͨϵͳļ
-	notifyCultureUnlocked(cultureId, it->second.name, it->second.effectDescription);
+// 激活市政
+void CultureTree::activateCulture(int cultureId) {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (!node || isActivatedAt(node->index)) {
+		return;
+	}
+
+	newlyUnlockableMask.reset();
+	unlockAt(*node);
+
+	// 通知监听器（包括政策系统的监听器）
+	notifyCultureUnlocked(cultureId, node->name, node->effectDescription);
 
 	onCultureUnlocked_internal(cultureId);
 }
 
-// Ƿɽ
+// 检查是否可解锁函数
 bool CultureTree::isUnlockable(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	if (currentNode == cultureList.end() || currentNode->second.activated) {
-		return false;
-	}
-
-	// ǰ
-	for (int srcId : currentNode->second.srcCultureList) {
-		auto prereqNode = cultureList.find(srcId);
-		if (prereqNode == cultureList.end() || !prereqNode->second.activated) {
-			return false;
-		}
-	}
-
-	return true;
+	int index = database->indexOf(cultureId);
+	return index >= 0 && unlockableMask.test(index);
 }
 
-// Ƿ
+// 检查市政是否解锁函数
 bool CultureTree::isActivated(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	return (currentNode != cultureList.end() && currentNode->second.activated);
+	int index = database->indexOf(cultureId);
+	return index >= 0 && isActivatedAt(index);
 }
 
-// ȡоȰٷֱ
+// 获取研究进度百分比
 int CultureTree::getResearchProgressPercent(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	if (currentNode == cultureList.end() || currentNode->second.cost == 0) {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (!node || node->cost == 0) {
 		return 0;
 	}
 
-	return static_cast<int>((currentNode->second.progress * 100) / currentNode->second.cost);
+	return static_cast<int>((cultureProgress[node->index] * 100) / node->cost);
 }
 
-// ȡɽб
+// 获取可解锁的市政列表函数（按 ID 升序）
 std::vector<int> CultureTree::getUnlockableCultureList() const {
-	std::vector<int> currentUnlockable;
-
-	for (const auto& currentCulture : cultureList) {
-		if (!currentCulture.second.activated && isUnlockable(currentCulture.first)) {
-			currentUnlockable.push_back(currentCulture.first);
-		}
-	}
-
-	return currentUnlockable;
+	return maskToIdList(unlockableMask);
 }
 
-// ȡѽб
-std::vector<int> CultureTree::getActivatedCultureList() const {
-	return activatedCultureList;
+// 获取最近一次解锁新开放的市政列表（按 ID 升序）
+std::vector<int> CultureTree::getNewlyUnlockableCultureList() const {
+	return maskToIdList(newlyUnlockableMask & unlockableMask);
 }
 
-// ȡϢ
-const CultureNode* CultureTree::getCultureInfo(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	if (currentNode == cultureList.end()) {
-		return nullptr;
-	}
-	else {
-		return &currentNode->second;
+// 内部函数：位集转换为市政ID列表
+std::vector<int> CultureTree::maskToIdList(const NodeMask& mask) const {
+	std::vector<int> ids;
+	for (int i = 0; i < database->getCultureCount(); i++) {
+		if (mask.test(i)) {
+			ids.push_back(database->getCultureAt(i).id);
+		}
 	}
+	return ids;
 }
 
-// ȡǰ
+// 获取市政当前进度
 int CultureTree::getCultureProgress(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	if (currentNode == cultureList.end()) {
+	int index = database->indexOf(cultureId);
+	if (index < 0) {
 		return -1;
 	}
-	return currentNode->second.progress;
+	return cultureProgress[index];
 }
 
-// ȡɱ
+// 获取市政成本
 int CultureTree::getCultureCost(int cultureId) const {
-	auto currentNode = cultureList.find(cultureId);
-	if (currentNode == cultureList.end()) {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (!node) {
 		return -1;
 	}
-	return currentNode->second.cost;
+	return node->cost;
 }
 
-// л庯
+// 切换政体函数
 bool CultureTree::switchGovernment(GovernmentType newGovernment) {
-	// Ƿ˸
+	// 检查是否解锁了该政体
 	if (!isGovernmentUnlocked(newGovernment)) {
 		return false;
 	}
 
-	// л
+	// 切换政体
 	currentGovernment = newGovernment;
 	return true;
 }
 
-// Ƿ
+// 检查政体是否解锁
 bool CultureTree::isGovernmentUnlocked(GovernmentType government) const {
-	// ѽǷ˸
+	// 遍历所有已解锁的市政，检查是否解锁了该政体
 	for (int cultureId : activatedCultureList) {
-		auto it = cultureList.find(cultureId);
-		if (it != cultureList.end()) {
-			for (GovernmentType unlockedGov : it->second.unlockedGovernmentList) {
-				if (unlockedGov == government) {
-					return true;
-				}
+		const CultureNode* node = database->getCulture(cultureId);
+		if (!node) continue;
+		for (GovernmentType unlockedGov : node->unlockedGovernmentList) {
+			if (unlockedGov == government) {
+				return true;
 			}
 		}
 	}
 	return false;
 }
 
-// ȡѽID
+// 获取所有已解锁的政策ID
 std::vector<int> CultureTree::getUnlockedPolicyIds() const {
 	std::vector<int> allPolicyIds;
 	for (int cultureId : activatedCultureList) {
-		auto it = cultureList.find(cultureId);
-		if (it != cultureList.end()) {
-			for (int policyId : it->second.unlockedPolicyIds) {
-				allPolicyIds.push_back(policyId);
-			}
+		const CultureNode* node = database->getCulture(cultureId);
+		if (node) {
+			allPolicyIds.insert(allPolicyIds.end(), node->unlockedPolicyIds.begin(), node->unlockedPolicyIds.end());
 		}
 	}
 
-	// ȥ
+	// 去重
 	std::sort(allPolicyIds.begin(), allPolicyIds.end());
 	allPolicyIds.erase(std::unique(allPolicyIds.begin(), allPolicyIds.end()),
 		allPolicyIds.end());
@@ -326,31 +397,16 @@ std::vector<int> CultureTree::getUnlockedPolicyIds() const {
 	return allPolicyIds;
 }
 
-// ĻIDȡ
-std::vector<int> CultureTree::getPoliciesUnlockedByCulture(int cultureId) const {
-	auto it = cultureList.find(cultureId);
-	if (it != cultureList.end() && it->second.activated) {
-		return it->second.unlockedPolicyIds;
+// 根据文化ID获取解锁的政策
+ConstSpan<int> CultureTree::getPoliciesUnlockedByCulture(int cultureId) const {
+	const CultureNode* node = database->getCulture(cultureId);
+	if (node && isActivatedAt(node->index)) {
+		return node->unlockedPolicyIds;
 	}
-	return {};
+	return ConstSpan<int>();
 }
 
-// ¼
-void CultureTree::addEventListener(CultureEventListener* listener) {
-	if (listener && std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) {
-		listeners.push_back(listener);
-	}
-}
-
-// Ƴ¼
-void CultureTree::removeEventListener(CultureEventListener* listener) {
-	auto it = std::find(listeners.begin(), listeners.end(), listener);
-	if (it != listeners.end()) {
-		listeners.erase(it);
-	}
-}
-
-// صӰ
+// 回调函数：对市政树内影响
 void CultureTree::onCultureUnlocked_internal(int prereqCultureId) {
 	std::vector<int> newlyUnlocked;
 	newlyUnlocked.push_back(prereqCultureId);
@@ -359,68 +415,42 @@ void CultureTree::onCultureUnlocked_internal(int prereqCultureId) {
 		int currentCulture = newlyUnlocked.back();
 		newlyUnlocked.pop_back();
 
-		// currentCulture
-		auto currentNode = cultureList.find(currentCulture);
-		if (currentNode != cultureList.end()) {
-			for (int dependentCultureId : currentNode->second.dstCultureList) {
-				auto dependentIt = cultureList.find(dependentCultureId);
-				if (dependentIt != cultureList.end() &&
-					!dependentIt->second.activated &&
-					dependentIt->second.progress >= dependentIt->second.cost) {
-
-					// ǰ
-					bool allPrereqsMet = true;
-					for (int prereqId : dependentIt->second.srcCultureList) {
-						auto prereqIt = cultureList.find(prereqId);
-						if (prereqIt == cultureList.end() || !prereqIt->second.activated) {
-							allPrereqsMet = false;
-							break;
-						}
-					}
-
-					if (allPrereqsMet) {
-						dependentIt->second.activated = true;
-						activatedCultureList.push_back(dependentCultureId);
-
-						// ߲λ
-						for (int i = 0; i < 4; i++) {
-							activePolicySlots[i] = std::max(activePolicySlots[i],
-								dependentIt->second.policySlotCount[i]);
-						}
-
-						// ǰоõǰо
-						if (currentResearchCulture == dependentCultureId) {
-							currentResearchCulture = -1;
-						}
-
-						notifyCultureUnlocked(dependentCultureId,
-							dependentIt->second.name,
-							dependentIt->second.effectDescription);
-						newlyUnlocked.push_back(dependentCultureId);
-					}
-				}
+		// 查找所有依赖currentCulture的市政
+		const CultureNode* currentNode = database->getCulture(currentCulture);
+		if (!currentNode) {
+			continue;
+		}
+
+		for (int dependentCultureId : currentNode->dstCultureList) {
+			const CultureNode* dependent = database->getCulture(dependentCultureId);
+			if (dependent &&
+				!isActivatedAt(dependent->index) &&
+				cultureProgress[dependent->index] >= dependent->cost &&
+				prereqsMet(*dependent)) {
+
+				unlockAt(*dependent);
+
+				notifyCultureUnlocked(dependentCultureId,
+					dependent->name,
+					dependent->effectDescription);
+				newlyUnlocked.push_back(dependentCultureId);
 			}
 		}
 	}
 }
 
-// ֪ͨ
+// 发布事件：市政解锁
 void CultureTree::notifyCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect) {
-	for (auto listener : listeners) {
-		listener->onCultureUnlocked(cultureId, cultureName, effect);
-	}
+	EventBus::getInstance()->publish(CultureUnlockedEvent{ this, cultureId });
 }
 
-// ֪ͨĻȸ
+// 发布事件：文化进度更新（界面只需要最新进度，按市政树合并）
 void CultureTree::notifyCultureProgress(int cultureId, int progress, int totalCost) {
-	for (auto listener : listeners) {
-		listener->onCultureProgress(cultureId, progress, totalCost);
-	}
+	EventBus::getInstance()->publishCoalesced(reinterpret_cast<std::intptr_t>(this),
+		CultureProgressEvent{ this, cultureId, progress, totalCost });
 }
 
-// ֪ͨд
+// 发布事件：灵感触发
 void CultureTree::notifyInspirationTriggered(int cultureId, const std::string& cultureName) {
-	for (auto listener : listeners) {
-		listener->onInspirationTriggered(cultureId, cultureName);
-	}
-}
\ No newline at end of file
+	EventBus::getInstance()->publish(InspirationTriggeredEvent{ this, cultureId });
+}
@@ -1,131 +1,174 @@
 #ifndef CULTURE_SYSTEM_H
 #define CULTURE_SYSTEM_H
 
-#include <unordered_map>
+#include "ConstSpan.h"
+#include "NodeMask.h"
 #include <vector>
 #include <string>
 #include <algorithm>
 
-// ö
+// 政体枚举
 enum class GovernmentType {
-	CHIEFDOM,           // 
-	AUTOCRACY,          // ͳ  
-	OLIGARCHY,          // ͷ
-	CLASSICAL_REPUBLIC, // ŵ乲
-	MONARCHY,           // 
-	THEOCRACY,          // Ȩ
-	MERCHANT_REPUBLIC,  // ˹͹
-	DEMOCRACY,          // 
-	COMMUNISM,          // 
-	FASCISM,            // ˹
-	CORPORATE_LIBERTY,  // ˾
-	DIGITAL_DEMOCRACY   // 
+	CHIEFDOM,           // 酋邦
+	AUTOCRACY,          // 独裁统治  
+	OLIGARCHY,          // 寡头政体
+	CLASSICAL_REPUBLIC, // 古典共和
+	MONARCHY,           // 君主制
+	THEOCRACY,          // 神权政治
+	MERCHANT_REPUBLIC,  // 商人共和国
+	DEMOCRACY,          // 民主制
+	COMMUNISM,          // 共产主义
+	FASCISM,            // 法西斯主义
+	CORPORATE_LIBERTY,  // 公司自由制
+	DIGITAL_DEMOCRACY   // 数字民主
 };
 
-// ڵṹ
+// 市政定义（只读，所有玩家共享；进度与解锁状态保存在各自的 CultureTree 中）
 struct CultureNode {
 	int id;
+	int index;                              // 在定义库扁平数组中的下标
 	std::string name;
-	int cost;                       // Ļֵܳɱ- ֶ
-	int progress;					// ͶĻֵӰٷֱȸΪֵ
-	bool activated;					// ״̬
-	std::vector<int> srcCultureList;	// ǰID
-	std::vector<int> dstCultureList;	// ID
-	std::string effectDescription;		// Ч
-
-	// 
-	std::vector<GovernmentType> unlockedGovernmentList;
-	// ߿λ
-	int policySlotCount[4]; // 4[,,⽻,ͨ]
-	// ߿IDб
-	std::vector<int> unlockedPolicyIds;
-
-	// ߲λö
+	int cost;                               // 所需文化值（总成本）
+	ConstSpan<int> srcCultureList;          // 前置市政ID
+	ConstSpan<int> dstCultureList;          // 后继市政ID
+	std::string effectDescription;          // 效果描述
+
+	// 市政解锁的政体
+	ConstSpan<GovernmentType> unlockedGovernmentList;
+	// 市政解锁的政策卡槽位
+	int policySlotCount[4]; // 4个索引依次是[军事,经济,外交,通用]
+	// 解锁的政策卡ID列表
+	ConstSpan<int> unlockedPolicyIds;
+
+	NodeMask prereqMask;                    // 前置市政位集（按下标）
+	NodeMask unlockMask;                    // 以本市政为前置的市政位集（由前置关系反推）
+
+	// 政策槽位类型枚举
 	enum class SlotType { MILITARY, ECONOMIC, DIPLOMATIC, WILDCARD };
-
-	CultureNode() = default;// ֹϵͳó
-	CultureNode(int id, const std::string& name, int cost, const std::vector<int>& prereqs, const std::string& effect = "");
 };
 
-// ¼ӿ
-class CultureEventListener {
+// 市政定义库：启动时编译一次，之后只读
+// 定义按 ID 升序存放在扁平数组中，前置/后继、政体与政策卡列表以 CSR 形式存储
+class CultureDatabase {
 public:
-	virtual ~CultureEventListener() {}
+	static const CultureDatabase& getInstance();
+
+	int getCultureCount() const { return static_cast<int>(cultures.size()); }
+	const CultureNode& getCultureAt(int index) const { return cultures[index]; }
+
+	// ID -> 下标，不存在时返回 -1
+	int indexOf(int cultureId) const {
+		int offset = cultureId - firstId;
+		return (offset >= 0 && offset < static_cast<int>(indexById.size())) ? indexById[offset] : -1;
+	}
+	const CultureNode* getCulture(int cultureId) const {
+		int index = indexOf(cultureId);
+		return index >= 0 ? &cultures[index] : nullptr;
+	}
 
-	// 
-	virtual void onCultureUnlocked(int cultureId, const std::string& cultureName,
-		const std::string& effect) = 0;
+private:
+	CultureDatabase();
+	CultureDatabase(const CultureDatabase&) = delete;
+	CultureDatabase& operator=(const CultureDatabase&) = delete;
+
+	std::vector<CultureNode> cultures;          // 按 ID 升序
+	int firstId;                                // 最小 ID（市政 ID 从 101 开始）
+	std::vector<int> indexById;                 // (ID - firstId) -> 下标（-1 表示不存在）
+	CsrTable<int> prereqs;                      // 前置市政
+	CsrTable<int> dependents;                   // 后继市政
+	CsrTable<GovernmentType> governments;       // 解锁的政体
+	CsrTable<int> policies;                     // 解锁的政策卡
+};
 
-	// Ļȸ
-	virtual void onCultureProgress(int cultureId, int currentProgress, int totalCost) = 0; // ޸Ĳ
+class CultureTree;
 
-	// б
-	virtual void onInspirationTriggered(int cultureId, const std::string& cultureName) = 0;
+// 市政事件（通过 EventBus 发布，tree 用于区分所属玩家，名称等信息通过 getCultureInfo 查询）
+// 市政被解锁（立即派发）
+struct CultureUnlockedEvent {
+	const CultureTree* tree;
+	int cultureId;
 };
 
-// 
+// 文化进度更新（按市政树合并，每帧派发一次）
+struct CultureProgressEvent {
+	const CultureTree* tree;
+	int cultureId;
+	int currentProgress;
+	int totalCost;
+};
+
+// 灵感被触发（立即派发）
+struct InspirationTriggeredEvent {
+	const CultureTree* tree;
+	int cultureId;
+};
+
+// 市政树：每个玩家一份，只保存按定义下标排列的进度与解锁状态
 class CultureTree {
 private:
-	std::unordered_map<int, CultureNode> cultureList;	// IDڵӳ
-	std::vector<int> activatedCultureList;				// Ѽб
-	GovernmentType currentGovernment;					// ǰ
-	int activePolicySlots[4];							// ǰ߲λ
-	int currentResearchCulture;							// ǰоID
-
-	std::vector<CultureEventListener*> listeners;
+	const CultureDatabase* database;					// 共享定义库
+	std::vector<int> cultureProgress;					// 已投入文化值（按下标）
+	NodeMask activatedMask;								// 已解锁市政位集
+	NodeMask unlockableMask;							// 可解锁市政位集（随解锁增量维护）
+	NodeMask newlyUnlockableMask;						// 最近一次解锁新开放的市政位集
+	std::vector<int> activatedCultureList;				// 已激活市政列表
+	GovernmentType currentGovernment;					// 当前政体
+	int activePolicySlots[4];							// 当前激活的政策槽位
+	int currentResearchCulture;							// 当前正在研究的市政ID
 
 public:
-	CultureTree() {
+	CultureTree() : database(&CultureDatabase::getInstance()) {
 		initializeCultureTree();
 		currentGovernment = GovernmentType::CHIEFDOM;
 		std::fill(activePolicySlots, activePolicySlots + 4, 0);
-		currentResearchCulture = -1; // ʼûо
+		currentResearchCulture = -1; // 初始没有研究
 	}
 
-	~CultureTree() {
-		listeners.clear();
-	}
-
-	// д
+	// 写操作
+	// 重置为初始状态（定义由 CultureDatabase 共享，这里只清空进度）
 	void initializeCultureTree();
 
-	// õǰо
+	// 设置当前研究的市政
 	bool setCurrentResearch(int cultureId);
 	int getCurrentResearch() const { return currentResearchCulture; }
 
-	// ĻƼӿһ£
+	// 增加文化点数（与科技树接口一致）
 	void updateProgress(int points);
 
-	// УƼӿһ£
+	// 触发灵感（与科技树接口一致）
 	void updateProgress_Inspiration(int cultureId);
 
-	// 
+	// 政体相关
 	bool switchGovernment(GovernmentType newGovernment);
 	GovernmentType getCurrentGovernment() const { return currentGovernment; }
 
-	// Ƿǲѯ
+	// 是非查询
 	bool isUnlockable(int cultureId) const;
 	bool isActivated(int cultureId) const;
 	bool isGovernmentUnlocked(GovernmentType government) const;
 
-	// ȡоȰٷֱȣƼӿһ£
+	// 获取研究进度百分比（与科技树接口一致）
 	int getResearchProgressPercent(int cultureId) const;
 
-	// 
+	// 读操作
 	std::vector<int> getUnlockableCultureList() const;
-	std::vector<int> getActivatedCultureList() const;
-	const CultureNode* getCultureInfo(int cultureId) const;
+	bool hasUnlockableCulture() const { return unlockableMask.any(); }
+	const NodeMask& getUnlockableMask() const { return unlockableMask; }
+	// 最近一次市政解锁（含连锁解锁）后新变为可解锁的市政ID
+	std::vector<int> getNewlyUnlockableCultureList() const;
+	const std::vector<int>& getActivatedCultureList() const { return activatedCultureList; }
+	const CultureNode* getCultureInfo(int cultureId) const { return database->getCulture(cultureId); }
 	int getCultureProgress(int cultureId) const;
-	int getCultureCost(int cultureId) const; // ȡĻɱ
+	int getCultureCost(int cultureId) const; // 新增：获取文化成本
 	const int* getActivePolicySlots() const { return activePolicySlots; }
 
-	// ȡѽIDϵͳã
+	// 新增：获取已解锁的政策ID（供政策系统调用）
 	std::vector<int> getUnlockedPolicyIds() const;
 
-	// ĻIDȡID
-	std::vector<int> getPoliciesUnlockedByCulture(int cultureId) const;
+	// 新增：根据文化ID获取解锁的政策ID
+	ConstSpan<int> getPoliciesUnlockedByCulture(int cultureId) const; // 市政未激活时为空区间
 
-	// ȡǰõ߲λϢ
+	// 新增：获取当前可用的政策槽位信息
 	struct PolicySlotInfo {
 		int military;
 		int economic;
@@ -138,20 +181,20 @@ public:
 				activePolicySlots[2], activePolicySlots[3] };
 	}
 
-	// ¼
-	void addEventListener(CultureEventListener* listener);
-	void removeEventListener(CultureEventListener* listener);
-
 private:
 	void onCultureUnlocked_internal(int prereqCultureId);
 
-	// ڲ
+	// 内部函数
+	bool isActivatedAt(int index) const { return activatedMask.test(index); }
+	bool prereqsMet(const CultureNode& node) const { return maskCovers(activatedMask, node.prereqMask); }
+	std::vector<int> maskToIdList(const NodeMask& mask) const;
+	void unlockAt(const CultureNode& node);
 	void addProgressToCulture(int cultureId, int points);
 	void activateCulture(int cultureId);
 
-	// ֪ͨ
+	// 发布事件
 	void notifyCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect);
-	void notifyCultureProgress(int cultureId, int progress, int totalCost); // ޸Ĳ
+	void notifyCultureProgress(int cultureId, int progress, int totalCost); // 修改参数
 	void notifyInspirationTriggered(int cultureId, const std::string& cultureName);
 };
 
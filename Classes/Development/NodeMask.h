@@ -0,0 +1,16 @@
+#ifndef NODE_MASK_H
+#define NODE_MASK_H
+
+#include <bitset>
+
+// 科技树/市政树节点位集：第 i 位对应定义库扁平数组中下标为 i 的节点
+// 两棵树的节点数都远小于上限，定义库构建时会检查
+static const int kMaxTreeNodes = 64;
+typedef std::bitset<kMaxTreeNodes> NodeMask;
+
+// 前置条件判断：prereq 中的每一位都已在 done 中置位
+inline bool maskCovers(const NodeMask& done, const NodeMask& prereq) {
+	return (prereq & ~done).none();
+}
+
+#endif // NODE_MASK_H
@@ -1,98 +1,201 @@
 #include "PolicySystem.h"
+#include <algorithm>
+#include <unordered_map>
 
-PolicyManager::PolicyManager(CultureTree* cultureTree) : _cultureTree(cultureTree) {
+void ModifierTable::clear() {
+    for (int i = 0; i < kEffectCount; ++i) {
+        total[i] = 0;
+        for (int j = 0; j < kTargetCount; ++j) byTarget[i][j] = 0;
+    }
+}
+
+void ModifierTable::add(const PolicyEffect& effect) {
+    int type = (int)effect.type;
+    byTarget[type][(int)PolicyManager::parseModifierTarget(effect.target)] += effect.value;
+    total[type] += effect.value;
+}
+
+PolicyManager::PolicyManager(CultureTree* cultureTree)
+    : _cultureTree(cultureTree), _cultureUnlockedListener(0), _database(&PolicyDatabase::getInstance()) {
     initGameData();
     if (_cultureTree) {
-        _cultureTree->addEventListener(this);
+        _cultureUnlockedListener = EventBus::getInstance()->subscribe<CultureUnlockedEvent>(
+            [this](const CultureUnlockedEvent& event) {
+                if (event.tree != _cultureTree) return;
+                const CultureNode* node = _cultureTree->getCultureInfo(event.cultureId);
+                if (node) onCultureUnlocked(event.cultureId, node->name, node->effectDescription);
+            });
     }
     updateGovernmentSlots();
 }
 
 PolicyManager::~PolicyManager() {
-    if (_cultureTree) {
-        _cultureTree->removeEventListener(this);
-    }
+    EventBus::getInstance()->unsubscribe<CultureUnlockedEvent>(_cultureUnlockedListener);
 }
 
-void PolicyManager::initGameData() {
+const PolicyDatabase& PolicyDatabase::getInstance() {
+    static PolicyDatabase instance;
+    return instance;
+}
+
+// 编译政策定义库：政体配置按枚举值存放，卡牌按 ID 升序存放
+PolicyDatabase::PolicyDatabase() {
     // Tier 0
-    _govDatabase[GovernmentType::CHIEFDOM] = { u8"", 1, 1, 0, {} };
+    _govConfigs[(int)GovernmentType::CHIEFDOM] = { u8"酋邦", 1, 1, 0, {} };
 
     // Tier 1
-    _govDatabase[GovernmentType::AUTOCRACY] = { u8"ͳ", 2, 1, 1,
+    _govConfigs[(int)GovernmentType::AUTOCRACY] = { u8"独裁统治", 2, 1, 1,
         {{EffectType::COMBAT_STRENGTH, 1, u8"AllUnits"}} };
 
-    _govDatabase[GovernmentType::OLIGARCHY] = { u8"ͷ", 2, 1, 1,
+    _govConfigs[(int)GovernmentType::OLIGARCHY] = { u8"寡头政体", 2, 1, 1,
         {{EffectType::COMBAT_STRENGTH, 4, u8"Melee"}} };
 
-    _govDatabase[GovernmentType::CLASSICAL_REPUBLIC] = { u8"ŵ乲", 0, 3, 1,
+    _govConfigs[(int)GovernmentType::CLASSICAL_REPUBLIC] = { u8"古典共和", 0, 3, 1,
         {{EffectType::MODIFIER_CULTURE, 10, u8"City"}} };
 
     // Tier 2
-    _govDatabase[GovernmentType::MONARCHY] = { u8"", 3, 2, 1,
+    _govConfigs[(int)GovernmentType::MONARCHY] = { u8"君主制", 3, 2, 1,
         {{EffectType::MODIFIER_PRODUCTION, 20, u8"Walls"}} };
 
-    _govDatabase[GovernmentType::DEMOCRACY] = { u8"", 1, 4, 1,
+    _govConfigs[(int)GovernmentType::DEMOCRACY] = { u8"民主制", 1, 4, 1,
         {{EffectType::MODIFIER_SCIENCE, 10, u8"City"}} };
 
-    // Ĭ
-    GovernmentConfig defaultConfig = { u8"δ֪", 1, 1, 0, {} };
-    _govDatabase[GovernmentType::THEOCRACY] = defaultConfig;
-    _govDatabase[GovernmentType::MERCHANT_REPUBLIC] = defaultConfig;
-    _govDatabase[GovernmentType::COMMUNISM] = defaultConfig;
-    _govDatabase[GovernmentType::FASCISM] = defaultConfig;
-    _govDatabase[GovernmentType::CORPORATE_LIBERTY] = defaultConfig;
-    _govDatabase[GovernmentType::DIGITAL_DEMOCRACY] = defaultConfig;
-
-    // ߿ʼ
-    _cardDatabase[1001] = { 1001, u8"", u8"λά-1", PolicyType::MILITARY, {{EffectType::MAINTENANCE_DISCOUNT, 1, u8"Unit"}} };
-    _cardDatabase[1001].isUnlocked = true;
-    _cardDatabase[1002] = { 1002, u8"", u8"еλ+5ս", PolicyType::MILITARY, {{EffectType::COMBAT_STRENGTH, 5, u8"All"}} };
-    _cardDatabase[1003] = { 1003, u8"ͳ", u8"+100%ٶ", PolicyType::MILITARY, {{EffectType::UNIT_PRODUCTION, 100, u8"Naval"}} };
-    _cardDatabase[1004] = { 1004, u8"", u8"+5սԿ", PolicyType::MILITARY, {{EffectType::COMBAT_STRENGTH, 5, u8"Barbarian"}} };
-    _cardDatabase[1005] = { 1005, u8"Ӷ", u8"-50%", PolicyType::MILITARY, {{EffectType::MAINTENANCE_DISCOUNT, 50, u8"Upgrade"}} };
-
-    _cardDatabase[2001] = { 2001, u8"й滮", u8"г+1", PolicyType::ECONOMIC, {{EffectType::MODIFIER_PRODUCTION, 5, u8"City"}} };
-    _cardDatabase[2001].isUnlocked = true;
-    _cardDatabase[2002] = { 2002, u8"ó", u8"+10% ", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 10, u8"City"}} };
-    _cardDatabase[2003] = { 2003, u8"г", u8"+20% ", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 20, u8"City"}} };
-    _cardDatabase[2004] = { 2004, u8"ҵ", u8"+15% ", PolicyType::ECONOMIC, {{EffectType::MODIFIER_PRODUCTION, 15, u8"City"}} };
-
-    _cardDatabase[3001] = { 3001, u8"⽻", u8"+5% Ƽ (ԭ⽻)", PolicyType::ECONOMIC, {{EffectType::MODIFIER_SCIENCE, 5, u8"City"}} };
-    _cardDatabase[3002] = { 3002, u8"˼", u8"+100% ѧԺ", PolicyType::ECONOMIC, {{EffectType::MODIFIER_SCIENCE, 100, u8"Campus"}} };
-    _cardDatabase[3003] = { 3003, u8"ʺ", u8"+50% ó·", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 50, u8"Trade"}} };
-
-    _cardDatabase[4001] = { 4001, u8"ʾ¼", u8"+2 ԤԼҵ", PolicyType::WILDCARD, {{EffectType::MODIFIER_CULTURE, 5, u8"City"}} };
-    _cardDatabase[4001].isUnlocked = true;
-    _cardDatabase[4002] = { 4002, u8"ѧ", u8"+100% Ժ", PolicyType::ECONOMIC, {{EffectType::MODIFIER_CULTURE, 100, u8"Theater"}} };
-    _cardDatabase[4003] = { 4003, u8"ƽʱ", u8"в+10%", PolicyType::WILDCARD, {{EffectType::MODIFIER_SCIENCE, 10, u8"City"}} };
-    _cardDatabase[4004] = { 4004, u8"ѧ", u8"+100% Ƽ", PolicyType::WILDCARD, {{EffectType::MODIFIER_SCIENCE, 100, u8"SciBuilding"}} };
+    // 默认
+    GovernmentConfig defaultConfig = { u8"未知政体", 1, 1, 0, {} };
+    _govConfigs[(int)GovernmentType::THEOCRACY] = defaultConfig;
+    _govConfigs[(int)GovernmentType::MERCHANT_REPUBLIC] = defaultConfig;
+    _govConfigs[(int)GovernmentType::COMMUNISM] = defaultConfig;
+    _govConfigs[(int)GovernmentType::FASCISM] = defaultConfig;
+    _govConfigs[(int)GovernmentType::CORPORATE_LIBERTY] = defaultConfig;
+    _govConfigs[(int)GovernmentType::DIGITAL_DEMOCRACY] = defaultConfig;
+
+    // 政策卡初始化
+    _cards.push_back({ 1001, u8"征兵", u8"单位维护费-1", PolicyType::MILITARY, {{EffectType::MAINTENANCE_DISCOUNT, 1, u8"Unit"}} });
+    _cards.back().startsUnlocked = true;
+    _cards.push_back({ 1002, u8"军团", u8"所有单位+5战斗力", PolicyType::MILITARY, {{EffectType::COMBAT_STRENGTH, 5, u8"All"}} });
+    _cards.push_back({ 1003, u8"海军传统", u8"海军+100%建造速度", PolicyType::MILITARY, {{EffectType::UNIT_PRODUCTION, 100, u8"Naval"}} });
+    _cards.push_back({ 1004, u8"纪律", u8"+5战斗力对抗蛮族", PolicyType::MILITARY, {{EffectType::COMBAT_STRENGTH, 5, u8"Barbarian"}} });
+    _cards.push_back({ 1005, u8"佣兵制", u8"升级费用-50%", PolicyType::MILITARY, {{EffectType::MAINTENANCE_DISCOUNT, 50, u8"Upgrade"}} });
+
+    _cards.push_back({ 2001, u8"城市规划", u8"所有城市+1生产力", PolicyType::ECONOMIC, {{EffectType::MODIFIER_PRODUCTION, 5, u8"City"}} });
+    _cards.back().startsUnlocked = true;
+    _cards.push_back({ 2002, u8"贸易联盟", u8"+10% 金币", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 10, u8"City"}} });
+    _cards.push_back({ 2003, u8"市场经济", u8"+20% 金币", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 20, u8"City"}} });
+    _cards.push_back({ 2004, u8"工业革命", u8"+15% 生产力", PolicyType::ECONOMIC, {{EffectType::MODIFIER_PRODUCTION, 15, u8"City"}} });
+
+    _cards.push_back({ 3001, u8"外交联盟", u8"+5% 科技 (原外交卡)", PolicyType::ECONOMIC, {{EffectType::MODIFIER_SCIENCE, 5, u8"City"}} });
+    _cards.push_back({ 3002, u8"启蒙思想", u8"+100% 学院产出", PolicyType::ECONOMIC, {{EffectType::MODIFIER_SCIENCE, 100, u8"Campus"}} });
+    _cards.push_back({ 3003, u8"国际合作", u8"+50% 贸易路线收益", PolicyType::ECONOMIC, {{EffectType::MODIFIER_GOLD, 50, u8"Trade"}} });
+
+    _cards.push_back({ 4001, u8"启示录", u8"+2 大预言家点数", PolicyType::WILDCARD, {{EffectType::MODIFIER_CULTURE, 5, u8"City"}} });
+    _cards.back().startsUnlocked = true;
+    _cards.push_back({ 4002, u8"哲学", u8"+100% 剧院产出", PolicyType::ECONOMIC, {{EffectType::MODIFIER_CULTURE, 100, u8"Theater"}} });
+    _cards.push_back({ 4003, u8"黄金时代", u8"所有产出+10%", PolicyType::WILDCARD, {{EffectType::MODIFIER_SCIENCE, 10, u8"City"}} });
+    _cards.push_back({ 4004, u8"科学革命", u8"+100% 科技建筑产出", PolicyType::WILDCARD, {{EffectType::MODIFIER_SCIENCE, 100, u8"SciBuilding"}} });
+
+    std::sort(_cards.begin(), _cards.end(),
+        [](const PolicyCard& a, const PolicyCard& b) { return a.id < b.id; });
+
+    // 政体固有加成不会变化，直接编译成表
+    for (int i = 0; i < kGovernmentCount; ++i) {
+        for (const auto& eff : _govConfigs[i].inherentBonuses) _govModifiers[i].add(eff);
+    }
 }
 
-void PolicyManager::updateGovernmentSlots() {
-    if (!_cultureTree) return;
-    GovernmentType currentGov = _cultureTree->getCurrentGovernment();
+int PolicyDatabase::indexOf(int cardId) const {
+    auto it = std::lower_bound(_cards.begin(), _cards.end(), cardId,
+        [](const PolicyCard& card, int id) { return card.id < id; });
+    if (it == _cards.end() || it->id != cardId) return -1;
+    return (int)(it - _cards.begin());
+}
 
-    if (_govDatabase.find(currentGov) == _govDatabase.end()) {
-        currentGov = GovernmentType::CHIEFDOM;
+const PolicyCard* PolicyDatabase::getCard(int cardId) const {
+    int index = indexOf(cardId);
+    return index >= 0 ? &_cards[index] : nullptr;
+}
+
+void PolicyManager::initGameData() {
+    _cardUnlocked.assign(_database->getCardCount(), 0);
+    _cardActive.assign(_database->getCardCount(), 0);
+    for (int i = 0; i < _database->getCardCount(); ++i) {
+        _cardUnlocked[i] = _database->getCardAt(i).startsUnlocked ? 1 : 0;
     }
+}
+
+bool PolicyManager::isPolicyUnlocked(int cardId) const {
+    int index = _database->indexOf(cardId);
+    return index >= 0 && _cardUnlocked[index];
+}
+
+bool PolicyManager::isPolicyActive(int cardId) const {
+    int index = _database->indexOf(cardId);
+    return index >= 0 && _cardActive[index];
+}
+
+ModifierTarget PolicyManager::parseModifierTarget(const std::string& target) {
+    static const std::unordered_map<std::string, ModifierTarget> kTargets = {
+        { "City", ModifierTarget::GLOBAL },
+        { "All", ModifierTarget::GLOBAL },
+        { "AllUnits", ModifierTarget::GLOBAL },
+        { "Unit", ModifierTarget::GLOBAL },
+        { "Campus", ModifierTarget::CAMPUS },
+        { "SciBuilding", ModifierTarget::CAMPUS },
+        { "Theater", ModifierTarget::THEATER_SQUARE },
+        { "CommercialHub", ModifierTarget::COMMERCIAL_HUB },
+        { "IndustryZone", ModifierTarget::INDUSTRY_ZONE },
+        { "Harbor", ModifierTarget::HARBOR },
+        { "Spaceport", ModifierTarget::SPACEPORT },
+        { "Melee", ModifierTarget::MELEE },
+        { "Ranged", ModifierTarget::RANGED },
+        { "Siege", ModifierTarget::SIEGE },
+        { "Aviation", ModifierTarget::AVIATION },
+        { "Naval", ModifierTarget::NAVAL }
+    };
+
+    auto it = kTargets.find(target);
+    return it != kTargets.end() ? it->second : ModifierTarget::OTHER;
+}
 
-    const auto& config = _govDatabase[currentGov];
+void PolicyManager::rebuildCardModifiers() {
+    _cardModifiers.clear();
 
-    for (auto& pair : _cardDatabase) pair.second.isActive = false;
+    auto addCards = [this](const std::vector<int>& slots) {
+        for (int id : slots) {
+            if (id == -1) continue;
+            const PolicyCard* card = _database->getCard(id);
+            if (!card) continue;
+            for (const auto& eff : card->effects) _cardModifiers.add(eff);
+        }
+        };
+    addCards(_equippedMilitary);
+    addCards(_equippedEconomic);
+    addCards(_equippedWildcard);
+}
+
+const ModifierTable* PolicyManager::getGovModifiers() const {
+    if (!_cultureTree) return nullptr;
+    return &_database->getGovModifiers(_cultureTree->getCurrentGovernment());
+}
+
+void PolicyManager::updateGovernmentSlots() {
+    if (!_cultureTree) return;
+    const auto& config = _database->getGovConfig(_cultureTree->getCurrentGovernment());
+
+    std::fill(_cardActive.begin(), _cardActive.end(), 0);
 
     _equippedMilitary.assign(config.militarySlots, -1);
     _equippedEconomic.assign(config.economicSlots, -1);
     _equippedWildcard.assign(config.wildcardSlots, -1);
+    rebuildCardModifiers();
 }
 
 bool PolicyManager::equipPolicy(int cardId, PolicyType slotType, int slotIndex) {
-    auto it = _cardDatabase.find(cardId);
-    if (it == _cardDatabase.end()) return false;
-    auto& card = it->second;
+    int index = _database->indexOf(cardId);
+    if (index < 0) return false;
+    const PolicyCard& card = _database->getCardAt(index);
 
-    if (!card.isUnlocked) return false;
-    if (card.isActive) return false;
+    if (!_cardUnlocked[index]) return false;
+    if (_cardActive[index]) return false;
 
     if (slotType != PolicyType::WILDCARD && card.type != slotType) {
         return false;
@@ -106,17 +209,19 @@ bool PolicyManager::equipPolicy(int cardId, PolicyType slotType, int slotIndex)
     }
 
     slots[slotIndex] = cardId;
-    card.isActive = true;
+    _cardActive[index] = 1;
+    rebuildCardModifiers();
     return true;
 }
 
 bool PolicyManager::unequipPolicy(int cardId) {
-    auto it = _cardDatabase.find(cardId);
-    if (it == _cardDatabase.end()) return false;
+    int index = _database->indexOf(cardId);
+    if (index < 0) return false;
 
-    if (it->second.isActive) {
+    if (_cardActive[index]) {
         removeCardFromSlots(cardId);
-        it->second.isActive = false;
+        _cardActive[index] = 0;
+        rebuildCardModifiers();
         return true;
     }
     return false;
@@ -133,91 +238,56 @@ void PolicyManager::removeCardFromSlots(int cardId) {
     remove(_equippedWildcard);
 }
 
-float PolicyManager::getYieldModifier(EffectType type) const {
-    float modifier = 0.0f;
-
-    if (_cultureTree) {
-        GovernmentType gov = _cultureTree->getCurrentGovernment();
-        auto it = _govDatabase.find(gov);
-        if (it != _govDatabase.end()) {
-            for (const auto& eff : it->second.inherentBonuses) {
-                if (eff.type == type) modifier += eff.value;
-            }
-        }
+int PolicyManager::getYieldModifier(EffectType type) const {
+    int modifier = _cardModifiers.total[(int)type];
+    if (const ModifierTable* gov = getGovModifiers()) {
+        modifier += gov->total[(int)type];
     }
+    return modifier;
+}
 
-    auto sumCards = [&](const std::vector<int>& slots) {
-        for (int id : slots) {
-            if (id != -1) {
-                auto itCard = _cardDatabase.find(id);
-                if (itCard != _cardDatabase.end()) {
-                    for (const auto& eff : itCard->second.effects) {
-                        if (eff.type == type) modifier += eff.value;
-                    }
-                }
-            }
-        }
-        };
-    sumCards(_equippedMilitary);
-    sumCards(_equippedEconomic);
-    sumCards(_equippedWildcard);
-
+int PolicyManager::getYieldModifier(EffectType type, ModifierTarget target) const {
+    int modifier = _cardModifiers.byTarget[(int)type][(int)target];
+    if (const ModifierTable* gov = getGovModifiers()) {
+        modifier += gov->byTarget[(int)type][(int)target];
+    }
     return modifier;
 }
 
 int PolicyManager::getCombatBonus(const std::string& targetUnit) const {
-    int bonus = 0;
-    auto sumCombat = [&](const std::vector<int>& slots) {
-        for (int id : slots) {
-            if (id != -1) {
-                auto itCard = _cardDatabase.find(id);
-                if (itCard != _cardDatabase.end()) {
-                    for (const auto& eff : itCard->second.effects) {
-                        if (eff.type == EffectType::COMBAT_STRENGTH) bonus += (int)eff.value;
-                    }
-                }
-            }
-        }
-        };
-    sumCombat(_equippedMilitary);
-    sumCombat(_equippedEconomic);
-    sumCombat(_equippedWildcard);
+    // 只统计政策卡：全局加成 + 该单位类别的加成
+    int type = (int)EffectType::COMBAT_STRENGTH;
+    int bonus = _cardModifiers.byTarget[type][(int)ModifierTarget::GLOBAL];
+    ModifierTarget target = parseModifierTarget(targetUnit);
+    if (target != ModifierTarget::GLOBAL) {
+        bonus += _cardModifiers.byTarget[type][(int)target];
+    }
     return bonus;
 }
 
 const GovernmentConfig& PolicyManager::getCurrentGovConfig() const {
     if (_cultureTree) {
-        GovernmentType gov = _cultureTree->getCurrentGovernment();
-        auto it = _govDatabase.find(gov);
-        if (it != _govDatabase.end()) {
-            return it->second;
-        }
+        return _database->getGovConfig(_cultureTree->getCurrentGovernment());
     }
-    return _govDatabase.at(GovernmentType::CHIEFDOM);
+    return _database->getGovConfig(GovernmentType::CHIEFDOM);
 }
 
-std::vector<PolicyCard> PolicyManager::getUnlockedCards(PolicyType type) const {
-    std::vector<PolicyCard> result;
-    for (const auto& pair : _cardDatabase) {
-        const auto& card = pair.second;
-        if (card.isUnlocked) {
+std::vector<const PolicyCard*> PolicyManager::getUnlockedCards(PolicyType type) const {
+    std::vector<const PolicyCard*> result;
+    for (int i = 0; i < _database->getCardCount(); ++i) {
+        const auto& card = _database->getCardAt(i);
+        if (_cardUnlocked[i]) {
             if (type == PolicyType::WILDCARD) {
-                if (card.type == PolicyType::WILDCARD) result.push_back(card);
+                if (card.type == PolicyType::WILDCARD) result.push_back(&card);
             }
             else {
-                if (card.type == type) result.push_back(card);
+                if (card.type == type) result.push_back(&card);
             }
         }
     }
     return result;
 }
 
-const PolicyCard* PolicyManager::getPolicyCard(int cardId) const {
-    auto it = _cardDatabase.find(cardId);
-    if (it != _cardDatabase.end()) return &it->second;
-    return nullptr;
-}
-
 std::vector<EquippedPolicyInfo> PolicyManager::getEquippedPolicies() const {
     std::vector<EquippedPolicyInfo> result;
     auto add = [&](const std::vector<int>& slots, PolicyType type) {
@@ -234,11 +304,12 @@ std::vector<EquippedPolicyInfo> PolicyManager::getEquippedPolicies() const {
 }
 
 void PolicyManager::onCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect) {
-    std::vector<int> unlockedIds = _cultureTree->getPoliciesUnlockedByCulture(cultureId);
+    ConstSpan<int> unlockedIds = _cultureTree->getPoliciesUnlockedByCulture(cultureId);
     for (int id : unlockedIds) {
-        if (_cardDatabase.find(id) != _cardDatabase.end()) {
-            _cardDatabase[id].isUnlocked = true;
-            std::cout << u8"Unlocked Policy: " << _cardDatabase[id].name << std::endl;
+        int index = _database->indexOf(id);
+        if (index >= 0) {
+            _cardUnlocked[index] = 1;
+            std::cout << u8"Unlocked Policy: " << _database->getCardAt(index).name << std::endl;
         }
     }
 }
@@ -262,10 +333,5 @@ const std::vector<int>& PolicyManager::getSlotArray(PolicyType type) const {
 }
 
 const GovernmentConfig& PolicyManager::getGovConfig(GovernmentType type) const {
-    auto it = _govDatabase.find(type);
-    if (it != _govDatabase.end()) {
-        return it->second;
-    }
-    // ҲĬ
-    return _govDatabase.at(GovernmentType::CHIEFDOM);
+    return _database->getGovConfig(type);
 }
\ No newline at end of file
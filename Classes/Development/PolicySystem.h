@@ -2,13 +2,14 @@
 #define POLICY_SYSTEM_H
 
 #include "CultureSystem.h" 
+#include "Utils/EventBus.h"
 #include <vector>
 #include <map>
 #include <string>
 #include <iostream>
 
 // ==========================================
-// 1. 
+// 1. 基础定义
 // ==========================================
 
 enum class PolicyType {
@@ -24,23 +25,57 @@ enum class EffectType {
     MODIFIER_CULTURE,
     COMBAT_STRENGTH,
     UNIT_PRODUCTION,
-    MAINTENANCE_DISCOUNT
+    MAINTENANCE_DISCOUNT,
+    COUNT
+};
+
+// 加成作用目标：全局、按区域类型、按单位类别
+enum class ModifierTarget {
+    GLOBAL,             // City / All / AllUnits / Unit
+    CAMPUS,             // 学院（含科技建筑）
+    THEATER_SQUARE,     // 剧院广场
+    COMMERCIAL_HUB,     // 商业中心
+    INDUSTRY_ZONE,      // 工业区
+    HARBOR,             // 港口
+    SPACEPORT,          // 航天中心
+    MELEE,              // 近战单位
+    RANGED,             // 远程单位
+    SIEGE,              // 攻城单位
+    AVIATION,           // 航空单位
+    NAVAL,              // 海军单位
+    OTHER,              // 城墙、蛮族、贸易路线等暂无对应系统的目标
+    COUNT
 };
 
 struct PolicyEffect {
     EffectType type;
-    float value;
+    int value;          // 百分比加成为百分点，战斗力 / 维护费为点数
     std::string target;
 };
 
+/**
+ * @brief 编译后的加成表：按效果类型 x 作用目标累加
+ * total 为同一效果类型在所有目标上的和
+ */
+struct ModifierTable {
+    static const int kEffectCount = (int)EffectType::COUNT;
+    static const int kTargetCount = (int)ModifierTarget::COUNT;
+
+    int byTarget[kEffectCount][kTargetCount];
+    int total[kEffectCount];
+
+    ModifierTable() { clear(); }
+    void clear();
+    void add(const PolicyEffect& effect);
+};
+
 struct PolicyCard {
     int id;
     std::string name;
     std::string desc;
     PolicyType type;
     std::vector<PolicyEffect> effects;
-    bool isUnlocked = false;
-    bool isActive = false;
+    bool startsUnlocked = false;    // 开局即解锁
 };
 
 struct GovernmentConfig {
@@ -58,55 +93,97 @@ struct EquippedPolicyInfo {
 };
 
 // ==========================================
-// 2. ߹
+// 2. 政策定义库（只读，所有玩家共享）
+// ==========================================
+
+class PolicyDatabase {
+public:
+    static const int kGovernmentCount = (int)GovernmentType::DIGITAL_DEMOCRACY + 1;
+
+    static const PolicyDatabase& getInstance();
+
+    int getCardCount() const { return (int)_cards.size(); }
+    const PolicyCard& getCardAt(int index) const { return _cards[index]; }
+    int indexOf(int cardId) const;          // 卡牌 ID -> 下标，不存在时返回 -1
+    const PolicyCard* getCard(int cardId) const;
+
+    const GovernmentConfig& getGovConfig(GovernmentType type) const { return _govConfigs[(int)type]; }
+    const ModifierTable& getGovModifiers(GovernmentType type) const { return _govModifiers[(int)type]; }
+
+private:
+    PolicyDatabase();
+    PolicyDatabase(const PolicyDatabase&) = delete;
+    PolicyDatabase& operator=(const PolicyDatabase&) = delete;
+
+    std::vector<PolicyCard> _cards;                         // 按 ID 升序
+    GovernmentConfig _govConfigs[kGovernmentCount];         // 按政体枚举值索引
+    ModifierTable _govModifiers[kGovernmentCount];          // 各政体固有加成，编译一次
+};
+
+// ==========================================
+// 3. 政策管理器（每个玩家一份，只保存解锁/装备状态）
 // ==========================================
 
-class PolicyManager : public CultureEventListener {
+class PolicyManager {
 private:
     CultureTree* _cultureTree;
+    EventBus::ListenerId _cultureUnlockedListener;   // 市政解锁事件监听
 
-    std::map<int, PolicyCard> _cardDatabase;
-    std::map<GovernmentType, GovernmentConfig> _govDatabase;
+    const PolicyDatabase* _database;                 // 共享定义库
+    std::vector<char> _cardUnlocked;                 // 卡牌解锁状态（按定义库下标）
+    std::vector<char> _cardActive;                   // 卡牌装备状态（按定义库下标）
 
     std::vector<int> _equippedMilitary;
     std::vector<int> _equippedEconomic;
     std::vector<int> _equippedWildcard;
 
+    ModifierTable _cardModifiers;                    // 已装备政策卡的加成，装备/卸下时重建
+
 public:
     PolicyManager(CultureTree* cultureTree);
+    PolicyManager(const PolicyManager&) = delete;
+    PolicyManager& operator=(const PolicyManager&) = delete;
     ~PolicyManager();
 
+    // 按定义库重置本玩家的卡牌解锁与装备状态
     void initGameData();
 
-    // --- Ĳ ( const) ---
+    // --- 核心操作 (非 const) ---
     bool equipPolicy(int cardId, PolicyType slotType, int slotIndex);
     bool unequipPolicy(int cardId);
     void updateGovernmentSlots();
 
-    // --- ݲѯ ( const) ---
-    // ޸ĵ㣺 const
-    float getYieldModifier(EffectType type) const;
-    // ޸ĵ㣺 const
+    // --- 数据查询 (必须是 const) ---
+    // 查表：政策卡加成 + 当前政体固有加成，不再遍历卡牌
+    // 不带目标的版本返回该效果类型在所有目标上的总和
+    // 返回百分点（整数），调用方用 Fixed::percent(100 + modifier) 换成系数
+    int getYieldModifier(EffectType type) const;
+    int getYieldModifier(EffectType type, ModifierTarget target) const;
     int getCombatBonus(const std::string& targetUnit) const;
 
-    // --- UI ݲѯӿ (const) ---
+    // 将卡牌/政体数据中的目标名称映射为加成目标
+    static ModifierTarget parseModifierTarget(const std::string& target);
+
+    // --- UI 数据查询接口 (const) ---
     const GovernmentConfig& getCurrentGovConfig() const;
-    std::vector<PolicyCard> getUnlockedCards(PolicyType type) const;
-    const PolicyCard* getPolicyCard(int cardId) const;
+    std::vector<const PolicyCard*> getUnlockedCards(PolicyType type) const; // 指向共享定义库，不复制卡片
+    const PolicyCard* getPolicyCard(int cardId) const { return _database->getCard(cardId); }
+    bool isPolicyUnlocked(int cardId) const;
+    bool isPolicyActive(int cardId) const;
     std::vector<EquippedPolicyInfo> getEquippedPolicies() const;
     bool isPolicyCompatible(int cardId) const { return true; }
     const GovernmentConfig& getGovConfig(GovernmentType type) const;
 
-    // --- CultureEventListener ʵ ---
-    virtual void onCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect) override;
-    virtual void onCultureProgress(int cultureId, int currentProgress, int totalCost) override {}
-    virtual void onInspirationTriggered(int cultureId, const std::string& cultureName) override {}
+    // --- 市政解锁事件处理 ---
+    void onCultureUnlocked(int cultureId, const std::string& cultureName, const std::string& effect);
 
 private:
     std::vector<int>& getSlotArray(PolicyType type);
-    //  const 汾ĸ
+    // 增加 const 版本的辅助函数
     const std::vector<int>& getSlotArray(PolicyType type) const;
     void removeCardFromSlots(int cardId);
+    void rebuildCardModifiers();
+    const ModifierTable* getGovModifiers() const;
 };
 
 #endif // POLICY_SYSTEM_H
\ No newline at end of file
@@ -112,6 +112,55 @@ std::map<std::string, int> ProductionProgram::ids = {
 	{"LaunchSatellite", 161}
 };
 
+namespace {
+	struct UnlockIndex {
+		std::vector<int> initial;
+		std::map<int, std::vector<int>> byTech;
+		std::map<int, std::vector<int>> byCivic;
+	};
+
+	const UnlockIndex& unlockIndex()
+	{
+		static const UnlockIndex index = [] {
+			UnlockIndex built;
+			for (const auto& program : ProductionProgram::programs)
+			{
+				const auto& condition = program.second;
+				if (condition.prereqTechID == -1 && condition.prereqCivicID == -1)
+					built.initial.push_back(program.first);
+				else if (condition.prereqTechID != -1)
+					built.byTech[condition.prereqTechID].push_back(program.first);
+				else
+					built.byCivic[condition.prereqCivicID].push_back(program.first);
+			}
+			return built;
+		}();
+		return index;
+	}
+
+	const std::vector<int>& lookup(const std::map<int, std::vector<int>>& table, int key)
+	{
+		static const std::vector<int> empty;
+		auto it = table.find(key);
+		return it != table.end() ? it->second : empty;
+	}
+}
+
+const std::vector<int>& ProductionProgram::getInitialPrograms()
+{
+	return unlockIndex().initial;
+}
+
+const std::vector<int>& ProductionProgram::getProgramsUnlockedByTech(int techID)
+{
+	return lookup(unlockIndex().byTech, techID);
+}
+
+const std::vector<int>& ProductionProgram::getProgramsUnlockedByCivic(int civicID)
+{
+	return lookup(unlockIndex().byCivic, civicID);
+}
+
 ProductionProgram::ProductionProgram(ProductionType type, std::string name, Hex pos, int cost, bool canPurchase, int purchaseCost):
 	status(ProductionStatus::IN_PROGRESS),
 	type(type),
@@ -125,6 +174,36 @@ ProductionProgram::ProductionProgram(ProductionType type, std::string name, Hex
 	turnsRemaining(0)
 {}
 
+namespace {
+	ObjectPool<ProductionProgram>& programPool()
+	{
+		static ObjectPool<ProductionProgram> pool;
+		return pool;
+	}
+}
+
+ProductionProgram* ProductionProgram::acquire(ProductionType type, const std::string& name, Hex pos, int cost, bool canPurchase, int purchaseCost)
+{
+	ProductionProgram* program = programPool().acquire(type, name, pos, cost, canPurchase, purchaseCost);
+	program->_pooled = true;
+	return program;
+}
+
+void ProductionProgram::recycle(ProductionProgram* program)
+{
+	if (!program)
+		return;
+	if (program->_pooled)
+		programPool().release(program);
+	else
+		delete program;
+}
+
+PoolStats ProductionProgram::getPoolStats()
+{
+	return programPool().getStats();
+}
+
 bool ProductionProgram::purchaseCompletion() 
 {
 	if (canPurchase && status != ProductionStatus::COMPLETED) {
@@ -144,7 +223,7 @@ void ProductionProgram::addProgress(int amount)
 			turnsRemaining = 0;
 		}
 		else {
-			turnsRemaining = (cost - progress + amount - 1) / amount; // ȡʣغ
+			turnsRemaining = (cost - progress + amount - 1) / amount; // 向上取整计算剩余回合数
 		}
 	}
 }
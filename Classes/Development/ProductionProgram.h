@@ -3,6 +3,7 @@
 #include <vector>
 #include "City/Yield.h"
 #include "Utils/HexUtils.h"
+#include "Utils/ObjectPool.h"
 #include <string>
 #include <map>
 class ProductionProgram {
@@ -25,32 +26,17 @@ public:
 	
 	static std::map<std::string, int> ids;
 
-	static std::vector<std::pair<int, UnlockCondition>> findProgram(int techID, int civicID)
-	{
-		std::vector<std::pair<int, UnlockCondition>> unlockedPrograms;
-		for (auto program : programs)
-		{
-			if (program.second.prereqTechID == -1 && program.second.prereqCivicID == -1)
-				unlockedPrograms.push_back(program);
-		}
+	// 解锁索引：由 programs 构建一次，按科技/市政ID直接取出它解锁的生产项目ID
+	static const std::vector<int>& getInitialPrograms();
+	static const std::vector<int>& getProgramsUnlockedByTech(int techID);
+	static const std::vector<int>& getProgramsUnlockedByCivic(int civicID);
 
-		if (techID == -1 && civicID != -1)
-		{
-			for (auto program : programs)
-			{
-				if (program.second.prereqCivicID == civicID)
-					unlockedPrograms.push_back(program);
-			}
-		}
-		else if (civicID == -1 && techID != -1)
-		{
-			for (auto program : programs)
-			{
-				if (program.second.prereqTechID == techID)
-					unlockedPrograms.push_back(program);
-			}
-		}
-		return unlockedPrograms;
+	// 按ID规则推断类型：<100 为单位，整十为区域，其余为建筑
+	static ProductionType typeOfProgram(int programID)
+	{
+		if (programID < 100)
+			return ProductionType::UNIT;
+		return programID % 10 == 0 ? ProductionType::DISTRICT : ProductionType::BUILDING;
 	}
 
 	enum class ProductionStatus {
@@ -60,9 +46,15 @@ public:
 	}; 
 
 	ProductionProgram(ProductionType type, std::string name, Hex pos, int cost, bool canPurchase, int purchaseCost = 0);
-	~ProductionProgram()
+	virtual ~ProductionProgram()
 	{}
 
+	// 从对象池取一个普通生产项目（区域、建筑、单位等派生类仍各自 new）
+	static ProductionProgram* acquire(ProductionType type, const std::string& name, Hex pos, int cost, bool canPurchase, int purchaseCost = 0);
+	// 释放生产项目：池中取出的归还对象池，其余直接 delete
+	static void recycle(ProductionProgram* program);
+	static PoolStats getPoolStats();
+
 	void			setPosOnCreated(Hex pos) { posOnCreated = pos; }
 
 
@@ -77,13 +69,13 @@ public:
 	bool 			getCanPurchase() const { return canPurchase; }
 	int				getPurchaseCost() const { return purchaseCost; }
 
-	void pauseProduction() { status = ProductionStatus::PAUSED; } // ͣ
-	void resumeProduction() { status = ProductionStatus::IN_PROGRESS; } // ָ
-	bool purchaseCompletion(); // ûƽ
-	virtual void addProgress(int amount); // (ʵ־߼)
-	bool isCompleted() const { return progress >= cost; } // Ƿ
+	void pauseProduction() { status = ProductionStatus::PAUSED; } // 暂停生产
+	void resumeProduction() { status = ProductionStatus::IN_PROGRESS; } // 恢复生产
+	bool purchaseCompletion(); // 用黄金购买完成生产
+	virtual void addProgress(int amount); // 增加生产进度(需在派生类中实现具体逻辑)
+	bool isCompleted() const { return progress >= cost; } // 是否完成生产
 protected:
-	void completeProduction() { status = ProductionStatus::COMPLETED; progress = cost; } // 
+	void completeProduction() { status = ProductionStatus::COMPLETED; progress = cost; } // 完成生产
 	ProductionType type;
 	ProductionStatus status;
 	int _id;
@@ -91,9 +83,11 @@ protected:
 	Hex posOnCreated;
 	int cost;
 	int progress;
-	int turnsRemaining; // ʣغ
-	bool canPurchase; // Ƿûƽ
-	int purchaseCost; // ƽɱ
+	int turnsRemaining; // 剩余回合数
+	bool canPurchase; // 是否可以用黄金购买完成
+	int purchaseCost; // 黄金购买成本
+private:
+	bool _pooled = false; // 是否由对象池分配
 };
 
 #endif // __PRODUCTION_PROGRAM_H__
@@ -1,113 +1,174 @@
 #include "TechSystem.h"
+#include "Utils/EventBus.h"
+#include <cassert>
+#include <map>
+
+namespace {
+	// 科技原始定义：ID、名称、成本、前置科技、效果描述
+	struct TechDefinition {
+		int id;
+		const char* name;
+		int cost;
+		std::vector<int> prereqs;
+		const char* effect;
+	};
+}
 
-TechNode::TechNode(int id, const std::string& name, int cost,
-	const std::vector<int>& prereqs, const std::string& effect)
-	: id(id), name(name), cost(cost), progress(0), activated(false),
-	srcTechList(prereqs), effectDescription(effect) {
+const TechDatabase& TechDatabase::getInstance() {
+	static TechDatabase instance;
+	return instance;
 }
 
-// ʼƼĿǰӲ
+// 编译科技定义库：目前采用硬编码
+TechDatabase::TechDatabase() {
+	std::vector<TechDefinition> definitions = {
+		// 第1层：基础科技（成本较低）
+		{ 1, u8"畜牧", 25, {}, u8"解锁牧场，允许训练骑兵单位" },
+		{ 2, u8"采矿", 25, {}, u8"解锁矿山，允许开采矿产资源" },
+
+		// 第2层：早期科技（成本增加）
+		{ 3, u8"弓箭手", 50, { 1, 2 }, u8"解锁弓箭手单位，增强远程攻击能力" },
+		{ 4, u8"书写", 50, { 1 }, u8"解锁图书馆，开启文化系统" },
+
+		// 第3层：古典时代科技
+		{ 5, u8"航海", 80, { 4 }, u8"解锁船只，开启海上探索和贸易" },
+		{ 6, u8"货币", 80, { 4 }, u8"解锁市场，增加金币收入" },
+		{ 7, u8"铁器", 80, { 2 }, u8"解锁铁剑士，增强近战能力" },
+
+		// 第4层：中世纪科技
+		{ 8, u8"工程学", 120, { 7 }, u8"解锁攻城武器，增强攻城能力" },
+		{ 9, u8"造船术", 120, { 5 }, u8"解锁更强大的船只，增强海军" },
+		{ 10, u8"数学", 120, { 4 }, u8"解锁大学，提升科研效率" },
+		{ 11, u8"机械", 120, { 7 }, u8"解锁弩兵和投石机" },
+
+		// 第5层：文艺复兴科技
+		{ 12, u8"学徒制", 200, { 10, 11 }, u8"解锁工坊，提升生产力" },
+		{ 13, u8"银行", 200, { 6 }, u8"解锁银行，大幅增加金币收入" },
+
+		// 第6层：工业时代科技
+		{ 14, u8"火药", 300, { 12 }, u8"解锁火枪手，开启热兵器时代" },
+		{ 15, u8"金属铸造", 300, { 12 }, u8"解锁工厂，大幅提升生产力" },
+
+		// 第7层：启蒙时代科技
+		{ 16, u8"制图学", 400, { 5, 9 }, u8"解锁更精确的地图，提升探索效率" },
+		{ 17, u8"工业化", 400, { 15 }, u8"解锁工业区，开启工业革命" },
+		{ 18, u8"飞行", 400, { 16 }, u8"解锁飞机，开启空中战斗" },
+		{ 19, u8"经济学", 400, { 13 }, u8"解锁证券交易所，经济大幅增长" },
+
+		// 第8层：现代科技
+		{ 20, u8"高级飞行", 600, { 18 }, u8"解锁喷气式飞机，掌握制空权" },
+		{ 21, u8"火箭学", 600, { 20 }, u8"解锁火箭，开启太空时代" },
+
+		// 第9层：信息时代科技
+		{ 22, u8"卫星", 800, { 21 }, u8"解锁卫星，获得全球视野" },
+		{ 23, u8"核裂变", 800, { 17 }, u8"解锁核电站和原子弹" },
+		{ 24, u8"核聚变", 1000, { 23 }, u8"解锁聚变反应堆，近乎无限的能源" }
+	};
+
+	std::map<int, std::vector<int>> dependentLists;
+
+	// 设置解锁关系（构建有向图）
+	// 第1层解锁第2层
+	dependentLists[1] = { 3, 4 };
+	dependentLists[2] = { 3 };
+
+	// 第2层解锁第3层
+	dependentLists[3] = { 8 };
+	dependentLists[4] = { 5, 6, 7, 10 };
+
+	// 第3层解锁第4层
+	dependentLists[5] = { 9, 16 };
+	dependentLists[6] = { 13 };
+	dependentLists[7] = { 8, 11 };
+
+	// 第4层解锁第5层
+	dependentLists[8] = { 12, 14 };
+	dependentLists[9] = { 16 };
+	dependentLists[10] = { 12 };
+	dependentLists[11] = { 12 };
+
+	// 第5层解锁第6层
+	dependentLists[12] = { 14, 15 };
+	dependentLists[13] = { 19 };
+
+	// 第6层解锁第7层
+	dependentLists[14] = { 17 };
+	dependentLists[15] = { 17 };
+
+	// 第7层解锁第8层
+	dependentLists[16] = { 18 };
+	dependentLists[17] = { 20, 23 };
+	dependentLists[18] = { 20 };
+	dependentLists[19] = { 20 };
+
+	// 第8层解锁第9层
+	dependentLists[20] = { 21 };
+	dependentLists[21] = { 22 };
+	dependentLists[23] = { 24 };
+
+	dependentLists[10].push_back(16);
+	dependentLists[14].push_back(21);
+	dependentLists[17].push_back(21);
+
+	// 按 ID 升序排列并建立 ID -> 下标映射
+	std::sort(definitions.begin(), definitions.end(),
+		[](const TechDefinition& a, const TechDefinition& b) { return a.id < b.id; });
+
+	indexById.assign(definitions.back().id + 1, -1);
+	std::vector<std::vector<int>> prereqRows;
+	std::vector<std::vector<int>> dependentRows;
+	for (size_t i = 0; i < definitions.size(); i++) {
+		indexById[definitions[i].id] = static_cast<int>(i);
+		prereqRows.push_back(definitions[i].prereqs);
+		dependentRows.push_back(dependentLists[definitions[i].id]);
+	}
+	prereqs.build(prereqRows);
+	dependents.build(dependentRows);
+
+	techs.resize(definitions.size());
+	for (size_t i = 0; i < definitions.size(); i++) {
+		TechNode& node = techs[i];
+		node.id = definitions[i].id;
+		node.index = static_cast<int>(i);
+		node.name = definitions[i].name;
+		node.cost = definitions[i].cost;
+		node.srcTechList = prereqs.row(static_cast<int>(i));
+		node.dstTechList = dependents.row(static_cast<int>(i));
+		node.effectDescription = definitions[i].effect;
+	}
+
+	// 前置位集；后继位集由前置关系反推，不依赖手工维护的后继列表
+	assert(techs.size() <= static_cast<size_t>(kMaxTreeNodes));
+	for (TechNode& node : techs) {
+		for (int srcId : node.srcTechList) {
+			int prereqIndex = indexOf(srcId);
+			assert(prereqIndex >= 0);
+			if (prereqIndex < 0) continue;
+			node.prereqMask.set(prereqIndex);
+			techs[prereqIndex].unlockMask.set(node.index);
+		}
+	}
+}
+
+// 重置科技树：定义共享，只清空本玩家的进度
 void TechTree::initializeTechTree() {
-	// 
-	techList.clear();
+	techProgress.assign(database->getTechCount(), 0);
+	activatedMask.reset();
+	researchableMask.reset();
+	for (int i = 0; i < database->getTechCount(); i++) {
+		if (database->getTechAt(i).prereqMask.none()) {
+			researchableMask.set(i);
+		}
+	}
+	newlyResearchableMask = researchableMask;
 	activatedTechList.clear();
 	currentResearchTech = -1;
-
-	// 1㣺Ƽɱϵͣ
-	techList.emplace(1, TechNode(1, u8"", 25, {}, u8"ѵλ"));
-	techList.emplace(2, TechNode(2, u8"ɿ", 25, {}, u8"ɽɿԴ"));
-
-	// 2㣺ڿƼɱӣ
-	techList.emplace(3, TechNode(3, u8"", 50, { 1, 2 }, u8"ֵλǿԶ̹"));
-	techList.emplace(4, TechNode(4, u8"д", 50, { 1 }, u8"ͼݣĻϵͳ"));
-
-	// 3㣺ŵʱƼ
-	techList.emplace(5, TechNode(5, u8"", 80, { 4 }, u8"ֻ̽ó"));
-	techList.emplace(6, TechNode(6, u8"", 80, { 4 }, u8"гӽ"));
-	techList.emplace(7, TechNode(7, u8"", 80, { 2 }, u8"ʿǿս"));
-
-	// 4㣺ͿƼ
-	techList.emplace(8, TechNode(8, u8"ѧ", 120, { 7 }, u8"ǿ"));
-	techList.emplace(9, TechNode(9, u8"촬", 120, { 5 }, u8"ǿĴֻǿ"));
-	techList.emplace(10, TechNode(10, u8"ѧ", 120, { 4 }, u8"ѧЧ"));
-	techList.emplace(11, TechNode(11, u8"е", 120, { 7 }, u8"Ͷʯ"));
-
-	// 5㣺ո˿Ƽ
-	techList.emplace(12, TechNode(12, u8"ѧͽ", 200, { 10, 11 }, u8""));
-	techList.emplace(13, TechNode(13, u8"", 200, { 6 }, u8"Уӽ"));
-
-	// 6㣺ҵʱƼ
-	techList.emplace(14, TechNode(14, u8"ҩ", 300, { 12 }, u8"ǹ֣ȱʱ"));
-	techList.emplace(15, TechNode(15, u8"", 300, { 12 }, u8""));
-
-	// 7㣺ʱƼ
-	techList.emplace(16, TechNode(16, u8"ͼѧ", 400, { 5, 9 }, u8"ȷĵͼ̽Ч"));
-	techList.emplace(17, TechNode(17, u8"ҵ", 400, { 15 }, u8"ҵҵ"));
-	techList.emplace(18, TechNode(18, u8"", 400, { 16 }, u8"ɻս"));
-	techList.emplace(19, TechNode(19, u8"ѧ", 400, { 13 }, u8"֤ȯô"));
-
-	// 8㣺ִƼ
-	techList.emplace(20, TechNode(20, u8"߼", 600, { 18 }, u8"ʽɻƿȨ"));
-	techList.emplace(21, TechNode(21, u8"ѧ", 600, { 20 }, u8"̫ʱ"));
-
-	// 9㣺ϢʱƼ
-	techList.emplace(22, TechNode(22, u8"", 800, { 21 }, u8"ǣȫҰ"));
-	techList.emplace(23, TechNode(23, u8"ѱ", 800, { 17 }, u8"˵վԭӵ"));
-	techList.emplace(24, TechNode(24, u8"˾۱", 1000, { 23 }, u8"۱䷴Ӧѣ޵Դ"));
-
-	// ýϵͼ
-	// 12
-	techList[1].dstTechList = { 3, 4 };
-	techList[2].dstTechList = { 3 };
-
-	// 23
-	techList[3].dstTechList = { 8 };
-	techList[4].dstTechList = { 5, 6, 7, 10 };
-
-	// 34
-	techList[5].dstTechList = { 9, 16 };
-	techList[6].dstTechList = { 13 };
-	techList[7].dstTechList = { 8, 11 };
-
-	// 45
-	techList[8].dstTechList = { 12, 14 };
-	techList[9].dstTechList = { 16 };
-	techList[10].dstTechList = { 12 };
-	techList[11].dstTechList = { 12 };
-
-	// 56
-	techList[12].dstTechList = { 14, 15 };
-	techList[13].dstTechList = { 19 };
-
-	// 67
-	techList[14].dstTechList = { 17 };
-	techList[15].dstTechList = { 17 };
-
-	// 78
-	techList[16].dstTechList = { 18 };
-	techList[17].dstTechList = { 20, 23 };
-	techList[18].dstTechList = { 20 };
-	techList[19].dstTechList = { 20 };
-
-	// 89
-	techList[20].dstTechList = { 21 };
-	techList[21].dstTechList = { 22 };
-	techList[23].dstTechList = { 24 };
-
-	techList[10].dstTechList.push_back(16);
-	techList[14].dstTechList.push_back(21);
-	techList[17].dstTechList.push_back(21);
 }
 
-// õǰоĿƼ
+// 设置当前研究的科技
 bool TechTree::setCurrentResearch(int techId) {
-	auto it = techList.find(techId);
-	if (it == techList.end()) {
-		return false;
-	}
-
-	// ƼǷѼо
-	if (it->second.activated || !isResearchable(techId)) {
+	// 检查科技是否存在、已激活或可研究
+	if (!isResearchable(techId)) {
 		return false;
 	}
 
@@ -115,7 +176,7 @@ bool TechTree::setCurrentResearch(int techId) {
 	return true;
 }
 
-// ӿеϷغϵͳã
+// 增加科研点数（由游戏回合系统调用）
 void TechTree::updateProgress(int points) {
 	if (currentResearchTech <= 0 || points <= 0) {
 		return;
@@ -124,173 +185,151 @@ void TechTree::updateProgress(int points) {
 	addProgressToTech(currentResearchTech, points);
 }
 
-// ￨¼ϵͳã
+// 触发尤里卡（由事件系统调用）
 void TechTree::updateProgress_Eureka(int techId) {
-	auto it = techList.find(techId);
-	if (it == techList.end() || it->second.activated) {
+	const TechNode* node = database->getTech(techId);
+	if (!node || isActivatedAt(node->index)) {
 		return;
 	}
 
-	// ￨ӸÿƼ50%ɱĿƼֵ
-	int eurekaPoints = it->second.cost / 2;
+	// 尤里卡：增加该科技50%成本的科技值
+	int eurekaPoints = node->cost / 2;
 
-	// ֪ͨ
-	notifyEurekaTriggered(techId, it->second.name);
+	// 通知监听器
+	notifyEurekaTriggered(techId, node->name);
 
-	// ӽ
+	// 增加进度
 	addProgressToTech(techId, eurekaPoints);
 }
 
-// ڲƼӽ
+// 内部函数：标记激活，并只检查以该科技为前置的节点，增量更新可研究集合
+void TechTree::markActivated(const TechNode& node) {
+	activatedMask.set(node.index);
+	activatedTechList.push_back(node.id);
+	researchableMask.reset(node.index);
+
+	NodeMask candidates = node.unlockMask & ~activatedMask;
+	for (int i = 0; i < database->getTechCount(); i++) {
+		if (candidates.test(i) && prereqsMet(database->getTechAt(i))) {
+			researchableMask.set(i);
+			newlyResearchableMask.set(i);
+		}
+	}
+}
+
+// 内部函数：向科技添加进度
 void TechTree::addProgressToTech(int techId, int points) {
-	auto it = techList.find(techId);
-	if (it == techList.end() || it->second.activated) {
+	const TechNode* node = database->getTech(techId);
+	if (!node || isActivatedAt(node->index)) {
 		return;
 	}
 
-	// ǰ￨ǰ
-	if (!isResearchable(techId)) {
+	// 检查前置条件（除非有尤里卡，否则必须有前置条件）
+	if (!prereqsMet(*node)) {
 		return;
 	}
 
-	// ӽȣܳɱ
-	int newProgress = it->second.progress + points;
-	if (newProgress > it->second.cost) {
-		newProgress = it->second.cost;
+	// 增加进度，但不能超过成本
+	int newProgress = techProgress[node->index] + points;
+	if (newProgress > node->cost) {
+		newProgress = node->cost;
 	}
 
-	it->second.progress = newProgress;
+	techProgress[node->index] = newProgress;
 
-	// ֪ͨȸ
-	notifyResearchProgress(techId, newProgress, it->second.cost);
+	// 通知进度更新
+	notifyResearchProgress(techId, newProgress, node->cost);
 
-	// Ƿо
-	if (newProgress >= it->second.cost) {
+	// 检查是否完成研究
+	if (newProgress >= node->cost) {
 		activateTech(techId);
 	}
 }
 
-// Ƽ
+// 激活科技
 void TechTree::activateTech(int techId) {
-	auto it = techList.find(techId);
-	if (it == techList.end() || it->second.activated) {
+	const TechNode* node = database->getTech(techId);
+	if (!node || isActivatedAt(node->index)) {
 		return;
 	}
 
-	it->second.activated = true;
-	activatedTechList.push_back(techId);
+	newlyResearchableMask.reset();
+	markActivated(*node);
 
-	// ǰоƼõǰо
+	// 如果当前正在研究这个科技，重置当前研究
 	if (currentResearchTech == techId) {
 		currentResearchTech = -1;
 	}
 
-	// ֪ͨ
-	notifyTechActivated(techId, it->second.name, it->second.effectDescription);
+	// 通知监听器
+	notifyTechActivated(techId, node->name, node->effectDescription);
 
-	// 
+	// 处理连锁激活
 	onTechActivated_internal(techId);
 }
 
-// Ƿо
+// 检查是否可研究
 bool TechTree::isResearchable(int techId) const {
-	auto currentNode = techList.find(techId);
-	if (currentNode == techList.end() || currentNode->second.activated) {
-		return false;
-	}
-
-	// ǰ
-	for (int srcId : currentNode->second.srcTechList) {
-		auto prereqNode = techList.find(srcId);
-		if (prereqNode == techList.end() || !prereqNode->second.activated) {
-			return false;
-		}
-	}
-
-	return true;
+	int index = database->indexOf(techId);
+	return index >= 0 && researchableMask.test(index);
 }
 
-// ƼǷ񼤻
+// 检查科技是否激活
 bool TechTree::isActivated(int techId) const {
-	auto currentNode = techList.find(techId);
-	return (currentNode != techList.end() && currentNode->second.activated);
+	int index = database->indexOf(techId);
+	return index >= 0 && isActivatedAt(index);
 }
 
-// ȡоȰٷֱ
+// 获取研究进度百分比
 int TechTree::getResearchProgressPercent(int techId) const {
-	auto currentNode = techList.find(techId);
-	if (currentNode == techList.end() || currentNode->second.cost == 0) {
+	const TechNode* node = database->getTech(techId);
+	if (!node || node->cost == 0) {
 		return 0;
 	}
 
-	return static_cast<int>((currentNode->second.progress * 100) / currentNode->second.cost);
+	return static_cast<int>((techProgress[node->index] * 100) / node->cost);
 }
 
-// ȡоĿƼб
+// 获取可研究的科技列表（按 ID 升序）
 std::vector<int> TechTree::getResearchableTechList() const {
-	std::vector<int> currentResearchable;
-
-	for (const auto& currentTech : techList) {
-		if (!currentTech.second.activated && isResearchable(currentTech.first)) {
-			currentResearchable.push_back(currentTech.first);
-		}
-	}
-
-	return currentResearchable;
+	return maskToIdList(researchableMask);
 }
 
-
-
-// ȡѼĿƼб
-std::vector<int> TechTree::getActivatedTechList() const {
-	return activatedTechList;
+// 获取最近一次激活新开放的科技列表（按 ID 升序）
+std::vector<int> TechTree::getNewlyResearchableTechList() const {
+	return maskToIdList(newlyResearchableMask & researchableMask);
 }
 
-// ȡƼϢ
-const TechNode* TechTree::getTechInfo(int techId) const {
-	auto currentNode = techList.find(techId);
-	if (currentNode == techList.end()) {
-		return nullptr;
-	}
-	else {
-		return &currentNode->second;
+// 内部函数：位集转换为科技ID列表
+std::vector<int> TechTree::maskToIdList(const NodeMask& mask) const {
+	std::vector<int> ids;
+	for (int i = 0; i < database->getTechCount(); i++) {
+		if (mask.test(i)) {
+			ids.push_back(database->getTechAt(i).id);
+		}
 	}
+	return ids;
 }
 
-// ȡƼǰȣͶƼֵ
+// 获取科技当前进度（已投入科技值）
 int TechTree::getTechProgress(int techId) const {
-	auto currentNode = techList.find(techId);
-	if (currentNode == techList.end()) {
+	int index = database->indexOf(techId);
+	if (index < 0) {
 		return -1;
 	}
-	return currentNode->second.progress;
+	return techProgress[index];
 }
 
-// ȡƼɱ
+// 获取科技成本
 int TechTree::getTechCost(int techId) const {
-	auto currentNode = techList.find(techId);
-	if (currentNode == techList.end()) {
+	const TechNode* node = database->getTech(techId);
+	if (!node) {
 		return -1;
 	}
-	return currentNode->second.cost;
-}
-
-// ¼
-void TechTree::addEventListener(TechEventListener* listener) {
-	if (listener && std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) {
-		listeners.push_back(listener);
-	}
+	return node->cost;
 }
 
-// Ƴ¼
-void TechTree::removeEventListener(TechEventListener* listener) {
-	auto it = std::find(listeners.begin(), listeners.end(), listener);
-	if (it != listeners.end()) {
-		listeners.erase(it);
-	}
-}
-
-// صԿƼӰ죬Ƽ
+// 回调函数：对科技树内影响，即检查后续科技更新
 void TechTree::onTechActivated_internal(int prereqTechId) {
 	std::vector<int> newlyActivated;
 	newlyActivated.push_back(prereqTechId);
@@ -299,59 +338,44 @@ void TechTree::onTechActivated_internal(int prereqTechId) {
 		int currentTech = newlyActivated.back();
 		newlyActivated.pop_back();
 
-		// currentTechĿƼ
-		auto currentNode = techList.find(currentTech);
-		if (currentNode != techList.end()) {
-			for (int dependentTechId : currentNode->second.dstTechList) {
-				auto dependentIt = techList.find(dependentTechId);
-				if (dependentIt != techList.end() &&
-					!dependentIt->second.activated &&
-					dependentIt->second.progress >= dependentIt->second.cost) {
-
-					// ǰ
-					bool allPrereqsMet = true;
-					for (int prereqId : dependentIt->second.srcTechList) {
-						auto prereqIt = techList.find(prereqId);
-						if (prereqIt == techList.end() || !prereqIt->second.activated) {
-							allPrereqsMet = false;
-							break;
-						}
-					}
-
-					if (allPrereqsMet) {
-						dependentIt->second.activated = true;
-						activatedTechList.push_back(dependentTechId);
-
-						// ֪ͨ
-						notifyTechActivated(dependentTechId, dependentIt->second.name,
-							dependentIt->second.effectDescription);
-
-						newlyActivated.push_back(dependentTechId);
-					}
-				}
+		// 查找所有依赖currentTech的科技
+		const TechNode* currentNode = database->getTech(currentTech);
+		if (!currentNode) {
+			continue;
+		}
+
+		for (int dependentTechId : currentNode->dstTechList) {
+			const TechNode* dependent = database->getTech(dependentTechId);
+			if (dependent &&
+				!isActivatedAt(dependent->index) &&
+				techProgress[dependent->index] >= dependent->cost &&
+				prereqsMet(*dependent)) {
+
+				markActivated(*dependent);
+
+				// 通知监听器
+				notifyTechActivated(dependentTechId, dependent->name,
+					dependent->effectDescription);
+
+				newlyActivated.push_back(dependentTechId);
 			}
 		}
 	}
 }
 
-// ֪ͨƼ
+// 发布事件：科技激活
 void TechTree::notifyTechActivated(int techId, const std::string& techName,
 	const std::string& effect) {
-	for (auto listener : listeners) {
-		listener->onTechActivated(techId, techName, effect);
-	}
+	EventBus::getInstance()->publish(TechActivatedEvent{ this, techId });
 }
 
-// ֪ͨоȸ
+// 发布事件：研究进度更新（界面只需要最新进度，按科技树合并）
 void TechTree::notifyResearchProgress(int techId, int currentProgress, int totalCost) {
-	for (auto listener : listeners) {
-		listener->onResearchProgress(techId, currentProgress, totalCost);
-	}
+	EventBus::getInstance()->publishCoalesced(reinterpret_cast<std::intptr_t>(this),
+		ResearchProgressEvent{ this, techId, currentProgress, totalCost });
 }
 
-// ֪ͨ￨
+// 发布事件：尤里卡触发
 void TechTree::notifyEurekaTriggered(int techId, const std::string& techName) {
-	for (auto listener : listeners) {
-		listener->onEurekaTriggered(techId, techName);
-	}
-}
\ No newline at end of file
+	EventBus::getInstance()->publish(EurekaTriggeredEvent{ this, techId });
+}
@@ -1,97 +1,135 @@
 #ifndef TECH_SYSTEM_H
 #define TECH_SYSTEM_H
 
-#include <unordered_map>
+#include "ConstSpan.h"
+#include "NodeMask.h"
 #include <vector>
 #include <string>
 #include <algorithm>
 
-// Ƽڵṹ
+// 科技定义（只读，所有玩家共享；进度与激活状态保存在各自的 TechTree 中）
 struct TechNode {
 	int id;
+	int index;                          // 在定义库扁平数组中的下标
 	std::string name;
-	int cost;                       // Ƽֵܳɱ
-	int progress;                   // ͶƼֵ
-	bool activated;					// ״̬
-	std::vector<int> srcTechList;	// ǰÿƼID
-	std::vector<int> dstTechList;	// ̿ƼID
-	std::string effectDescription;  // Ч
-
-	TechNode() = default;// ֹϵͳó
-	TechNode(int id, const std::string& name, int cost, const std::vector<int>& prereqs, const std::string& effect = "");
+	int cost;                           // 所需科技值（总成本）
+	ConstSpan<int> srcTechList;         // 前置科技ID
+	ConstSpan<int> dstTechList;         // 后继科技ID
+	std::string effectDescription;      // 效果描述
+	NodeMask prereqMask;                // 前置科技位集（按下标）
+	NodeMask unlockMask;                // 以本科技为前置的科技位集（由前置关系反推）
 };
 
-// Ƽ¼ӿ
-class TechEventListener {
+// 科技定义库：启动时编译一次，之后只读
+// 定义按 ID 升序存放在扁平数组中，前置/后继关系以 CSR 形式存储
+class TechDatabase {
 public:
-	virtual ~TechEventListener() {}
+	static const TechDatabase& getInstance();
 
-	// Ƽ
-	virtual void onTechActivated(int techId, const std::string& techName, const std::string& effect) = 0;
+	int getTechCount() const { return static_cast<int>(techs.size()); }
+	const TechNode& getTechAt(int index) const { return techs[index]; }
 
-	// оȸ
-	virtual void onResearchProgress(int techId, int currentProgress, int totalCost) = 0;
+	// ID -> 下标，不存在时返回 -1
+	int indexOf(int techId) const {
+		return (techId >= 0 && techId < static_cast<int>(indexById.size())) ? indexById[techId] : -1;
+	}
+	const TechNode* getTech(int techId) const {
+		int index = indexOf(techId);
+		return index >= 0 ? &techs[index] : nullptr;
+	}
+
+private:
+	TechDatabase();
+	TechDatabase(const TechDatabase&) = delete;
+	TechDatabase& operator=(const TechDatabase&) = delete;
+
+	std::vector<TechNode> techs;        // 按 ID 升序
+	std::vector<int> indexById;         // ID -> 下标（-1 表示不存在）
+	CsrTable<int> prereqs;              // 前置科技
+	CsrTable<int> dependents;           // 后继科技
+};
+
+class TechTree;
+
+// 科技事件（通过 EventBus 发布，tree 用于区分所属玩家，名称等信息通过 getTechInfo 查询）
+// 科技被激活（立即派发）
+struct TechActivatedEvent {
+	const TechTree* tree;
+	int techId;
+};
+
+// 研究进度更新（按科技树合并，每帧派发一次）
+struct ResearchProgressEvent {
+	const TechTree* tree;
+	int techId;
+	int currentProgress;
+	int totalCost;
+};
 
-	// ￨
-	virtual void onEurekaTriggered(int techId, const std::string& techName) = 0;
+// 尤里卡被触发（立即派发）
+struct EurekaTriggeredEvent {
+	const TechTree* tree;
+	int techId;
 };
 
-// Ƽ
+// 科技树：每个玩家一份，只保存按定义下标排列的进度与激活状态
 class TechTree {
 private:
-	std::unordered_map<int, TechNode> techList; // IDڵӳ
-	std::vector<int> activatedTechList;         // Ѽڵб
-	int currentResearchTech;                    // ǰоĿƼID
-
-	std::vector<TechEventListener*> listeners;
+	const TechDatabase* database;               // 共享定义库
+	std::vector<int> techProgress;              // 已投入科技值（按下标）
+	NodeMask activatedMask;                     // 已激活科技位集
+	NodeMask researchableMask;                  // 可研究科技位集（随激活增量维护）
+	NodeMask newlyResearchableMask;             // 最近一次激活新开放的科技位集
+	std::vector<int> activatedTechList;         // 已激活节点列表
+	int currentResearchTech;                    // 当前正在研究的科技ID
 
 public:
-	TechTree() : currentResearchTech(-1) {
+	TechTree() : database(&TechDatabase::getInstance()), currentResearchTech(-1) {
 		initializeTechTree();
 	}
 
-	~TechTree() {
-		listeners.clear();
-	}
-
-	// ʼ
+	// 重置为初始状态（定义由 TechDatabase 共享，这里只清空进度）
 	void initializeTechTree();
 
-	// õǰоĿƼѡ
+	// 设置当前研究的科技（由玩家选择）
 	bool setCurrentResearch(int techId);
 	int getCurrentResearch() const { return currentResearchTech; }
 
-	// ӿеϷغϵͳã
+	// 增加科研点数（由游戏回合系统调用）
 	void updateProgress(int points);
 
-	// ￨¼ϵͳã
+	// 触发尤里卡（由事件系统调用）
 	void updateProgress_Eureka(int techId);
 
-	// ѯ
+	// 查询函数
 	bool isResearchable(int techId) const;
 	bool isActivated(int techId) const;
-	int getResearchProgressPercent(int techId) const; // ȡоȰٷֱ
+	int getResearchProgressPercent(int techId) const; // 获取研究进度百分比
 
-	// 
+	// 读操作
 	std::vector<int> getResearchableTechList() const;
-	std::vector<int> getActivatedTechList() const;
-	const TechNode* getTechInfo(int techId) const;
+	bool hasResearchableTech() const { return researchableMask.any(); }
+	const NodeMask& getResearchableMask() const { return researchableMask; }
+	// 最近一次科技激活（含连锁激活）后新变为可研究的科技ID
+	std::vector<int> getNewlyResearchableTechList() const;
+	const std::vector<int>& getActivatedTechList() const { return activatedTechList; }
+	const TechNode* getTechInfo(int techId) const { return database->getTech(techId); }
 	int getTechProgress(int techId) const;
 	int getTechCost(int techId) const;
 
-	// ¼
-	void addEventListener(TechEventListener* listener);
-	void removeEventListener(TechEventListener* listener);
-
 private:
-	// ڲº
+	// 内部更新函数
+	bool isActivatedAt(int index) const { return activatedMask.test(index); }
+	bool prereqsMet(const TechNode& node) const { return maskCovers(activatedMask, node.prereqMask); }
+	void markActivated(const TechNode& node);
+	std::vector<int> maskToIdList(const NodeMask& mask) const;
 	void addProgressToTech(int techId, int points);
 	void activateTech(int techId);
 
-	// ڲص
+	// 内部回调函数
 	void onTechActivated_internal(int prereqTechId);
 
-	// ֪ͨ
+	// 发布事件
 	void notifyTechActivated(int techId, const std::string& techName, const std::string& effect);
 	void notifyResearchProgress(int techId, int currentProgress, int totalCost);
 	void notifyEurekaTriggered(int techId, const std::string& techName);
@@ -1,43 +1,25 @@
 #include "cocos2d.h"
 #include "District.h"
+#include "DistrictRegistry.h"
 #include "District/Building/Building.h"
 #include "Scene/GameScene.h"
 #include "Core/GameManager.h"
+#include "Map/GameMapLayer.h"
+#include "City/BaseCity.h"
+#include <algorithm>
 USING_NS_CC;
 
 
 int District::count = 0;
-std::vector<Hex> District::districtPositions(0);
-
-bool District::isThereDistrictAt(Hex where)
-{
-	for (const auto& pos : districtPositions)
-	{
-		if (pos == where)
-			return true;
-	}
-	return false;
-}
-
-
+std::vector<District*> District::adjacencyQueue;
 
 District::District(int player, Hex pos, DistrictType type, std::string name):
-	ProductionProgram(ProductionType::DISTRICT, name, pos, 0, false), // 򲻿ûƽ
+	ProductionProgram(ProductionType::DISTRICT, name, pos, 0, false), // 区域不可以用黄金购买完成
 	playerID(player),
 	_id(count++),
 	_pos(pos),
 	_name(name),
 	_type(type),
-	prereqTechID(-1),
-	prereqCivicID(-1),
-	prereqTerrains({
-		TerrainType::DESERT,
-		TerrainType::GRASSLAND,
-		TerrainType::JUNGLE,
-		TerrainType::PLAINS,
-		TerrainType::SNOW,
-		TerrainType::TUNDRA
-	}),
 	possibleBuildings(),
 	baseMaintenanceCost(0),
 	buildingMaintenanceCost(0),
@@ -47,86 +29,56 @@ District::District(int player, Hex pos, DistrictType type, std::string name):
 	grossYield({ 0,0,0,0,0 }),
 	baseBenefit({ 0,0,0,0,0 }),
 	buildingBenefit({ 0,0,0,0,0 }),
-	citizenBenefit({ 0,0,0,0,0 })
+	citizenBenefit({ 0,0,0,0,0 }),
+	_ownerCity(nullptr),
+	_adjacencyDirty(false)
 {
-	// ¼λ
-	districtPositions.push_back(pos);
-	if (name == "Downtown")
-	{
-		_type = District::DistrictType::DOWNTOWN;
-		cost = 54;
-	}
-	else if (name == "Campus")
-	{
-		_type = District::DistrictType::CAMPUS;
-		cost = 54;
-	}
-	else if (name == "IndustryZone")
-	{
-		_type = District::DistrictType::INDUSTRY_ZONE;
-		cost = 54;
-	}
-	else if (name == "CommercialHub")
-	{
-		_type = District::DistrictType::COMMERCIAL_HUB;
-		cost = 110;
-	}
-	else if (name == "TheaterSquare")
-	{
-		_type = District::DistrictType::THEATER_SQUARE;
-		cost = 54;
-	}
-	else if (name == "Harbor")
-	{
-		_type = District::DistrictType::HARBOR;
-		cost = 54;
-	}
-	else if (name == "Spaceport")
-	{
-		_type = District::DistrictType::SPACEPORT;
-		cost = 1800;
-	}
+	// 生产面板以 TO_BE_DEFINED 创建候选项目，此时按名称反查一次类型，成本从类型表读取
+	if (_type == DistrictType::TO_BE_DEFINED)
+		_type = DistrictRegistry::findByName(name);
+	if (_type != DistrictType::TO_BE_DEFINED)
+		cost = DistrictRegistry::info(_type).cost;
 }
 
 District::~District()
 {
-	// ͷŽ
+	removeFromMap();
+	// 释放建筑对象
 	for (auto building : buildings) {
 		delete building;
 	}
 }
 
-// ṩһ,½״̬,ؽǷɹ
+// 提供一定的生产力后,更新建造状态,返回建造是否成功
 bool District::updateProduction(int productionYield)
 {
 	if (productionYield <= 0)
-		return status == ProductionStatus::COMPLETED; // Ч
+		return status == ProductionStatus::COMPLETED; // 无效生产力输入
 	progress += productionYield;
-	if (progress >= cost) // 
+	if (progress >= cost) // 建造完成
 	{
 		turnsRemaining = 0;
 		status = ProductionStatus::COMPLETED;
 		progress = cost;
-		updateGrossYield(); // 
+		updateGrossYield(); // 更新区域产出
 		return true;
 	}
 	else
 	{
-		turnsRemaining = (cost - progress + productionYield - 1) / productionYield; // ȡ
+		turnsRemaining = (cost - progress + productionYield - 1) / productionYield; // 向上取整
 		return false;
 	}
 }
 
-// ӳɲ
+// 计算区域相邻加成(默认无相邻加成)
 void District::calculateBonus()
 {
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-	adjacencyBonus += buildingBonus;
+	adjacencyBonus = { 0, 0, 0, 0, 0 };
 }
 
 void District::updateMaintenanceCost()
 {
-	// 㽨ά
+	// 计算建筑维护费用
 	buildingMaintenanceCost = 0;
 	for (auto building : buildings)
 	{
@@ -135,13 +87,107 @@ void District::updateMaintenanceCost()
 	maintanenceCost = baseMaintenanceCost + buildingMaintenanceCost;
 }
 
-// ܲ(ܻ϶Χ6ؿ״̬/Χؿ״̬ıʱ)
+// 区域总产出更新：建筑加成每次从头累加，相邻加成使用缓存值
 void District::updateGrossYield()
 {
-	calculateBonus(); // ¼ӳɲ
+	YieldAccumulator acc;
+	for (auto building : buildings)
+	{
+		acc.add(building->getYield());
+	}
+	buildingBonus = acc.result();
 	grossYield = buildingBonus + adjacencyBonus;
 }
 
+// 重算相邻加成并汇总总产出
+bool District::refreshAdjacency()
+{
+	Yield oldYield = grossYield;
+	calculateBonus();
+	updateGrossYield();
+	return grossYield != oldYield;
+}
+
+// 区域建成并加入城市
+void District::placeInCity(BaseCity* city)
+{
+	_ownerCity = city;
+	progress = cost;
+	status = ProductionStatus::COMPLETED;
+	GameManager::getInstance()->getDistrictGrid().place(this);
+
+	refreshAdjacency(); // 自身立即计算，相邻区域等回合结束时统一重算
+	markAdjacencyDirtyAround(_pos);
+}
+
+// 区域从地图移除
+void District::removeFromMap()
+{
+	if (_adjacencyDirty)
+	{
+		adjacencyQueue.erase(std::remove(adjacencyQueue.begin(), adjacencyQueue.end(), this), adjacencyQueue.end());
+		_adjacencyDirty = false;
+	}
+	if (!_ownerCity || !GameManager::getInstance()->getDistrictGrid().remove(this))
+		return;
+	_ownerCity = nullptr;
+	markAdjacencyDirtyAround(_pos);
+}
+
+void District::markAdjacencyDirty()
+{
+	if (_adjacencyDirty)
+		return;
+	_adjacencyDirty = true;
+	adjacencyQueue.push_back(this);
+}
+
+// 地块变化只影响以它为邻的区域；区域本身所在地块的变化也会使该区域失效
+void District::markAdjacencyDirtyAround(Hex tile)
+{
+	const DistrictGrid& grid = GameManager::getInstance()->getDistrictGrid();
+	for (int dir = 0; dir < 6; dir++)
+	{
+		District* neighbor = grid.getDistrictAt(tile.getNeighbor(dir));
+		if (neighbor)
+			neighbor->markAdjacencyDirty();
+	}
+	District* self = grid.getDistrictAt(tile);
+	if (self)
+		self->markAdjacencyDirty();
+}
+
+int District::processAdjacencyQueue()
+{
+	int changed = 0;
+	std::vector<District*> queue;
+	queue.swap(adjacencyQueue);
+	for (auto district : queue)
+	{
+		district->_adjacencyDirty = false;
+		if (district->refreshAdjacency())
+		{
+			changed++;
+			if (district->_ownerCity)
+				district->_ownerCity->markYieldDirty();
+		}
+	}
+	return changed;
+}
+
+int District::countAdjacentDistricts() const
+{
+	return GameManager::getInstance()->getDistrictGrid().countAdjacent(_pos);
+}
+
+const TileData* District::findTileData(Hex where)
+{
+	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
+	if (!gameScene)
+		return nullptr;
+	return gameScene->getMapLayer()->findTileData(where);
+}
+
 void District::updateCitizenBenefit()
 {
 	buildingBenefit = { 0,0,0,0,0 };
@@ -195,65 +241,66 @@ bool District::addBuilding(std::string buildingName)
 		delete newBuilding;
 		return false;
 	}
-	// ʵ
+	// 创建建筑实例
 	if (!newBuilding)
-		return false; // ʧ
+		return false; // 创建失败
 	if (!newBuilding->canErectBuilding())
 	{
 		delete newBuilding;
-		return false; // 㽨
+		return false; // 不满足建造条件
 	}
 	buildings.push_back(newBuilding);
-	updateGrossYield(); // ܻӰ,øº
+	updateGrossYield(); // 建筑物可能会影响区域产出,调用更新函数
 	return true;
 }
 
-std::vector<Hex> District::getHexNeighbors(Hex center)
+bool District::canErectDistrict(Hex where)
 {
-	std::vector<Hex> neighbors;
-	std::vector<Hex> directions = {
-		Hex(1, 0), Hex(1, -1), Hex(0, -1),
-		Hex(-1, 0), Hex(-1, 1), Hex(0, 1)
-	};
-	for (const auto& dir : directions)
-	{
-		neighbors.push_back(Hex(center.q + dir.q, center.r + dir.r));
-	}
-	return neighbors;
+	return canErectAt(_type, playerID, where);
 }
 
-bool District::canErectDistrict(Hex where)
+int District::getPrereqTech() const
 {
-	auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
-	if (!gameScene) return false;
-	TileData tileData = gameScene->getTileData(where);
-	bool tileMatch = false;
-	for (auto terrain : prereqTerrains)
-	{
-		if (tileData.type == terrain)
-		{
-			tileMatch = true;
-			break;
-		}
-	}
-	// У԰ܽں󡢺ɽ
-	if (tileMatch)
-	{
-		if ((prereqTechID == -1 || GameManager::getInstance()->getPlayer(playerID)->getTechTree()->isActivated(prereqTechID)) &&
-			(prereqCivicID == -1 || GameManager::getInstance()->getPlayer(playerID)->getTechTree()->isActivated(prereqCivicID)))
-			return true;
-	}
-	return false;
+	return _type == DistrictType::TO_BE_DEFINED ? -1 : DistrictRegistry::info(_type).prereqTechID;
+}
+
+int District::getPrereqCivic() const
+{
+	return _type == DistrictType::TO_BE_DEFINED ? -1 : DistrictRegistry::info(_type).prereqCivicID;
+}
+
+unsigned District::getPrereqTerrainMask() const
+{
+	return _type == DistrictType::TO_BE_DEFINED ? 0 : DistrictRegistry::info(_type).terrainMask;
+}
+
+bool District::canErectAt(DistrictType type, int playerID, Hex where)
+{
+	if (type == DistrictType::TO_BE_DEFINED)
+		return false;
+	// 地块上已有区域（包括市中心）时不能再建
+	if (GameManager::getInstance()->getDistrictGrid().isOccupied(where))
+		return false;
+	const TileData* tileData = findTileData(where);
+	if (!tileData || !DistrictRegistry::allowsTerrain(type, tileData->type))
+		return false;
+
+	const DistrictTypeInfo& info = DistrictRegistry::info(type);
+	Player* player = GameManager::getInstance()->getPlayer(playerID);
+	if (!player)
+		return false;
+	return (info.prereqTechID == -1 || player->getTechTree()->isActivated(info.prereqTechID)) &&
+		(info.prereqCivicID == -1 || player->getCultureTree()->isActivated(info.prereqCivicID));
 }
 
-// ====================  ====================
+// ==================== 市中心区 ====================
 
 Downtown::Downtown(int player, Hex pos, std::string name)
 	: District(player, pos, DistrictType(District::DistrictType::DOWNTOWN), name)
 {
-	cost = 54; // ɱΪ54
+	cost = 54; // 市中心区建造成本为54
 	progress = 0;
-	turnsRemaining = cost; // ĬϳʼʣغΪ54
+	turnsRemaining = cost; // 默认初始剩余回合数为54
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::MONUMENT,
 		BuildingCategory::GRANARY,
@@ -261,30 +308,10 @@ Downtown::Downtown(int player, Hex pos, std::string name)
 	});
 	updateGrossYield();
 
-	// Ƴ (ɫ)
+	// 绘制城市 (蓝色方块)
 	auto draw = DrawNode::create();
 	draw->drawSolidRect(Vec2(-15, -15), Vec2(15, 15), Color4F::BLUE);
-	// Ӹǽ
+	// 加个城墙轮廓
 	draw->drawRect(Vec2(-15, -15), Vec2(15, 15), Color4F::WHITE);
 	_downtownVisual = draw;
 }
-void Downtown::calculateBonus()
-{
-	// δ,޼ӳɲ
-	if (status != ProductionStatus::COMPLETED)
-	{
-		adjacencyBonus = { 0,0,0,0,0 };
-		return;
-	}
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-
-	// ڵؿļӳ
-
-	// 㽨ӳ
-	for (auto building : buildings)
-	{
-		buildingBonus += building->getYield();
-	}
-	adjacencyBonus += buildingBonus;
-	// ߼ӳɵӳɼ
-}
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
-* 
+* 区域类
 */
 
 #ifndef __DISTRICT_H__
@@ -12,70 +12,78 @@
 #include <vector> 
 
 class Building;
+class BaseCity;
 
 
 class District : public ProductionProgram {
 public:
-	enum class DistrictType { // ö
-		DOWNTOWN, // (Ĭ)
-		CAMPUS, // ѧԺ
-		INDUSTRY_ZONE, // ҵ
-		COMMERCIAL_HUB, // ҵ
-		THEATER_SQUARE, // Ժ㳡
-		HARBOR, // ۿ
-		SPACEPORT, // 
-		//... Ӫ
-		TO_BE_DEFINED // δ
+	enum class DistrictType { // 区域类型枚举
+		DOWNTOWN, // 市中心(默认区域类型)
+		CAMPUS, // 学院
+		INDUSTRY_ZONE, // 工业区
+		COMMERCIAL_HUB, // 商业中心
+		THEATER_SQUARE, // 剧院广场
+		HARBOR, // 港口
+		SPACEPORT, // 航天中心
+		//... 军营
+		TO_BE_DEFINED // 未定义
 	};
 
 	enum class BuildingCategory
 	{
-		PALACE, // 
-		MONUMENT, // 
-		GRANARY, // Ȳ
+		PALACE, // 宫殿
+		MONUMENT, // 纪念碑
+		GRANARY, // 谷仓
 
-		LIBRARY, // ͼ
-		UNIVERSITY, // ѧ
-		LABORATORY, // ʵ
+		LIBRARY, // 图书馆
+		UNIVERSITY, // 大学
+		LABORATORY, // 实验室
 
-		MARKET, // г
-		BANK, // 
-		STOCK_EXCHANGE, // ֤ȯ
+		MARKET, // 市场
+		BANK, // 银行
+		STOCK_EXCHANGE, // 证券交易所
 
-		WORKSHOP, // 
-		FACTORY, // 
-		POWER_PLANT, // 糧
-		RHUR_VALLEY, // ³ҵ(⽨-¹ ԭۣﵱ)
+		WORKSHOP, // 工坊
+		FACTORY, // 工厂
+		POWER_PLANT, // 发电厂
+		RHUR_VALLEY, // 鲁尔工业区(特殊建筑-德国， 原版是奇观，这里当作建筑处理)
 
-		AMPHITHEATER, // ¶糡
-		MUSEUM, // 
-		BROADCAST_CENTER, // 㲥
+		AMPHITHEATER, // 露天剧场
+		MUSEUM, // 博物馆
+		BROADCAST_CENTER, // 广播中心
 
-		LIGHTHOUSE, // 
-		DOCKYARD, // 촬
-		DOCKS, // ͷ
+		LIGHTHOUSE, // 灯塔
+		DOCKYARD, // 造船厂
+		DOCKS, // 码头
 
-		// ѺĵĿΪ
-		LAUNCH_SATELLITE, // 
+		// 这里把航天中心的项目视为建筑
+		LAUNCH_SATELLITE, // 发射卫星
 
 		TO_BE_DEFINED
 	};
 
 	District(int playerID, Hex pos, DistrictType type, std::string name);
 	~District();
-	static bool isThereDistrictAt(Hex where);
 
-	// ຯд
+	// 基类函数重写
 	virtual void addProgress(int amount) override { updateProduction(amount); };
 
 
 	bool canErectDistrict(Hex where);
+	// 只读类型表与区域占用表判断能否在 where 建造该类型区域，不需要构造区域对象
+	static bool canErectAt(DistrictType type, int playerID, Hex where);
 	bool updateProduction(int productionYield);
-	virtual void calculateBonus();
 	void updateMaintenanceCost();
-	void updateGrossYield();
+	void updateGrossYield(); // 重新汇总建筑加成与已缓存的相邻加成，不扫描相邻地块
 	void updateCitizenBenefit();
 
+	// 相邻加成缓存：只在相邻地块、区域或改良变化时失效，失效区域进入队列，回合结束时统一重算
+	void placeInCity(BaseCity* city); // 区域建成并加入城市：登记到地图，计算自身相邻加成，相邻区域失效
+	void removeFromMap(); // 区域被摧毁或随城市移除：注销并使相邻区域失效
+	void markAdjacencyDirty(); // 标记自身相邻加成失效（已在队列中则忽略）
+	static void markAdjacencyDirtyAround(Hex tile); // 地块变化：使以该地块为邻的已建成区域失效
+	static int processAdjacencyQueue(); // 重算队列中的区域，返回产出发生变化的区域数
+
 
 	virtual bool addBuilding(std::string buildingName);
 
@@ -85,60 +93,64 @@ public:
 	inline std::string				getName() { return _name; }
 	inline Hex						getPos() const { return _pos; }
 
-	inline int						getPrereqTech() const { return prereqTechID; }
-	inline int						getPrereqCivic() const { return prereqCivicID; }
-	inline std::vector<TerrainType> getPrereqTerrains() const { return prereqTerrains; }; // ǰõ
+	// 建造前置条件只存放在 DistrictRegistry 的类型表中，这里直接读表
+	int								getPrereqTech() const; // 建造前置科技
+	int								getPrereqCivic() const; // 建造前置市政
+	unsigned						getPrereqTerrainMask() const; // 可建造地形（terrainBit 位掩码）
 	inline int						getMaintenanceCost() const { return maintanenceCost; }
 	inline Yield					getCitizenBenefit() const { return citizenBenefit; }
 	inline Yield					getYield() const { return grossYield; }
 
-	inline std::vector<Building*>   getBuildings() const { return buildings; }
+	inline const std::vector<Building*>& getBuildings() const { return buildings; }
 protected:
-	std::vector<Hex> getHexNeighbors(Hex center);
-	// е,ڱ
+	virtual void calculateBonus(); // 根据相邻地块重新计算 adjacencyBonus，只由相邻加成缓存调用
+	bool refreshAdjacency(); // 重算相邻加成，返回总产出是否变化
+	int countAdjacentDistricts() const; // 相邻的已建成区域数
+	static const TileData* findTileData(Hex where); // 地块数据（不复制），地图未加载时返回空
+	// 计数所有的区域,便于编号
 	static int count;
-	static std::vector<Hex> districtPositions; // λб
-	// Ϣ
-	int playerID; // ID
-	int _id; // Ψһ־
-	DistrictType _type; // 
-	std::string _name; // 
-
-	// 
-	Hex _pos; // 
+	// 基础信息
+	int playerID; // 区域所属玩家ID
+	int _id; // 区域的唯一标志符
+	DistrictType _type; // 区域类型
+	std::string _name; // 区域名称
+
+	// 归属相关
+	Hex _pos; // 区域坐标
 	 
-	// 
+	// 建造相关
 	
-	int prereqTechID; // ǰÿƼ
-	int prereqCivicID; // ǰ
-	std::vector<TerrainType> prereqTerrains; // ǰõ
-	std::vector<BuildingCategory> possibleBuildings; // ڵĽ
-	// ά
-	int baseMaintenanceCost; // ά
-	int buildingMaintenanceCost;// ά
-	int maintanenceCost; // ά
-
-	// 
-	Yield buildingBonus; // ӳɲ
-	Yield adjacencyBonus; // ڼӳ
-	Yield grossYield; // ܲ(ǰ֮)
-	Yield baseBenefit; // Ӱ
-	Yield buildingBenefit; // ĸӰ
-	Yield citizenBenefit; // ĸӰ
-
-	// 
-	std::vector<Building*> buildings; // ɵĽб
+	std::vector<BuildingCategory> possibleBuildings; // 包含在内的建筑
+	// 维护相关
+	int baseMaintenanceCost; // 区域维护费用
+	int buildingMaintenanceCost;// 建筑维护费用
+	int maintanenceCost; // 区域总维护费用
+
+	// 产出相关
+	Yield buildingBonus; // 建筑加成产出
+	Yield adjacencyBonus; // 区域相邻加成
+	Yield grossYield; // 区域总产出(前两项之和)
+	Yield baseBenefit; // 区域基础福利影响
+	Yield buildingBenefit; // 建筑对市民的福利影响
+	Yield citizenBenefit; // 区域对市民的福利影响
+
+	// 建筑
+	std::vector<Building*> buildings; // 区域容纳的建筑列表
+
+private:
+	static std::vector<District*> adjacencyQueue; // 相邻加成失效的区域
+	BaseCity* _ownerCity; // 所属城市（未建成为空），相邻加成变化时通知其重新汇总产出
+	bool _adjacencyDirty; // 是否已在失效队列中
 };
 
 class Downtown : public District {
 public:
 	Downtown(int player, Hex pos, std::string name);
-	void completeDirectly() { // ³ʱֱĽ죬޸еĲҪ
+	void completeDirectly() { // 建立新城市时直接完成市中心区的建造，修复已有的市中心才需要正常建造流程
 		progress = cost;
 		status = ProductionStatus::COMPLETED;
 		updateGrossYield();
 	}
-	virtual void calculateBonus();
 	cocos2d::Node* _downtownVisual;
 };
 
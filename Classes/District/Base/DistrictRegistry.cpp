@@ -0,0 +1,57 @@
+#include "DistrictRegistry.h"
+#include <unordered_map>
+
+// 区域类型表：顺序必须与 DistrictType 枚举一致
+const DistrictTypeInfo kDistrictTypeTable[kDistrictTypeCount] = {
+	{ District::DistrictType::DOWNTOWN,       "Downtown",      100, 54,   -1, -1,  kLandDistrictTerrains },
+	{ District::DistrictType::CAMPUS,         "Campus",        110, 54,   4,  -1,  kLandDistrictTerrains }, // 书写
+	{ District::DistrictType::INDUSTRY_ZONE,  "IndustryZone",  150, 54,   12, -1,  kLandDistrictTerrains }, // 学徒制
+	{ District::DistrictType::COMMERCIAL_HUB, "CommercialHub", 120, 110,  6,  -1,  kLandDistrictTerrains }, // 货币
+	{ District::DistrictType::THEATER_SQUARE, "TheaterSquare", 140, 54,   -1, 102, kLandDistrictTerrains }, // 技艺
+	{ District::DistrictType::HARBOR,         "Harbor",        130, 54,   5,  -1,  kWaterDistrictTerrains }, // 航海
+	{ District::DistrictType::SPACEPORT,      "Spaceport",     160, 1800, 21, -1,  kLandDistrictTerrains } // 火箭学
+};
+
+namespace {
+	// 区域项目ID为 100 起的整十数，反查表按 (ID - 100) / 10 下标
+	const int kFirstDistrictProgramId = 100;
+	const int kDistrictProgramSlots = 10;
+
+	struct ReverseIndex {
+		std::unordered_map<std::string, District::DistrictType> byName;
+		District::DistrictType bySlot[kDistrictProgramSlots];
+	};
+
+	const ReverseIndex& reverseIndex()
+	{
+		static const ReverseIndex index = [] {
+			ReverseIndex built;
+			for (int i = 0; i < kDistrictProgramSlots; i++)
+				built.bySlot[i] = District::DistrictType::TO_BE_DEFINED;
+			for (int i = 0; i < kDistrictTypeCount; i++)
+			{
+				const DistrictTypeInfo& info = kDistrictTypeTable[i];
+				CCASSERT(static_cast<int>(info.type) == i, "kDistrictTypeTable order must match DistrictType");
+				built.byName[info.name] = info.type;
+				built.bySlot[(info.programId - kFirstDistrictProgramId) / 10] = info.type;
+			}
+			return built;
+		}();
+		return index;
+	}
+}
+
+District::DistrictType DistrictRegistry::findByName(const std::string& name)
+{
+	const auto& byName = reverseIndex().byName;
+	auto it = byName.find(name);
+	return it == byName.end() ? District::DistrictType::TO_BE_DEFINED : it->second;
+}
+
+District::DistrictType DistrictRegistry::findByProgramId(int programId)
+{
+	int offset = programId - kFirstDistrictProgramId;
+	if (offset < 0 || offset % 10 != 0 || offset / 10 >= kDistrictProgramSlots)
+		return District::DistrictType::TO_BE_DEFINED;
+	return reverseIndex().bySlot[offset / 10];
+}
@@ -0,0 +1,55 @@
+/*
+* 区域类型注册表
+*/
+
+#ifndef __DISTRICT_REGISTRY_H__
+#define __DISTRICT_REGISTRY_H__
+
+#include "District.h"
+#include <string>
+
+// 地形位掩码：按 TerrainType 取位
+constexpr unsigned terrainBit(TerrainType terrain) { return 1u << static_cast<int>(terrain); }
+
+// 陆地区域可建造的地形（不含海洋、海岸和山脉）
+constexpr unsigned kLandDistrictTerrains =
+	terrainBit(TerrainType::DESERT) | terrainBit(TerrainType::GRASSLAND) | terrainBit(TerrainType::JUNGLE) |
+	terrainBit(TerrainType::PLAINS) | terrainBit(TerrainType::SNOW) | terrainBit(TerrainType::TUNDRA);
+// 港口只能建在海岸或海洋上
+constexpr unsigned kWaterDistrictTerrains = terrainBit(TerrainType::COAST) | terrainBit(TerrainType::OCEAN);
+
+// 区域类型的静态数据（只读常量，按 DistrictType 下标存放）
+struct DistrictTypeInfo {
+	District::DistrictType type; // 类型ID（与下标一致）
+	const char* name; // 显示/存档用名称，与生产项目名称一致
+	int programId; // 生产项目ID
+	int cost; // 生产力成本
+	int prereqTechID; // 建造前置科技，-1 表示无
+	int prereqCivicID; // 建造前置市政，-1 表示无
+	unsigned terrainMask; // 可建造地形
+};
+
+static const int kDistrictTypeCount = static_cast<int>(District::DistrictType::TO_BE_DEFINED);
+
+// 区域类型表：顺序必须与 DistrictType 枚举一致，定义在 DistrictRegistry.cpp（全程序只有一份）
+extern const DistrictTypeInfo kDistrictTypeTable[kDistrictTypeCount];
+
+/**
+ * 区域类型注册表
+ * 类型ID直接下标到 kDistrictTypeTable；名称只在生产面板与存档边界反查一次。
+ */
+class DistrictRegistry {
+public:
+	static const DistrictTypeInfo& info(District::DistrictType type) {
+		return kDistrictTypeTable[static_cast<int>(type)];
+	}
+	static bool allowsTerrain(District::DistrictType type, TerrainType terrain) {
+		return (info(type).terrainMask & terrainBit(terrain)) != 0;
+	}
+	// 按名称反查类型ID，未注册时返回 TO_BE_DEFINED
+	static District::DistrictType findByName(const std::string& name);
+	// 按生产项目ID反查类型ID，不是区域项目时返回 TO_BE_DEFINED
+	static District::DistrictType findByProgramId(int programId);
+};
+
+#endif // __DISTRICT_REGISTRY_H__
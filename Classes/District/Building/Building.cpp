@@ -3,415 +3,89 @@
 #include "Development/CultureSystem.h"
 #include "Core/GameManager.h"
 #include "District/Base/District.h"
+#include <unordered_map>
 
-// 캯ݽͳʼ
-Building::Building(int player, BuildingType type)
-	: _type(type),
-	ProductionProgram(ProductionType::BUILDING, "", Hex(), 0, true, 0), // ûƽ
-	playerID(player),
-	districtName(""),
-	maintenanceCost(0), 
-	hasCitizenBenefit(false),
-	citizenBenefit({ 0,0,0,0,0 }),
-	prereqTechID(-1), // ĬǰÿƼ
-	prereqCivicID(-1), // Ĭǰ
-	isUnique(false), // ĬϷΨһ
-	yield({ 0,0,0,0,0 })
-{
-	// ݽͳʼ
-	switch (type)
+namespace {
+	const int kBuildingTypeCount = static_cast<int>(Building::BuildingType::TO_BE_DEFINED);
+
+	// 建筑类型表：顺序必须与 BuildingType 枚举一致，末尾为未定义类型的空定义
+	// 列：类型、名称、分类、区域、成本、购买价、可购买、维护、前置科技、前置市政、唯一、产出{食物,生产,科技,金币,文化}、市民加成
+	const Building::Definition kBuildingTable[kBuildingTypeCount + 1] = {
+	{ Building::BuildingType::PALACE, "Palace", District::BuildingCategory::PALACE, "Downtown", 1, 0, true, 0, -1, -1, true, { 0, 2, 2, 5, 1 }, { 0, 0, 0, 0, 0 } },
+	{ Building::BuildingType::MONUMENT, "Monument", District::BuildingCategory::MONUMENT, "Downtown", 60, 240, true, 0, -1, -1, false, { 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0 } },
+	{ Building::BuildingType::GRANARY, "Granary", District::BuildingCategory::GRANARY, "Downtown", 65, 260, true, 0, -1, -1, false, { 1, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } },
+	{ Building::BuildingType::LIBRARY, "Library", District::BuildingCategory::LIBRARY, "Campus", 90, 360, true, 1, 4, -1, false, { 0, 0, 2, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 书写
+	{ Building::BuildingType::UNIVERSITY, "University", District::BuildingCategory::UNIVERSITY, "Campus", 250, 1000, true, 2, 10, -1, false, { 0, 0, 4, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 数学
+	{ Building::BuildingType::LABORATORY, "Laboratory", District::BuildingCategory::LABORATORY, "Campus", 440, 1760, true, 3, 14, -1, false, { 0, 0, 5, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 火药
+	{ Building::BuildingType::MARKET, "Market", District::BuildingCategory::MARKET, "CommercialHub", 120, 480, true, 0, 6, -1, false, { 0, 0, 0, 2, 0 }, { 0, 0, 0, 0, 0 } }, // 货币
+	{ Building::BuildingType::BANK, "Bank", District::BuildingCategory::BANK, "CommercialHub", 290, 1160, true, 0, 13, -1, false, { 0, 0, 0, 5, 0 }, { 0, 0, 0, 0, 0 } }, // 银行
+	{ Building::BuildingType::STOCK_EXCHANGE, "StockExchange", District::BuildingCategory::STOCK_EXCHANGE, "CommercialHub", 330, 1320, true, 0, 19, -1, false, { 0, 0, 0, 7, 0 }, { 0, 0, 0, 0, 0 } }, // 经济学
+	{ Building::BuildingType::WORKSHOP, "Workshop", District::BuildingCategory::WORKSHOP, "IndustryZone", 195, 780, true, 1, 12, -1, false, { 0, 3, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 学徒制
+	{ Building::BuildingType::FACTORY, "Factory", District::BuildingCategory::FACTORY, "IndustryZone", 330, 1320, true, 2, 17, -1, false, { 0, 6, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 工业化
+	{ Building::BuildingType::POWER_PLANT, "PowerPlant", District::BuildingCategory::POWER_PLANT, "IndustryZone", 300, 1200, true, 3, 17, -1, false, { 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0 } }, // 工业化
+	{ Building::BuildingType::RHUR_VALLEY, "RhurValley", District::BuildingCategory::RHUR_VALLEY, "IndustryZone", 1240, 0, false, 0, 17, -1, true, { 0, 8, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 工业化，不能用黄金购买
+	{ Building::BuildingType::AMPHITHEATER, "Amphitheater", District::BuildingCategory::AMPHITHEATER, "TheaterSquare", 150, 600, true, 1, -1, 102, false, { 0, 0, 0, 0, 2 }, { 0, 0, 0, 0, 0 } }, // 技艺
+	{ Building::BuildingType::MUSEUM, "Museum", District::BuildingCategory::MUSEUM, "TheaterSquare", 290, 1160, true, 2, -1, 107, false, { 0, 0, 0, 0, 2 }, { 0, 0, 0, 0, 0 } }, // 人文主义
+	{ Building::BuildingType::BROADCAST_CENTER, "BroadcastCenter", District::BuildingCategory::BROADCAST_CENTER, "TheaterSquare", 440, 1760, true, 3, -1, 109, false, { 0, 0, 0, 0, 4 }, { 0, 0, 0, 0, 1 } }, // 意识形态
+	{ Building::BuildingType::LIGHTHOUSE, "Lighthouse", District::BuildingCategory::LIGHTHOUSE, "Harbor", 120, 480, true, 0, 5, -1, false, { 1, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 航海
+	{ Building::BuildingType::DOCKYARD, "Dockyard", District::BuildingCategory::DOCKYARD, "Harbor", 290, 1160, true, 1, 9, -1, false, { 2, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 造船术
+	{ Building::BuildingType::DOCKS, "Docks", District::BuildingCategory::DOCKS, "Harbor", 440, 1760, true, 0, 16, -1, false, { 3, 0, 0, 2, 0 }, { 1, 0, 0, 0, 0 } }, // 制图学
+	{ Building::BuildingType::LAUNCH_SATELLITE, "LaunchSatellite", District::BuildingCategory::LAUNCH_SATELLITE, "Spaceport", 1000, 4000, true, 0, 21, -1, true, { 0, 0, 10, 0, 0 }, { 0, 0, 0, 0, 0 } }, // 火箭学
+	{ Building::BuildingType::TO_BE_DEFINED, "", District::BuildingCategory::TO_BE_DEFINED, "", 0, 0, false, 0, -1, -1, false, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } }
+	};
+
+	const std::unordered_map<std::string, int>& nameIndex()
 	{
-	case BuildingType::PALACE:
-		districtName = "Downtown";
-		cost = 1;
-		isUnique = true;
-		yield.cultureYield = 1;
-		yield.productionYield = 2;
-		yield.goldYield = 5;
-		yield.scienceYield = 2;
-		break;
-	case BuildingType::MONUMENT:
-		districtName = "Downtown";
-		cost = 60;
-		purchaseCost = 240;
-		isUnique = false;
-		yield.cultureYield = 1; // +1Ļ
-		break;
-	case BuildingType::GRANARY:
-		districtName = "Downtown";
-		cost = 65;
-		purchaseCost = 260;
-		yield.foodYield = 1;
-		break;
-	case BuildingType::LIBRARY:
-		districtName = "Campus";
-		cost = 90;
-		purchaseCost = 360;
-		maintenanceCost = 1;
-		prereqTechID = 4; // ǰÿƼд(ID 4)
-		yield.scienceYield = 2; // +2Ƽ
-		break;
-	case BuildingType::UNIVERSITY:
-		districtName = "Campus";
-		cost = 250;
-		purchaseCost = 1000;
-		maintenanceCost = 2;
-		prereqTechID = 10; // ǰÿƼѧ(ID 10)
-		yield.scienceYield = 4; // +4Ƽ
-		break;
-	case BuildingType::LABORATORY:
-		districtName = "Campus";
-		cost = 440;
-		purchaseCost = 1760;
-		maintenanceCost = 3;
-		prereqTechID = 14; // ǰÿƼҩ(ID 14)
-		yield.scienceYield = 5; // +5Ƽ
-		break;
-	case BuildingType::MARKET:
-		districtName = "CommercialHub";
-		cost = 120;
-		purchaseCost = 480;
-		prereqTechID = 6; // ǰÿƼ(ID 6)
-		yield.goldYield = 2; // +2
-		break;
-	case BuildingType::BANK:
-		districtName = "CommercialHub";
-		cost = 290;
-		purchaseCost = 1160;
-		prereqTechID = 13; // ǰÿƼ(ID 13)
-		yield.goldYield = 5; // +5
-		break;
-	case BuildingType::STOCK_EXCHANGE:
-		districtName = "CommercialHub";
-		cost = 330;
-		purchaseCost = 1320;
-		prereqTechID = 19; // ǰÿƼѧ(ID 19)
-		yield.goldYield = 7; // +7
-		break;
-	case BuildingType::WORKSHOP:
-		districtName = "IndustryZone";
-		cost = 195;
-		purchaseCost = 780;
-		maintenanceCost = 1;
-		prereqTechID = 12; // ǰÿƼѧͽ(ID 12)
-		yield.productionYield = 3; // +3
-		break;
-	case BuildingType::FACTORY:
-		districtName = "IndustryZone";
-		cost = 330;
-		purchaseCost = 1320;
-		maintenanceCost = 2;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		yield.productionYield = 6; // +6
-		break;
-	case BuildingType::POWER_PLANT:
-		districtName = "IndustryZone";
-		cost = 300;
-		purchaseCost = 1200;
-		maintenanceCost = 3;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		citizenBenefit.productionYield = 1; // +1ÿλ
-		break;
-	case BuildingType::RHUR_VALLEY:
-		districtName = "IndustryZone";
-		cost = 1240;
-		canPurchase = false; //	ûƽ
-		isUnique = true;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		yield.productionYield = 8; // +8
-		break;
-	case BuildingType::AMPHITHEATER:
-		districtName = "TheaterSquare";
-		cost = 150;
-		purchaseCost = 600;
-		maintenanceCost = 1;
-		prereqCivicID = 102; // ǰ(ID 102)
-		yield.cultureYield = 2; // +2Ļ
-		break;
-	case BuildingType::MUSEUM:
-		districtName = "TheaterSquare";
-		cost = 290;
-		purchaseCost = 1160;
-		maintenanceCost = 2;
-		prereqCivicID = 107; // ǰ(ID 107)
-		yield.cultureYield = 2; // +2Ļ
-		break;
-	case BuildingType::BROADCAST_CENTER:
-		districtName = "TheaterSquare";
-		cost = 440;
-		purchaseCost = 1760;
-		maintenanceCost = 3;
-		prereqCivicID = 109; // ǰʶ̬(ID 109)
-		yield.cultureYield = 4; // +4Ļ
-		citizenBenefit.cultureYield = 1; // +1Ļÿλ
-		break;
-	case BuildingType::LIGHTHOUSE:
-		districtName = "Harbor";
-		cost = 120;
-		purchaseCost = 480;
-		prereqTechID = 5; // ǰÿƼ(ID 5)
-		yield.foodYield = 1; // +1ʳ
-		break;
-	case BuildingType::DOCKYARD:
-		districtName = "Harbor";
-		cost = 290;
-		purchaseCost = 1160;
-		maintenanceCost = 1;
-		prereqTechID = 9; // ǰÿƼ촬(ID 9)
-		yield.foodYield = 2; // +2ʳ
-		break;
-	case BuildingType::DOCKS:
-		districtName = "Harbor";
-		cost = 440;
-		purchaseCost = 1760;
-		prereqTechID = 16; // ǰÿƼͼѧ(ID 16)
-		yield.foodYield = 3; // +3ʳ
-		yield.goldYield = 2; // +2
-		citizenBenefit.foodYield = 1; // +1ʳÿλ
-		break;
-	case BuildingType::LAUNCH_SATELLITE:
-		districtName = "Spaceport";
-		cost = 1000;
-		purchaseCost = 4000;
-		isUnique = true;
-		prereqTechID = 21; // ǰÿƼѧ(ID 21)
-		yield.scienceYield = 10; // +10Ƽ
-		break;
-	default:
-		break;
+		static const std::unordered_map<std::string, int> index = [] {
+			std::unordered_map<std::string, int> built;
+			for (int i = 0; i < kBuildingTypeCount; i++)
+			{
+				CCASSERT(static_cast<int>(kBuildingTable[i].type) == i, "kBuildingTable order must match BuildingType");
+				built[kBuildingTable[i].name] = i;
+			}
+			return built;
+		}();
+		return index;
 	}
 }
-Building::Building(int player, std::string name)
-	:_type(BuildingType::TO_BE_DEFINED),
-	ProductionProgram(ProductionType::BUILDING, name, Hex(), 0, true, 0), // ûƽ
-	playerID(player),
-	districtName(""),
-	maintenanceCost(0),
-	hasCitizenBenefit(false),
-	citizenBenefit({ 0,0,0,0,0 }),
-	prereqTechID(-1), // ĬǰÿƼ
-	prereqCivicID(-1), // Ĭǰ
-	isUnique(false), // ĬϷΨһ
-	yield({ 0,0,0,0,0 })
+
+const Building::Definition& Building::definition(BuildingType type)
 {
-	// ݽͳʼ
-	if (name == "Palace") {
-		_type = BuildingType::PALACE;
-		districtName = "Downtown";
-		cost = 1;
-		isUnique = true;
-		yield.cultureYield = 1;
-		yield.productionYield = 2;
-		yield.goldYield = 5;
-		yield.scienceYield = 2;
-	}
-	else if (name == "Monument") {
-		_type = BuildingType::MONUMENT;
-		districtName = "Downtown";
-		cost = 60;
-		purchaseCost = 240;
-		isUnique = false;
-		yield.cultureYield = 1; // +1Ļ
-	}
-	else if (name == "Granary") {
-		_type = BuildingType::GRANARY;
-		districtName = "Downtown";
-		cost = 65;
-		purchaseCost = 260;
-		yield.foodYield = 1;
-	}
-	else if (name == "Library") {
-		_type = BuildingType::LIBRARY;
-		districtName = "Campus";
-		cost = 90;
-		purchaseCost = 360;
-		maintenanceCost = 1;
-		prereqTechID = 4; // ǰÿƼд(ID 4)
-		yield.scienceYield = 2; // +2Ƽ
-	}
-	else if (name == "University") {
-		_type = BuildingType::UNIVERSITY;
-		districtName = "Campus";
-		cost = 250;
-		purchaseCost = 1000;
-		maintenanceCost = 2;
-		prereqTechID = 10; // ǰÿƼѧ(ID 10)
-		yield.scienceYield = 4; // +4Ƽ
-	}
-	else if (name == "Laboratory") {
-		_type = BuildingType::LABORATORY;
-		districtName = "Campus";
-		cost = 440;
-		purchaseCost = 1760;
-		maintenanceCost = 3;
-		prereqTechID = 14; // ǰÿƼҩ(ID 14)
-		yield.scienceYield = 5; // +5Ƽ
-	}
-	else if (name == "Market") {
-		_type = BuildingType::MARKET;
-		districtName = "CommercialHub";
-		cost = 120;
-		purchaseCost = 480;
-		prereqTechID = 6; // ǰÿƼ(ID 6)
-		yield.goldYield = 2; // +2
-	}
-	else if (name == "Bank") {
-		_type = BuildingType::BANK;
-		districtName = "CommercialHub";
-		cost = 290;
-		purchaseCost = 1160;
-		prereqTechID = 13; // ǰÿƼ(ID 13)
-		yield.goldYield = 5; // +5
-	}
-	else if (name == "StockExchange") {
-		_type = BuildingType::STOCK_EXCHANGE;
-		districtName = "CommercialHub";
-		cost = 330;
-		purchaseCost = 1320;
-		prereqTechID = 19; // ǰÿƼѧ(ID 19)
-		yield.goldYield = 7; // +7
-	}
-	else if (name == "Workshop") {
-		_type = BuildingType::WORKSHOP;
-		districtName = "IndustryZone";
-		cost = 195;
-		purchaseCost = 780;
-		maintenanceCost = 1;
-		prereqTechID = 12; // ǰÿƼѧͽ(ID 12)
-		yield.productionYield = 3; // +3
-	}
-	else if (name == "Factory") {
-		_type = BuildingType::FACTORY;
-		districtName = "IndustryZone";
-		cost = 330;
-		purchaseCost = 1320;
-		maintenanceCost = 2;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		yield.productionYield = 6; // +6
-	}
-	else if (name == "PowerPlant") {
-		_type = BuildingType::POWER_PLANT;
-		districtName = "IndustryZone";
-		cost = 300;
-		purchaseCost = 1200;
-		maintenanceCost = 3;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		citizenBenefit.productionYield = 1; // +1ÿλ
-	}
-	else if (name == "RhurValley") {
-		_type = BuildingType::RHUR_VALLEY;
-		districtName = "IndustryZone";
-		cost = 1240;
-		canPurchase = false; // ûƽ
-		isUnique = true;
-		prereqTechID = 17; // ǰÿƼҵ(ID 17)
-		yield.productionYield = 8; // +8
-	}
-	else if (name == "Amphitheater") {
-		_type = BuildingType::AMPHITHEATER;
-		districtName = "TheaterSquare";
-		cost = 150;
-		purchaseCost = 600;
-		maintenanceCost = 1;
-		prereqCivicID = 102; // ǰ(ID 102)
-		yield.cultureYield = 2; // +2Ļ
-	}
-	else if (name == "Museum") {
-		_type = BuildingType::MUSEUM;
-		districtName = "TheaterSquare";
-		cost = 290;
-		purchaseCost = 1160;
-		maintenanceCost = 2;
-		prereqCivicID = 107; // ǰ(ID 107)
-		yield.cultureYield = 2; // +2Ļ
-	}
-	else if (name == "BroadcastCenter") {
-		_type = BuildingType::BROADCAST_CENTER;
-		districtName = "TheaterSquare";
-		cost = 440;
-		purchaseCost = 1760;
-		maintenanceCost = 3;
-		prereqCivicID = 109; // ǰʶ̬(ID 109)
-		yield.cultureYield = 4; // +4Ļ
-		citizenBenefit.cultureYield = 1; // +1Ļÿλ
-	}
-	else if (name == "Lighthouse") {
-		_type = BuildingType::LIGHTHOUSE;
-		districtName = "Harbor";
-		cost = 120;
-		purchaseCost = 480;
-		prereqTechID = 5; // ǰÿƼ(ID 5)
-		yield.foodYield = 1; // +1ʳ
-	}
-	else if (name == "Dockyard") {
-		_type = BuildingType::DOCKYARD;
-		districtName = "Harbor";
-		cost = 290;
-		purchaseCost = 1160;
-		maintenanceCost = 1;
-		prereqTechID = 9; // ǰÿƼ촬(ID 9)
-		yield.foodYield = 2; // +2ʳ
-	}
-	else if (name == "Docks") {
-		_type = BuildingType::DOCKS;
-		districtName = "Harbor";
-		cost = 440;
-		purchaseCost = 1760;
-		prereqTechID = 16; // ǰÿƼͼѧ(ID 16)
-		yield.foodYield = 3; // +3ʳ
-		yield.goldYield = 2; // +2
-		citizenBenefit.foodYield = 1; // +1ʳÿλ
-	}
-	else if (name == "LaunchSatellite") {
-		_type = BuildingType::LAUNCH_SATELLITE;
-		districtName = "Spaceport";
-		cost = 1000;
-		purchaseCost = 4000;
-		isUnique = true;
-		prereqTechID = 21; // ǰÿƼѧ(ID 21)
-		yield.scienceYield = 10; // +10Ƽ
-	}
-	else {
-		// Ĭδ֪
-		_type = BuildingType::TO_BE_DEFINED;
-	}
+	return kBuildingTable[static_cast<int>(type)];
 }
-District::BuildingCategory convertFromBuildingType(Building::BuildingType type) {
-	switch (type) {
-	case Building::BuildingType::PALACE:           return District::BuildingCategory::PALACE;
-	case Building::BuildingType::MONUMENT:         return District::BuildingCategory::MONUMENT;
-	case Building::BuildingType::GRANARY:          return District::BuildingCategory::GRANARY;
-	case Building::BuildingType::LIBRARY:          return District::BuildingCategory::LIBRARY;
-	case Building::BuildingType::UNIVERSITY:       return District::BuildingCategory::UNIVERSITY;
-	case Building::BuildingType::LABORATORY:       return District::BuildingCategory::LABORATORY;
-	case Building::BuildingType::MARKET:           return District::BuildingCategory::MARKET;
-	case Building::BuildingType::BANK:             return District::BuildingCategory::BANK;
-	case Building::BuildingType::STOCK_EXCHANGE:   return District::BuildingCategory::STOCK_EXCHANGE;
-	case Building::BuildingType::WORKSHOP:         return District::BuildingCategory::WORKSHOP;
-	case Building::BuildingType::FACTORY:          return District::BuildingCategory::FACTORY;
-	case Building::BuildingType::POWER_PLANT:      return District::BuildingCategory::POWER_PLANT;
-	case Building::BuildingType::RHUR_VALLEY:      return District::BuildingCategory::RHUR_VALLEY;
-	case Building::BuildingType::AMPHITHEATER:     return District::BuildingCategory::AMPHITHEATER;
-	case Building::BuildingType::MUSEUM:           return District::BuildingCategory::MUSEUM;
-	case Building::BuildingType::BROADCAST_CENTER: return District::BuildingCategory::BROADCAST_CENTER;
-	case Building::BuildingType::LIGHTHOUSE:       return District::BuildingCategory::LIGHTHOUSE;
-	case Building::BuildingType::DOCKYARD:         return District::BuildingCategory::DOCKYARD;
-	case Building::BuildingType::DOCKS:            return District::BuildingCategory::DOCKS;
-	case Building::BuildingType::LAUNCH_SATELLITE: return District::BuildingCategory::LAUNCH_SATELLITE;
-	default:                                       return District::BuildingCategory::TO_BE_DEFINED;
-	}
+
+const Building::Definition& Building::findDefinition(const std::string& name)
+{
+	const auto& index = nameIndex();
+	auto it = index.find(name);
+	return kBuildingTable[it == index.end() ? kBuildingTypeCount : it->second];
 }
 
-District::BuildingCategory Building::getType() const { return convertFromBuildingType(_type); }
+// 构造函数：只记录共享的类型定义，生产成本从定义读取
+Building::Building(int player, BuildingType type)
+	: ProductionProgram(ProductionType::BUILDING, definition(type).name, Hex(),
+		definition(type).cost, definition(type).canPurchase, definition(type).purchaseCost),
+	_def(&definition(type)),
+	playerID(player)
+{
+}
 
+Building::Building(int player, const std::string& name)
+	: ProductionProgram(ProductionType::BUILDING, name, Hex(),
+		findDefinition(name).cost, findDefinition(name).canPurchase, findDefinition(name).purchaseCost),
+	_def(&findDefinition(name)),
+	playerID(player)
+{
+}
 
-// ǷԽý
+// 检查是否可以建造该建筑
 bool Building::canErectBuilding()
 {
-	// ǰýDistrictaddBuildingд
-	// ǰÿƼ
-	if ((prereqTechID == -1 || GameManager::getInstance()->getPlayer(playerID)->getTechTree()->isActivated(prereqTechID)) &&
-		(prereqCivicID == -1 || GameManager::getInstance()->getPlayer(playerID)->getTechTree()->isActivated(prereqCivicID)))
+	// 前置建筑检查在District类的addBuilding中处理
+	// 检查前置科技和市政
+	auto player = GameManager::getInstance()->getPlayer(playerID);
+	if ((_def->prereqTechID == -1 || player->getTechTree()->isActivated(_def->prereqTechID)) &&
+		(_def->prereqCivicID == -1 || player->getCultureTree()->isActivated(_def->prereqCivicID)))
 		return true;
 
 	return false;
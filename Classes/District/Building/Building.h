@@ -11,64 +11,78 @@
 class Building : public ProductionProgram {
 public:
 	enum class BuildingType {
-		PALACE, // 
-		MONUMENT, // 
-		GRANARY, // Ȳ
+		PALACE, // 宫殿
+		MONUMENT, // 纪念碑
+		GRANARY, // 谷仓
 
-		LIBRARY, // ͼ
-		UNIVERSITY, // ѧ
-		LABORATORY, // ʵ
+		LIBRARY, // 图书馆
+		UNIVERSITY, // 大学
+		LABORATORY, // 实验室
 
-		MARKET, // г
-		BANK, // 
-		STOCK_EXCHANGE, // ֤ȯ
+		MARKET, // 市场
+		BANK, // 银行
+		STOCK_EXCHANGE, // 证券交易所
 
-		WORKSHOP, // 
-		FACTORY, // 
-		POWER_PLANT, // 糧
-		RHUR_VALLEY, // ³ҵ(⽨-¹ ԭۣﵱ)
+		WORKSHOP, // 工坊
+		FACTORY, // 工厂
+		POWER_PLANT, // 发电厂
+		RHUR_VALLEY, // 鲁尔工业区(特殊建筑-德国， 原版是奇观，这里当作建筑处理)
 
-		AMPHITHEATER, // ¶糡
-		MUSEUM, // 
-		BROADCAST_CENTER, // 㲥
+		AMPHITHEATER, // 露天剧场
+		MUSEUM, // 博物馆
+		BROADCAST_CENTER, // 广播中心
 
-		LIGHTHOUSE, // 
-		DOCKYARD, // 촬
-		DOCKS, // ͷ
+		LIGHTHOUSE, // 灯塔
+		DOCKYARD, // 造船厂
+		DOCKS, // 码头
 
-		// ѺĵĿΪ
-		LAUNCH_SATELLITE, // 
+		// 这里把航天中心的项目视为建筑
+		LAUNCH_SATELLITE, // 发射卫星
 
 		TO_BE_DEFINED
 	};
 
+	// 建筑类型定义：同类建筑共享一份，实例只保存指向它的指针与自身的可变状态
+	struct Definition {
+		BuildingType type;					// 类型ID（与下标一致）
+		const char* name;					// 显示/存档用名称，与生产项目名称一致
+		District::BuildingCategory category;	// 区域中使用的建筑分类
+		const char* districtName;			// 所属区域名称
+		int cost;							// 生产力成本
+		int purchaseCost;					// 黄金购买成本
+		bool canPurchase;					// 是否可以用黄金购买
+		int maintenanceCost;				// 建筑维护费用
+		int prereqTechID;					// 前置科技
+		int prereqCivicID;					// 前置市政
+		bool isUnique;						// 是否为唯一建筑
+		Yield yield;						// 建筑产出
+		Yield citizenBenefit;				// 建筑市民加成
+	};
+
+	// 按类型ID取定义（TO_BE_DEFINED 对应一份空定义）
+	static const Definition& definition(BuildingType type);
+	// 按名称取定义，未注册时返回 TO_BE_DEFINED 的空定义
+	static const Definition& findDefinition(const std::string& name);
+
 	Building(int player, BuildingType type);
-	Building(int player, std::string name);
+	Building(int player, const std::string& name);
 	~Building() {}
+	inline const Definition& getDefinition() const { return *_def; }
 	inline int			getPlayerID() const { return playerID; }
-	inline std::string	getDistrictName() const { return districtName; }
-	inline int			getMaintenanceCost() const { return maintenanceCost; }
-	inline Yield		getCitizenBenefit() const { return citizenBenefit; }
-	inline int			getPrereqTechID() const { return prereqTechID; }
-	inline int			getPrereqCivicID() const { return prereqCivicID; }
-	inline bool			getIsUnique() const { return isUnique; }
-	District::BuildingCategory getType() const;
-	inline Yield		getYield() const { return yield; }
+	inline std::string	getDistrictName() const { return _def->districtName; }
+	inline int			getMaintenanceCost() const { return _def->maintenanceCost; }
+	inline Yield		getCitizenBenefit() const { return _def->citizenBenefit; }
+	inline int			getPrereqTechID() const { return _def->prereqTechID; }
+	inline int			getPrereqCivicID() const { return _def->prereqCivicID; }
+	inline bool			getIsUnique() const { return _def->isUnique; }
+	inline District::BuildingCategory getType() const { return _def->category; }
+	inline Yield		getYield() const { return _def->yield; }
 
-	virtual bool canErectBuilding(); // Ƿܽý
+	virtual bool canErectBuilding(); // 检查是否能建造该建筑
 
 private:
-	int			playerID;			// ӵиýID
-	std::string districtName;		// 
-	int			maintenanceCost;	// ά
-	Yield		citizenBenefit;		// ӳ
-	int			prereqTechID;		// ǰÿƼ
-	int			prereqCivicID;		// ǰ
-	bool		isUnique;			// ǷΪΨһ
-	bool		hasCitizenBenefit;	// Ƿӳ
-
-	BuildingType _type;
-	Yield yield; // 
+	const Definition* _def;	// 共享的类型定义
+	int			playerID;	// 拥有该建筑的玩家ID
 };
 
 #endif // __BUILDING_H__
\ No newline at end of file
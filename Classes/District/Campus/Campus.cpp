@@ -11,18 +11,17 @@ int Campus::campusCount = 0;
 Campus::Campus(int player, Hex pos, std::string name): 
 	District(player, pos, DistrictType(District::DistrictType::CAMPUS), name)
 {
-	cost = 54; // У԰ɱ
+	cost = 54; // 校园区建造成本
 	progress = 0;
-	turnsRemaining = cost; // Ĭϳʼʣغɱ
-	prereqTechID = 4; // ǰÿƼ: д(Tech ID 4)
+	turnsRemaining = cost; // 默认初始剩余回合数等于生产力成本
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::LIBRARY, 
 		BuildingCategory::UNIVERSITY, 
 		BuildingCategory::LABORATORY
 	});
-	baseMaintenanceCost = 1; // ά
+	baseMaintenanceCost = 1; // 基础维护费用
 	updateMaintenanceCost();
-	baseBenefit.scienceYield = 2; // : +2Ƽ
+	baseBenefit.scienceYield = 2; // 基础产出: +2科技
 	updateCitizenBenefit();
 	updateGrossYield();
 	
@@ -31,7 +30,7 @@ Campus::Campus(int player, Hex pos, std::string name):
 		campusCount++;
 	}
 
-	// ѧԺ (ɫ)
+	// 绘制学院 (绿色六边形)
 	auto draw = DrawNode::create();
 	Vec2 vertices[6] = {
 		Vec2(0, 20),
@@ -42,57 +41,41 @@ Campus::Campus(int player, Hex pos, std::string name):
 		Vec2(-17.32f, 10)
 	};
 	draw->drawSolidPoly(vertices, 6, Color4F::GREEN);
-	// Ӹɫ
+	// 加个白色轮廓
 	draw->drawPoly(vertices, 6, false, Color4F::WHITE);
 	_campusVisual = draw;
 }
 
 void Campus::calculateBonus()
 {
-	// δ,޼ӳɲ
+	// 如果未建造完成,则无加成产出
 	if (status != ProductionStatus::COMPLETED)
 	{
 		adjacencyBonus = { 0,0,0,0,0 };
 		return;
 	}
 
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-	// У԰ļӳɲ߼
-	// 磺ÿڵɽؿ1Ƽ
-	auto gameScene = static_cast<GameScene*>(Director::getInstance()->getRunningScene());
-	if (!gameScene) return;
-	std::vector<Hex> neighbors = getHexNeighbors(_pos);
+	adjacencyBonus = { 0, 0, 0, 0, 0 }; // 重置加成产出
+	// 校园区的加成产出计算逻辑
+	// 例如：每个相邻的山脉地块增加1点科技产出
 	int mountainCount = 0;
 	int jungleCount = 0;
-	for (const auto& neighbor : neighbors)
+	for (int dir = 0; dir < 6; dir++)
 	{
-		TileData tileData = gameScene->getTileData(neighbor);
-		if (tileData.type == TerrainType::MOUNTAIN)
+		const TileData* tileData = findTileData(_pos.getNeighbor(dir));
+		if (!tileData)
+			continue;
+		if (tileData->type == TerrainType::MOUNTAIN)
 		{
 			mountainCount++;
 		}
-		else if (tileData.type == TerrainType::JUNGLE)
+		else if (tileData->type == TerrainType::JUNGLE)
 		{
 			jungleCount++;
 		}
 	}
-	adjacencyBonus.scienceYield += mountainCount * 1; // ÿɽ+1Ƽ
-	adjacencyBonus.scienceYield += jungleCount / 2; // ÿ+1Ƽ
-	// ÿ+1Ƽ
-	int districtCount = 0;
-	for (const auto& neighbor : neighbors)
-	{
-		if (District::isThereDistrictAt(neighbor))
-		{
-			districtCount++;
-		}
-	}
-	adjacencyBonus.scienceYield += (districtCount / 2); // ÿ+1Ƽ
-
-
-	// 㽨ӳ
-	for (auto building : buildings)
-	{
-		buildingBonus += building->getYield();
-	}
+	adjacencyBonus.scienceYield += mountainCount * 1; // 每个山脉+1科技
+	adjacencyBonus.scienceYield += jungleCount / 2; // 每两个雨林+1科技
+	// 每两个相邻区域+1点科技
+	adjacencyBonus.scienceYield += (countAdjacentDistricts() / 2); // 每两个相邻区域+1科技
 }
\ No newline at end of file
@@ -8,12 +8,12 @@ public:
 	Campus(int player, Hex pos, std::string name);
 	virtual void calculateBonus();
 	enum class BuildingType {
-		LIBRARY, // ͼ
-		UNIVERSITY, // ѧ
-		RESEARCH_LAB // оʵ
+		LIBRARY, // 图书馆
+		UNIVERSITY, // 大学
+		RESEARCH_LAB // 研究实验室
 	};
 	cocos2d::Node* _campusVisual;
 private:
-	static int campusCount; // У԰
+	static int campusCount; // 校园区计数器
 };
 #endif
\ No newline at end of file
@@ -7,15 +7,14 @@ int CommercialHub::commercialHubCount = 0;
 CommercialHub::CommercialHub(int player, Hex pos, std::string name)
 	: District(player, pos, DistrictType(District::DistrictType::COMMERCIAL_HUB), name)
 {
-	cost = 54; // ҵĽɱ
-	turnsRemaining = cost; // Ĭϳʼʣغɱ
-	prereqTechID = 6; // ǰÿƼ: (Tech ID 6)
+	cost = 54; // 商业中心建造成本
+	turnsRemaining = cost; // 默认初始剩余回合数等于生产力成本
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::MARKET,
 		BuildingCategory::BANK,
 		BuildingCategory::STOCK_EXCHANGE
 		});
-	baseBenefit.goldYield = 4;    // : +4
+	baseBenefit.goldYield = 4;    // 基础产出: +4金币
 	updateCitizenBenefit();
 	updateGrossYield();
 	if (canErectDistrict(pos))
@@ -23,7 +22,7 @@ CommercialHub::CommercialHub(int player, Hex pos, std::string name)
 		commercialHubCount++;
 	}
 
-	// ҵ (ɫ)
+	// 绘制商业中心 (黄色六边形)
 	auto draw = DrawNode::create();
 	Vec2 vertices[6] = {
 		Vec2(0, 20),
@@ -34,24 +33,23 @@ CommercialHub::CommercialHub(int player, Hex pos, std::string name)
 		Vec2(-17.32f, 10)
 	};
 	draw->drawSolidPoly(vertices, 6, Color4F::YELLOW);
-	// Ӹɫ
+	// 加个白色轮廓
 	draw->drawPoly(vertices, 6, false, Color4F::WHITE);
 	_commercialHubVisual = draw;
 }
 
 void CommercialHub::calculateBonus()
 {
-	// δ,޼ӳɲ
+	// 如果未建造完成,则无加成产出
 	if (status != ProductionStatus::COMPLETED)
 	{
 		adjacencyBonus = { 0,0,0,0,0 };
 		return;
 	}
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-	// ҵĵļӳɲ߼
-	// 磺ÿڵĺؿ1Ҳ
-	std::vector<Hex> neighbors = getHexNeighbors(_pos);
-	//// ݲǺӳ
+	adjacencyBonus = { 0, 0, 0, 0, 0 }; // 重置加成产出
+	// 商业中心的加成产出计算逻辑
+	// 例如：每个相邻的河流地块增加1点金币产出
+	//// 暂不考虑河流加成
 	//s*int riverCount = 0;
 	//for (const auto& neighbor : neighbors)
 	//{
@@ -61,22 +59,9 @@ void CommercialHub::calculateBonus()
 	//		riverCount++;
 	//	}
 	//}
-	//adjacencyBonus.goldYield += riverCount * 1;*/ // ÿ+1
-	// ÿ+1
-	// ÿڸۿ+2
-	int districtCount = 0;
-	for (const auto& neighbor : neighbors)
-	{
-		// ڵÿ+1
-		if (District::isThereDistrictAt(neighbor))
-		{
-			districtCount++;
-		}
-	}
-	adjacencyBonus.goldYield += (districtCount / 2) * 1;
-	// 㽨ӳ
-	for (auto building : buildings)
-	{
-		buildingBonus += building->getYield();
-	}
+	//adjacencyBonus.goldYield += riverCount * 1;*/ // 每个河流+1金币
+	// 每两个相邻区域+1点金币
+	// 每个相邻港口+2点金币
+	// 相邻的每两个区域+1点金币
+	adjacencyBonus.goldYield += (countAdjacentDistricts() / 2) * 1;
 }
\ No newline at end of file
@@ -8,7 +8,7 @@ class CommercialHub : public District {
 public:
 	CommercialHub(int player, Hex pos, std::string name);
 	virtual void calculateBonus();
-	static int commercialHubCount; // ҵļ
+	static int commercialHubCount; // 商业中心计数器
 	cocos2d::Node* _commercialHubVisual;
 };
 
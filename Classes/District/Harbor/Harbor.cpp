@@ -5,25 +5,23 @@ int Harbor::harborCount = 0;
 Harbor::Harbor(int player, Hex pos, std::string name)
 	: District(player, pos, DistrictType(District::DistrictType::HARBOR), name)
 {
-	cost = 54; // ۿڽɱ
+	cost = 54; // 港口建造成本
 	progress = 0;
-	turnsRemaining = cost; // Ĭϳʼʣغɱ
-	prereqTechID = 5; // ǰÿƼ: (Tech ID 5)
+	turnsRemaining = cost; // 默认初始剩余回合数等于生产力成本
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::LIGHTHOUSE,
 		BuildingCategory::DOCKYARD,
 		BuildingCategory::DOCKS,
 		});
-	prereqTerrains = { TerrainType::COAST, TerrainType::OCEAN }; // ۿֻܽں
-	baseBenefit.foodYield = 1;    // : +1ʳ
-	baseBenefit.goldYield = 2;    // : +2
+	baseBenefit.foodYield = 1;    // 基础产出: +1粮食
+	baseBenefit.goldYield = 2;    // 基础产出: +2金币
 	updateCitizenBenefit();
 	updateGrossYield();
 	if (canErectDistrict(pos))
 	{
 		harborCount++;
 	}
-	// Ƹۿ (ɫ)
+	// 绘制港口 (蓝色六边形)
 	auto draw = DrawNode::create();
 	Vec2 vertices[6] = {
 		Vec2(0, 20),
@@ -34,36 +32,20 @@ Harbor::Harbor(int player, Hex pos, std::string name)
 		Vec2(-17.32f, 10)
 	};
 	draw->drawSolidPoly(vertices, 6, Color4F::BLUE);
-	// Ӹɫ
+	// 加个白色轮廓
 	draw->drawPoly(vertices, 6, false, Color4F::WHITE);
 	_harborVisual = draw;
 }
 
 void Harbor::calculateBonus()
 {
-	// δ,޼ӳɲ
+	// 如果未建造完成,则无加成产出
 	if (status != ProductionStatus::COMPLETED)
 	{
 		adjacencyBonus = { 0,0,0,0,0 };
 		return;
 	}
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-	// ۿڵļӳɲ߼
-	std::vector<Hex> neighbors = getHexNeighbors(_pos);
-	int districtCount = 0;
-	for (const auto& neighbor : neighbors)
-	{
-		// ڵÿ+1
-		if (District::isThereDistrictAt(neighbor))
-		{
-			districtCount++;
-		}
-	}
-	adjacencyBonus.goldYield += (districtCount / 2); // ÿ+1
-
-	// 㽨ӳ
-	for (const auto& building : buildings)
-	{
-		buildingBonus += building->getYield();
-	}
+	adjacencyBonus = { 0, 0, 0, 0, 0 }; // 重置加成产出
+	// 港口的加成产出计算逻辑
+	adjacencyBonus.goldYield += (countAdjacentDistricts() / 2); // 每两个相邻区域+1金币
 }
\ No newline at end of file
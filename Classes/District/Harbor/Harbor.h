@@ -10,7 +10,7 @@ public:
 	virtual void calculateBonus();
 	cocos2d::Node* _harborVisual;
 private:
-	static int harborCount; // ۿڼ
+	static int harborCount; // 港口计数器
 };
 
 #endif // __HARBOR_H__
\ No newline at end of file
@@ -7,7 +7,7 @@ public:
 	virtual void calculateBonus();
 	cocos2d::Node* _industryZoneVisual;
 private:
-	static int industryZoneCount; // ҵ
+	static int industryZoneCount; // 工业区计数器
 };
 
 #endif // __INDUSTRY_ZONE_H__
\ No newline at end of file
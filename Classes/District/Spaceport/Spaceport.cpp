@@ -7,10 +7,9 @@ int Spaceport::spaceportCount = 0;
 Spaceport::Spaceport(int player, Hex pos, std::string name)
 	: District(player, pos, DistrictType(District::DistrictType::SPACEPORT), name)
 {
-	cost = 1800; // Ľɱ
+	cost = 1800; // 航天中心建造成本
 	progress = 0;
-	turnsRemaining = cost; // Ĭϳʼʣغɱ
-	prereqTechID = 21; // ǰÿƼ: ѧ(Tech ID 21)
+	turnsRemaining = cost; // 默认初始剩余回合数等于生产力成本
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::LAUNCH_SATELLITE
 		});
@@ -19,7 +18,7 @@ Spaceport::Spaceport(int player, Hex pos, std::string name)
 	{
 		spaceportCount++;
 	}
-	// ƺ (ɫ)
+	// 绘制航天中心 (白色六边形)
 	auto draw = DrawNode::create();
 	Vec2 vertices[6] = {
 		Vec2(0, 20),
@@ -30,13 +29,13 @@ Spaceport::Spaceport(int player, Hex pos, std::string name)
 		Vec2(-17.32f, 10)
 	};
 	draw->drawSolidPoly(vertices, 6, Color4F::WHITE);
-	// Ӹɫ
+	// 加个黑色轮廓
 	draw->drawPoly(vertices, 6, false, Color4F::BLACK);
 	_spaceportVisual = draw;
 }
 
 void Spaceport::calculateBonus()
 {
-	// ûмӳɲ
+	// 航天中心没有加成产出
 	adjacencyBonus = { 0, 0, 0, 0, 0 };
 }
\ No newline at end of file
@@ -7,6 +7,6 @@ public:
 	virtual void calculateBonus();
 	cocos2d::Node* _spaceportVisual;
 private:
-	static int spaceportCount; // ļ
+	static int spaceportCount; // 航天中心计数器
 };
 #endif // __SPACEPORT_H__
\ No newline at end of file
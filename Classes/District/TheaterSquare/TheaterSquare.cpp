@@ -7,24 +7,23 @@ int TheaterSquare::theaterSquareCount = 0;
 TheaterSquare::TheaterSquare(int player, Hex pos, std::string name)
 	: District(player, pos, DistrictType(District::DistrictType::THEATER_SQUARE), name)
 {
-	cost = 54; // Ժ㳡ɱ
-	turnsRemaining = cost; // Ĭϳʼʣغɱ
-	prereqCivicID = 102; // ǰ: (Tech ID 102)
+	cost = 54; // 剧院广场建造成本
+	turnsRemaining = cost; // 默认初始剩余回合数等于生产力成本
 	possibleBuildings = std::vector<BuildingCategory>({
 		BuildingCategory::AMPHITHEATER,
 		BuildingCategory::MUSEUM,
 		BuildingCategory::BROADCAST_CENTER
 		});
-	baseMaintenanceCost = 1; // ά
+	baseMaintenanceCost = 1; // 基础维护费用
 	updateMaintenanceCost();
-	baseBenefit.cultureYield = 2; // : +2Ļ
+	baseBenefit.cultureYield = 2; // 区域公民收益: +2文化
 	updateCitizenBenefit();
 	updateGrossYield();
 	if (canErectDistrict(pos))
 	{
 		theaterSquareCount++;
 	}
-	// ƾԺ㳡 (ɫ)
+	// 绘制剧院广场 (紫色六边形)
 	auto draw = DrawNode::create();
 	Vec2 vertices[6] = {
 		Vec2(0, 20),
@@ -35,29 +34,22 @@ TheaterSquare::TheaterSquare(int player, Hex pos, std::string name)
 		Vec2(-17.32f, 10)
 	};
 	draw->drawSolidPoly(vertices, 6, Color4F::MAGENTA);
-	// Ӹɫ
+	// 加个白色轮廓
 	draw->drawPoly(vertices, 6, false, Color4F::WHITE);
 	_theaterSquareVisual = draw;
 }
 
 void TheaterSquare::calculateBonus()
 {
-	// δ,޼ӳɲ
+	// 如果未建造完成,则无加成产出
 	if (status != ProductionStatus::COMPLETED)
 	{
 		adjacencyBonus = { 0,0,0,0,0 };
 		return;
 	}
-	adjacencyBonus = { 0, 0, 0, 0, 0 }; // üӳɲ
-	// Ժ㳡ļӳɲ߼
-	// 磺ÿڵ2Ļ
-	std::vector<Hex> neighbors = getHexNeighbors(_pos);
-	for (const auto& neighbor : neighbors)
-	{
-		// ڵÿ+2Ļ
-		if (District::isThereDistrictAt(neighbor))
-		{
-			adjacencyBonus.cultureYield += 2;
-		}
-	}
+	adjacencyBonus = { 0, 0, 0, 0, 0 }; // 重置加成产出
+	// 剧院广场的加成产出计算逻辑
+	// 例如：每个相邻的区域增加2点文化产出
+	// 相邻的每个区域+2点文化产出
+	adjacencyBonus.cultureYield += countAdjacentDistricts() * 2;
 }
@@ -9,7 +9,7 @@ public:
 	virtual void calculateBonus();
 	cocos2d::Node* _theaterSquareVisual;
 private:
-	static int theaterSquareCount; // Ժ㳡
+	static int theaterSquareCount; // 剧院广场计数器
 };
 
 #endif // __THEATER_SQUARE_H__
\ No newline at end of file
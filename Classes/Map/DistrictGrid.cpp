@@ -0,0 +1,42 @@
+#include "DistrictGrid.h"
+
+void DistrictGrid::place(District* district) {
+    DistrictCell cell;
+    cell.district = district;
+    cell.owner = district->getPlayerID();
+    cell.type = district->getType();
+    _cells[district->getPos()] = cell;
+}
+
+bool DistrictGrid::remove(const District* district) {
+    auto it = _cells.find(district->getPos());
+    if (it == _cells.end() || it->second.district != district)
+        return false;
+    _cells.erase(it);
+    return true;
+}
+
+void DistrictGrid::setOwner(Hex tile, int owner) {
+    auto it = _cells.find(tile);
+    if (it != _cells.end())
+        it->second.owner = owner;
+}
+
+const DistrictCell* DistrictGrid::find(Hex tile) const {
+    auto it = _cells.find(tile);
+    return it == _cells.end() ? nullptr : &it->second;
+}
+
+District* DistrictGrid::getDistrictAt(Hex tile) const {
+    const DistrictCell* cell = find(tile);
+    return cell ? cell->district : nullptr;
+}
+
+int DistrictGrid::countAdjacent(Hex tile) const {
+    int count = 0;
+    for (int dir = 0; dir < 6; dir++) {
+        if (_cells.count(tile.getNeighbor(dir)))
+            count++;
+    }
+    return count;
+}
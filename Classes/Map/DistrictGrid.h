@@ -0,0 +1,66 @@
+#ifndef __DISTRICT_GRID_H__
+#define __DISTRICT_GRID_H__
+
+#include "Utils/HexUtils.h"
+#include "District/Base/District.h"
+#include <unordered_map>
+
+/**
+ * @brief 地块上已建成区域的记录
+ */
+struct DistrictCell {
+    District* district;             // 区域对象
+    int owner;                      // 当前控制该区域的玩家ID
+    District::DistrictType type;    // 区域类型
+};
+
+/**
+ * @class DistrictGrid
+ * @brief 世界级的区域占用表（地块 -> 已建成区域）
+ *
+ * 由 GameManager 持有，区域建成时登记、被摧毁时注销，城市易主时更新控制者。
+ * 放置合法性检查、相邻加成计算与“地块上是否有区域”的查询都是常数时间。
+ * 未建成的区域（生产面板中的候选项目、原型）不会登记。
+ */
+class DistrictGrid {
+public:
+    /**
+     * @brief 登记已建成的区域（同一地块上的旧记录会被覆盖）
+     */
+    void place(District* district);
+
+    /**
+     * @brief 注销区域，只有记录仍指向该区域时才删除
+     * @return 是否删除了记录
+     */
+    bool remove(const District* district);
+
+    /**
+     * @brief 城市易主时更新区域控制者
+     */
+    void setOwner(Hex tile, int owner);
+
+    bool isOccupied(Hex tile) const { return _cells.count(tile) != 0; }
+
+    /**
+     * @brief 查询地块上的区域记录，没有区域时返回空
+     */
+    const DistrictCell* find(Hex tile) const;
+
+    /**
+     * @brief 查询地块上的区域对象，没有区域时返回空
+     */
+    District* getDistrictAt(Hex tile) const;
+
+    /**
+     * @brief 地块相邻的已建成区域数
+     */
+    int countAdjacent(Hex tile) const;
+
+    void clear() { _cells.clear(); }
+
+private:
+    std::unordered_map<Hex, DistrictCell> _cells;
+};
+
+#endif // __DISTRICT_GRID_H__
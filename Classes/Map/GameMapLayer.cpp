@@ -1,8 +1,11 @@
 #include "GameMapLayer.h"
 #include "MapGenerator.h"
 #include "../Units/Melee/Warrior.h"
+#include "../Units/Base/UnitStateTable.h"
 #include "../Utils/PathFinder.h"
+#include "../Utils/GameLog.h"
 #include "../Core/GameManager.h"
+#include "../UI/FloatingTextPool.h"
 #include "cocos2d.h"
 #define RADIUS 50.0f
 USING_NS_CC;
@@ -11,16 +14,16 @@ bool GameMapLayer::init() {
     if (!Layer::init()) return false;
 
     _isDragging = false;
-    _layout = new HexLayout(RADIUS); // ⶥβ
+    _layout = new HexLayout(RADIUS); // 尖顶六边形布局
     _isSelectingTile = false;
     _highlightNode = nullptr;
     _onSelectionCancelled = nullptr;
 
-    // 1. ʼ˫
+    // 1. 初始化双击变量
     _lastClickHex = Hex(-999, -999);
     _lastClickTime = std::chrono::steady_clock::now();
 
-    // 2. ע Touch  (ק +  + ˫)
+    // 2. 注册 Touch 监听器 (拖拽 + 单击 + 双击)
     auto touchListener = EventListenerTouchOneByOne::create();
     touchListener->setSwallowTouches(true);
     touchListener->onTouchBegan = CC_CALLBACK_2(GameMapLayer::onTouchBegan, this);
@@ -39,38 +42,38 @@ bool GameMapLayer::init() {
     _selectedUnit = nullptr;
     _myUnit = nullptr;
 
-    generateMap(); // ͼС 120 x 50
+    generateMap(); // 地图大小是 120 x 50
 
     // ============================================================
-    // ޸ĵ㡿óڵͼ
+    // 【修改点】：设置出生地在地图中心
     // ============================================================
-    //  generateMap Ŀ12050
-    // Ĵ q=60, r=10  (ȡھĵͼ㷨)
-    // ȡһŵмֵ
+    // 假设 generateMap 里的宽是120，高是50
+    // 轴向坐标的中心大概在 q=60, r=10 左右 (取决于具体的地图生成算法)
+    // 这里我们取一个大概的中间值
     Hex startHex(55, 15);
 
-    // Ѱ½ (ֹں)
-    // ǰǺ (Cost < 0)Ѱ
+    // 寻找最近的陆地 (防止生在海里)
+    // 如果当前点是海 (Cost < 0)，就向右寻找
     int safeGuard = 0;
     while (getTerrainCost(startHex) < 0 && safeGuard < 500) {
-        startHex.q++; // ƶ
+        startHex.q++; // 向右移动
 
-        // һ˻ûҵһм
+        // 如果一行找完了还没找到，换一行继续找
         if (safeGuard % 20 == 0) {
-            startHex.q -= 20; // 
-            startHex.r++;     // һ
+            startHex.q -= 20; // 回退
+            startHex.r++;     // 下一行
         }
         safeGuard++;
     }
     // ============================================================
 
     // ============================================================
-    // ޸ĵ㡿ͷ
+    // 【修改点】：镜头跟随出生点
     // ============================================================
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 unitPos = _layout->hexToPixel(startHex);
 
-    //  Layer ƫʹλĻ
+    // 计算 Layer 的偏移量，使单位处于屏幕中心
     // LayerPos + UnitPos = ScreenCenter
     // LayerPos = ScreenCenter - UnitPos
     Vec2 centerOffset = Vec2(visibleSize.width / 2, visibleSize.height / 2) - unitPos;
@@ -82,12 +85,12 @@ bool GameMapLayer::init() {
     return true;
 }
 
-// 滻ԭе initGameManagerAndPlayers 
+// 替换原有的 initGameManagerAndPlayers 函数
 void GameMapLayer::initGameManagerAndPlayers() {
     auto gameManager = GameManager::getInstance();
     if (!gameManager) return;
 
-    // 1. ʼϷúĬңûеĻ
+    // 1. 初始化游戏配置和默认玩家（如果没有的话）
     if (gameManager->getAllPlayers().empty()) {
         GameConfig config;
         config.maxTurns = 500;
@@ -95,11 +98,11 @@ void GameMapLayer::initGameManagerAndPlayers() {
         config.enableDominationVictory = true;
         gameManager->initialize(config);
 
-        //  0 ()
+        // 创建玩家 0 (人类)
         auto player = Player::create(0, CivilizationType::BASIC);
         if (player) gameManager->addPlayer(player);
 
-        // Զ AI  ( 3  AI) ڲ
+        // 【新增】：自动创建几个 AI 玩家 (例如 3 个 AI) 用于测试
         for (int i = 1; i <= 3; i++) {
             auto aiPlayer = Player::create(i, CivilizationType::BASIC);
             gameManager->addPlayer(aiPlayer);
@@ -110,25 +113,25 @@ void GameMapLayer::initGameManagerAndPlayers() {
     gameManager->setCurrentPlayer(0);
 
     // ===========================================================================
-    // ׼¼ռõĳ㣬ֹײ
+    // 准备工作：记录已占用的出生点，防止撞车
     // ===========================================================================
-    // ʹ shared_ptr װ vectorȷ lambda ܳʺ޸ͬһб
+    // 使用 shared_ptr 包装 vector，确保在 lambda 中能持续访问和修改同一个列表
     auto occupiedSpawns = std::make_shared<std::vector<Hex>>();
 
-    //  lambdaεľ
+    // 辅助 lambda：计算两个六边形的距离
     auto getHexDistance = [](Hex a, Hex b) -> int {
         return (std::abs(a.q - b.q) + std::abs(a.q + a.r - b.q - b.r) + std::abs(a.r - b.r)) / 2;
         };
 
-    // жϣǷ㣨Χ2ɽˮ
+    // 核心判断：是否是完美出生点（周围2格无山无水）
     auto isPerfectSpawn = [this](Hex center) -> bool {
-        // 1. ĵ
+        // 1. 检查中心点
         TileData centerData = getTileData(center);
         if (centerData.type == TerrainType::OCEAN ||
             centerData.type == TerrainType::COAST ||
             centerData.type == TerrainType::MOUNTAIN) return false;
 
-        // 2. Χ 2 
+        // 2. 检查周围 2 格
         int radius = 2;
         for (int q = -radius; q <= radius; q++) {
             int r1 = std::max(-radius, -q - radius);
@@ -137,7 +140,7 @@ void GameMapLayer::initGameManagerAndPlayers() {
                 Hex neighbor = center + Hex(q, r);
                 TileData data = getTileData(neighbor);
 
-                // ϸܾɽˮ
+                // 严格拒绝山脉和水域
                 if (data.type == TerrainType::MOUNTAIN ||
                     data.type == TerrainType::OCEAN ||
                     data.type == TerrainType::COAST) {
@@ -149,27 +152,27 @@ void GameMapLayer::initGameManagerAndPlayers() {
         };
 
     // ===========================================================================
-    // ѡ߼ ( + AI ͨ)
+    // 出生点选择逻辑 (玩家 + AI 通用)
     // ===========================================================================
     auto getStartHexForPlayer = [this, occupiedSpawns, isPerfectSpawn, getHexDistance](int playerId) -> Hex {
         Hex finalHex(0, 0);
         bool found = false;
 
         // ---------------------------------------------------
-        //  A:  0 () -> ͼ
+        // 策略 A: 玩家 0 (人类) -> 优先螺旋搜索地图中心
         // ---------------------------------------------------
         if (playerId == 0) {
             CCLOG("Finding perfect start for Human Player 0...");
-            Hex center(55, 15); // ͼ
+            Hex center(55, 15); // 地图大致中心
             int maxRadius = 50;
 
-            // ĵ
+            // 检查中心点
             if (isPerfectSpawn(center)) {
                 finalHex = center;
                 found = true;
             }
             else {
-                // 
+                // 螺旋搜索
                 for (int radius = 1; radius <= maxRadius && !found; radius++) {
                     Hex current = center + Hex(-radius, 0);
                     std::vector<Hex> directions = {
@@ -191,48 +194,48 @@ void GameMapLayer::initGameManagerAndPlayers() {
             }
         }
         // ---------------------------------------------------
-        //  B: AI  -> Ҹ 8-12 ΧѰҳ
+        // 策略 B: AI 玩家 -> 在人类玩家附近 8-12 格范围内寻找出生点
         // ---------------------------------------------------
         else {
             CCLOG("Finding start for AI Player %d near human player...", playerId);
             
-            // ȡҵĳ㣨һռõ㣩
+            // 获取人类玩家的出生点（第一个占用点）
             Hex humanSpawn = occupiedSpawns->empty() ? Hex(55, 15) : (*occupiedSpawns)[0];
             
-            int minDistFromHuman = 8;   // С 8 
-            int maxDistFromHuman = 12;  //  12 
-            int minDistFromAI = 6;      // AI ֮ 6 
+            int minDistFromHuman = 8;   // 距离人类玩家最小 8 格
+            int maxDistFromHuman = 12;  // 距离人类玩家最大 12 格
+            int minDistFromAI = 6;      // AI 之间至少 6 格
             
             int maxAttempts = 500;
 
             for (int i = 0; i < maxAttempts; i++) {
-                // ΧĻѡ
-                // ѡһ (8-12)
+                // 在人类玩家周围的环形区域随机选点
+                // 随机选择一个距离 (8-12)
                 int targetDist = minDistFromHuman + (rand() % (maxDistFromHuman - minDistFromHuman + 1));
                 
-                // ѡһǶ (0-5 Ӧε6)
+                // 随机选择一个方向角度 (0-5 对应六边形的6个方向)
                 int startDir = rand() % 6;
                 
-                //  targetDist 
+                // 从人类出生点出发，按照随机方向走 targetDist 步
                 Hex candidate = humanSpawn;
                 for (int step = 0; step < targetDist; step++) {
-                    // ÿ΢ƫƷ
+                    // 每步稍微偏移方向，增加随机性
                     int dir = (startDir + (rand() % 3) - 1 + 6) % 6;
                     candidate = candidate.getNeighbor(dir);
                 }
                 
-                // 1. μ
+                // 1. 地形检查
                 if (!isPerfectSpawn(candidate)) continue;
                 
-                // 2. ֤ 8-12 Χ
+                // 2. 验证距离人类玩家在 8-12 范围内
                 int actualDistFromHuman = getHexDistance(candidate, humanSpawn);
                 if (actualDistFromHuman < minDistFromHuman || actualDistFromHuman > maxDistFromHuman) {
                     continue;
                 }
                 
-                // 3. Ƿ AI 㹻Զ 6 
+                // 3. 检查是否离其他 AI 出生点足够远（至少 6 格）
                 bool tooCloseToOtherAI = false;
-                for (size_t j = 1; j < occupiedSpawns->size(); j++) { //  1 ʼ
+                for (size_t j = 1; j < occupiedSpawns->size(); j++) { // 从 1 开始，跳过人类玩家
                     if (getHexDistance(candidate, (*occupiedSpawns)[j]) < minDistFromAI) {
                         tooCloseToOtherAI = true;
                         break;
@@ -240,7 +243,7 @@ void GameMapLayer::initGameManagerAndPlayers() {
                 }
                 if (tooCloseToOtherAI) continue;
                 
-                // ҵλ
+                // 找到合适位置
                 finalHex = candidate;
                 found = true;
                 CCLOG("AI Player %d found spawn at (%d, %d), distance from human: %d",
@@ -250,17 +253,17 @@ void GameMapLayer::initGameManagerAndPlayers() {
         }
 
         // ---------------------------------------------------
-        // ߼ʵҲ
+        // 兜底逻辑：如果实在找不到完美点
         // ---------------------------------------------------
         if (!found) {
             CCLOG("Warning: Perfect spawn not found for Player %d. Using fallback.", playerId);
             
             Hex humanSpawn = occupiedSpawns->empty() ? Hex(55, 15) : (*occupiedSpawns)[0];
             
-            // ԣſҪֻ½ؼ
+            // 降级策略：放宽地形要求，只需是陆地即可
             int safeGuard = 0;
             while (safeGuard < 200) {
-                // AI ң฽ 8-12 ½
+                // AI 玩家：在人类附近 8-12 格找陆地
                 if (playerId > 0) {
                     int targetDist = 8 + (rand() % 5);
                     int dir = rand() % 6;
@@ -285,7 +288,7 @@ void GameMapLayer::initGameManagerAndPlayers() {
                     }
                 }
                 else {
-                    // ұ
+                    // 人类玩家保底
                     int q = cocos2d::random(5, 115);
                     int r = cocos2d::random(5, 45);
                     Hex h(q, r);
@@ -298,13 +301,13 @@ void GameMapLayer::initGameManagerAndPlayers() {
                 safeGuard++;
             }
             
-            // 
+            // 绝望保底
             if (!found) {
                 if (playerId == 0) {
                     finalHex = Hex(55, 15);
                 }
                 else {
-                    // AI ฽̶λ
+                    // AI 在人类附近固定位置
                     int offset = 10;
                     int dir = playerId % 6;
                     finalHex = humanSpawn;
@@ -315,7 +318,7 @@ void GameMapLayer::initGameManagerAndPlayers() {
             }
         }
 
-        // ¼
+        // 记录并返回
         int distFromHuman = 0;
         if (!occupiedSpawns->empty()) {
             distFromHuman = getHexDistance(finalHex, (*occupiedSpawns)[0]);
@@ -356,6 +359,7 @@ void GameMapLayer::initGameManagerAndPlayers() {
 }
 
 void GameMapLayer::generateMap() {
+    PROFILE_SCOPE("GameMapLayer::generateMap");
     _mapData = MapGenerator::generate(120, 50);
 
     for (auto const& item : _mapData) {
@@ -364,7 +368,7 @@ void GameMapLayer::generateMap() {
         Vec2 pos = _layout->hexToPixel(hex);
         Color4F color;
 
-        // ʹµ Civ6 ɫ
+        // 使用新调配的 Civ6 风格配色
         switch (data.type) {
             case TerrainType::OCEAN:     color = Color4F(0.12f, 0.18f, 0.30f, 1.0f); break;
             case TerrainType::COAST:     color = Color4F(0.25f, 0.45f, 0.55f, 1.0f); break;
@@ -378,16 +382,16 @@ void GameMapLayer::generateMap() {
             default: color = Color4F::WHITE;
         }
 
-        // ӦøղᵽġƤֽ
+        // 应用刚才提到的“羊皮纸化”处理
         color = applyCivStyle(color);
 
-        //  (ּСΧɫ)
+        // 噪声处理 (保持极小范围，以免颜色变脏)
         float noise = (sin(hex.q * 0.4f) + cos(hex.r * 0.4f)) * 0.03f;
         color.r = clampf(color.r + noise, 0.0f, 1.0f);
         color.g = clampf(color.g + noise, 0.0f, 1.0f);
         color.b = clampf(color.b + noise, 0.0f, 1.0f);
 
-        // ...
+        // 绘制...
         drawHexOnNode(_tilesDrawNode, pos, _layout->size, color);
         drawTileDecorations(hex, pos, _layout->size, data);
         drawTileResources(hex, data);
@@ -402,46 +406,46 @@ void GameMapLayer::drawHexOnNode(DrawNode* node, Vec2 pos, float size, Color4F c
         vertices[i] = Vec2(pos.x + size * cos(rad), pos.y + size * sin(rad));
     }
 
-    // 1. ɫ (ĵɫ)
-    // ΢͸(0.8)õͼɫô
+    // 1. 底色填充 (核心地形色)
+    // 稍微降低透明度(如0.8)，可以让地图底色不那么死板
     node->drawPolygon(vertices, 6, color, 0, Color4F(0, 0, 0, 0));
 
-    // 2. ģ6ġؿߡ
-    // ʹüϸɫ͸ֻڱԵ
+    // 2. 模拟文明6的“地块网格线”
+    // 使用极细的深色半透明线条，只在边缘勾勒
     Color4F gridLineColor = Color4F(0, 0, 0, 0.15f);
     node->drawPoly(vertices, 6, true, gridLineColor);
 
-    // 3. ӡ߹߽硱6ڲͬν紦΢ߣ
+    // 3. 增加“高光边界”（文明6在不同地形交界处有轻微的亮边）
     Vec2 innerVertices[6];
-    float innerMargin = 2.0f; // 2
+    float innerMargin = 2.0f; // 缩进2像素
     for (int i = 0; i < 6; i++) {
         float rad = CC_DEGREES_TO_RADIANS(60 * i - 30);
         innerVertices[i] = Vec2(pos.x + (size - innerMargin) * cos(rad),
             pos.y + (size - innerMargin) * sin(rad));
     }
-    // һֻб߿Σɫȵɫģȸ
+    // 绘制一个只有边框的六边形，颜色比底色稍亮，模拟厚度感
     Color4F highlightColor = Color4F(1, 1, 1, 0.1f);
     node->drawPoly(innerVertices, 6, true, highlightColor);
 }
 
 Color4F GameMapLayer::applyCivStyle(Color4F c) {
-    // 1. ΢ͱͶȣмɫ£
+    // 1. 稍微降低饱和度（向中间灰色靠拢）
     float gray = (c.r + c.g + c.b) / 3.0f;
-    float sat = 0.8f; // Ͷϵ
+    float sat = 0.8f; // 饱和度系数
     c.r = gray + (c.r - gray) * sat;
     c.g = gray + (c.g - gray) * sat;
     c.b = gray + (c.b - gray) * sat;
 
-    // 2. ע뼫΢ůɫģֽţ
+    // 2. 注入极其微弱的暖黄色调（模拟旧纸张）
     c.r = std::min(1.0f, c.r + 0.02f);
     c.g = std::min(1.0f, c.g + 0.01f);
 
     return c;
 }
 
-// ƵƤԴԣʾ߲ĵؿ飩
+// 绘制地皮资源属性（仅显示高产出的地块）
 void GameMapLayer::drawTileResources(Hex hex, const TileData& data) {
-    // ֻʾܲ >= 3 ĵؿ飬 Label 
+    // 只显示总产出 >= 3 的地块，减少 Label 数量
     int totalOutput = data.food + data.production + data.gold + data.science + data.culture;
     if (totalOutput < 3) {
         return;
@@ -449,31 +453,31 @@ void GameMapLayer::drawTileResources(Hex hex, const TileData& data) {
 
     Vec2 centerPos = _layout->hexToPixel(hex);
     
-    // Դıʹִ棩
+    // 创建资源文本（使用中文字代替）
     std::string resourceStr = "";
     
-    // =ʳ, =, =, =Ƽ, =Ļ
+    // 粮=粮食, 产=生产力, 金=金币, 科=科技, 文=文化
     if (data.food > 0) {
-        resourceStr += u8"" + std::to_string(data.food);
+        resourceStr += u8"粮" + std::to_string(data.food);
     }
     if (data.production > 0) {
         if (!resourceStr.empty()) resourceStr += " ";
-        resourceStr += u8"" + std::to_string(data.production);
+        resourceStr += u8"产" + std::to_string(data.production);
     }
     if (data.gold > 0) {
         if (!resourceStr.empty()) resourceStr += " ";
-        resourceStr += u8"" + std::to_string(data.gold);
+        resourceStr += u8"金" + std::to_string(data.gold);
     }
     if (data.science > 0) {
         if (!resourceStr.empty()) resourceStr += " ";
-        resourceStr += u8"" + std::to_string(data.science);
+        resourceStr += u8"科" + std::to_string(data.science);
     }
     if (data.culture > 0) {
         if (!resourceStr.empty()) resourceStr += " ";
-        resourceStr += u8"" + std::to_string(data.culture);
+        resourceStr += u8"文" + std::to_string(data.culture);
     }
 
-    //  LabelUTF-8 룩- ʹøСֺźͻ
+    // 创建 Label（UTF-8 编码）- 使用更小的字号和缓存
     auto label = Label::createWithSystemFont(resourceStr, "Arial", 9);
     label->setPosition(centerPos);
     label->setColor(Color3B::WHITE);
@@ -481,32 +485,32 @@ void GameMapLayer::drawTileResources(Hex hex, const TileData& data) {
 }
 
 void GameMapLayer::drawMountain(Vec2 center, float size) {
-    // һȫ͸ɫٴд
+    // 定义一个完全透明的颜色变量，避免再次写错
     const Color4F shadowColor = Color4F(0, 0, 0, 0);
 
-    // صɽ壨һһСӲθ
+    // 绘制两座重叠的山峰（一大一小），增加层次感
     struct MountainPeak { Vec2 offset; float scale; };
     MountainPeak peaks[] = { {Vec2(0, 5), 1.0f}, {Vec2(size * 0.4f, -size * 0.2f), 0.6f} };
 
     for (auto& p : peaks) {
-        float h = size * 0.8f * p.scale; // ɽ߶
-        float w = size * 0.6f * p.scale; // ɽ
+        float h = size * 0.8f * p.scale; // 山高度
+        float w = size * 0.6f * p.scale; // 山宽度
 
         Vec2 peak = center + p.offset + Vec2(0, h);
         Vec2 leftBase = center + p.offset + Vec2(-w, -size * 0.2f);
         Vec2 rightBase = center + p.offset + Vec2(w, -size * 0.2f);
-        Vec2 midBase = center + p.offset + Vec2(0, -size * 0.1f); // е
+        Vec2 midBase = center + p.offset + Vec2(0, -size * 0.1f); // 脊线中点
 
-        // 1. ܹ (ǳ)
+        // 1. 左侧受光面 (浅灰棕)
         Vec2 leftSide[] = { peak, midBase, leftBase };
         _tilesDrawNode->drawPolygon(leftSide, 3, Color4F(0.6f, 0.5f, 0.45f, 1), 0, shadowColor);
 
-        // 2. Ҳ౳ ()
+        // 2. 右侧背阴面 (深棕)
         Vec2 rightSide[] = { peak, rightBase, midBase };
         _tilesDrawNode->drawPolygon(rightSide, 3, Color4F(0.45f, 0.35f, 0.3f, 1), 0, shadowColor);
 
-        // 3. ѩ (ߺε)
-        // ȡɽ 30% λ
+        // 3. 雪顶 (高海拔的灵魂)
+        // 取山尖往下 30% 的位置
         Vec2 snowLeft = peak + (leftBase - peak) * 0.3f;
         Vec2 snowRight = peak + (rightBase - peak) * 0.3f;
         Vec2 snowMid = peak + (midBase - peak) * 0.35f;
@@ -515,13 +519,13 @@ void GameMapLayer::drawMountain(Vec2 center, float size) {
     }
 }
 void GameMapLayer::drawSmoothWave(Vec2 startPos, float length, float height) {
-    const int segments = 8; // ԽԽԲ
-    Color4F waveColor = Color4F(1.0f, 1.0f, 1.0f, 0.18f); // İɫ
+    const int segments = 8; // 段数越多越圆滑
+    Color4F waveColor = Color4F(1.0f, 1.0f, 1.0f, 0.18f); // 淡淡的白色
 
     Vec2 prevPoint = startPos;
     for (int i = 1; i <= segments; i++) {
         float t = (float)i / segments;
-        // ʹҺģԲĻȣy = sin(PI * t) * height
+        // 使用正弦函数模拟圆润的弧度：y = sin(PI * t) * height
         float x = startPos.x + t * length;
         float y = startPos.y + sinf(M_PI * t) * height;
         Vec2 currentPoint = Vec2(x, y);
@@ -531,27 +535,27 @@ void GameMapLayer::drawSmoothWave(Vec2 startPos, float length, float height) {
     }
 }
 void GameMapLayer::drawTileDecorations(Hex hex, Vec2 pos, float size, const TileData& data) {
-    // 1. ɹ̶
+    // 1. 基于坐标生成固定随机种子
     unsigned int seed = std::hash<int>{}(hex.q) ^ std::hash<int>{}(hex.r);
     auto getRand = [&seed]() {
         seed = seed * 1103515245 + 12345;
         return (float)((seed / 65536) % 32768) / 32768.0f;
         };
 
-    // 2. ɽ (ȣΪɽ)
+    // 2. 绘制山脉 (最优先，因为山体大)
     if (data.type == TerrainType::MOUNTAIN) {
         drawMountain(pos, size);
     }
-    // 3. ɭ/
+    // 3. 绘制森林/丛林
     else if (data.type == TerrainType::JUNGLE || data.type == TerrainType::JUNGLE) {
         for (int i = 0; i < 5; i++) {
             Vec2 tPos = pos + Vec2((getRand() - 0.5f) * size * 0.6f, (getRand() - 0.5f) * size * 0.6f);
             float r = size * 0.18f;
-            _tilesDrawNode->drawDot(tPos, r, Color4F(0.15f, 0.35f, 0.15f, 1.0f)); // 
-            _tilesDrawNode->drawDot(tPos + Vec2(-r * 0.3f, r * 0.3f), r * 0.2f, Color4F(1, 1, 1, 0.08f)); // ߹
+            _tilesDrawNode->drawDot(tPos, r, Color4F(0.15f, 0.35f, 0.15f, 1.0f)); // 树冠
+            _tilesDrawNode->drawDot(tPos + Vec2(-r * 0.3f, r * 0.3f), r * 0.2f, Color4F(1, 1, 1, 0.08f)); // 高光
         }
     }
-    // 4. Ʋݵ/ƽԭ
+    // 4. 绘制草地/平原纹理
     else if (data.type == TerrainType::GRASSLAND || data.type == TerrainType::PLAINS) {
         for (int i = 0; i < 3; i++) {
             Vec2 p = pos + Vec2((getRand() - 0.5f) * size * 0.7f, (getRand() - 0.5f) * size * 0.7f);
@@ -560,14 +564,14 @@ void GameMapLayer::drawTileDecorations(Hex hex, Vec2 pos, float size, const Tile
             _tilesDrawNode->drawSegment(p, p + Vec2(h * 0.2f, h), 1.0f, Color4F(0, 0, 0, 0.1f));
         }
     }
-    // 5. Ƹ߼ˮ
-    else if (data.type == TerrainType::COAST) { // ǳƲ
-        // ǳ 1-2 ߲
+    // 5. 绘制高级水纹
+    else if (data.type == TerrainType::COAST) { // 仅在浅海绘制波浪
+        // 浅海绘制 1-2 条长弧线波浪
         int waveCount = (getRand() > 0.5f) ? 2 : 1;
         for (int i = 0; i < waveCount; i++) {
             Vec2 wPos = pos + Vec2((getRand() - 0.5f) * size * 0.6f, (getRand() - 0.5f) * size * 0.6f);
-            float waveLength = size * (0.4f + getRand() * 0.3f); // 
-            drawSmoothWave(wPos, waveLength, size * 0.08f); // ƽ˻
+            float waveLength = size * (0.4f + getRand() * 0.3f); // 长度增加
+            drawSmoothWave(wPos, waveLength, size * 0.08f); // 调用平滑波浪绘制
         }
     }
 }
@@ -581,7 +585,7 @@ void GameMapLayer::drawHexBoundaries(Hex h, TileData data) {
         float rad_1 = CC_DEGREES_TO_RADIANS(60 * i - 30);
         float rad_2 = CC_DEGREES_TO_RADIANS(60 * (i + 1) - 30);
 
-        // ԭʼ
+        // 原始顶点
         Vec2 v1 = center + Vec2(size * cos(rad_1), size * sin(rad_1));
         Vec2 v2 = center + Vec2(size * cos(rad_2), size * sin(rad_2));
 
@@ -590,9 +594,9 @@ void GameMapLayer::drawHexBoundaries(Hex h, TileData data) {
         bool isNeighborLand = (nData.type != TerrainType::OCEAN && nData.type != TerrainType::COAST);
 
         if (isCurrentWater && isNeighborLand) {
-            // --- ĭЧŻ ---
+            // --- 柔和泡沫效果优化 ---
 
-            // 1. 򣨴ӱ߽Ŀ£ 2-3 أ
+            // 1. 计算缩进方向（从边界向六边形中心靠拢 2-3 像素）
             Vec2 edgeMid = (v1 + v2) * 0.5f;
             Vec2 dirToCenter = (center - edgeMid).getNormalized();
             float inset = 2.5f;
@@ -600,22 +604,22 @@ void GameMapLayer::drawHexBoundaries(Hex h, TileData data) {
             Vec2 sv1 = v1 + dirToCenter * inset;
             Vec2 sv2 = v2 + dirToCenter * inset;
 
-            // 2. һ㣺ײ΢ (ϴ֣ģˮµǳɫ)
+            // 2. 第一层：底层微弱蓝光 (较粗，模拟水下的浅色)
             _tilesDrawNode->drawSegment(sv1, sv2, 3.5f, Color4F(0.8f, 0.95f, 1.0f, 0.15f));
 
-            // 3. ڶ㣺İɫĭ (ϸһ㣬ڶ㴦Ӳص)
+            // 3. 第二层：核心白色泡沫 (较细，且缩短一点，避免在顶点处生硬重叠)
             Vec2 shortV1 = sv1 + (sv2 - sv1) * 0.1f;
             Vec2 shortV2 = sv1 + (sv2 - sv1) * 0.9f;
             _tilesDrawNode->drawSegment(shortV1, shortV2, 1.2f, Color4F(1.0f, 1.0f, 1.0f, 0.25f));
 
-            // 4. 㣺һϸ˻
-            if (std::hash<float>{}(v1.x + v2.y) > 0.5) { // ж
+            // 4. 第三层：增加一点点随机的细浪花
+            if (std::hash<float>{}(v1.x + v2.y) > 0.5) { // 简单随机判断
                 Vec2 vMid = (shortV1 + shortV2) * 0.5f;
                 _tilesDrawNode->drawSegment(vMid, vMid + (shortV2 - shortV1) * 0.2f, 2.0f, Color4F(1, 1, 1, 0.1f));
             }
         }
         else {
-            // ͨؿ񣺱øٸ
+            // 普通地块网格：变得更淡，几乎看不见，减少干扰
             _tilesDrawNode->drawSegment(v1, v2, 0.5f, Color4F(0, 0, 0, 0.05f));
         }
     }
@@ -632,96 +636,96 @@ int GameMapLayer::getTerrainCost(Hex h) {
     return 1;
 }
 
-// ޸ onTouchBegan ֧EscȡҪĻ
+// 修改 onTouchBegan 函数，支持Esc键或特殊手势取消（如果需要的话）
 bool GameMapLayer::onTouchBegan(Touch* touch, Event* event) {
     _isDragging = false;
-    _mouseDownPos = touch->getLocation();  // ¼ʼλ
+    _mouseDownPos = touch->getLocation();  // 记录触摸开始位置
 
-    // ѡģʽ£Կȡƣ˫հ״ȡ
+    // 如果在选择模式下，可以考虑添加取消手势（例如双击空白处取消）
     return true;
 }
 
 void GameMapLayer::onTouchMoved(Touch* touch, Event* event) {
     Vec2 delta = touch->getDelta();
 
-    // ֵ
+    // 防抖动阈值
     if (delta.getLengthSq() > 5.0f) {
         _isDragging = true;
-        // ֱӵ deltaʵָָ϶
+        // 直接叠加 delta，实现跟随手指拖动
         this->setPosition(this->getPosition() + delta);
     }
 }
 
 void GameMapLayer::onTouchEnded(Touch* touch, Event* event) {
-    // жǷקǾͲԪ߼
+    // 首先判断是否是拖拽，如果是就不处理单元逻辑
     if (_isDragging) return;
 
-    // ѡģʽ£ȴؿѡ
+    // 如果在选择模式下，优先处理地块选择
     if (_isSelectingTile) {
         handleTileSelection(touch);
         return;
     }
 
-    // 1. ת (Touch -> NodeSpace -> Hex)
+    // 1. 将触摸转换 (Touch -> NodeSpace -> Hex)
     Vec2 clickPos = this->convertToNodeSpace(touch->getLocation());
     Hex clickHex = _layout->pixelToHex(clickPos);
 
     // ============================================================
-    // ˫߼
+    // 双击逻辑处理
     // ============================================================
     auto now = std::chrono::steady_clock::now();
     long long diff = std::chrono::duration_cast<std::chrono::milliseconds>(now - _lastClickTime).count();
 
-    // ͬ˫
+    // 同格双击标记
     bool isSameHexDoubleTap = (clickHex == _lastClickHex && diff < 300);
 
-    // ȡλõĵλ
+    // 获取点击位置的单位
     AbstractUnit* clickedUnit = getUnitAt(clickHex);
     
-    // Ƿ˵зλ
+    // 检查是否点击了敌方单位
     bool clickedOnEnemy = (clickedUnit != nullptr && 
                            _selectedUnit != nullptr && 
                            _selectedUnit->getOwnerId() == 0 &&
                            clickedUnit->getOwnerId() != _selectedUnit->getOwnerId());
 
-    CCLOG("=== Touch Debug ===");
-    CCLOG("Touch Hex: (%d, %d)", clickHex.q, clickHex.r);
-    CCLOG("LastClickHex: (%d, %d)", _lastClickHex.q, _lastClickHex.r);
-    CCLOG("Time diff: %lld ms", diff);
-    CCLOG("isSameHexDoubleTap: %d", isSameHexDoubleTap);
-    CCLOG("SelectedUnit: %s (owner=%d)", 
+    GLOG_TRACE(MAP, "=== Touch Debug ===");
+    GLOG_TRACE(MAP, "Touch Hex: (%d, %d)", clickHex.q, clickHex.r);
+    GLOG_TRACE(MAP, "LastClickHex: (%d, %d)", _lastClickHex.q, _lastClickHex.r);
+    GLOG_TRACE(MAP, "Time diff: %lld ms", diff);
+    GLOG_TRACE(MAP, "isSameHexDoubleTap: %d", isSameHexDoubleTap);
+    GLOG_TRACE(MAP, "SelectedUnit: %s (owner=%d)", 
           _selectedUnit ? _selectedUnit->getUnitName().c_str() : "NULL",
           _selectedUnit ? _selectedUnit->getOwnerId() : -1);
-    CCLOG("ClickedUnit: %s (owner=%d)", 
+    GLOG_TRACE(MAP, "ClickedUnit: %s (owner=%d)", 
           clickedUnit ? clickedUnit->getUnitName().c_str() : "NULL",
           clickedUnit ? clickedUnit->getOwnerId() : -1);
-    CCLOG("clickedOnEnemy: %d", clickedOnEnemy);
+    GLOG_TRACE(MAP, "clickedOnEnemy: %d", clickedOnEnemy);
 
     // ============================================================
-    // ֧ A: ˫ͬ + ѡмλ -> ִƶ򹥻
+    // 分支 A: 双击同格 + 已选中己方单位 -> 执行移动或攻击
     // ============================================================
     if (isSameHexDoubleTap && _selectedUnit && _selectedUnit->getOwnerId() == 0) {
-        CCLOG(">>> Entering DOUBLE TAP branch");
+        GLOG_TRACE(MAP, ">>> Entering DOUBLE TAP branch");
         
-        // ˫Լڵĸ
+        // 不能双击自己所在的格子
         if (clickHex == _selectedUnit->getGridPos()) {
-            CCLOG("Double tap on self position, ignored.");
+            GLOG_TRACE(MAP, "Double tap on self position, ignored.");
             _lastClickTime = now;
             _lastClickHex = clickHex;
             return;
         }
 
-        // ȴĿλезλ -> 
+        // 【优先处理】目标位置有敌方单位 -> 攻击
         if (clickedOnEnemy) {
-            CCLOG(">>> ATTACK: Double tap on enemy at (%d, %d)", clickHex.q, clickHex.r);
+            GLOG_TRACE(MAP, ">>> ATTACK: Double tap on enemy at (%d, %d)", clickHex.q, clickHex.r);
             handleUnitAttack(_selectedUnit, clickHex);
-            _lastClickHex = Hex(-999, -999);  // ˫¼
+            _lastClickHex = Hex(-999, -999);  // 清除双击记录
             _lastClickTime = now;
             return;
         }
 
-        // Ŀλǿյ -> ƶ
-        CCLOG(">>> MOVE: Double tap on empty hex at (%d, %d)", clickHex.q, clickHex.r);
+        // 目标位置是空地 -> 移动
+        GLOG_TRACE(MAP, ">>> MOVE: Double tap on empty hex at (%d, %d)", clickHex.q, clickHex.r);
         auto costFunc = [this](Hex h) { return this->getTerrainCost(h); };
         std::vector<Hex> path = PathFinder::findPath(_selectedUnit->getGridPos(), clickHex, costFunc);
 
@@ -740,51 +744,53 @@ void GameMapLayer::onTouchEnded(Touch* touch, Event* event) {
                 _selectedUnit->moveTo(clickHex, _layout, pathCost);
                 updateSelection(clickHex);
                 _selectedUnit->hideMoveRange();
-                CCLOG("Move success! Cost: %d", pathCost);
+                GLOG_VERBOSE(PATH, "Move success! Cost: %d", pathCost);
             }
             else {
-                CCLOG("ƶ! Ҫ%dʣ%d", pathCost, _selectedUnit->getCurrentMoves());
+                GLOG_VERBOSE(PATH, "移动力不足! 需要%d，剩余%d", pathCost, _selectedUnit->getCurrentMoves());
             }
         }
         else {
-            CCLOG("޷ҵĿ·");
+            GLOG_VERBOSE(PATH, "无法找到到目标的路径");
         }
         
         _lastClickHex = Hex(-999, -999);
         _lastClickTime = now;
-        return;  // ˫¼
+        return;  // 双击事件处理完毕
     }
 
-    CCLOG(">>> Entering SINGLE CLICK branch");
+    GLOG_TRACE(MAP, ">>> Entering SINGLE CLICK branch");
 
     // ============================================================
-    // ֧ B: ¼ִѡ/л
+    // 分支 B: 单击事件（执行选择/切换）
     // ============================================================
 
-    // Ҫȸʱλü¼´εܼ˫
+    // 【重要】先更新时间和位置记录，这样下次点击才能检测双击
     _lastClickTime = now;
     _lastClickHex = clickHex;
 
-    // ѡп
+    // 更新选中框框
     updateSelection(clickHex);
 
+    // 只能打开己方城市的面板
     BaseCity* clickedCity = getCityAt(clickHex);
+    if (clickedCity && clickedCity->getOwnerPlayer() != 0) clickedCity = nullptr;
 
     if (clickedUnit) {
-        // --- 1: λ ---
+        // --- 情况1: 点击单位 ---
         
-        // ؼѡмλҵǵзλ
-        // лѡУּλѡ״̬ȴ˫
+        // 【关键】如果已选中己方单位，且点击的是敌方单位
+        // 不切换选中，保持己方单位选中状态，等待双击攻击
         if (clickedOnEnemy) {
-            CCLOG("Single click on enemy. Waiting for double-tap to attack.");
-            // л _selectedUnitκ£ȴһε
+            GLOG_TRACE(MAP, "Single click on enemy. Waiting for double-tap to attack.");
+            // 不切换 _selectedUnit，不做任何事，等待下一次点击
             if (_onInvalidSelected) _onInvalidSelected();
-            return;  //  return ǶԵģΪ _lastClickHex Ѿ
+            return;  // 这里 return 是对的，因为 _lastClickHex 已经更新了
         }
         
-        // ͬһѡеĵλȡѡ
+        // 如果点击的是同一个已选中的单位，取消选中
         if (_selectedUnit == clickedUnit) {
-            CCLOG("Deselecting unit.");
+            GLOG_TRACE(MAP, "Deselecting unit.");
             _selectedUnit->hideMoveRange();
             _selectedUnit = nullptr;
             _selectionNode->clear();
@@ -792,26 +798,26 @@ void GameMapLayer::onTouchEnded(Touch* touch, Event* event) {
             return;
         }
 
-        // лѡĿ꣨λ
-        CCLOG("Selecting unit: %s", clickedUnit->getUnitName().c_str());
+        // 切换选中目标（己方单位）
+        GLOG_TRACE(MAP, "Selecting unit: %s", clickedUnit->getUnitName().c_str());
         if (_selectedUnit) _selectedUnit->hideMoveRange();
         _selectedUnit = clickedUnit;
 
-        // ֪ͨ UI
+        // 通知 UI
         if (_onUnitSelected) _onUnitSelected(_selectedUnit);
 
-        // ֻмλʾƶΧ
+        // 只有己方单位才显示移动范围
         if (_selectedUnit->getOwnerId() == 0) {
             auto costFunc = [this](Hex h) { return this->getTerrainCost(h); };
             _selectedUnit->showMoveRange(_layout, costFunc);
         }
 
-        // رճ
+        // 关闭城市面板
         if (_onInvalidSelected) _onInvalidSelected();
     }
     else if (clickedCity) {
-        // --- 2:  ---
-        CCLOG("Clicked on city.");
+        // --- 情况2: 点击城市 ---
+        GLOG_TRACE(MAP, "Clicked on city.");
         if (_selectedUnit) {
             _selectedUnit->hideMoveRange();
             _selectedUnit = nullptr;
@@ -820,9 +826,9 @@ void GameMapLayer::onTouchEnded(Touch* touch, Event* event) {
         if (_onCitySelected) _onCitySelected(clickedCity);
     }
     else {
-        // --- 3: յ ---
-        CCLOG("Clicked on empty hex.");
-        // ȡλѡУԱ˫ƶ
+        // --- 情况3: 点击空地 ---
+        GLOG_TRACE(MAP, "Clicked on empty hex.");
+        // 不取消己方单位选中，以便双击移动
         if (_onInvalidSelected) _onInvalidSelected();
     }
 }
@@ -847,7 +853,7 @@ void GameMapLayer::onBuildCityAction() {
     if (!_selectedUnit) return;
 
     if (_selectedUnit->getOwnerId() != 0) {
-        CCLOG("ֻ 0 ĵλԽǣǰλ %d", _selectedUnit->getOwnerId());
+        CCLOG("只有玩家 0 的单位可以建城！当前单位属于玩家 %d", _selectedUnit->getOwnerId());
         return;
     }
 
@@ -864,11 +870,11 @@ void GameMapLayer::onBuildCityAction() {
     if (gameManager) {
         Player* currentPlayer = gameManager->getCurrentPlayer();
         if (currentPlayer) {
-            // ӵҵĳб
+            // 添加到玩家的城市列表
             city->ownerPlayer = currentPlayer->getPlayerId();
             currentPlayer->addCity(city);
 
-            CCLOG("ӵ %d: %d",
+            CCLOG("城市已添加到玩家 %d，城市总数: %d",
                 currentPlayer->getPlayerId(), currentPlayer->getCityCount());
         }
         else {
@@ -879,7 +885,7 @@ void GameMapLayer::onBuildCityAction() {
     if (gameManager) {
         Player* currentPlayer = gameManager->getCurrentPlayer();
         if (currentPlayer) {
-            // ߼бƳÿ
+            // 从玩家逻辑列表中移除该开拓者
             currentPlayer->removeUnit(_selectedUnit);
 
             city->ownerPlayer = currentPlayer->getPlayerId();
@@ -887,17 +893,17 @@ void GameMapLayer::onBuildCityAction() {
         }
     }
 
-    // ӵͼȾбƳ
+    // 从地图渲染列表移除
     auto it = std::find(_allUnits.begin(), _allUnits.end(), _selectedUnit);
     if (it != _allUnits.end()) {
         _allUnits.erase(it);
     }
 
-    //  UI ڴ
+    // 彻底销毁 UI 和内存
     _selectedUnit->removeFromParent();
     _selectedUnit = nullptr;
 
-    CCLOG("нɹ");
+    CCLOG("城市建立成功！");
 }
 
 void GameMapLayer::onNextTurnAction() {
@@ -908,15 +914,19 @@ void GameMapLayer::onNextTurnAction() {
 
 
 
-// ȡָؿ
+// 获取指定地块的数据
 TileData GameMapLayer::getTileData(Hex h)
 {
-	if (_mapData.find(h) != _mapData.end()) {
-		return _mapData[h];
-	}
-	return TileData();
+	const TileData* data = findTileData(h);
+	return data ? *data : TileData();
 }
-// 1. ʵûص
+
+const TileData* GameMapLayer::findTileData(Hex h) const
+{
+	auto it = _mapData.find(h);
+	return it == _mapData.end() ? nullptr : &it->second;
+}
+// 1. 实现设置回调
 void GameMapLayer::setOnCitySelectedCallback(const std::function<void(BaseCity*)>& cb) {
     _onCitySelected = cb;
 }
@@ -924,39 +934,31 @@ void GameMapLayer::setOnInvalidSeletedCallback(const std::function<void()>& cb)
     _onInvalidSelected = cb;
 }
 
-// 2. ʵֲҳ
+// 2. 实现查找城市
 BaseCity* GameMapLayer::getCityAt(Hex hex) {
-    for (auto city : _cities) {
-        if (city->gridPos == hex) {
-            return city;
-        }
-    }
-    return nullptr;
+    // 城市按坐标登记在 GameManager 的注册表中，O(1) 查询（包括AI城市）
+    return GameManager::getInstance()->getCityAt(hex);
 }
 
 AbstractUnit* GameMapLayer::getUnitAt(Hex hex) {
-    for (auto unit : _allUnits) { // ʹͳһı
-        if (unit->isAlive() && unit->getGridPos() == hex) {
-            return unit;
-        }
-    }
-    return nullptr;
+    // 经单位状态表的坐标索引 O(1) 查询
+    return UnitStateTable::getInstance()->findAt(hex);
 }
 
-// ָλΧ2ΧǷζɴ
+// 【新增】检查指定位置周围2格范围内是否所有六边形都可达
 bool GameMapLayer::isValidStartingPosition(Hex centerHex) {
-    // ȡĵ㼰Χ2Χڵ
+    // 获取中心点及周围2格范围内的所有六边形
     std::vector<Hex> nearbyHexes;
-    nearbyHexes.push_back(centerHex);  // ĵ㱾
+    nearbyHexes.push_back(centerHex);  // 中心点本身
     
-    // 6
+    // 6个方向
     std::vector<Hex> directions = {
         Hex(1, 0),   Hex(1, -1),
         Hex(0, -1),  Hex(-1, 0),
         Hex(-1, 1),  Hex(0, 1)
     };
     
-    // ռĵ1ڵ
+    // 收集距离中心点1格内的所有六边形
     std::set<Hex> visited;
     std::queue<std::pair<Hex, int>> bfs;  // (hex, distance)
     bfs.push({centerHex, 0});
@@ -968,7 +970,7 @@ bool GameMapLayer::isValidStartingPosition(Hex centerHex) {
         auto dist = p.second;
         bfs.pop();
         
-        if (dist < 2) {  // ռС2
+        if (dist < 2) {  // 收集距离小于2的六边形
             for (const Hex& dir : directions) {
                 Hex neighbor = current + dir;
                 
@@ -981,10 +983,10 @@ bool GameMapLayer::isValidStartingPosition(Hex centerHex) {
         }
     }
     
-    // ΧǷ񶼿ɴ > 0
+    // 检查所有周围六边形是否都可达（地形消耗 > 0）
     for (const Hex& hex : nearbyHexes) {
         int cost = getTerrainCost(hex);
-        if (cost <= 0) {  // кɽͨĵ
+        if (cost <= 0) {  // 如果有海洋、山脉或其他不可通过的地形
             CCLOG("Hex(%d, %d) is not passable (cost=%d)", hex.q, hex.r, cost);
             return false;
         }
@@ -996,64 +998,64 @@ bool GameMapLayer::isValidStartingPosition(Hex centerHex) {
 }
 
 
-// =========================ؿѡģʽ======================== //
+// =========================地块选择模式======================== //
 
 void GameMapLayer::enableTileSelection(const std::vector<Hex>& allowedTiles,
     const std::function<void(Hex)>& callback,
     const std::function<void()>& cancelCallback) {
     CCLOG("Enable tile selection mode with %zu allowed tiles", allowedTiles.size());
 
-    // ֮ǰѡеλ
+    // 清除之前的选中单位
     if (_selectedUnit) {
         _selectedUnit->hideMoveRange();
         _selectedUnit = nullptr;
     }
 
-    // ѡ
+    // 清除城市选择
     if (_onCitySelected) {
         _onCitySelected(nullptr);
     }
 
-    // ѡģʽ
+    // 设置选择模式
     _isSelectingTile = true;
     _allowedTiles = allowedTiles;
     _tileSelectionCallback = callback;
-    _onSelectionCancelled = cancelCallback;  // ȡص
+    _onSelectionCancelled = cancelCallback;  // 保存取消回调
 
-    // ڵ㣨ڣ
+    // 创建高亮节点（如果不存在）
     if (!_highlightNode) {
         _highlightNode = DrawNode::create();
         this->addChild(_highlightNode, 15);
     }
 
-    // ʾѡؿ
+    // 高亮显示可选地块
     highlightAllowedTiles(allowedTiles);
 }
 
-// ʵ disableTileSelection 
-// ޸ disableTileSelection Ӳ֧
+// 实现 disableTileSelection 函数
+// 修改 disableTileSelection 函数，添加参数支持
 void GameMapLayer::disableTileSelection(bool triggerCancelCallback) {
-    // ֱӵ cancelTileSelection
+    // 直接调用 cancelTileSelection
     cancelTileSelection(triggerCancelCallback);
 }
 
-// ʵ highlightAllowedTiles 
+// 实现 highlightAllowedTiles 函数
 void GameMapLayer::highlightAllowedTiles(const std::vector<Hex>& allowedTiles) {
     if (!_highlightNode) return;
 
     _highlightNode->clear();
 
-    // ֮ǰıǩ
+    // 清除之前的标签
     for (auto label : _highlightLabels) {
-        label->removeFromParent();
+        FloatingTextPool::getInstance()->release(label);
     }
     _highlightLabels.clear();
 
-    // ΪÿѡؿƸЧ
+    // 为每个可选地块绘制高亮效果
     for (const Hex& hex : allowedTiles) {
         Vec2 center = _layout->hexToPixel(hex);
 
-        // Ƹ߿
+        // 绘制高亮边框
         Vec2 vertices[6];
         for (int i = 0; i < 6; i++) {
             float rad = CC_DEGREES_TO_RADIANS(60 * i - 30);
@@ -1061,47 +1063,45 @@ void GameMapLayer::highlightAllowedTiles(const std::vector<Hex>& allowedTiles) {
                 center.y + _layout->size * sin(rad));
         }
 
-        // ʹð͸ɫ߿ʾѡؿ
+        // 使用半透明的绿色边框表示可选地块
         _highlightNode->drawPoly(vertices, 6, false, Color4F(0.0f, 1.0f, 0.0f, 0.7f));
         _highlightNode->setLineWidth(4.0f);
 
-        // ѡڵؿűǩ
-        int index = &hex - &allowedTiles[0];  // ȡе
+        // 可选：在地块上添加序号标签
+        int index = &hex - &allowedTiles[0];  // 获取在数组中的索引
         std::string labelText = std::to_string(index + 1);
 
-        auto label = Label::createWithSystemFont(labelText, "Arial", 18);
+        auto label = FloatingTextPool::getInstance()->acquire(this, labelText, 18, Color3B::WHITE, 16);  // 在边框之上
         label->setPosition(center);
-        label->setColor(Color3B::WHITE);
         label->enableOutline(Color4B::BLACK, 2);
-        this->addChild(label, 16);  // ڱ߿֮
         _highlightLabels.push_back(label);
     }
 
     CCLOG("Highlighted %zu allowed tiles", allowedTiles.size());
 }
 
-// ʵ clearHighlights 
+// 实现 clearHighlights 函数
 void GameMapLayer::clearHighlights() {
     if (_highlightNode) {
         _highlightNode->clear();
     }
 
     for (auto label : _highlightLabels) {
-        label->removeFromParent();
+        FloatingTextPool::getInstance()->release(label);
     }
     _highlightLabels.clear();
 }
 
-// Ӵؿѡĺ
-// ޸ handleTileSelection ڵؿʱṩ
+// 添加处理地块选择的函数
+// 修改 handleTileSelection 函数，在点击不允许地块时提供反馈
 void GameMapLayer::handleTileSelection(Touch* touch) {
-    // ת (Touch -> NodeSpace -> Hex)
+    // 将触摸转换 (Touch -> NodeSpace -> Hex)
     Vec2 clickPos = this->convertToNodeSpace(touch->getLocation());
     Hex clickHex = _layout->pixelToHex(clickPos);
 
     CCLOG("Tile selection mode: Clicked Hex (%d, %d)", clickHex.q, clickHex.r);
 
-    // ĵؿǷб
+    // 检查点击的地块是否在允许的列表中
     bool isAllowed = false;
     for (const Hex& allowedHex : _allowedTiles) {
         if (allowedHex == clickHex) {
@@ -1113,34 +1113,34 @@ void GameMapLayer::handleTileSelection(Touch* touch) {
     if (isAllowed) {
         CCLOG("Tile (%d, %d) selected!", clickHex.q, clickHex.r);
 
-        // ʱصȻ״̬
+        // 临时保存回调，然后清理状态
         auto callback = _tileSelectionCallback;
-        cancelTileSelection(false);  // ȡص
+        cancelTileSelection(false);  // 不触发取消回调
 
-        // ѡص
+        // 触发选择回调
         if (callback) {
             callback(clickHex);
         }
 
-        // ʾѡб
+        // 显示选中标记
         showSelectionMarker(clickHex);
     }
     else {
         CCLOG("Tile (%d, %d) is not in allowed list", clickHex.q, clickHex.r);
 
-        // ѡṩӾ˸ɫ߿
+        // 可选：提供视觉反馈（例如闪烁红色边框）
         showInvalidSelectionFeedback(clickHex);
     }
 }
 
-// ʾѡбǵĺ
+// 添加显示选中标记的函数
 void GameMapLayer::showSelectionMarker(Hex hex) {
-    // ʱѡбǣһ˸ǣ
+    // 创建临时的选中标记（例如一个闪烁的星星）
     Vec2 center = _layout->hexToPixel(hex);
 
-    auto marker = Sprite::create("selection_marker.png"); // Ҫ׼ͼƬ
+    auto marker = Sprite::create("selection_marker.png"); // 需要准备这个图片
     if (!marker) {
-        // ͼƬڣһ򵥵
+        // 如果图片不存在，绘制一个简单的星星
         auto drawNode = DrawNode::create();
         float radius = _layout->size * 0.3f;
         Vec2 starPoints[10];
@@ -1152,10 +1152,10 @@ void GameMapLayer::showSelectionMarker(Hex hex) {
         }
         drawNode->drawPolygon(starPoints, 10, Color4F(1.0f, 1.0f, 0.0f, 0.3f),
             1.0f, Color4F(1.0f, 1.0f, 0.0f, 0.8f));
-        drawNode->setTag(9999); // ʹtagںƳ
+        drawNode->setTag(9999); // 使用tag便于后续移除
         this->addChild(drawNode, 18);
 
-        // ˸
+        // 添加闪烁动画
         auto fadeIn = FadeTo::create(0.5f, 255);
         auto fadeOut = FadeTo::create(0.5f, 128);
         auto sequence = Sequence::create(fadeIn, fadeOut, nullptr);
@@ -1167,19 +1167,19 @@ void GameMapLayer::showSelectionMarker(Hex hex) {
         marker->setTag(9999);
         this->addChild(marker, 18);
 
-        // ת
+        // 旋转动画
         auto rotate = RotateBy::create(2.0f, 360);
         auto repeat = RepeatForever::create(rotate);
         marker->runAction(repeat);
     }
 }
 
-// ѡбǵĺ
+// 添加清除选中标记的函数
 void GameMapLayer::clearSelectionMarker() {
     this->removeChildByTag(9999);
 }
 
-//  cancelTileSelection ʵ
+// 添加 cancelTileSelection 函数实现
 void GameMapLayer::cancelTileSelection(bool triggerCancelCallback) {
     if (!_isSelectingTile) {
         CCLOG("Not in tile selection mode, nothing to cancel");
@@ -1188,33 +1188,33 @@ void GameMapLayer::cancelTileSelection(bool triggerCancelCallback) {
 
     CCLOG("Canceling tile selection mode");
 
-    // ѡģʽ״̬
+    // 清除选择模式状态
     _isSelectingTile = false;
     _allowedTiles.clear();
 
-    // ȡصҪ
+    // 触发取消回调（如果需要）
     if (triggerCancelCallback && _onSelectionCancelled) {
         _onSelectionCancelled();
         CCLOG("Tile selection cancelled by user");
     }
 
-    // ص
+    // 清除回调函数
     _tileSelectionCallback = nullptr;
     _onSelectionCancelled = nullptr;
 
-    // ӾԪ
+    // 清除所有视觉元素
     clearHighlights();
     clearSelectionMarker();
 
-    // ѡȡЧ
+    // 可选：播放取消音效
     // AudioEngine::play2d("cancel_sound.mp3");
 }
 
-// ʾЧѡĺ
+// 添加显示无效选择反馈的函数
 void GameMapLayer::showInvalidSelectionFeedback(Hex hex) {
     Vec2 center = _layout->hexToPixel(hex);
 
-    // ɫ˸߿
+    // 创建红色闪烁边框
     auto feedbackNode = DrawNode::create();
 
     Vec2 vertices[6];
@@ -1224,14 +1224,14 @@ void GameMapLayer::showInvalidSelectionFeedback(Hex hex) {
             center.y + _layout->size * sin(rad));
     }
 
-    // ƺɫ߿
+    // 绘制红色边框
     feedbackNode->drawPoly(vertices, 6, false, Color4F(1.0f, 0.0f, 0.0f, 0.8f));
     feedbackNode->setLineWidth(3.0f);
-    feedbackNode->setTag(9998);  // ںƳ
+    feedbackNode->setTag(9998);  // 用于后续移除
 
     this->addChild(feedbackNode, 17);
 
-    // ˸
+    // 闪烁动画
     auto fadeOut = FadeOut::create(0.3f);
     auto remove = CallFunc::create([feedbackNode]() {
         feedbackNode->removeFromParent();
@@ -1247,7 +1247,7 @@ void GameMapLayer::handleUnitAttack(AbstractUnit* attacker, Hex targetHex) {
     if (!target || !target->isAlive()) return;
     if (target->getOwnerId() == attacker->getOwnerId()) return;
 
-    // Χж
+    // 范围与行动力检查
     int distance = attacker->getGridPos().distance(targetHex);
     if (distance > attacker->getAttackRange()) {
         CCLOG("Attack failed: target out of range. dist=%d, range=%d", distance, attacker->getAttackRange());
@@ -1262,10 +1262,10 @@ void GameMapLayer::handleUnitAttack(AbstractUnit* attacker, Hex targetHex) {
         return;
     }
 
-    // ִй
+    // 执行攻击
     attacker->attack(target, _layout);
     attacker->hideMoveRange();
 
-    // һ˫¼ظ
+    // 清一次双击记录，避免重复触发
     _lastClickHex = Hex(-999, -999);
 }
\ No newline at end of file
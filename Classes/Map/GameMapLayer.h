@@ -1,9 +1,9 @@
 /**
  * @file GameMapLayer.h
- * @brief Ϸͼ
+ * @brief 游戏地图层
  * 
- * ϷͼȾλսϵͳ
- * ϷҪ㣬롢λƶս
+ * 管理游戏地图的渲染、单位管理、战斗系统等
+ * 这是游戏的主要交互层，处理触摸输入、单位移动、战斗等
  */
 
 #ifndef __GAME_MAP_LAYER_H__
@@ -23,47 +23,47 @@ class BaseCity;
 
 /**
  * @class GameMapLayer
- * @brief Ϸͼ
+ * @brief 游戏地图层
  * 
- * ְ
- * - ͼɺȾ
- * - ؿԴʾʳȣ
- * - λĹƶ
- * - λ֮սϵͳ
- * - еĽ͹
- * - 봦
+ * 职责：
+ * - 六边形网格地图的生成和渲染
+ * - 地块资源的显示（食物、生产力等）
+ * - 单位的管理和移动
+ * - 单位之间的战斗系统
+ * - 城市的建立和管理
+ * - 玩家输入处理（触摸）
  * 
- * @note ̳ cocos2d::LayerΪҪݲ
+ * @note 此类继承自 cocos2d::Layer，作为场景的主要内容层
  */
 class GameMapLayer : public cocos2d::Layer {
 public:
     /**
-     * @brief ʼͼ
-     * @return true ʼɹfalse ʧ
+     * @brief 初始化地图层
+     * @return true 初始化成功，false 失败
      * 
-     * ˷᣺
-     * 1. ͼ
-     * 2. ҵλ
-     * 3. жԵλʾã
-     * 4. עᴥ¼
+     * 此方法会：
+     * 1. 生成六边形网格地图
+     * 2. 创建玩家单位
+     * 3. 创建敌对单位（演示用）
+     * 4. 注册触摸事件监听器
      */
     virtual bool init();
 
     /**
-     * @brief ʼGameManager
-     * @return true ʼɹfalse ʧ
+     * @brief 初始化GameManager和玩家类
+     * @return true 初始化成功，false 失败
      *
-     * ˷᣺
-     * 1. ҳʼ
-     * 2. 󶨵ǰ
+     * 此方法会：
+     * 1. 创建玩家初始开拓者
+     * 2. 绑定到当前玩家
      */
     void initGameManagerAndPlayers();
     
     /**
-     * @brief 
-     * @return Զͷŵ GameMapLayer ָ
+     * @brief 创建函数
+     * @return 自动释放的 GameMapLayer 指针
      * 
-     * ʹʾ
+     * 使用示例：
      * @code
      * GameMapLayer* layer = GameMapLayer::create();
      * scene->addChild(layer);
@@ -72,89 +72,90 @@ public:
     CREATE_FUNC(GameMapLayer);
 
     /**
-     * @brief õλѡлص
-     * @param cb صΪѡеĵλָ
+     * @brief 设置单位选中回调函数
+     * @param cb 回调函数，参数为选中的单位指针
      * 
-     * ҵѡеλʱô˻ص
+     * 当玩家点击选中单位时会调用此回调
      */
     void setOnUnitSelectedCallback(const std::function<void(AbstractUnit*)>& cb);
 
     /**
-	* @brief óѡлص
-    * @param cb صΪѡеĵλָ
+	* @brief 设置城市选中回调函数
+    * @param cb 回调函数，参数为选中的单位指针
     * 
-    * ҵѡгʱô˻ص
+    * 当玩家点击选中城市时会调用此回调
     */
     void setOnCitySelectedCallback(const std::function<void(BaseCity*)>& cb);
-    void setOnInvalidSeletedCallback(const std::function<void()>& cb);  ///< ѡлص
+    void setOnInvalidSeletedCallback(const std::function<void()>& cb);  ///< 城市选中回调
 
     /**
-     * @brief еĶ
+     * @brief 处理建立城市的动作
      * 
-     * ˷᣺
-     * 1. ѡеĵλǷܽ
-     * 2. ڵλλý
-     * 3. Ƴߵλ
-     * 4. µͼʾ
+     * 此方法会：
+     * 1. 检查选中的单位是否能建城
+     * 2. 在单位位置建立城市
+     * 3. 移除定居者单位
+     * 4. 更新地图显示
      */
     void onBuildCityAction();
 
     /**
-     * @brief غϽ
+     * @brief 处理回合结束
      * 
-     * ˷᣺
-     * 1. геĲ
-     * 2. õλƶ
-     * 3. غ¼
+     * 此方法会：
+     * 1. 更新所有城市的产出
+     * 2. 重置单位的移动力
+     * 3. 触发回合相关事件
      */
     void onNextTurnAction();
 
 	TileData getTileData(Hex h);
+	const TileData* findTileData(Hex h) const; // 不复制的地块查询，地块不存在时返回空
 
-    //========ؿѡģʽ========//
+    //========地块选择模式========//
 
     /**
-     * @brief õؿѡģʽ
-     * @param allowedTiles ѡĵؿ
-     * @param callback ѡɺĻص
+     * @brief 启用地块选择模式
+     * @param allowedTiles 允许选择的地块数组
+     * @param callback 选择完成后的回调函数
      *
-     * ģʽҿԵͼѡؿ
-     * ֻ allowedTiles еĵؿԱѡ
-     * ؿᱻ
+     * 进入此模式后，玩家可以点击地图选择地块
+     * 只有 allowedTiles 中的地块可以被选择
+     * 点击其他地块会被忽略
      */
     void enableTileSelection(const std::vector<Hex>& allowedTiles,
         const std::function<void(Hex)>& callback,
         const std::function<void()>& cancelCallback);
 
     /**
-     * @brief µؿѡʾ
-     * @param h Ҫѡе
+     * @brief 更新地块选中显示
+     * @param h 要选中的六边形坐标
      *
-     * ˷ָؿΧƻɫ߿
+     * 此方法会在指定地块周围绘制黄色边框
      */
     void updateSelection(Hex h);
 
 
 
     /**
-    * @brief õؿѡģʽ
+    * @brief 禁用地块选择模式
     */
    
     void disableTileSelection(bool triggerCancelCallback);
     /**
-     * @brief Ƿѡģʽ
-     * @return true ڵؿѡģʽ
+     * @brief 检查是否在选择模式下
+     * @return true 如果在地块选择模式下
      */
     bool isSelectingTile() const { return _isSelectingTile; }
 
     /**
-     * @brief ʾѡؿ
-     * @param allowedTiles Ҫĵؿ
+     * @brief 高亮显示可选地块
+     * @param allowedTiles 需要高亮的地块数组
      */
     void highlightAllowedTiles(const std::vector<Hex>& allowedTiles);
 
     /**
-     * @brief иʾ
+     * @brief 清除所有高亮显示
      */
     void clearHighlights();
 
@@ -164,50 +165,50 @@ public:
     void clearSelectionMarker();
 
     /**
-        * @brief ǿ˳ֶѡģʽ
-        * @param cancelCallback Ƿ񴥷ȡصѡĬϲ
+        * @brief 强制退出手动选择模式
+        * @param cancelCallback 是否触发取消回调（可选，默认不触发）
         *
-        * ҸıҪȡǰѡʱ
+        * 当玩家改变主意或需要取消当前选择操作时调用
         */
     void cancelTileSelection(bool cancelCallback = false);
     void GameMapLayer::showInvalidSelectionFeedback(Hex hex);
 
 
-    HexLayout* getLayout() const { return _layout; }                    ///< βֶ
+    HexLayout* getLayout() const { return _layout; }                    ///< 六边形布局对象
 
 
 private:
-    // ȡص
+    // 添加取消回调函数
     std::function<void()> _onSelectionCancelled;
     /**
-     * @brief ͼ
+     * @brief 生成六边形网格地图
      * 
-     * ˷᣺
-     * 1. ָС
-     * 2. ݵͷɫ
-     * 3. ʾؿԴϢ
+     * 此方法会：
+     * 1. 创建指定大小的六边形网格
+     * 2. 根据地形类型分配颜色
+     * 3. 显示地块资源信息
      */
     void generateMap();
 
     /**
-     * @brief ϲ DrawNode л
-     * @param node Ŀ DrawNode
-     * @param pos Ļ
-     * @param size δСأ
-     * @param color ɫ
+     * @brief 向合并的 DrawNode 中绘制六边形
+     * @param node 目标 DrawNode
+     * @param pos 屏幕像素坐标
+     * @param size 六边形大小（像素）
+     * @param color 六边形颜色
      * 
-     * @note Żιһ DrawNodeÿµ
+     * @note 性能优化：所有六边形共用一个 DrawNode，而非每个都创建新的
      */
     void drawHexOnNode(cocos2d::DrawNode* node, cocos2d::Vec2 pos, float size, cocos2d::Color4F color);
 
     Color4F applyCivStyle(Color4F c);
 
     /**
-     * @brief ڵؿʾԴϢ
-     * @param hex 
-     * @param data ؿ
+     * @brief 在地块上显示资源信息
+     * @param hex 六边形坐标
+     * @param data 地块数据
      * 
-     * ˷ڵؿʾʳҡƼĻ
+     * 此方法会在地块中心显示：粮食、生产力、金币、科技、文化产出
      */
     void drawTileResources(Hex hex, const TileData& data);
 
@@ -222,59 +223,59 @@ private:
 
     
     /**
-     * @brief ȡؿƶɱ
-     * @param h 
-     * @return ƶɱ -1 ʾ޷ͨ
+     * @brief 获取地块的移动成本
+     * @param h 六边形坐标
+     * @return 移动成本（正数），或 -1 表示无法通行
      * 
-     * ͬεĳɱ
-     * - ݵءƽԭ1
-     * - ֡ɳĮѩأ2
-     * - ɽ󺣡-1ͨУ
+     * 不同地形的成本：
+     * - 草地、平原：1
+     * - 丛林、沙漠、雪地：2
+     * - 山脉、大海、海岸：-1（不可通行）
      */
     int getTerrainCost(Hex h);
     
 
     /**
-     * @brief ֮ľǷڷΧ
-     * @param from ʼ
-     * @param to Ŀ
-     * @param range Χ
-     * @return true ڷΧڣfalse Χ
+     * @brief 检查两点之间的距离是否在范围内
+     * @param from 起始六边形坐标
+     * @param to 目标六边形坐标
+     * @param range 范围（格数）
+     * @return true 在范围内，false 超出范围
      * 
-     * ʹپ
+     * 使用曼哈顿距离计算
      */
     bool isHexWithinRange(Hex from, Hex to, int range);
 
     /**
-     * @brief λĹ
-     * @param attacker λָ
-     * @param targetHex Ŀλõ
+     * @brief 处理单位的攻击动作
+     * @param attacker 攻击方单位指针
+     * @param targetHex 目标位置的六边形坐标
      * 
-     * ˷᣺
-     * 1. Ŀλõĵзλ
-     * 2. ֤Ч
-     * 3. ִս߼
+     * 此方法会：
+     * 1. 查找目标位置的敌方单位
+     * 2. 验证攻击的有效性
+     * 3. 执行战斗逻辑
      */
     void handleUnitAttack(AbstractUnit* attacker, Hex targetHex);
 
     
 
-    // жǷקͼ
+    // 用于判断是否在拖拽地图
     cocos2d::Vec2 _mouseDownPos;
-    // ============ Ա ============
-    HexLayout* _layout;                    ///< βֶ
-    AbstractUnit* _myUnit;                 ///< ҿƵҪλ
-    cocos2d::DrawNode* _selectionNode;     ///< ѡеؿı߿ʾ
-    cocos2d::DrawNode* _tilesDrawNode;     ///< εĺϲ DrawNode
-    bool _isDragging;                      ///< Ƿקͼ
-    std::function<void(AbstractUnit*)> _onUnitSelected; ///< λѡлص
-    std::map<Hex, TileData> _mapData;      ///< ؿݣΡԴȣ
-    std::vector<BaseCity*> _cities;        ///< гб
-    std::vector<AbstractUnit*> _allUnits;  ///< еλбз
-    AbstractUnit* _selectedUnit;           ///< ǰѡеĵλ
-    std::function<void(BaseCity*)> _onCitySelected;  ///< ѡлص
-    std::function<void()> _onInvalidSelected;  ///< Чѡ
-	BaseCity* getCityAt(Hex hex);   ///<  ȡָλõĳָ루޳з nullptr
+    // ============ 成员变量 ============
+    HexLayout* _layout;                    ///< 六边形布局对象
+    AbstractUnit* _myUnit;                 ///< 玩家控制的主要单位
+    cocos2d::DrawNode* _selectionNode;     ///< 选中地块的边框显示
+    cocos2d::DrawNode* _tilesDrawNode;     ///< 所有六边形的合并 DrawNode
+    bool _isDragging;                      ///< 是否正在拖拽地图
+    std::function<void(AbstractUnit*)> _onUnitSelected; ///< 单位选中回调
+    std::map<Hex, TileData> _mapData;      ///< 地块数据（地形、资源等）
+    std::vector<BaseCity*> _cities;        ///< 所有城市列表
+    std::vector<AbstractUnit*> _allUnits;  ///< 所有单位列表（包括敌方）
+    AbstractUnit* _selectedUnit;           ///< 当前选中的单位
+    std::function<void(BaseCity*)> _onCitySelected;  ///< 城市选中回调
+    std::function<void()> _onInvalidSelected;  ///< 无效选中
+	BaseCity* getCityAt(Hex hex);   ///<  获取指定位置的城市指针（无城市返回 nullptr）
     AbstractUnit* getUnitAt(Hex h);
 
     bool onTouchBegan(cocos2d::Touch* touch, cocos2d::Event* event);
@@ -287,12 +288,12 @@ private:
     bool isValidStartingPosition(Hex centerHex);
 
 private:
-    // ѡģʽسԱ
+    // 选择模式相关成员变量
     bool _isSelectingTile;
     std::vector<Hex> _allowedTiles;
     std::function<void(Hex)> _tileSelectionCallback;
-    cocos2d::DrawNode* _highlightNode;  // ڻƸؿ
-    std::vector<cocos2d::Node*> _highlightLabels;  // ؿϵıǩ
+    cocos2d::DrawNode* _highlightNode;  // 用于绘制高亮地块
+    std::vector<cocos2d::Label*> _highlightLabels; // 高亮地块上的标签（取自飘字对象池）
 
 };
 
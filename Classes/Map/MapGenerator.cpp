@@ -1,10 +1,11 @@
 /*
-* ɢʽϸɽ (Scattered Strip Mountains)
-* ص㣺ɽϸ״ֲϡҲ
+* 散布式细长山脉生成器 (Scattered Strip Mountains)
+* 特点：山脉呈细条状，但分布稀疏且不连续，被随机打断
 */
 
 #include "MapGenerator.h"
 #include "Utils/PerlinNoise.h"
+#include "Utils/ScopeProfiler.h"
 #include <cmath>
 #include <ctime>
 #include <algorithm>
@@ -16,7 +17,7 @@
 USING_NS_CC;
 
 // ----------------------------------------------------------------------------
-// 
+// 辅助函数
 // ----------------------------------------------------------------------------
 
 std::vector<Hex> GetNeighbors(const Hex& center) {
@@ -37,26 +38,28 @@ float SmoothStep(float edge0, float edge1, float x) {
 }
 
 // ----------------------------------------------------------------------------
-// ߼
+// 主生成逻辑
 // ----------------------------------------------------------------------------
 
 std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
+    PROFILE_SCOPE("MapGenerator::generate");
+    PROFILE_STAGES(stages, "MapGenerator::setup");
     std::map<Hex, TileData> map_data;
 
-    // 1. ʼ
+    // 1. 初始化随机数
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> dist_seed(0, 10000);
     std::uniform_real_distribution<> dist_offset(-50000.0, 50000.0);
 
-    // 2. ʼ
-    PerlinNoise continent_noise(dist_seed(gen)); // ½
-    PerlinNoise ridge_noise1(dist_seed(gen));    // ɽ1 ()
-    PerlinNoise ridge_noise2(dist_seed(gen));    // ɽ2 ()
-    PerlinNoise warp_noise(dist_seed(gen));      // Ť
-    PerlinNoise breakup_noise(dist_seed(gen));   //  (жɽ)
-    PerlinNoise climate_noise(dist_seed(gen));   // 
-    PerlinNoise river_noise(dist_seed(gen));     // 
+    // 2. 初始化噪声生成器
+    PerlinNoise continent_noise(dist_seed(gen)); // 大陆轮廓
+    PerlinNoise ridge_noise1(dist_seed(gen));    // 山脉层1 (横向)
+    PerlinNoise ridge_noise2(dist_seed(gen));    // 山脉层2 (纵向)
+    PerlinNoise warp_noise(dist_seed(gen));      // 坐标扭曲
+    PerlinNoise breakup_noise(dist_seed(gen));   // 打断噪声 (用于切断山脉)
+    PerlinNoise climate_noise(dist_seed(gen));   // 气候
+    PerlinNoise river_noise(dist_seed(gen));     // 河流
 
     const float kOffsetX = dist_offset(gen);
     const float kOffsetY = dist_offset(gen);
@@ -65,8 +68,9 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     const float kSeaLevel = dist_sea_level(gen);
 
     // ========================================================================
-    //  1ɺ½ֲ (Continents)
+    // 步骤 1：生成海陆分布 (Continents)
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::continents");
     std::map<Hex, bool> is_land;
 
     for (int r = 0; r < height; r++) {
@@ -79,14 +83,14 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
             float nx = static_cast<float>(q) / width;
             float ny = static_cast<float>(r) / height;
 
-            // ɴ½
+            // 生成大陆噪声
             float continent = continent_noise.octaveNoise(
                 nx * 3.6f * 2.4f + kOffsetX,
                 ny * 3.6f + kOffsetY,
                 4, 0.5f
             );
 
-            // Ե˥
+            // 边缘衰减
             float dx = 2.0f * nx - 1.0f;
             float dy = 2.0f * ny - 1.0f;
             float edge_dist = std::max(std::abs(dx), std::abs(dy));
@@ -111,8 +115,9 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  2ɢ״ɽ (Scattered Strip Ridges)
+    // 步骤 2：生成散开的条状山脉 (Scattered Strip Ridges)
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::ridges");
     std::map<Hex, float> ridge_value_map;
 
     for (auto& pair : map_data) {
@@ -122,8 +127,8 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
             continue;
         }
 
-        // --- 1. ǿŤ (Stronger Warping) ---
-        // Ťȣɽֲģ鼷ѹ
+        // --- 1. 强力坐标扭曲 (Stronger Warping) ---
+        // 增加扭曲力度，让山脉分布更不规则，模拟板块挤压的随机性
         float nx = static_cast<float>(hex.q + (hex.r >> 1)) / width;
         float ny = static_cast<float>(hex.r) / height;
 
@@ -131,34 +136,34 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
         float wx = nx + warp_noise.noise(nx * 2.5f, ny * 2.5f) * warp_strength;
         float wy = ny + warp_noise.noise(nx * 2.5f + 100.0f, ny * 2.5f + 100.0f) * warp_strength;
 
-        // --- 2. ϡĸ ---
+        // --- 2. 稀疏的各向异性生成 ---
 
-        //  Aں
-        // Ƶʽ 0.8 -> ɽ֮ľǳԶ
-        // ѹ 10.0 -> ״
+        // 组 A：倾向于横向延伸
+        // 频率降到 0.8 -> 山脉链之间的距离会非常远
+        // 压缩比 10.0 -> 保持条状
         float ridge_h = ridge_noise1.noise(wx * 0.8f + kOffsetX, wy * 10.0f + kOffsetY);
         ridge_h = 1.0f - std::abs(ridge_h - 0.5f) * 2.0f;
-        ridge_h = std::pow(ridge_h, 12.0f); // ϸ
+        ridge_h = std::pow(ridge_h, 12.0f); // 极细锐化
 
-        //  B
+        // 组 B：倾向于纵向延伸
         float ridge_v = ridge_noise2.noise(wx * 10.0f + kOffsetX + 500.0f, wy * 0.8f + kOffsetY + 500.0f);
         ridge_v = 1.0f - std::abs(ridge_v - 0.5f) * 2.0f;
         ridge_v = std::pow(ridge_v, 12.0f);
 
         float final_ridge = std::max(ridge_h, ridge_v);
 
-        // --- 3. ؼ (The "Breakup" Pass) ---
-        // һƵڵֵǿаɽĨ
-        // Ƶ 4.0 ζÿһξһ
+        // --- 3. 关键：打断连续性 (The "Breakup" Pass) ---
+        // 生成一个高频噪声，如果在低值区，就强行把山脉抹掉
+        // 频率 4.0 意味着每隔一段距离就切一刀
         float breakup = breakup_noise.noise(nx * 4.0f + kOffsetX, ny * 4.0f + kOffsetY);
 
-        // breakup < 0.4 ĵطɽᱻж
+        // breakup < 0.4 的地方山脉会被切断
         float breakup_mask = SmoothStep(0.35f, 0.55f, breakup);
 
         final_ridge *= breakup_mask;
 
-        // --- 4.  ---
-        // ȻĿհףֹɽ
+        // --- 4. 区域限制 ---
+        // 依然保留大区域的空白，防止满屏都是碎山
         float region_mask = continent_noise.noise(nx * 1.5f + kOffsetX, ny * 1.5f + kOffsetY);
         region_mask = SmoothStep(0.2f, 0.6f, region_mask);
 
@@ -166,13 +171,14 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  3ϸֵ (Thresholding)
+    // 步骤 3：严格阈值化 (Thresholding)
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::threshold");
     for (auto& pair : map_data) {
         if (!is_land[pair.first]) continue;
 
-        // ֵ趨0.18
-        //  pow(12) ʹ¶϶ϸ
+        // 阈值设定：0.18
+        // 配合 pow(12) 和打断噪声，这会留下断断续续的细线
         if (ridge_value_map[pair.first] > 0.18f) {
             pair.second.type = TerrainType::MOUNTAIN;
             pair.second.height = 0.85f + (static_cast<float>(dist_seed(gen)) / 10000.0f) * 0.15f;
@@ -180,13 +186,14 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  4̬ѧϸȥ (Morphological Cleaning)
+    // 步骤 4：形态学细化与去噪 (Morphological Cleaning)
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::cleanup");
     std::map<Hex, TerrainType> temp_types;
     for (auto& pair : map_data) temp_types[pair.first] = pair.second.type;
 
-    // --- һ֣ʴ (Erosion) ---
-    // ȥſ飬״
+    // --- 第一轮：腐蚀 (Erosion) ---
+    // 去除团块，保持条状
     for (auto& pair : map_data) {
         Hex hex = pair.first;
         if (pair.second.type == TerrainType::MOUNTAIN) {
@@ -197,7 +204,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 }
             }
 
-            //  >=5 ɽΧ˵ſģƽ
+            // 如果被 >=5 个山脉包围，说明它是团块的中心，变成平地
             if (mountain_neighbors >= 5) {
                 temp_types[hex] = TerrainType::GRASSLAND;
             }
@@ -205,8 +212,8 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
     for (auto& pair : map_data) pair.second.type = temp_types[pair.first];
 
-    // --- ڶ֣ȥµ (Despeckle) ---
-    // ΪҪɢɽҪӵ
+    // --- 第二轮：去孤点 (Despeckle) ---
+    // 因为我们要散开的山脉，但不要单个格子的噪点
     for (auto& pair : map_data) temp_types[pair.first] = pair.second.type;
 
     for (auto& pair : map_data) {
@@ -218,19 +225,20 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                     mountain_neighbors++;
                 }
             }
-            // ȫɾ
+            // 如果完全孤立，删掉
             if (mountain_neighbors == 0) {
                 temp_types[hex] = TerrainType::GRASSLAND;
             }
         }
-        // ע⣺Ҳϵ㡱ĲˣΪǡɢ
-        // Ѵ
+        // 注意：这次我不做“填补断点”的操作了，因为你的需求是“散开”
+        // 所以我们允许断裂存在
     }
     for (auto& pair : map_data) pair.second.type = temp_types[pair.first];
 
     // ========================================================================
-    //  5 (Climate: Moisture & Temperature)
+    // 步骤 5：生成气候 (Climate: Moisture & Temperature)
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::climate");
     for (auto& pair : map_data) {
         Hex hex = pair.first;
         TileData& tile = pair.second;
@@ -242,14 +250,14 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
         float nx = static_cast<float>(offset_q) / width;
         float ny = static_cast<float>(offset_r) / height;
 
-        // 1. ʪ
+        // 1. 湿度
         float moisture = climate_noise.octaveNoise(
             nx * 5.5f * 2.4f + kOffsetX + 500.0f,
             ny * 5.5f + kOffsetY + 500.0f,
             3, 0.5f
         );
 
-        // ɽ赲ЧӦ
+        // 山脉阻挡效应
         int mountain_neighbors = 0;
         for (const auto& n : GetNeighbors(hex)) {
             if (map_data.find(n) != map_data.end() && map_data[n].type == TerrainType::MOUNTAIN) {
@@ -260,7 +268,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
         moisture += 0.30f;
         moisture = std::max(0.0f, std::min(1.0f, moisture));
 
-        // 2. ¶
+        // 2. 温度
         float temperature = 1.0f - std::abs(ny - 0.5f) * 2.0f;
         temperature += climate_noise.octaveNoise(
             nx * 4.0f * 2.4f + kOffsetX,
@@ -272,7 +280,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
         tile.moisture = moisture;
         tile.temperature = temperature;
 
-        // 3. ȷò
+        // 3. 确定地貌
         if (temperature < 0.20f) {
             tile.type = (temperature < 0.10f) ? TerrainType::SNOW : TerrainType::TUNDRA;
         }
@@ -291,8 +299,9 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  6ɺ
+    // 步骤 6：生成海岸线
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::coast");
     std::queue<std::pair<Hex, int>> frontier;
     std::map<Hex, bool> visited;
 
@@ -335,8 +344,9 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  7ɺ
+    // 步骤 7：生成河流
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::rivers");
     std::vector<Hex> all_mountains;
     std::set<Hex> river_tiles;
 
@@ -404,7 +414,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
         }
     }
 
-    // Ч
+    // 河流效果
     for (const auto& river_hex : river_tiles) {
         if (map_data[river_hex].type == TerrainType::DESERT) map_data[river_hex].type = TerrainType::GRASSLAND;
         map_data[river_hex].moisture = std::min(1.0f, map_data[river_hex].moisture + 0.22f);
@@ -420,16 +430,17 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
     }
 
     // ========================================================================
-    //  8ʼβ
+    // 步骤 8：初始化地形产出
     // ========================================================================
+    PROFILE_NEXT_STAGE(stages, "MapGenerator::yields");
     for (auto& pair : map_data) {
         TileData& tile = pair.second;
 
-        // ݵͳʼ
-        // ؼɽûв
+        // 根据地形类型初始化产出
+        // 【关键】山脉和深海没有产出
         switch(tile.type) {
             case TerrainType::OCEAN:
-                // ûв
+                // 深海：没有产出
                 tile.food = 0;
                 tile.gold = 0;
                 tile.production = 0;
@@ -438,7 +449,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::COAST:
-                // ǳв
+                // 浅海：有产出
                 tile.food = 2;
                 tile.gold = 1;
                 tile.production = 0;
@@ -447,7 +458,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::DESERT:
-                // ɳĮ
+                // 沙漠：少量产出
                 tile.food = 0;
                 tile.gold = 1;
                 tile.production = 1;
@@ -456,7 +467,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::PLAINS:
-                // ƽԭ׼
+                // 平原：标准产出
                 tile.food = 2;
                 tile.gold = 1;
                 tile.production = 2;
@@ -465,7 +476,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::GRASSLAND:
-                // ԭʳḻ
+                // 草原：粮食丰富
                 tile.food = 3;
                 tile.gold = 0;
                 tile.production = 1;
@@ -474,7 +485,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::JUNGLE:
-                // ֣
+                // 雨林：多样化产出
                 tile.food = 2;
                 tile.gold = 0;
                 tile.production = 1;
@@ -483,7 +494,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::TUNDRA:
-                // ٲ
+                // 冻土：极少产出
                 tile.food = 1;
                 tile.gold = 0;
                 tile.production = 0;
@@ -492,7 +503,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::SNOW:
-                // ѩأûв
+                // 雪地：没有产出
                 tile.food = 0;
                 tile.gold = 0;
                 tile.production = 0;
@@ -501,7 +512,7 @@ std::map<Hex, TileData> MapGenerator::generate(int width, int height) {
                 break;
                 
             case TerrainType::MOUNTAIN:
-                // ɽûв
+                // 山脉：没有产出
                 tile.food = 0;
                 tile.gold = 0;
                 tile.production = 0;
@@ -1,6 +1,6 @@
 /*
-* ǵͼͷļ
-* 㲻Ӧ޸ļ
+* 这是地图生成器的头文件。
+* 你不应该修改这个文件。
 */
 
 #ifndef __MAP_GENERATOR_H__
@@ -13,7 +13,7 @@
 
 class MapGenerator {
 public:
-    // ̬ߣɵĵͼ
+    // 静态函数：输入宽高，返回生成的地图数据
     static std::map<Hex, TileData> generate(int width, int height);
 };
 
@@ -6,6 +6,8 @@
 #include "../Core/Player.h"
 #include "SelectionScene.h"
 #include "../Audio/MusicManager.h"
+#include "../Utils/ScopeProfiler.h"
+#include "../Utils/PerfCounters.h"
 
 USING_NS_CC;
 
@@ -16,18 +18,18 @@ Scene* GameScene::createScene() {
 bool GameScene::init() {
     if (!Scene::init()) return false;
 
-    CCLOG("GameScene::init() - ʼʼ");
+    CCLOG("GameScene::init() - 基本初始化开始");
 
-    // ֻĳʼ
+    // 只做最基本的场景初始化
     _dataInitialized = false;
     _graphicsInitialized = false;
-    _coverLayerCreated = false;  // ȷǲ״̬ȷ
+    _coverLayerCreated = false;  // 确保覆盖层状态正确
 
-    // ñɫɼ
+    // 设置背景颜色（立即可见，避免黑屏）
     auto bg = LayerColor::create(Color4B(50, 50, 70, 255));
     this->addChild(bg, -100);
 
-    CCLOG("GameScene::init() - ʼ");
+    CCLOG("GameScene::init() - 基本初始化完成");
     return true;
 }
 
@@ -38,13 +40,14 @@ bool GameScene::initGameData() {
 
     CCLOG("GameScene::initGameData() - start");
 
-    // 1. ʼϷ
+    // 1. 初始化游戏管理器
     m_gameManager = GameManager::getInstance();
 
     GameConfig config;
     config.maxTurns = 300;
     config.enableScienceVictory = true;
     config.enableDominationVictory = true;
+    config.quickAITurns = CivilizationSelectionScene::getQuickAITurns();
 
     if (!m_gameManager->initialize(config)) {
         CCLOG("Failed to initialize GameManager");
@@ -52,7 +55,7 @@ bool GameScene::initGameData() {
     }
     m_gameManager->setGameState(GameState::PLAYING);
 
-    // 2. 
+    // 2. 创建人类玩家
     CivilizationType playerCiv = CivilizationType::CHINA;
     if (CivilizationSelectionScene::getSelectedCivilization() != CivilizationType::BASIC) {
         playerCiv = CivilizationSelectionScene::getSelectedCivilization();
@@ -66,30 +69,30 @@ bool GameScene::initGameData() {
         CCLOG("Human player created with civilization: %d", static_cast<int>(playerCiv));
     }
 
-    // 3. AI - ʹѡе
+    // 3. 创建AI玩家 - 使用选择界面中的设置
     std::vector<AIPlayerSetting> aiSettings = CivilizationSelectionScene::getAIPlayerSettings();
     int aiPlayerCount = CivilizationSelectionScene::getAIPlayerCount();
 
     CCLOG("Creating %d AI players", aiPlayerCount);
 
-    // ʾ
+    // 如果设置数量不等于显示数量，重新生成
     if (aiSettings.size() != aiPlayerCount) {
         aiSettings.clear();
         std::vector<CivilizationType> availableCivs;
 
-        // ȡų
+        // 获取可用文明（排除玩家文明）
         if (playerCiv != CivilizationType::GERMANY) availableCivs.push_back(CivilizationType::GERMANY);
         if (playerCiv != CivilizationType::RUSSIA) availableCivs.push_back(CivilizationType::RUSSIA);
         if (playerCiv != CivilizationType::CHINA) availableCivs.push_back(CivilizationType::CHINA);
 
-        // ظ
+        // 如果可用文明不够，允许重复
         for (int i = 0; i < aiPlayerCount; i++) {
             CivilizationType civ;
             if (i < availableCivs.size()) {
                 civ = availableCivs[i];
             }
             else {
-                // ʹĬ
+                // 使用默认文明
                 civ = CivilizationType::GERMANY;
             }
 
@@ -98,7 +101,7 @@ bool GameScene::initGameData() {
         }
     }
 
-    // AI
+    // 创建AI玩家
     for (int i = 0; i < aiPlayerCount; i++) {
         Player* aiPlayer = Player::create(i + 1, aiSettings[i].civilization);
         if (aiPlayer) {
@@ -110,8 +113,8 @@ bool GameScene::initGameData() {
         }
     }
 
-    // ====================  ====================
-    // ѡŶӦı
+    // ==================== 播放文明音乐 ====================
+    // 根据玩家选择的文明播放对应的背景音乐
     MusicManager::getInstance()->playCivilizationMusic(playerCiv);
     CCLOG("Started playing civilization music for civ type: %d", static_cast<int>(playerCiv));
     // ======================================================
@@ -124,43 +127,43 @@ bool GameScene::initGameData() {
 bool GameScene::initGraphics() {
     if (_graphicsInitialized) return true;
 
-    CCLOG("GameScene::initGraphics() - ͼγʼʼ");
+    CCLOG("GameScene::initGraphics() - 图形初始化开始");
 
-    // ȷڸǲ洴Ϸ
+    // 确保在覆盖层下面创建游戏内容
     int zOrder = -1;
 
-    // 1. ͼ
+    // 1. 创建地图层
     _mapLayer = GameMapLayer::create();
     if (!_mapLayer) return false;
     this->addChild(_mapLayer, zOrder++);
-    CCLOG("ͼ㴴ɣzOrder: %d", zOrder - 1);
+    CCLOG("地图层创建完成，zOrder: %d", zOrder - 1);
 
-    // 2. 
+    // 2. 创建生产面板层
     _productionPanelLayer = CityProductionPanel::create();
     _productionPanelLayer->setVisible(false);
     this->addChild(_productionPanelLayer, zOrder++);
-    CCLOG("㴴ɣzOrder: %d", zOrder - 1);
+    CCLOG("生产面板层创建完成，zOrder: %d", zOrder - 1);
 
-    // 3. HUD
+    // 3. 创建HUD层
     _hudLayer = HUDLayer::create();
     if (!_hudLayer) return false;
     this->addChild(_hudLayer, zOrder++);
-    CCLOG("HUD㴴ɣzOrder: %d", zOrder - 1);
+    CCLOG("HUD层创建完成，zOrder: %d", zOrder - 1);
 
     
-    // 4. HUDʹҵϵͳʵ
+    // 4. 设置HUD层使用人类玩家的系统实例
     if (m_humanPlayer) {
         _hudLayer->setTechTree(m_humanPlayer->getTechTree());
         _hudLayer->setCultureTree(m_humanPlayer->getCultureTree());
         _hudLayer->setPolicyManager(m_humanPlayer->getPolicyManager());
-        CCLOG("HUDLayer");
+        CCLOG("HUDLayer设置完成");
     }
 
-    // 5. ûص
+    // 5. 设置回调
     setupCallbacks();
-    CCLOG("ص");
+    CCLOG("回调设置完成");
 
-    // 6. Ϸص
+    // 6. 设置游戏管理器回调
     if (m_gameManager) {
         m_gameManager->setOnTurnStartCallback([this](int playerId) {
             Player* currentPlayer = m_gameManager->getPlayer(playerId);
@@ -168,17 +171,17 @@ bool GameScene::initGraphics() {
 
             bool isHuman = currentPlayer->getIsHuman();
 
-            // ޸ Aʲôʱʼ»غϣUI ͬť״̬
+            // 【核心修复 A】：无论什么时候开始新回合，UI 必须同步按钮状态
             if (_hudLayer) {
                 _hudLayer->setNextTurnButtonEnabled(isHuman);
 
                 if (isHuman) {
-                    // ֵࣺͬϵͳ
+                    // 轮到人类：同步所有系统引用
                     _hudLayer->setTechTree(currentPlayer->getTechTree());
                     _hudLayer->setCultureTree(currentPlayer->getCultureTree());
                     _hudLayer->setPolicyManager(currentPlayer->getPolicyManager());
 
-                    // ˢԴ UI 
+                    // 刷新资源 UI 顶部栏
                     _hudLayer->updateResources(
                         currentPlayer->getGold(),
                         currentPlayer->getSciencePerTurn(),
@@ -194,80 +197,80 @@ bool GameScene::initGraphics() {
             });
     }
 
-    CCLOG("GameScene::initGraphics() - ͼγʼ");
+    CCLOG("GameScene::initGraphics() - 图形初始化完成");
     _graphicsInitialized = true;
 
-    // ϷѭȸǲƳٿʼϷ߼
+    // 启动游戏循环（但等覆盖层移除后再开始真正的游戏逻辑）
     this->scheduleUpdate();
-    CCLOG("Ϸѭ");
+    CCLOG("游戏循环已启动");
 
     return true;
 }
 
 void GameScene::createCoverLayer() {
     if (_coverLayerCreated) {
-        CCLOG("ǲѴڣ");
+        CCLOG("覆盖层已存在，跳过创建");
         return;
     }
 
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 center = Vec2(visibleSize.width / 2, visibleSize.height / 2);
 
-    // 1. ǲ㱳 - ȷĻģʽ
+    // 1. 创建覆盖层背景 - 设置正确的混合模式
     _coverLayer = LayerColor::create(Color4B(25, 25, 35, 255));
     _coverLayer->setContentSize(visibleSize);
     _coverLayer->setOpacity(255);
 
-    // ؼûģʽ֧͸ȱ仯
+    // 关键：设置混合模式，支持透明度变化
     _coverLayer->setBlendFunc(BlendFunc::ALPHA_PREMULTIPLIED);
-    // ʹñ׼ģʽ
+    // 或者使用标准混合模式
     // _coverLayer->setBlendFunc(BlendFunc::ALPHA_NON_PREMULTIPLIED);
 
-    this->addChild(_coverLayer, 9999); // 
+    this->addChild(_coverLayer, 9999); // 放在最顶层
 
-    // 2. һڵиǲUIԪ
+    // 2. 创建一个容器节点来包裹所有覆盖层UI元素
     auto uiContainer = Node::create();
     uiContainer->setContentSize(visibleSize);
     uiContainer->setPosition(0, 0);
     _coverLayer->addChild(uiContainer, 1);
 
-    // 
+    // 保存容器引用
     _coverContainer = uiContainer;
 
-    // 3. UIԪӵ
-    // ϷLogo
+    // 3. 将所有UI元素添加到容器中
+    // 游戏Logo
     _coverTitleLabel = Label::createWithSystemFont("CIVILIZATION VI", "Georgia", 60);
     _coverTitleLabel->setPosition(center.x, visibleSize.height - 150);
     _coverTitleLabel->setColor(Color3B(220, 200, 120));
     _coverTitleLabel->enableShadow(Color4B::BLACK, Size(2, -2), 2);
     uiContainer->addChild(_coverTitleLabel);
 
-    // ʾ
+    // 加载提示
     _coverSubtitleLabel = Label::createWithSystemFont("Generating World...", "Arial", 30);
     _coverSubtitleLabel->setPosition(center.x, center.y + 50);
     _coverSubtitleLabel->setColor(Color3B(200, 200, 200));
     uiContainer->addChild(_coverSubtitleLabel);
 
-    // 
+    // 进度条背景
     auto progressBg = LayerColor::create(Color4B(50, 50, 60, 255));
     progressBg->setContentSize(Size(400, 20));
     progressBg->setPosition(center.x - 200, center.y - 10);
     _coverLayer->addChild(progressBg);
 
-    // ǰʹLayerColor򵥣
+    // 进度条前景（使用LayerColor，更简单）
     _coverProgressBarForeground = LayerColor::create(Color4B(80, 160, 240, 255));
-    _coverProgressBarForeground->setContentSize(Size(0, 20)); // ʼΪ0
+    _coverProgressBarForeground->setContentSize(Size(0, 20)); // 初始宽度为0
     _coverProgressBarForeground->setPosition(center.x - 200, center.y - 10);
     _coverProgressBarForeground->setAnchorPoint(Vec2(0, 0));
     _coverLayer->addChild(_coverProgressBarForeground);
 
-    // ̬ı
+    // 动态加载文本
     _coverLoadingLabel = Label::createWithSystemFont("Finalizing game initialization...", "Arial", 22);
     _coverLoadingLabel->setPosition(center.x, center.y - 50);
     _coverLoadingLabel->setColor(Color3B(180, 180, 200));
     uiContainer->addChild(_coverLoadingLabel);
 
-    // Сʾѡһ
+    // 小提示（随机选择一条）
     const char* tips[] = {
         "A civilization's greatness is measured by its cities.",
         "Science leads to progress, culture to enlightenment.",
@@ -284,14 +287,14 @@ void GameScene::createCoverLayer() {
     _coverTipLabel->setOpacity(200);
     uiContainer->addChild(_coverTipLabel);
 
-    // 汾Ϣ
+    // 版本信息
     _coverVersionLabel = Label::createWithSystemFont("v1.0.0 | Civilization Lite", "Arial", 16);
     _coverVersionLabel->setPosition(center.x, 40);
     _coverVersionLabel->setColor(Color3B(120, 120, 140));
     uiContainer->addChild(_coverVersionLabel);
 
     _coverLayerCreated = true;
-    CCLOG("GameSceneǲ㴴");
+    CCLOG("GameScene覆盖层创建完成");
 }
 
 void GameScene::updateCoverProgress(float progress) {
@@ -303,26 +306,26 @@ void GameScene::updateCoverProgress(float progress) {
 
 void GameScene::removeCoverLayer(float fadeTime) {
     if (!_coverLayerCreated || !_coverLayer) {
-        CCLOG("ǲ㲻ڻƳ");
+        CCLOG("覆盖层不存在或已移除，跳过");
         return;
     }
 
-    CCLOG("ʼƳGameSceneǲ㣬ʱ䣺%.2f", fadeTime);
+    CCLOG("开始移除GameScene覆盖层，淡出时间：%.2f秒", fadeTime);
 
-    // 1ȿٵ
+    // 步骤1：进度条先快速淡出
     if (_coverProgressBar) {
-        auto progressFadeOut = FadeOut::create(0.2f); // ٵ
+        auto progressFadeOut = FadeOut::create(0.2f); // 进度条快速淡出
         auto removeProgress = CallFunc::create([this]() {
             if (_coverProgressBar) {
                 _coverProgressBar->removeFromParent();
                 _coverProgressBar = nullptr;
-                CCLOG("ѵƳ");
+                CCLOG("进度条已淡出移除");
             }
             });
         _coverProgressBar->runAction(Sequence::create(progressFadeOut, removeProgress, nullptr));
     }
 
-    // ͬʱƳ򵭳
+    // 同时移除或淡出进度条背景
     if (_coverContainer) {
         auto progressBg = _coverContainer->getChildByName("progress_bg");
         if (progressBg) {
@@ -331,8 +334,8 @@ void GameScene::removeCoverLayer(float fadeTime) {
         }
     }
 
-    // 2ȴɺ嵭
-    auto delay = DelayTime::create(0.25f); // Գһ㣬ȷ
+    // 步骤2：等待进度条淡出完成后，整体淡出
+    auto delay = DelayTime::create(0.25f); // 稍长一点，确保进度条淡出完成
 
     auto fadeOut = FadeOut::create(fadeTime);
     auto remove = CallFunc::create([this]() {
@@ -341,7 +344,7 @@ void GameScene::removeCoverLayer(float fadeTime) {
             _coverLayer = nullptr;
             _coverContainer = nullptr;
 
-            // ӽڵ
+            // 清除所有子节点引用
             _coverTitleLabel = nullptr;
             _coverSubtitleLabel = nullptr;
             _coverLoadingLabel = nullptr;
@@ -349,7 +352,7 @@ void GameScene::removeCoverLayer(float fadeTime) {
             _coverVersionLabel = nullptr;
 
             _coverLayerCreated = false;
-            CCLOG("ǲȫƳ");
+            CCLOG("覆盖层已完全移除");
         }
         });
 
@@ -357,20 +360,20 @@ void GameScene::removeCoverLayer(float fadeTime) {
 }
 
 void GameScene::onEnter() {
-    CCLOG("========== GameScene::onEnter() ʼ ==========");
+    CCLOG("========== GameScene::onEnter() 开始 ==========");
 
     Scene::onEnter();
 
-    // ǲ
+    // 创建覆盖层
     createCoverLayer();
 
-    // ʹóԱٽȣǾֲ
-    // ƳɵĽ߼ʹµ״̬
+    // 使用成员变量来跟踪进度，而不是局部变量
+    // 移除旧的进度逻辑，使用新的状态机方法
 
-    // ״̬
+    // 进度状态
     struct {
         float progress = 0.0f;
-        float progressSpeed = 40.0f; // ÿ40%Լ2.5
+        float progressSpeed = 40.0f; // 每秒增加40%，约2.5秒完成
         bool dataInitializing = false;
         bool graphicsInitializing = false;
         bool dataInitialized = false;
@@ -379,43 +382,43 @@ void GameScene::onEnter() {
 
     loadingState.progress = 0.0f;
 
-    // ÿ֡¼״̬
+    // 每帧更新加载状态
     this->schedule([this, loadingState](float dt) mutable {
         if (!_coverLayerCreated || !_coverLayer) {
-            CCLOG("ǲ㲻ڣֹͣ");
+            CCLOG("覆盖层不存在，停止更新");
             this->unschedule("loading_update");
             return;
         }
 
-        // ½
+        // 更新进度
         loadingState.progress += loadingState.progressSpeed * dt;
         if (loadingState.progress > 100.0f) loadingState.progress = 100.0f;
 
-        CCLOG("ǰ: %.1f%%", loadingState.progress);
+        CCLOG("当前进度: %.1f%%", loadingState.progress);
 
-        // ½£ƽ
+        // 更新进度条（立即更新，不平滑）
         if (_coverProgressBar) {
             _coverProgressBar->setPercentage(loadingState.progress);
         }
         updateCoverProgress(loadingState.progress);
 
-        // ݽȸ¼ı
+        // 根据进度更新加载文本
         if (_coverLoadingLabel) {
             if (loadingState.progress < 25.0f) {
                 _coverLoadingLabel->setString("Initializing game systems...");
 
-                // ڵͽȽ׶ξͿʼݳʼUI߳
+                // 在低进度阶段就开始数据初始化（但不在UI线程阻塞）
                 if (!loadingState.dataInitializing && !_dataInitialized) {
                     loadingState.dataInitializing = true;
-                    CCLOG("ʼݳʼ...");
+                    CCLOG("开始数据初始化...");
 
-                    // һִ֡гʼUI
+                    // 在下一帧执行初始化，避免阻塞UI更新
                     Director::getInstance()->getScheduler()->performFunctionInCocosThread([this]() {
                         if (initGameData()) {
-                            CCLOG("ݳʼ");
+                            CCLOG("数据初始化完成");
                         }
                         else {
-                            CCLOG("ݳʼʧ");
+                            CCLOG("数据初始化失败");
                         }
                         });
                 }
@@ -426,19 +429,19 @@ void GameScene::onEnter() {
             else if (loadingState.progress < 75.0f) {
                 _coverLoadingLabel->setString("Generating world map...");
 
-                // ʼͼγʼ
+                // 开始图形初始化
                 if (!loadingState.graphicsInitializing && !_graphicsInitialized) {
                     loadingState.graphicsInitializing = true;
-                    CCLOG("ʼͼγʼ...");
+                    CCLOG("开始图形初始化...");
 
-                    // ȷݳʼ
+                    // 确保数据初始化已完成
                     if (_dataInitialized) {
                         Director::getInstance()->getScheduler()->performFunctionInCocosThread([this]() {
                             if (initGraphics()) {
-                                CCLOG("ͼγʼ");
+                                CCLOG("图形初始化完成");
                             }
                             else {
-                                CCLOG("ͼγʼʧ");
+                                CCLOG("图形初始化失败");
                             }
                             });
                     }
@@ -447,26 +450,26 @@ void GameScene::onEnter() {
             else {
                 _coverLoadingLabel->setString("Finalizing game state...");
 
-                // ȴгʼ
+                // 等待所有初始化完成
                 if (_dataInitialized && _graphicsInitialized && loadingState.progress >= 100.0f) {
                     this->unschedule("loading_update");
 
-                    // ٸһνȵ100%
+                    // 最后再更新一次进度到100%
                     if (_coverProgressBar) {
                         _coverProgressBar->setPercentage(100.0f);
                     }
 
-                    CCLOG("гʼɣ׼Ƴǲ");
+                    CCLOG("所有初始化完成，准备移除覆盖层");
 
-                    // ӳ0.5Ƴǲ
+                    // 延迟0.5秒后移除覆盖层
                     this->scheduleOnce([this](float dt) {
                         removeCoverLayer(0.8f);
-                        CCLOG("========== GameSceneʼɣǲƳ ==========");
+                        CCLOG("========== GameScene初始化完成，覆盖层已移除 ==========");
 
-                        //// ȷϷѭ
+                        //// 确保游戏循环已启动
                         //if (!this->isScheduled(schedule_selector(GameScene::update))) {
                         //    this->scheduleUpdate();
-                        //    CCLOG("Ϸѭ");
+                        //    CCLOG("游戏循环已启动");
                         //}
                         }, 0.5f, "remove_cover_delay");
                 }
@@ -476,18 +479,31 @@ void GameScene::onEnter() {
         }, 0.016f, CC_REPEAT_FOREVER, 0.0f, "loading_update");
 }
 
+void GameScene::update(float dt) {
+    uint64_t startNs = ScopeProfiler::nowNs();
+
+    // 派发本帧积累的延迟/合并事件
+    EventBus::getInstance()->dispatchDeferred();
+
+    PerfCounters::getInstance()->setGameUpdateNs(ScopeProfiler::nowNs() - startNs);
+}
+
 void GameScene::onExit() {
     CCLOG("GameScene onExit called");
 
-    // ڵؿѡģʽ£ȡ
+    // 如果在地块选择模式下，取消它
     if (_mapLayer && _mapLayer->isSelectingTile()) {
-        cancelTileSelection(false);  // صΪ˳
+        cancelTileSelection(false);  // 不触发回调，因为场景正在退出
     }
 
-    // ֹͣϷѭ
+    // 停止游戏循环
     this->unscheduleUpdate();
 
-    // Ϸ
+    // 注销事件总线监听
+    EventBus::getInstance()->unsubscribe<PlayerResourceEvent>(_resourceListenerId);
+    _resourceListenerId = 0;
+
+    // 清理游戏管理器
     if (m_gameManager) {
         m_gameManager->cleanup();
     }
@@ -495,25 +511,25 @@ void GameScene::onExit() {
     Scene::onExit();
 }
 
-// ЩֻҪʼҵϵͳ
+// 这些函数现在只需要初始化玩家的系统
 void GameScene::initTechTree() {
-    // PlayerﲻҪκ
+    // 现在由Player管理，这里不需要做任何事
     CCLOG("Note: TechTree is now managed by Player class");
 }
 
 void GameScene::initCultureTree() {
-    // Player
+    // 现在由Player管理
     CCLOG("Note: CultureTree is now managed by Player class");
 }
 
 void GameScene::initPolicySystem() {
-    // Player
+    // 现在由Player管理
     CCLOG("Note: Policy system is now managed by Player class");
 }
 
 void GameScene::setupCallbacks() {
 
-    // ͼѡеλ -> HUDʾ
+    // 地图层选中单位 -> 更新HUD显示
     _mapLayer->setOnUnitSelectedCallback([this](AbstractUnit* unit) {
         if (unit) {
             _hudLayer->showUnitInfo(unit);
@@ -523,69 +539,69 @@ void GameScene::setupCallbacks() {
         }
         });
 
-    // HUDǰť -> ִнǡذťʾ
+    // HUD建城按钮 -> 执行建城、隐藏按钮、显示生产面板
     _hudLayer->setBuildCityCallback([this]() {
         CCLOG("GameScene: Received Build City Request");
 
-        // 1. ִеͼĽ߼ģ͡Ŀߣ
+        // 1. 执行地图层的建城逻辑（创建城市模型、消耗开拓者）
         _mapLayer->onBuildCityAction();
 
-        // 2. ֪ͨ HUD صλϢ Found City ť
+        // 2. 立即通知 HUD 隐藏单位信息（包含 Found City 按钮）
         _hudLayer->hideUnitInfo();
 
-        // 3. ʾ壨6񣺽ǺҲťӦÿɼ
+        // 3. 激活并显示生产面板（文明6风格：建城后右侧面板呼出按钮应该可见）
         if (_productionPanelLayer) {
             _productionPanelLayer->setVisible(true);
             CCLOG("GameScene: City Production Panel is now visible");
         }
         });
 
-    // һغϰťص
+    // 下一回合按钮回调
     _hudLayer->setNextTurnCallback([this]() {
-        // 1. ȡǰ
+        // 1. 获取当前玩家
         Player* currentPlayer = m_gameManager->getCurrentPlayer();
         if (!currentPlayer) return;
 
-        //  AI Ļغ
+        // 如果是 AI 的回合
         if (!currentPlayer->getIsHuman()) {
             CCLOG("HUD: Ignoring click - AI Player %d is thinking.", currentPlayer->getPlayerId());
             return;
         }
 
-        // 2. ߼߼
+        // 2. 决策检查逻辑
         bool foundSpecificDecision = false;
         int pid = currentPlayer->getPlayerId();
 
-        // ǷйĴ
+        // 检查是否有挂起的待办事项
         if (m_gameManager->hasPendingDecisions(pid)) {
 
-            //ȼƼ
+            //优先检查科技
             if (currentPlayer->getCurrentResearchTechId() == -1) {
                 auto techTree = currentPlayer->getTechTree();
-                if (techTree && !techTree->getResearchableTechList().empty()) {
+                if (techTree && techTree->hasResearchableTech()) {
                     CCLOG("Decision blocked: Opening Tech Tree.");
                     _hudLayer->openTechTree();
                     foundSpecificDecision = true;
                 }
             }
 
-            // Ļ
+            // 检查文化
             if (!foundSpecificDecision && currentPlayer->getCurrentResearchCivicId() == -1) {
                 auto cultureTree = currentPlayer->getCultureTree();
-                if (cultureTree && !cultureTree->getUnlockableCultureList().empty()) {
+                if (cultureTree && cultureTree->hasUnlockableCulture()) {
                     CCLOG("Decision blocked: Opening Culture Tree.");
                     _hudLayer->openCultureTree();
                     foundSpecificDecision = true;
                 }
             }
 
-            // 
+            // 检查城市生产
             if (!foundSpecificDecision) {
                 for (auto city : currentPlayer->getCities()) {
                     if (city->getCurrentProduction() == nullptr) {
                         CCLOG("Decision blocked: City %s needs production.", city->getCityName().c_str());
 
-                        // Զѡóв
+                        // 自动选择该城市并打开生产面板
                         _productionPanelLayer->setVisible(true);
                         this->updateProductionPanel(pid, city);
                         _mapLayer->updateSelection(city->gridPos);
@@ -597,22 +613,22 @@ void GameScene::setupCallbacks() {
             }
         }
 
-        // 3. ִлغл
+        // 3. 执行回合切换
         if (!foundSpecificDecision) {
             CCLOG("Decision Check Passed. Player %d ending turn.", pid);
 
-            // A. رпܸŵ UI 
+            // A. 立即关闭所有可能干扰的 UI 面板
             _productionPanelLayer->setVisible(false);
 
-            // B. ðťֹظֱΪ AI BUSY
+            // B. 禁用按钮防止重复点击，文字变为 AI BUSY
             _hudLayer->setNextTurnButtonEnabled(false);
 
-            // C. ֪ͨ߼غ
-            // ⽫ AI ˳ִУֱֵһ
+            // C. 通知逻辑层结束回合
+            // 这将触发所有 AI 的顺序执行，直到轮到下一个人类玩家
             m_gameManager->endTurn();
         }
         else {
-            // ΪûأȷťȻ
+            // 如果是因为有事没做被拦截，确保按钮依然是亮的
             _hudLayer->setNextTurnButtonEnabled(true);
             CCLOG("Human decision required before ending turn.");
         }
@@ -636,30 +652,39 @@ void GameScene::setupCallbacks() {
 
         });
 
-    // Դ¼
-    auto resourceListener = cocos2d::EventListenerCustom::create(
-        "player_turn_resource_update",
-        [this](cocos2d::EventCustom* event) {
-            ValueMap* data = static_cast<ValueMap*>(event->getUserData());
-            if (data) {
-                int playerId = data->at("player_id").asInt();
-                Player* player = m_gameManager->getPlayer(playerId);
-                if (player && player->getIsHuman()) {
-                    // HUDʾ
-                    _hudLayer->updateResources(
-                        player->getGold(),
-                        player->getSciencePerTurn(),
-                        player->getCulturePerTurn(),
-                        data->at("turn").asInt()
-                    );
-
-                    // ¿Ƽ/ĻĽʾ
-                    _hudLayer->updateSciencePerTurn(player->getSciencePerTurn());
-                    _hudLayer->updateCulturePerTurn(player->getCulturePerTurn());
-                }
+#if CIV_PROFILER_ENABLED
+    // F9：导出性能记录为 Chrome trace JSON
+    auto keyboardListener = EventListenerKeyboard::create();
+    keyboardListener->onKeyPressed = [](EventKeyboard::KeyCode keyCode, Event* event) {
+        if (keyCode == EventKeyboard::KeyCode::KEY_F9) {
+            std::string path = FileUtils::getInstance()->getWritablePath() +
+                "civ_trace_" + std::to_string(time(nullptr)) + ".json";
+            bool ok = ScopeProfiler::getInstance()->dumpChromeTrace(path);
+            CCLOG("Profiler trace %s: %s", ok ? "written" : "failed", path.c_str());
+        }
+        };
+    this->getEventDispatcher()->addEventListenerWithSceneGraphPriority(keyboardListener, this);
+#endif
+
+    // 添加资源更新事件监听（快照在每帧 update 中合并派发）
+    EventBus::getInstance()->unsubscribe<PlayerResourceEvent>(_resourceListenerId);
+    _resourceListenerId = EventBus::getInstance()->subscribe<PlayerResourceEvent>(
+        [this](const PlayerResourceEvent& event) {
+            Player* player = m_gameManager->getPlayer(event.playerId);
+            if (player && player->getIsHuman() && _hudLayer) {
+                // 更新HUD显示
+                _hudLayer->updateResources(
+                    event.gold,
+                    event.sciencePerTurn,
+                    event.culturePerTurn,
+                    m_gameManager->getGameStats().currentTurn
+                );
+
+                // 更新科技树/文化树的进度显示
+                _hudLayer->updateSciencePerTurn(event.sciencePerTurn);
+                _hudLayer->updateCulturePerTurn(event.culturePerTurn);
             }
         });
-    this->getEventDispatcher()->addEventListenerWithSceneGraphPriority(resourceListener, this);
 }
 
 Player* GameScene::getCurrentPlayer() const {
@@ -671,38 +696,34 @@ TileData GameScene::getTileData(Hex h) { return _mapLayer->getTileData(h); }
 void GameScene::updateProductionPanel(int playerID, BaseCity* currentCity)
 {
     Player* currentPlayer = GameManager::getInstance()->getPlayer(playerID);
-    std::vector<ProductionProgram*> districts;
-    std::vector<ProductionProgram*> buildings;
-    std::vector<ProductionProgram*> units;
-    currentPlayer->getUnlockedProduction(units, districts, buildings);
-    std::vector<ProductionProgram*> programs[3] = { districts, buildings, units };
-    this->_productionPanelLayer->updateProductionPanel(playerID, currentCity, programs);
+    this->_productionPanelLayer->updateProductionPanel(playerID, currentCity,
+        currentPlayer->getUnlockedDistricts(), currentPlayer->getUnlockedBuildings(), currentPlayer->getUnlockedUnits());
 }
 
-// ʵ selectTileFromOptions 
+// 实现 selectTileFromOptions 函数
 Hex GameScene::selectTileFromOptions(const std::vector<Hex>& allowedTiles) {
-    // ע⣺ѡ첽ģҪûҪʹûصȴ
-    // ﷵһĬֵʵѡͨص
+    // 注意：由于选择是异步的（需要用户点击），我们需要使用回调或等待机制
+    // 这里返回一个默认值，实际选择通过回调处理
     CCLOG("selectTileFromOptions called with %zu allowed tiles", allowedTiles.size());
 
     if (!allowedTiles.empty()) {
-        return allowedTiles[0]; // صһΪĬֵ
+        return allowedTiles[0]; // 返回第一个作为默认值
     }
 
-    return Hex(0, 0); // ĬϷֵ
+    return Hex(0, 0); // 默认返回值
 }
 
-// ʵ setTileSelectionCallback 
+// 实现 setTileSelectionCallback 函数
 void GameScene::setTileSelectionCallback(const std::function<void(Hex)>& callback,
     const std::function<void()>& cancelCallback) {
     if (_mapLayer) {
-        // ʹе selectTile ѡ
-        _mapLayer->enableTileSelection({}, callback, cancelCallback); // ʾеؿ鶼ѡ
+        // 使用已有的 selectTile 函数启动选择
+        _mapLayer->enableTileSelection({}, callback, cancelCallback); // 空数组表示所有地块都可选
     }
 }
 
 
-// ʵ cancelTileSelection 
+// 实现 cancelTileSelection 函数
 void GameScene::cancelTileSelection(bool triggerCallback) {
     if (_mapLayer && _mapLayer->isSelectingTile()) {
         _mapLayer->cancelTileSelection(triggerCallback);
@@ -719,31 +740,26 @@ bool GameScene::isTileOccupied(Hex h)
     {
         for (auto city : player->getCities())
         {
-            for (auto& tile : city->territory)
-            {
-                if (h == tile)
-                {
-                    return true;
-                }
-            }
+            if (city->ownsTile(h))
+                return true;
         }
     }
     return false;
 }
 
 
-// ޸е selectTileAsync ֧ȡص
+// 修改现有的 selectTileAsync 函数，支持取消回调
 void GameScene::selectTileAsync(const std::vector<Hex>& allowedTiles,
     const std::function<void(Hex)>& selectionCallback,
     const std::function<void()>& cancelCallback) {
     if (_mapLayer) {
 
-        // ѡģʽȡص
+        // 启用选择模式，传入取消回调
         _mapLayer->enableTileSelection(allowedTiles, selectionCallback, cancelCallback);
     }
     else {
         if (cancelCallback) {
-            cancelCallback();  // ͼ㲻ڣֱӵȡص
+            cancelCallback();  // 如果地图层不存在，直接调用取消回调
         }
     }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Utils/HexUtils.h"
 #include "City/BaseCity.h"
 #include "SelectionScene.h"
+#include "Utils/EventBus.h"
 
 USING_NS_CC;
 
@@ -27,21 +28,22 @@ public:
 
     static cocos2d::Scene* createScene();
     virtual bool init();
-    virtual void onEnter() override;  // ҪдonEnter
+    virtual void onEnter() override;  // 重要：重写onEnter
 
-    // ĳʼ
-    bool initGameData();      // ʼϷݣLoadingSceneеã
-    bool initGraphics();      // ʼͼΣڳ뵼ݺã
+    // 分离的初始化函数
+    bool initGameData();      // 初始化游戏数据（可以在LoadingScene中调用）
+    bool initGraphics();      // 初始化图形（必须在场景进入导演后调用）
 
-    // ǲ
-    void createCoverLayer();          // ǲ㣨LoadingSceneһ
-    void updateCoverProgress(float progress); // ¸ǲ
-    void removeCoverLayer(float fadeTime = 0.5f); // Ƴǲ
+    // 覆盖层相关
+    void createCoverLayer();          // 创建覆盖层（与LoadingScene一样）
+    void updateCoverProgress(float progress); // 更新覆盖层进度
+    void removeCoverLayer(float fadeTime = 0.5f); // 移除覆盖层
 
     virtual void onExit() override;
+    virtual void update(float dt) override;
     TileData getTileData(Hex h);
     void updateProductionPanel(int playerID, BaseCity* currentCity);
-    // ӻȡǰҵķ
+    // 添加获取当前玩家的方法
     Player* getCurrentPlayer() const;
 
     Hex selectTileFromOptions(const std::vector<Hex>& allowedTiles);
@@ -50,10 +52,10 @@ public:
 
     GameMapLayer* getMapLayer() const { return _mapLayer;};
     /**
-     * @brief ȡǰĵؿѡ
-     * @param triggerCallback Ƿ񴥷ȡص
+     * @brief 取消当前的地块选择操作
+     * @param triggerCallback 是否触发取消回调
      *
-     * ҸıҪжѡʱ
+     * 当玩家改变主意或需要中断选择时调用
      */
     void cancelTileSelection(bool triggerCallback = true);
     bool isTileOccupied(Hex h);
@@ -72,27 +74,28 @@ private:
     void initPolicySystem();
     void setupCallbacks();
 
-    cocos2d::Camera* _uiCamera; // UIԱ
+    cocos2d::Camera* _uiCamera; // 添加UI摄像机成员
 
     GameManager* m_gameManager;
     Player* m_humanPlayer;
     HUDLayer* _hudLayer;
     GameMapLayer* _mapLayer;
     CityProductionPanel* _productionPanelLayer;
+    EventBus::ListenerId _resourceListenerId = 0;   // 玩家资源快照监听
 
-    bool _dataInitialized;    // Ƿѳʼ
-    bool _graphicsInitialized; // ͼǷѳʼ
+    bool _dataInitialized;    // 数据是否已初始化
+    bool _graphicsInitialized; // 图形是否已初始化
 
-    // ǲسԱ
-    cocos2d::LayerColor* _coverLayer;          // ǲ㱳
-    cocos2d::Label* _coverTitleLabel;          // 
-    cocos2d::Label* _coverSubtitleLabel;       // 
-    cocos2d::ProgressTimer* _coverProgressBar; // 
-    cocos2d::Label* _coverLoadingLabel;        // ı
-    cocos2d::Label* _coverTipLabel;            // ʾı
-    cocos2d::Label* _coverVersionLabel;        // 汾Ϣ
+    // 覆盖层相关成员
+    cocos2d::LayerColor* _coverLayer;          // 覆盖层背景
+    cocos2d::Label* _coverTitleLabel;          // 标题
+    cocos2d::Label* _coverSubtitleLabel;       // 副标题
+    cocos2d::ProgressTimer* _coverProgressBar; // 进度条
+    cocos2d::Label* _coverLoadingLabel;        // 加载文本
+    cocos2d::Label* _coverTipLabel;            // 提示文本
+    cocos2d::Label* _coverVersionLabel;        // 版本信息
 
-    bool _coverLayerCreated;                    // ǲǷѴ
+    bool _coverLayerCreated;                    // 覆盖层是否已创建
     Node* _coverContainer;
     LayerColor* _coverProgressBarForeground;
 
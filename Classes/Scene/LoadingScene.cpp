@@ -1,4 +1,4 @@
-// LoadingScene.cpp - ޸汾
+// LoadingScene.cpp - 修复版本
 #include "LoadingScene.h"
 #include "GameScene.h"
 #include "Map/GameMapLayer.h"
@@ -21,30 +21,30 @@ bool LoadingScene::init() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 center = Vec2(visibleSize.width / 2, visibleSize.height / 2);
 
-    // 1. ɫ
+    // 1. 深色背景
     auto bg = LayerColor::create(Color4B(25, 25, 35, 255));
     this->addChild(bg);
 
-    // 2. ϷLogo
+    // 2. 游戏Logo
     auto title = Label::createWithSystemFont("CIVILIZATION VI", "Georgia", 60);
     title->setPosition(center.x, visibleSize.height - 150);
     title->setColor(Color3B(220, 200, 120));
     title->enableShadow(Color4B::BLACK, Size(2, -2), 2);
     this->addChild(title);
 
-    // 3. ʾ
+    // 3. 加载提示
     auto subtitle = Label::createWithSystemFont("Generating World...", "Arial", 30);
     subtitle->setPosition(center.x, center.y + 50);
     subtitle->setColor(Color3B(200, 200, 200));
     this->addChild(subtitle);
 
-    // 4. 
+    // 4. 进度条背景
     auto progressBg = LayerColor::create(Color4B(50, 50, 60, 255));
     progressBg->setContentSize(Size(400, 20));
     progressBg->setPosition(center.x - 200, center.y - 10);
     this->addChild(progressBg);
 
-    // 5. 
+    // 5. 进度条
     _progressBar = ProgressTimer::create(Sprite::create());
     _progressBar->setType(ProgressTimer::Type::BAR);
     _progressBar->setMidpoint(Vec2(0, 0));
@@ -55,13 +55,13 @@ bool LoadingScene::init() {
     _progressBar->setPosition(center.x - 200, center.y - 10);
     this->addChild(_progressBar);
 
-    // 6. ̬ı
+    // 6. 动态加载文本
     _loadingLabel = Label::createWithSystemFont("Initializing game systems...", "Arial", 22);
     _loadingLabel->setPosition(center.x, center.y - 50);
     _loadingLabel->setColor(Color3B(180, 180, 200));
     this->addChild(_loadingLabel);
 
-    // 7. Сʾ
+    // 7. 小提示
     const char* tips[] = {
         "A civilization's greatness is measured by its cities.",
         "Science leads to progress, culture to enlightenment.",
@@ -78,26 +78,26 @@ bool LoadingScene::init() {
     tipLabel->setOpacity(200);
     this->addChild(tipLabel);
 
-    // 8. 汾Ϣ
+    // 8. 版本信息
     auto versionLabel = Label::createWithSystemFont("v1.0.0 | Civilization Lite", "Arial", 16);
     versionLabel->setPosition(center.x, 40);
     versionLabel->setColor(Color3B(120, 120, 140));
     this->addChild(versionLabel);
 
-    // ʼ״̬
+    // 初始化状态
     _currentState = LoadingState::INITIALIZING;
     _currentResourceIndex = 0;
     _totalResources = 0;
     _successfullyLoaded = 0;
     _failedToLoad = 0;
     _elapsedTime = 0.0f;
-    _minDisplayTime = 2.0f; // Сʾ2
+    _minDisplayTime = 2.0f; // 最小显示2秒
     _preCreatedScene = nullptr;
 
-    // ҪصԴб
+    // 定义需要加载的资源列表
     _resourcesToLoad.clear();
 
-    // ӻUI
+    // 添加基本的UI纹理
     addResourcesToLoad({
         "Images/UI/button_normal.png",
         "Images/UI/button_pressed.png",
@@ -105,7 +105,7 @@ bool LoadingScene::init() {
         "Images/UI/progress_bar.png"
         });
 
-    // ӵ
+    // 添加地形纹理
     addResourcesToLoad({
         "Images/Terrain/grass.png",
         "Images/Terrain/forest.png",
@@ -115,7 +115,7 @@ bool LoadingScene::init() {
         "Images/Terrain/tundra.png"
         });
 
-    // ӵλ
+    // 添加单位纹理
     addResourcesToLoad({
         "Images/Units/settler.png",
         "Images/Units/warrior.png",
@@ -123,7 +123,7 @@ bool LoadingScene::init() {
         "Images/Units/scout.png"
         });
 
-    // ͼƬ
+    // 添加领袖图片
     addResourcesToLoad({
         "Images/Leaders/CivChina.png",
         "Images/Leaders/CivGermany.png",
@@ -154,18 +154,18 @@ void LoadingScene::addResourcesToLoad(const std::vector<std::string>& resources)
 void LoadingScene::startRealLoading() {
     CCLOG("Starting real loading with %d resources", _totalResources);
 
-    // ʼؼʱ
+    // 开始加载计时器
     _elapsedTime = 0.0f;
     _currentState = LoadingState::INITIALIZING;
 
-    // ÿ֡¼״̬
+    // 每帧更新加载状态
     this->schedule(CC_SCHEDULE_SELECTOR(LoadingScene::onLoadingUpdate), 0.016f);
 }
 
 void LoadingScene::onLoadingUpdate(float dt) {
     _elapsedTime += dt;
 
-    // ½ʵȺٽȣ
+    // 更新进度条（混合真实进度和虚假进度）
     float fakeProgress = (_elapsedTime / _minDisplayTime) * 100.0f;
     float realProgress = 0.0f;
 
@@ -174,7 +174,7 @@ void LoadingScene::onLoadingUpdate(float dt) {
         _loadingLabel->setString("Initializing game systems...");
         fakeProgress = 0.0f;
 
-        // ݳʼԴؽ׶
+        // 短暂初始化后进入资源加载阶段
         if (_elapsedTime > 0.3f) {
             _currentState = LoadingState::LOADING_TEXTURES;
             _currentResourceIndex = 0;
@@ -186,16 +186,16 @@ void LoadingScene::onLoadingUpdate(float dt) {
     case LoadingState::LOADING_TEXTURES:
         _loadingLabel->setString("Loading basic assets...");
 
-        // ʵ
+        // 计算真实进度
         if (_totalResources > 0) {
             realProgress = (float)_currentResourceIndex / (float)_totalResources * 100.0f;
         }
 
-        // 첽Դ
+        // 异步加载资源
         if (_currentResourceIndex < _totalResources) {
             std::string resourcePath = _resourcesToLoad[_currentResourceIndex];
 
-            // 첽
+            // 异步加载纹理
             Director::getInstance()->getTextureCache()->addImageAsync(
                 resourcePath,
                 CC_CALLBACK_1(LoadingScene::onSingleResourceLoaded, this)
@@ -204,12 +204,12 @@ void LoadingScene::onLoadingUpdate(float dt) {
             _currentResourceIndex++;
         }
         else {
-            // Դѿʼأȴص
+            // 所有资源都已开始加载，等待回调完成
             if (_successfullyLoaded + _failedToLoad >= _totalResources) {
                 CCLOG("All resources loaded: %d success, %d failed",
                     _successfullyLoaded, _failedToLoad);
 
-                // Ԥ׶
+                // 进入预创建场景阶段
                 _currentState = LoadingState::PRE_CREATING_SCENE;
                 _elapsedTime = 0.0f;
             }
@@ -219,13 +219,13 @@ void LoadingScene::onLoadingUpdate(float dt) {
     case LoadingState::PRE_CREATING_SCENE:
         _loadingLabel->setString("Initializing game instances...");
 
-        // 
+        // 计算进度
         if (_elapsedTime < 0.5f) {
-            // ģȣ75%90%
+            // 模拟进度：75%到90%
             realProgress = 75.0f + (_elapsedTime / 0.5f) * 15.0f;
         }
         else {
-            // ͬԤϷ
+            // 同步预创建游戏场景
             preCreateGameObjectsSync();
             _currentState = LoadingState::FINALIZING;
             _elapsedTime = 0.0f;
@@ -235,7 +235,7 @@ void LoadingScene::onLoadingUpdate(float dt) {
     case LoadingState::FINALIZING:
         _loadingLabel->setString("Shifting the layer...");
 
-        // ģս׶
+        // 模拟最终阶段
         if (_elapsedTime < 0.5f) {
             realProgress = 90.0f + (_elapsedTime / 0.5f) * 10.0f;
         }
@@ -249,35 +249,35 @@ void LoadingScene::onLoadingUpdate(float dt) {
         _loadingLabel->setString("Updating global state...");
         realProgress = 100.0f;
 
-        // ȷСʾʱ
+        // 确保最小显示时间
         if (_elapsedTime >= _minDisplayTime) {
             this->unschedule(CC_SCHEDULE_SELECTOR(LoadingScene::onLoadingUpdate));
 
-            // תʹӳ
+            // 立即跳转，不使用延迟
             goToNextScene();
         }
         break;
     }
 
-    // ʵȺٽ
+    // 混合真实进度和虚假进度
     float displayProgress;
     if (_currentState == LoadingState::INITIALIZING) {
         displayProgress = fakeProgress;
     }
     else {
-        // ʹʵΪȷᵹ
+        // 使用真实进度为主，但确保不会倒退
         displayProgress = std::max(realProgress, _progressBar->getPercentage());
 
-        // ʵ̫΢ӵ
+        // 如果真实进度太慢，稍微加点速
         if (displayProgress < fakeProgress && fakeProgress < 90.0f) {
             displayProgress += 0.5f;
         }
     }
 
-    // ½
+    // 更新进度条
     _progressBar->setPercentage(displayProgress);
 
-    // ¼رǩ
+    // 更新加载标签
     if (_currentState == LoadingState::LOADING_TEXTURES && _totalResources > 0) {
         std::string progressText = StringUtils::format(
             "Loading assets... (%d/%d)",
@@ -299,7 +299,7 @@ void LoadingScene::onSingleResourceLoaded(cocos2d::Texture2D* texture) {
 void LoadingScene::preCreateGameObjectsSync() {
     CCLOG("Synchronously pre-creating game scene...");
 
-    // ֱӴϷгʼ
+    // 直接创建游戏场景并完成所有初始化
     if (_sceneCreator) {
         _preCreatedScene = _sceneCreator();
     }
@@ -308,14 +308,14 @@ void LoadingScene::preCreateGameObjectsSync() {
     }
 
     if (_preCreatedScene) {
-        // ҪãֹԶͷųͷ
+        // 重要：保留引用，防止被自动释放池释放
         _preCreatedScene->retain();
         CCLOG("GameScene created and retained in LoadingScene");
 
-        // ǿGameSceneгʼ
+        // 强制GameScene完成所有初始化
         auto gameScene = dynamic_cast<GameScene*>(_preCreatedScene);
         if (gameScene) {
-            // GameSceneinitѾcreateSceneеù
+            // GameScene的init已经在createScene中调用过
             CCLOG("GameScene already initialized in createScene");
         }
     }
@@ -326,32 +326,32 @@ void LoadingScene::goToNextScene() {
 
     Scene* targetScene = nullptr;
 
-    // ʹԤĳ
+    // 优先使用预创建的场景
     if (_preCreatedScene) {
         targetScene = _preCreatedScene;
         CCLOG("Using pre-created GameScene");
     }
     else if (_sceneCreator) {
-        // ʹó
+        // 使用场景创建函数
         targetScene = _sceneCreator();
     }
     else {
-        // ĬϴϷ
+        // 默认创建游戏场景
         targetScene = GameScene::createScene();
     }
 
     if (targetScene) {
-        // ֱ滻
+        // 直接替换场景
         Director::getInstance()->replaceScene(targetScene);
     }
     else {
         CCLOGERROR("Failed to create target scene!");
-        // ÷һGameScene
+        // 备用方案：创建一个基本的GameScene
         auto fallbackScene = GameScene::createScene();
         Director::getInstance()->replaceScene(fallbackScene);
     }
 
-    // Ԥĳ
+    // 清理预创建的场景引用
     if (_preCreatedScene) {
         _preCreatedScene->release();
         _preCreatedScene = nullptr;
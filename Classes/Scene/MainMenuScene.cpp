@@ -17,42 +17,42 @@ bool MainMenuScene::init()
     auto visibleSize = Director::getInstance()->getVisibleSize();
     auto origin = Director::getInstance()->getVisibleOrigin();
 
-    // 1. ģǰ΢ϵĽ
+    // 1. 背景：模拟黎明前的深蓝到微紫的渐变
     auto bg = LayerGradient::create(Color4B(10, 15, 30, 255), Color4B(40, 45, 65, 255));
     this->addChild(bg);
 
-    // 2. װԻ (DrawNode) - Ӫʸ
+    // 2. 装饰性绘制 (DrawNode) - 营造侧边栏质感
     auto decorationNode = DrawNode::create();
     this->addChild(decorationNode);
 
-    float menuX = origin.x + 250; // ˵߿
+    float menuX = origin.x + 250; // 菜单中心线靠近左侧
 
-    // һᴩĻϸߣɫ
+    // 绘制一条贯穿屏幕的细长竖线（深金色）
     Color4F civGold(0.75f, 0.65f, 0.35f, 0.5f);
     decorationNode->drawSegment(Vec2(menuX - 120, 0), Vec2(menuX - 120, visibleSize.height), 1.0f, civGold);
 
-    // 3. Ϸ⣺ʹø߹ŵе壬λ
-    auto title = Label::createWithSystemFont("CIVILIZATION VI", "Georgia", 50); // Georgiaг
+    // 3. 游戏标题：使用更具古典感的字体，并调整位置
+    auto title = Label::createWithSystemFont("CIVILIZATION VI", "Georgia", 50); // Georgia更有衬线书卷气
     title->setAnchorPoint(Vec2(0, 0.5f));
     title->setPosition(menuX - 100, visibleSize.height - 150);
-    title->setTextColor(Color4B(230, 210, 170, 255)); // ƫ
+    title->setTextColor(Color4B(230, 210, 170, 255)); // 象牙白偏金
     title->enableShadow(Color4B::BLACK, Size(3, -3), 4);
     this->addChild(title);
 
-    // 4. ťͣЧ»
+    // 4. 按钮美化：增加悬停效果和下划线
     auto createMenuButton = [&](const std::string& text, float yPos, std::function<void(Ref*)> callback) {
         auto btn = Button::create();
         btn->setTitleText(text);
         btn->setTitleFontName("Arial");
         btn->setTitleFontSize(26);
-        btn->setTitleColor(Color3B(180, 170, 150)); // Ĭǳɫ
+        btn->setTitleColor(Color3B(180, 170, 150)); // 默认浅灰色
         btn->setAnchorPoint(Vec2(0, 0.5f));
         btn->setPosition(Vec2(menuX - 100, yPos));
 
-        // ߼
+        // 交互逻辑：点击变亮
         btn->addClickEventListener(callback);
 
-        // ť·װϸ
+        // 按钮下方的装饰细线
         decorationNode->drawSegment(Vec2(menuX - 100, yPos - 20), Vec2(menuX + 50, yPos - 20), 0.5f, civGold);
 
         return btn;
@@ -64,7 +64,7 @@ bool MainMenuScene::init()
     auto btnExit = createMenuButton("RETIRE", visibleSize.height / 2 - 80, CC_CALLBACK_1(MainMenuScene::onExitClicked, this));
     this->addChild(btnExit);
 
-    // 5. ײȨ/汾ϢС͸
+    // 5. 底部版权/版本信息（极小、半透明）
     auto version = Label::createWithSystemFont("v1.0 - Built for Exploration", "Arial", 14);
     version->setAnchorPoint(Vec2(1, 0));
     version->setPosition(visibleSize.width - 20, 20);
@@ -77,12 +77,12 @@ bool MainMenuScene::init()
 }
 
 void MainMenuScene::addAtmosphericCenterpiece(Vec2 center) {
-    // ȡʵĻߴ磬ȷ init ľֲ
+    // 获取实际屏幕尺寸，确保不依赖 init 的局部变量
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 
+    // 创建容器
     auto orbitNode = Node::create();
-    // 㣺ƫĻȵ 15%
+    // 修正后的坐标运算：向右偏移屏幕宽度的 15%
     orbitNode->setPosition(center.x + visibleSize.width * 0.15f, center.y);
     this->addChild(orbitNode, 1);
 
@@ -91,13 +91,13 @@ void MainMenuScene::addAtmosphericCenterpiece(Vec2 center) {
 
     Color4F lineGold(0.75f, 0.65f, 0.35f, 0.4f);
 
-    // Բ߼ (ȷӦ Cocos2d-x 汾)
-    // 볢ԼΪ: circles->drawCircle(Vec2::ZERO, 220, 0, 120, false, lineGold);
+    // 绘制圆环逻辑 (确保参数适应你的 Cocos2d-x 版本)
+    // 如果报错，请尝试简化为: circles->drawCircle(Vec2::ZERO, 220, 0, 120, false, lineGold);
     circles->drawCircle(Vec2::ZERO, 220, 0, 120, false, 1.0f, 0.4f, lineGold);
     circles->drawCircle(Vec2::ZERO, 180, 0, 100, false, 0.3f, 1.0f, lineGold);
     circles->drawCircle(Vec2::ZERO, 140, 0, 80, false, 1.0f, 1.0f, lineGold);
 
-    // --- ǵװ ---
+    // --- 新增：星点装饰 ---
     for (int i = 0; i < 12; i++) {
         float angle = CC_DEGREES_TO_RADIANS(i * 30);
         float r = 140.0f;
@@ -106,10 +106,10 @@ void MainMenuScene::addAtmosphericCenterpiece(Vec2 center) {
 
     circles->drawDot(Vec2::ZERO, 4, lineGold);
 
-    // ߼ת
+    // 动作逻辑：旋转
     orbitNode->runAction(RepeatForever::create(RotateBy::create(40.0f, 360)));
 
-    // 
+    // 呼吸动画
     circles->runAction(RepeatForever::create(Sequence::create(
         FadeTo::create(3.0f, 80),
         FadeTo::create(3.0f, 200),
@@ -120,21 +120,21 @@ void MainMenuScene::addAtmosphericCenterpiece(Vec2 center) {
 void MainMenuScene::onNewGameClicked(Ref* sender)
 {
     CCLOG("Start New Game...");
-    // ле뵭Ч (1.0)
+    // 切换场景：带有淡入淡出特效 (1.0秒)
     auto gameScene = GameScene::createScene();
     Director::getInstance()->replaceScene(TransitionFade::create(1.0f, gameScene));
 
-    // ֱֲţлѡ
+    // 音乐保持播放，切换到文明选择界面
     auto selectionScene = CivilizationSelectionScene::createScene();
     Director::getInstance()->replaceScene(TransitionFade::create(0.5f, selectionScene));
 }
 
 void MainMenuScene::onExitClicked(Ref* sender)
 {
-    // ֲֹͣ
+    // 停止音乐并清理
     MusicManager::getInstance()->stopMusic();
     MusicManager::destroyInstance();
 
-    // ˳Ϸ
+    // 退出游戏
     Director::getInstance()->end();
 }
\ No newline at end of file
@@ -2,9 +2,9 @@
 #define __MAIN_MENU_SCENE_H__
 
 #include "cocos2d.h"
-#include "ui/CocosGUI.h" //  GUI 
-#include "LoadingScene.h" // 
-#include "GameScene.h"    // 
+#include "ui/CocosGUI.h" // 引入 GUI 库
+#include "LoadingScene.h" // 添加这行
+#include "GameScene.h"    // 添加这行
 
 class MainMenuScene : public cocos2d::Scene {
 public:
@@ -14,7 +14,7 @@ public:
     CREATE_FUNC(MainMenuScene);
 
 private:
-    // ťص
+    // 按钮回调
     void onNewGameClicked(cocos2d::Ref* sender);
     void onExitClicked(cocos2d::Ref* sender);
 };
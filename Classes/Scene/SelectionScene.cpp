@@ -7,10 +7,11 @@
 USING_NS_CC;
 using namespace ui;
 
-// ʼ̬
+// 初始化静态变量
 CivilizationType CivilizationSelectionScene::s_selectedCivilization = CivilizationType::CHINA;
 std::vector<AIPlayerSetting> CivilizationSelectionScene::s_aiPlayerSettings;
-int CivilizationSelectionScene::s_aiPlayerCount = 2; // Ĭ2AI
+int CivilizationSelectionScene::s_aiPlayerCount = 2; // 默认2个AI
+bool CivilizationSelectionScene::s_quickAITurns = false;
 
 Scene* CivilizationSelectionScene::createScene() {
     return CivilizationSelectionScene::create();
@@ -22,59 +23,59 @@ bool CivilizationSelectionScene::init() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
     Vec2 center = Vec2(visibleSize.width / 2, visibleSize.height / 2);
 
-    // 1. 
+    // 1. 创建背景
     createBackground();
 
-    // 2. 
+    // 2. 创建标题
     createTitle();
 
-    // 3. ʼϢ
+    // 3. 初始化文明信息
     _civilizations.clear();
     _civilizations.push_back(CivilizationInfo(
-        u8"", u8"ʼʵ",
-        u8"ϵĶӵƾõʷĻ",
-        u8"ʹô+2￨ṩ75%ӳ",
-        u8"", u8"",
-        CivilizationType::CHINA, Color3B(200, 50, 50) // ɫ
+        u8"华夏文明", u8"始皇帝",
+        u8"古老的东方文明，拥有悠久的历史和文化传承",
+        u8"建造者使用次数+2，尤里卡和灵感提供75%加成",
+        u8"虎蹲炮", u8"",
+        CivilizationType::CHINA, Color3B(200, 50, 50) // 红色
     ));
 
     _civilizations.push_back(CivilizationInfo(
-        u8"־", u8"ʥʵ",
-        u8"ҵǿЧʺͼ",
-        u8"ҵٶ+50%ÿпɶཨһ",
-        "", u8"վ",
-        CivilizationType::GERMANY, Color3B(100, 100, 200) // ɫ
+        u8"德意志", u8"神圣罗马皇帝",
+        u8"工业与军事强国，以效率和纪律著称",
+        u8"工业区建造速度+50%，每个城市可多建一个区域",
+        "", u8"汉萨商站",
+        CivilizationType::GERMANY, Color3B(100, 100, 200) // 蓝色
     ));
 
     _civilizations.push_back(CivilizationInfo(
-        u8"˹", u8"˵ô",
-        u8"ŷǵӴ۹ӵй",
-        u8"ʼ+5ѧԺ;Ժ㳡+20%",
+        u8"俄罗斯", u8"彼得大帝",
+        u8"横跨欧亚的庞大帝国，拥有广袤的领土",
+        u8"初始领土+5，学院和剧院广场产出+20%",
         u8"", u8"",
-        CivilizationType::RUSSIA, Color3B(50, 150, 50) // ɫ
+        CivilizationType::RUSSIA, Color3B(50, 150, 50) // 绿色
     ));
 
-    // 4. ʼAI
-    _aiPlayerCount = 2; // Ĭ2AI
+    // 4. 初始化AI设置
+    _aiPlayerCount = 2; // 默认2个AI
     _aiSettings.clear();
 
-    // ĬAIãųѡ
+    // 默认AI设置（排除玩家选择的文明）
     std::vector<CivilizationType> availableCivs = getAvailableAICivilizations();
     for (int i = 0; i < _aiPlayerCount && i < availableCivs.size(); i++) {
         std::string aiName = "AI Player " + std::to_string(i + 1);
         _aiSettings.push_back(AIPlayerSetting(i + 1, availableCivs[i], aiName));
     }
 
-    // 5. ѡ
+    // 5. 创建玩家文明选择面板
     createPlayerCivilizationPanel();
 
-    // 6. AI
+    // 6. 创建AI设置面板
     createAISettingsPanel();
 
-    // 7. ưť
+    // 7. 创建控制按钮
     createControlButtons();
 
-    // 8. Ĭѡ
+    // 8. 设置默认选择
     _currentSelection = CivilizationType::CHINA;
     updateSelection(_currentSelection);
 
@@ -84,32 +85,32 @@ bool CivilizationSelectionScene::init() {
 void CivilizationSelectionScene::createBackground() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 1. ɫ
+    // 1. 渐变底色
     auto bg = LayerGradient::create(Color4B(10, 15, 30, 255), Color4B(30, 35, 50, 255), Vec2(0, -1));
     this->addChild(bg, -2);
 
-    // 2. ˵ԲԪ (Ҫ)
+    // 2. 延续主菜单的圆环元素 (但是要更淡、更大)
     auto bgDecor = DrawNode::create();
     bgDecor->drawCircle(Vec2(visibleSize.width * 0.8f, visibleSize.height * 0.5f),
         400, 0, 100, false, 1.0f, 1.0f, Color4F(0.75f, 0.65f, 0.35f, 0.05f));
     this->addChild(bgDecor, -1);
 
-    // ôԲת
+    // 让大圆环缓慢旋转
     bgDecor->runAction(RepeatForever::create(RotateBy::create(100.0f, 360)));
 }
 
 void CivilizationSelectionScene::createTitle() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 
-    auto title = Label::createWithSystemFont(u8"ʼ", "Arial", 60);
+    // 主标题
+    auto title = Label::createWithSystemFont(u8"初始设置", "Arial", 60);
     title->setPosition(visibleSize.width / 2, visibleSize.height - 80);
     title->setColor(Color3B(220, 200, 120));
     title->enableShadow(Color4B::BLACK, Size(3, -3), 3);
     this->addChild(title, 1);
 
-    // 
-    auto subtitle = Label::createWithSystemFont(u8"AI", "Arial", 24);
+    // 副标题
+    auto subtitle = Label::createWithSystemFont(u8"配置你的文明和AI对手", "Arial", 24);
     subtitle->setPosition(visibleSize.width / 2, visibleSize.height - 160);
     subtitle->setColor(Color3B(180, 180, 200));
     this->addChild(subtitle, 1);
@@ -120,32 +121,32 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
     Color4F civGold(0.75f, 0.65f, 0.35f, 0.6f);
     Color4F panelBg(0.05f, 0.07f, 0.12f, 0.8f);
 
-    // ---  ---
+    // --- 左侧面板 ---
     auto leftPanel = Layout::create();
     leftPanel->setContentSize(Size(visibleSize.width * 0.22f, visibleSize.height * 0.55f));
-    leftPanel->setPosition(Vec2(visibleSize.width * 0.04f, visibleSize.height * 0.25f)); // ΢Ʊܿ»
-    this->addChild(leftPanel, 2); // ȷ㼶㹻
+    leftPanel->setPosition(Vec2(visibleSize.width * 0.04f, visibleSize.height * 0.25f)); // 稍微上移避开下划线
+    this->addChild(leftPanel, 2); // 确保层级足够高
 
     auto leftBorder = DrawNode::create();
     leftPanel->addChild(leftBorder, -1);
     leftBorder->drawSolidRect(Vec2::ZERO, leftPanel->getContentSize(), panelBg);
     leftBorder->drawRect(Vec2::ZERO, leftPanel->getContentSize(), civGold);
 
-    // ѡť (ؼ㣺ȷѭ)
+    // 重新添加左侧文明选择按钮 (关键点：确保在这里循环添加)
     float buttonHeight = 55;
     float startY = leftPanel->getContentSize().height - 80;
 
-    _civButtons.clear(); // վ
+    _civButtons.clear(); // 清空旧引用
     for (int i = 0; i < _civilizations.size(); i++) {
         const auto& civ = _civilizations[i];
         auto civButton = Button::create();
         civButton->setTitleText(civ.name);
-        civButton->setTitleFontName("Georgia"); // ʹó
+        civButton->setTitleFontName("Georgia"); // 使用衬线体
         civButton->setTitleFontSize(22);
         civButton->setContentSize(Size(leftPanel->getContentSize().width * 0.9f, buttonHeight));
         civButton->setPosition(Vec2(leftPanel->getContentSize().width * 0.5f, startY - i * (buttonHeight + 15)));
 
-        // ðťɫ
+        // 设置按钮基础颜色
         civButton->setTitleColor(Color3B(200, 200, 200));
         civButton->addClickEventListener([this, civ](Ref* sender) {
             this->onCivilizationSelected(sender, civ.type);
@@ -155,7 +156,7 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
         _civButtons.push_back(civButton);
     }
 
-    // --- Ҳ ---
+    // --- 右侧面板 ---
     _selectedPanel = Layout::create();
     _selectedPanel->setContentSize(Size(visibleSize.width * 0.68f, visibleSize.height * 0.55f));
     _selectedPanel->setPosition(Vec2(visibleSize.width * 0.28f, visibleSize.height * 0.25f));
@@ -166,21 +167,21 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
     rightBorder->drawSolidRect(Vec2::ZERO, _selectedPanel->getContentSize(), panelBg);
     rightBorder->drawRect(Vec2::ZERO, _selectedPanel->getContentSize(), civGold);
 
-    // 
+    // 文明标题
     _selectedLabel = Label::createWithSystemFont("", "Georgia", 40);
     _selectedLabel->setPosition(_selectedPanel->getContentSize().width * 0.5f, _selectedPanel->getContentSize().height - 40);
     _selectedLabel->setColor(Color3B(255, 230, 150));
     _selectedPanel->addChild(_selectedLabel);
 
-    // ƣ⣩
+    // 领袖名称（副标题）
     _leaderLabel = Label::createWithSystemFont("", "Arial", 28);
-    _leaderLabel->setAnchorPoint(Vec2(0.5f, 0.5f));  // ê
+    _leaderLabel->setAnchorPoint(Vec2(0.5f, 0.5f));  // 居中锚点
     _leaderLabel->setPosition(_selectedPanel->getContentSize().width * 0.5f,
         _selectedPanel->getContentSize().height * 0.78f);
     _leaderLabel->setColor(Color3B(220, 200, 150));
     _selectedPanel->addChild(_leaderLabel);
 
-    // ռ60%ȣ
+    // 左侧文字描述区域（占60%宽度）
     auto textArea = Layout::create();
     textArea->setBackGroundColorType(Layout::BackGroundColorType::NONE);
     textArea->setContentSize(Size(_selectedPanel->getContentSize().width * 0.6f,
@@ -190,16 +191,16 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
     textArea->setAnchorPoint(Vec2(0, 0));
     _selectedPanel->addChild(textArea);
 
-    // Ȼ
-    auto descriptionTitle = Label::createWithSystemFont(u8"", "Arial", 24);
-    descriptionTitle->setAnchorPoint(Vec2(0, 1));  // Ͻê
+    // 自然语言描述标题
+    auto descriptionTitle = Label::createWithSystemFont(u8"文明特性", "Arial", 24);
+    descriptionTitle->setAnchorPoint(Vec2(0, 1));  // 左上角锚点
     descriptionTitle->setPosition(0, textArea->getContentSize().height - 10);
     descriptionTitle->setColor(Color3B(180, 200, 220));
     textArea->addChild(descriptionTitle);
 
-    // Ȼ
+    // 自然语言描述内容
     _descriptionLabel = Label::createWithSystemFont("", "Arial", 18);
-    _descriptionLabel->setAnchorPoint(Vec2(0, 1));  // Ͻê
+    _descriptionLabel->setAnchorPoint(Vec2(0, 1));  // 左上角锚点
     _descriptionLabel->setPosition(0, textArea->getContentSize().height - 40);
     _descriptionLabel->setColor(Color3B(180, 200, 220));
     _descriptionLabel->setDimensions(textArea->getContentSize().width - 10,
@@ -208,7 +209,7 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
     _descriptionLabel->setVerticalAlignment(TextVAlignment::TOP);
     textArea->addChild(_descriptionLabel);
 
-    // Ҳ仭ռ35%ȣ5%Ϊ߾ࣩ
+    // 右侧领袖画像区域（占35%宽度，留5%作为边距）
     auto portraitArea = Layout::create();
     portraitArea->setBackGroundColorType(Layout::BackGroundColorType::NONE);
     portraitArea->setContentSize(Size(_selectedPanel->getContentSize().width * 0.35f,
@@ -218,29 +219,29 @@ void CivilizationSelectionScene::createPlayerCivilizationPanel() {
     portraitArea->setAnchorPoint(Vec2(0, 0));
     _selectedPanel->addChild(portraitArea);
 
-    // 仭ռλΣȫձԼ2:3
+    // 领袖画像占位矩形（全身照比例，大约2:3）
     float portraitWidth = portraitArea->getContentSize().width * 0.9f;
-    float portraitHeight = portraitWidth * 1.075f;  // 2:3
+    float portraitHeight = portraitWidth * 1.075f;  // 2:3比例
 
     _portraitFrame = LayerColor::create(Color4B(60, 60, 80, 255), portraitWidth, portraitHeight);
     _portraitFrame->setPosition((portraitArea->getContentSize().width - portraitWidth) * 0.5f,
         (portraitArea->getContentSize().height - portraitHeight) * 0.5f);
     portraitArea->addChild(_portraitFrame);
 
-    // ռλ
-    auto portraitPlaceholder = Label::createWithSystemFont(u8"仭", "Arial", 20);
+    // 画像占位文字
+    auto portraitPlaceholder = Label::createWithSystemFont(u8"领袖画像", "Arial", 20);
     portraitPlaceholder->setPosition(portraitWidth * 0.5f, portraitHeight * 0.5f);
     portraitPlaceholder->setColor(Color3B(150, 150, 170));
     _portraitFrame->addChild(portraitPlaceholder);
 
-    // ڻ·
-    auto portraitNameLabel = Label::createWithSystemFont(u8"", "Arial", 18);
+    // 领袖名称在画像下方
+    auto portraitNameLabel = Label::createWithSystemFont(u8"领袖", "Arial", 18);
     portraitNameLabel->setPosition(portraitWidth * 0.5f, -20);
     portraitNameLabel->setColor(Color3B(180, 180, 200));
     _portraitFrame->addChild(portraitNameLabel);
 
-    // ѡʾ
-    auto selectionHint = Label::createWithSystemFont(u8"ťѡ", "Arial", 18);
+    // 选择提示
+    auto selectionHint = Label::createWithSystemFont(u8"点击左侧文明按钮选择你的文明", "Arial", 18);
     selectionHint->setPosition(_selectedPanel->getContentSize().width * 0.5f, 30);
     selectionHint->setColor(Color3B(150, 150, 170));
     selectionHint->setOpacity(180);
@@ -258,21 +259,21 @@ void CivilizationSelectionScene::createAISettingsPanel() {
 
     auto aiBorder = DrawNode::create();
     _aiSettingsPanel->addChild(aiBorder, -1);
-    // ߣӪ쿪ʽ
+    // 仅绘制上下两条横线，营造开放式面板感
     aiBorder->drawSegment(Vec2(0, _aiSettingsPanel->getContentSize().height),
         Vec2(_aiSettingsPanel->getContentSize().width, _aiSettingsPanel->getContentSize().height), 1.0f, civGold);
     aiBorder->drawSegment(Vec2(0, 0), Vec2(_aiSettingsPanel->getContentSize().width, 0), 1.0f, civGold);
 
-    // AIʾ
-    _aiCountLabel = Label::createWithSystemFont(u8"AI: 2", "Arial", 24);
+    // AI数量显示
+    _aiCountLabel = Label::createWithSystemFont(u8"AI对手数量: 2", "Arial", 24);
     _aiCountLabel->setPosition(_aiSettingsPanel->getContentSize().width * 0.15f,
         _aiSettingsPanel->getContentSize().height * 0.7f);
     _aiCountLabel->setColor(Color3B(180, 180, 200));
     _aiSettingsPanel->addChild(_aiCountLabel);
 
-    // AIť
+    // 增加AI按钮
     auto addAIButton = Button::create();
-    addAIButton->setTitleText(u8"+ AI");
+    addAIButton->setTitleText(u8"+ 增加AI");
     addAIButton->setTitleFontSize(20);
     addAIButton->setTitleColor(Color3B::WHITE);
     addAIButton->setContentSize(Size(100, 40));
@@ -282,9 +283,9 @@ void CivilizationSelectionScene::createAISettingsPanel() {
     addAIButton->addClickEventListener(CC_CALLBACK_1(CivilizationSelectionScene::onAIAddClicked, this));
     _aiSettingsPanel->addChild(addAIButton);
 
-    // AIť
+    // 减少AI按钮
     auto removeAIButton = Button::create();
-    removeAIButton->setTitleText(u8"- AI");
+    removeAIButton->setTitleText(u8"- 减少AI");
     removeAIButton->setTitleFontSize(20);
     removeAIButton->setTitleColor(Color3B::WHITE);
     removeAIButton->setContentSize(Size(100, 40));
@@ -294,21 +295,33 @@ void CivilizationSelectionScene::createAISettingsPanel() {
     removeAIButton->addClickEventListener(CC_CALLBACK_1(CivilizationSelectionScene::onAIRemoveClicked, this));
     _aiSettingsPanel->addChild(removeAIButton);
 
-    // AIб
-    auto aiListTitle = Label::createWithSystemFont(u8"AIѡ:", "Arial", 22);
+    // 快速AI回合开关
+    _quickAITurnsButton = Button::create();
+    _quickAITurnsButton->setTitleText(s_quickAITurns ? u8"快速AI回合: 开" : u8"快速AI回合: 关");
+    _quickAITurnsButton->setTitleFontSize(20);
+    _quickAITurnsButton->setTitleColor(Color3B::WHITE);
+    _quickAITurnsButton->setContentSize(Size(160, 40));
+    _quickAITurnsButton->setPosition(Vec2(_aiSettingsPanel->getContentSize().width * 0.85f,
+        _aiSettingsPanel->getContentSize().height * 0.7f));
+    _quickAITurnsButton->setColor(s_quickAITurns ? Color3B(100, 180, 100) : Color3B(150, 150, 160));
+    _quickAITurnsButton->addClickEventListener(CC_CALLBACK_1(CivilizationSelectionScene::onQuickAITurnsClicked, this));
+    _aiSettingsPanel->addChild(_quickAITurnsButton);
+
+    // AI对手列表标题
+    auto aiListTitle = Label::createWithSystemFont(u8"AI文明选择:", "Arial", 22);
     aiListTitle->setPosition(_aiSettingsPanel->getContentSize().width * 0.5f,
         _aiSettingsPanel->getContentSize().height * 0.7f);
     aiListTitle->setColor(Color3B(180, 200, 220));
     _aiSettingsPanel->addChild(aiListTitle);
 
-    // AIʾ
+    // 更新AI设置显示
     updateAISettingsDisplay();
 }
 
 void CivilizationSelectionScene::createControlButtons() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // --- 1. ذť ---
+    // --- 1. 返回按钮 ---
     auto backButton = Button::create();
     backButton->setTitleText(u8"BACK TO MENU");
     backButton->setTitleFontName("Georgia");
@@ -316,31 +329,31 @@ void CivilizationSelectionScene::createControlButtons() {
     backButton->setAnchorPoint(Vec2(0, 0.5f));
     backButton->setPosition(Vec2(visibleSize.width * 0.05f, 50));
     backButton->addClickEventListener(CC_CALLBACK_1(CivilizationSelectionScene::onBackClicked, this));
-    this->addChild(backButton, 10); // ߲㼶
+    this->addChild(backButton, 10); // 提高层级
 
-    // --- 2. ʼť (BEGIN JOURNEY) ---
+    // --- 2. 开始按钮 (BEGIN JOURNEY) ---
     auto startButton = Button::create();
-    // ʹþŹñûͼƬǿֶһɫΪ
+    // 使用九宫格设置背景，如果没有图片，我们可以手动设置一个纯色块作为背景
     startButton->setScale9Enabled(true);
-    startButton->setContentSize(Size(260, 70)); // ֶָɵС
+    startButton->setContentSize(Size(260, 70)); // 手动指定可点击区域大小
 
     startButton->setTitleText(u8"BEGIN JOURNEY");
     startButton->setTitleFontName("Georgia");
     startButton->setTitleFontSize(28);
     startButton->setTitleColor(Color3B::WHITE);
 
-    // ê㣺ж룬ұ 10% Ļ
+    // 修正坐标与锚点：居中对齐，距离右边 10% 屏幕宽度
     startButton->setAnchorPoint(Vec2(0.5f, 0.5f));
     startButton->setPosition(Vec2(visibleSize.width * 0.85f, 50));
 
-    // ģõص
+    // 核心：设置点击回调
     startButton->addClickEventListener(CC_CALLBACK_1(CivilizationSelectionScene::onStartGameClicked, this));
 
-    // ӾװΣҪӽڵ㣬ֱӻ Scene ϻťһ
+    // 视觉装饰：不要挂在子节点，直接画在 Scene 上或给按钮加一层描边
     auto btnDecor = DrawNode::create();
-    this->addChild(btnDecor, 9); // ڰťһ
+    this->addChild(btnDecor, 9); // 放在按钮下面一层
 
-    // ԰ťΪĻ
+    // 以按钮坐标为中心画框
     Vec2 pos = startButton->getPosition();
     btnDecor->drawSolidRect(pos - Vec2(130, 35), pos + Vec2(130, 35), Color4F(0.4f, 0.35f, 0.2f, 0.5f));
     btnDecor->drawRect(pos - Vec2(130, 35), pos + Vec2(130, 35), Color4F(0.75f, 0.65f, 0.35f, 1.0f));
@@ -354,7 +367,7 @@ void CivilizationSelectionScene::onCivilizationSelected(Ref* sender, Civilizatio
 
     for (int i = 0; i < _civilizations.size(); i++) {
         if (_civilizations[i].type == civType) {
-            // ѡеİťЧɫ߿ֱ
+            // 选中的按钮效果：金色边框，文字变亮
             _civButtons[i]->setTitleColor(Color3B(255, 230, 150));
             _civButtons[i]->setScale(1.05f);
         }
@@ -368,15 +381,15 @@ void CivilizationSelectionScene::onCivilizationSelected(Ref* sender, Civilizatio
 void CivilizationSelectionScene::onAIButtonClicked(cocos2d::Ref* sender, int aiIndex) {
     if (aiIndex < 0 || aiIndex >= _aiSettings.size()) return;
 
-    // ѡ˵
+    // 弹出文明选择菜单
     auto availableCivs = getAvailableAICivilizations();
     if (availableCivs.empty()) return;
 
-    // ʵ֣ѭл
+    // 简单实现：循环切换文明
     CivilizationType currentCiv = _aiSettings[aiIndex].civilization;
     int currentIndex = -1;
 
-    // ҵǰڿбеλ
+    // 找到当前文明在可用列表中的位置
     for (int i = 0; i < availableCivs.size(); i++) {
         if (availableCivs[i] == currentCiv) {
             currentIndex = i;
@@ -384,11 +397,11 @@ void CivilizationSelectionScene::onAIButtonClicked(cocos2d::Ref* sender, int aiI
         }
     }
 
-    // ѡһ
+    // 选择下一个文明
     int nextIndex = (currentIndex + 1) % availableCivs.size();
     _aiSettings[aiIndex].civilization = availableCivs[nextIndex];
 
-    // °ťʾ
+    // 更新按钮显示
     updateAISettingsDisplay();
 
     CCLOG("AI %d civilization changed to: %d", aiIndex, static_cast<int>(availableCivs[nextIndex]));
@@ -402,14 +415,14 @@ void CivilizationSelectionScene::onAIAddClicked(cocos2d::Ref* sender) {
 
     _aiPlayerCount++;
 
-    // ΪAIһ
+    // 为新AI分配一个文明
     auto availableCivs = getAvailableAICivilizations();
     if (!availableCivs.empty()) {
         std::string aiName = "AI Player " + std::to_string(_aiPlayerCount);
         _aiSettings.push_back(AIPlayerSetting(_aiPlayerCount, availableCivs[0], aiName));
     }
     else {
-        // ûпʹĬ
+        // 如果没有可用文明，使用默认文明
         std::string aiName = "AI Player " + std::to_string(_aiPlayerCount);
         _aiSettings.push_back(AIPlayerSetting(_aiPlayerCount, CivilizationType::GERMANY, aiName));
     }
@@ -435,6 +448,15 @@ void CivilizationSelectionScene::onAIRemoveClicked(cocos2d::Ref* sender) {
     CCLOG("AI player removed. Total AI: %d", _aiPlayerCount);
 }
 
+void CivilizationSelectionScene::onQuickAITurnsClicked(cocos2d::Ref* sender) {
+    s_quickAITurns = !s_quickAITurns;
+
+    _quickAITurnsButton->setTitleText(s_quickAITurns ? u8"快速AI回合: 开" : u8"快速AI回合: 关");
+    _quickAITurnsButton->setColor(s_quickAITurns ? Color3B(100, 180, 100) : Color3B(150, 150, 160));
+
+    CCLOG("Quick AI turns: %s", s_quickAITurns ? "ON" : "OFF");
+}
+
 void CivilizationSelectionScene::updateSelection(CivilizationType selectedCiv) {
     for (const auto& civ : _civilizations) {
         if (civ.type == selectedCiv) {
@@ -442,7 +464,7 @@ void CivilizationSelectionScene::updateSelection(CivilizationType selectedCiv) {
             _leaderLabel->setString(civ.leader);
             _descriptionLabel->setString(generateNaturalDescription(civ));
 
-            // ɻ
+            // 清理旧画像
             _portraitFrame->removeAllChildren();
 
             std::string portraitPath = "";
@@ -452,18 +474,18 @@ void CivilizationSelectionScene::updateSelection(CivilizationType selectedCiv) {
 
             auto leaderSprite = Sprite::create(portraitPath);
             if (leaderSprite) {
-                // ȷͼƬ
+                // 确保图片居中
                 leaderSprite->setPosition(_portraitFrame->getContentSize().width / 2,
                     _portraitFrame->getContentSize().height / 2);
 
-                // ߼
+                // 缩放逻辑
                 float scale = (_portraitFrame->getContentSize().height * 0.9f) / leaderSprite->getContentSize().height;
                 leaderSprite->setScale(scale);
 
                 _portraitFrame->addChild(leaderSprite);
             }
             else {
-                // ͼƬʧܣʾռλ
+                // 如果图片加载失败，显示占位文字
                 auto failLabel = Label::createWithSystemFont("Image Missing", "Arial", 20);
                 failLabel->setPosition(_portraitFrame->getContentSize().width / 2, _portraitFrame->getContentSize().height / 2);
                 _portraitFrame->addChild(failLabel);
@@ -474,13 +496,13 @@ void CivilizationSelectionScene::updateSelection(CivilizationType selectedCiv) {
 }
 
 void CivilizationSelectionScene::updateAISettingsDisplay() {
-    // еAIť
+    // 清除现有的AI按钮
     for (auto button : _aiButtons) {
         _aiSettingsPanel->removeChild(button);
     }
     _aiButtons.clear();
 
-    // µAIť
+    // 创建新的AI按钮
     int aiCount = _aiSettings.size();
     float buttonWidth = 200;
     float totalWidth = aiCount * buttonWidth + (aiCount - 1) * 20;
@@ -489,7 +511,7 @@ void CivilizationSelectionScene::updateAISettingsDisplay() {
     for (int i = 0; i < aiCount; i++) {
         float posX = startX + i * (buttonWidth + 20);
 
-        // Ϣ
+        // 查找文明信息
         CivilizationType civType = _aiSettings[i].civilization;
         CivilizationInfo civInfo("", "", "", "", "", "", CivilizationType::BASIC, Color3B::WHITE);
 
@@ -500,7 +522,7 @@ void CivilizationSelectionScene::updateAISettingsDisplay() {
             }
         }
 
-        // AIť
+        // 创建AI按钮
         auto aiButton = Button::create();
         aiButton->setTitleText(u8"AI " + std::to_string(i + 1) + ": " + civInfo.name);
         aiButton->setTitleFontSize(18);
@@ -518,20 +540,20 @@ void CivilizationSelectionScene::updateAISettingsDisplay() {
 }
 
 void CivilizationSelectionScene::updateAICountLabel() {
-    _aiCountLabel->setString(u8"AI: " + std::to_string(_aiPlayerCount));
+    _aiCountLabel->setString(u8"AI数量: " + std::to_string(_aiPlayerCount));
 }
 
 std::vector<CivilizationType> CivilizationSelectionScene::getAvailableAICivilizations() {
     std::vector<CivilizationType> available;
 
-    //// ųѡ
+    //// 排除玩家选择的文明
     //for (const auto& civ : _civilizations) {
     //    if (civ.type != _currentSelection) {
     //        available.push_back(civ.type);
     //    }
     //}
 
-    // ֻҵģ
+    // 如果只有玩家文明，返回所有文明（包括玩家的）
     if (available.empty()) {
         for (const auto& civ : _civilizations) {
             available.push_back(civ.type);
@@ -544,55 +566,55 @@ std::vector<CivilizationType> CivilizationSelectionScene::getAvailableAICiviliza
 void CivilizationSelectionScene::onStartGameClicked(cocos2d::Ref* sender) {
     CCLOG("Starting game with civilization: %d", static_cast<int>(_currentSelection));
 
-    // ѡ
+    // 保存玩家文明选择
     s_selectedCivilization = _currentSelection;
 
-    // AI
+    // 保存AI设置
     s_aiPlayerSettings = _aiSettings;
     s_aiPlayerCount = _aiPlayerCount;
 
-    // س봴Ϸĺ
+    // 创建加载场景，传入创建游戏场景的函数
     auto sceneCreator = []() -> cocos2d::Scene* {
         return dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
         };
 
     auto loadingScene = LoadingScene::createScene(sceneCreator);
 
-    // лLoading
+    // 切换到Loading场景
     Director::getInstance()->replaceScene(TransitionFade::create(0.5f, loadingScene));
 }
 
 void CivilizationSelectionScene::onBackClicked(cocos2d::Ref* sender) {
-    // ˵
+    // 返回主菜单
     Director::getInstance()->replaceScene(TransitionFade::create(0.5f, MainMenuScene::createScene()));
 }
 
 std::string CivilizationSelectionScene::generateNaturalDescription(const CivilizationInfo& civ) {
-    // ϢȻ
+    // 根据文明信息生成自然语言描述
     std::string description;
 
     if (civ.type == CivilizationType::CHINA) {
         description =
-            u8"ʼʵ쵼ϵ֮һ\n\n"
-            u8"й￨мӳ75%ÿƼĻչѸ١\n\n"
-            u8"йⵥλǻڣһǿڹ\n\n"
-            u8"ʺϲͨЧͿٿƼչƵҡ";
+            u8"华夏文明由始皇帝领导，是世界上最古老的文明之一。\n\n"
+            u8"中国的尤里卡和灵感加成提升至75%，让科技和文化发展更加迅速。\n\n"
+            u8"中国的特殊单位是虎蹲炮，一种强大的早期攻城武器。\n\n"
+            u8"适合喜欢通过高效建造和快速科技发展来建立优势的玩家。";
     }
     else if (civ.type == CivilizationType::GERMANY) {
         description =
-            u8"־ʥʵ۰Ͱ쵼ŷ޵Ĺҵǿ\n\n"
-            u8"¹Ĺҵٶȱ50%ɱ룬Ը콨ҵ"
-            u8"ÿ¹лԶ⽨һṩ˸սԡ\n\n"
-            u8"¹⽨Ǻվ"
-            u8"ҵʱṩ\n\n"
-            u8"ʺϲͨǿĹҵ͸Ч۹ҡ";
+            u8"德意志文明由神圣罗马皇帝巴巴罗萨领导，是欧洲的工业与军事强国。\n\n"
+            u8"德国的工业区建造速度比其他文明快50%，成本减半，让您可以更快建立工业基础。"
+            u8"每个德国城市还可以额外建造一个区域，提供了更多的战略灵活性。\n\n"
+            u8"德国的特殊建筑是汉萨商站，"
+            u8"与商业区相邻时提供额外的生产力。\n\n"
+            u8"适合喜欢通过强大的工业基础和高效生产来建立帝国的玩家。";
     }
     else if (civ.type == CivilizationType::RUSSIA) {
         description =
-            u8"˹ɱ˵ô쵼һŷǴ½Ӵ۹\n\n"
-            u8"˹ĳʼ5ؿ飬ϷھܿƸԴ"
-            u8"˹ѧԺ;Ժ㳡20%ʹƼĻչѸ١\n\n"
-            u8"ʺϲͨƼĻ˫ȡʤҡ";
+            u8"俄罗斯文明由彼得大帝领导，是一个横跨欧亚大陆的庞大帝国。\n\n"
+            u8"俄罗斯的初始领土比其他文明大5个地块，让您在游戏早期就能控制更多资源。"
+            u8"俄罗斯的学院和剧院广场产出提升20%，使科技和文化发展更加迅速。\n\n"
+            u8"适合喜欢扩张领土并通过科技和文化双重优势取胜的玩家。";
     }
 
     return description;
@@ -600,11 +622,11 @@ std::string CivilizationSelectionScene::generateNaturalDescription(const Civiliz
 
 void CivilizationSelectionScene::updatePortraitColor(const cocos2d::Color3B& civColor) {
     if (_portraitFrame) {
-        // ʹĴɫ΢һЩΪ߿
+        // 使用文明的代表色，但稍微调暗一些作为边框
         Color4B frameColor(civColor.r * 0.7f, civColor.g * 0.7f, civColor.b * 0.7f, 255);
         _portraitFrame->setColor(Color3B(frameColor.r, frameColor.g, frameColor.b));
 
-        // ϣб߿Ч
+        // 或者如果希望有边框效果，可以这样做：
         // _portraitFrame->setColor(Color3B(civColor.r, civColor.g, civColor.b));
     }
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 #include "../Core/Player.h"
 #include <vector>
 
-// Ϣṹ
+// 文明信息结构
 struct CivilizationInfo {
     std::string name;
     std::string leader;
@@ -29,7 +29,7 @@ struct CivilizationInfo {
     }
 };
 
-// AI
+// AI玩家设置
 struct AIPlayerSetting {
     int playerId;
     CivilizationType civilization;
@@ -46,44 +46,49 @@ public:
     virtual bool init();
     CREATE_FUNC(CivilizationSelectionScene);
 
-    // ȡѡе
+    // 获取选中的文明类型
     static CivilizationType getSelectedCivilization() { return s_selectedCivilization; }
     static void setSelectedCivilization(CivilizationType civ) { s_selectedCivilization = civ; }
 
-    // ȡAI
-    static std::vector<AIPlayerSetting> getAIPlayerSettings() { return s_aiPlayerSettings; }
+    // 获取AI玩家设置
+    static const std::vector<AIPlayerSetting>& getAIPlayerSettings() { return s_aiPlayerSettings; }
 
-    // ȡAI
+    // 获取AI玩家数量
     static int getAIPlayerCount() { return s_aiPlayerCount; }
     static void setAIPlayerCount(int count) { s_aiPlayerCount = count; }
 
+    // 快速AI回合（跳过AI单位动画）
+    static bool getQuickAITurns() { return s_quickAITurns; }
+    static void setQuickAITurns(bool quick) { s_quickAITurns = quick; }
+
 private:
-    // UI
+    // UI创建
     void createBackground();
     void createTitle();
     void createPlayerCivilizationPanel();
     void createAISettingsPanel();
     void createControlButtons();
 
-    // ťص
+    // 按钮回调
     void onCivilizationSelected(cocos2d::Ref* sender, CivilizationType civType);
     void onAIButtonClicked(cocos2d::Ref* sender, int aiIndex);
     void onAIAddClicked(cocos2d::Ref* sender);
     void onAIRemoveClicked(cocos2d::Ref* sender);
+    void onQuickAITurnsClicked(cocos2d::Ref* sender);
     void onStartGameClicked(cocos2d::Ref* sender);
     void onBackClicked(cocos2d::Ref* sender);
 
-    // UI
+    // 更新UI
     void updateSelection(CivilizationType selectedCiv);
     void updateAISettingsDisplay();
     void updateAICountLabel();
     std::string generateNaturalDescription(const CivilizationInfo& civ);
     void updatePortraitColor(const cocos2d::Color3B& civColor);
 
-    // ȡõAIųѡģ
+    // 获取可用的AI文明（排除玩家选择的）
     std::vector<CivilizationType> getAvailableAICivilizations();
 
-    // UIԪ
+    // UI元素
     cocos2d::ui::Layout* _selectedPanel;
     cocos2d::Label* _selectedLabel;
     cocos2d::Label* _abilityLabel;
@@ -93,28 +98,30 @@ private:
     cocos2d::ui::Layout* _aiSettingsPanel;
     cocos2d::Label* _aiCountLabel;
     std::vector<cocos2d::ui::Button*> _aiButtons;
+    cocos2d::ui::Button* _quickAITurnsButton;
 
-    // Ϣб
+    // 文明信息列表
     std::vector<CivilizationInfo> _civilizations;
 
-    // ǰѡе
+    // 当前选中的玩家文明
     CivilizationType _currentSelection;
 
-    // AI
+    // AI玩家设置
     std::vector<AIPlayerSetting> _aiSettings;
     int _aiPlayerCount;
 
-    std::vector<cocos2d::ui::Button*> _civButtons;  // 洢ť
+    std::vector<cocos2d::ui::Button*> _civButtons;  // 存储文明按钮
 
-    cocos2d::Label* _leaderLabel;        // 
-    cocos2d::Label* _descriptionLabel;   // Ȼ
+    cocos2d::Label* _leaderLabel;        // 领袖名称
+    cocos2d::Label* _descriptionLabel;   // 自然语言描述
 
-    cocos2d::LayerColor* _portraitFrame; // 仭߿
+    cocos2d::LayerColor* _portraitFrame; // 领袖画像边框
 
-    // ̬洢ѡ
+    // 静态变量存储选择
     static CivilizationType s_selectedCivilization;
     static std::vector<AIPlayerSetting> s_aiPlayerSettings;
     static int s_aiPlayerCount;
+    static bool s_quickAITurns;
 };
 
 #endif // __CIVILIZATION_SELECTION_SCENE_H__
\ No newline at end of file
@@ -3,10 +3,53 @@
 #include "Map/GameMapLayer.h"
 #include "Development/ProductionProgram.h"
 #include "District/Building/Building.h"
+#include "District/Base/DistrictRegistry.h"
+#include "Units/Base/UnitRegistry.h"
 #include "algorithm"
 USING_NS_CC;
 
-//// =================== CityProductionPanel ʵ =================== ////
+ProgramInfo ProgramInfo::describe(const ProductionProgram* program)
+{
+	ProgramInfo info;
+	info.name = program->getName();
+	info.type = ProductionProgram::typeOfProgram(program->getID());
+	switch (info.type)
+	{
+	case ProductionProgram::ProductionType::UNIT:
+	{
+		UnitName id;
+		if (UnitRegistry::findByProgramId(program->getID(), id))
+		{
+			const UnitTypeInfo& def = UnitRegistry::info(id);
+			info.cost = def.cost;
+			info.goldCost = def.purchaseCost;
+		}
+		break;
+	}
+	case ProductionProgram::ProductionType::DISTRICT:
+	{
+		auto type = DistrictRegistry::findByProgramId(program->getID());
+		if (type != District::DistrictType::TO_BE_DEFINED)
+			info.cost = DistrictRegistry::info(type).cost;
+		info.canPurchase = false; // 区域不可以用黄金购买完成
+		break;
+	}
+	case ProductionProgram::ProductionType::BUILDING:
+	{
+		const Building::Definition& def = Building::findDefinition(info.name);
+		info.cost = def.cost;
+		info.canPurchase = def.canPurchase;
+		info.goldCost = def.purchaseCost;
+		info.districtName = def.districtName;
+		break;
+	}
+	default:
+		break;
+	}
+	return info;
+}
+
+//// =================== CityProductionPanel 类实现 =================== ////
 bool CityProductionPanel::init()
 {
 	if (!Layer::init())
@@ -19,29 +62,29 @@ bool CityProductionPanel::init()
 	auto visibleSize = Director::getInstance()->getVisibleSize();
 	auto panelSize = Size(visibleSize.width / 5, visibleSize.height);
 
-	// 
+	// 背景面板
 	this->PanelBG = ui::Layout::create();
 	PanelBG->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
-	PanelBG->setBackGroundColor(Color3B(0, 76, 153)); // ɫ
+	PanelBG->setBackGroundColor(Color3B(0, 76, 153)); // 深灰色背景
 	PanelBG->setContentSize(panelSize);
 	PanelBG->setPosition(Vec2(visibleSize.width - panelSize.width, 0));
 	this->addChild(PanelBG);
 
-	// 
+	// 生产面板
 	productionPanel = ProductionPanel::create();
 	PanelBG->addChild(productionPanel);
 
-	// ˿ڷ
+	// 人口分配面板
 	populationPanel = PopulationDistributionPanel::create();
 	PanelBG->addChild(populationPanel);
 
-	currentShownPanel = productionPanel; // Ĭʾб
-	populationPanel->setVisible(false); // ʼ˿ڷ
+	currentShownPanel = productionPanel; // 默认显示生产列表
+	populationPanel->setVisible(false); // 初始隐藏人口分配面板
 
-	// ť
+	// 面板拉出按钮
 	this->Pull = ui::Button::create();
 	this->Pull->setTitleText(" <[ ");
-	this->Pull->setTitleColor(Color3B::WHITE); // ɫ
+	this->Pull->setTitleColor(Color3B::WHITE); // 黄色文字
 	this->Pull->setTitleFontSize(36);
 	this->Pull->setPosition(Vec2(-Pull->getContentSize().width, 200));
 	this->Pull->addClickEventListener([=](Ref* sender) {
@@ -70,16 +113,16 @@ bool CityProductionPanel::init()
 	pullBg->setPosition(Pull->getPosition());
 	PanelBG->addChild(pullBg, -10);
 
-	// ʾ尴ť
+	// 显示生产面板按钮
 	this->showProductionPanel = ui::Button::create();
 	this->showProductionPanel->setTitleText("[ Production ]");
-	this->showProductionPanel->setTitleColor(Color3B(204, 204, 0)); // ɫ
+	this->showProductionPanel->setTitleColor(Color3B(204, 204, 0)); // 黄色文字
 	this->showProductionPanel->setTitleFontSize(24);
-	this->showProductionPanel->setPosition(Vec2(-showProductionPanel->getContentSize().width / 2, 250)); // ʼλ
+	this->showProductionPanel->setPosition(Vec2(-showProductionPanel->getContentSize().width / 2, 250)); // 初始位置在面板外
 	this->showProductionPanel->addClickEventListener([=](Ref* sender) {
 		if (currentShownPanel != productionPanel)
 		{
-			// е
+			// 切到生产面板
 			currentShownPanel = productionPanel;
 			this->populationPanel->setVisible(false);
 			this->productionPanel->setVisible(true);
@@ -87,25 +130,25 @@ bool CityProductionPanel::init()
 	});
 	PanelBG->addChild(this->showProductionPanel);
 
-	// ʾ尴ť
+	// 显示生产面板按钮背景
 	auto showProductionPanelBg = ui::Layout::create();
 	showProductionPanelBg->setContentSize(Size(showProductionPanel->getContentSize().width + 10, showProductionPanel->getContentSize().height + 10));
-	showProductionPanelBg->setBackGroundColor(Color3B(0, 76, 153)); // ɫ
+	showProductionPanelBg->setBackGroundColor(Color3B(0, 76, 153)); // 深蓝色背景
 	showProductionPanelBg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
 	showProductionPanelBg->setAnchorPoint(Vec2(0.5f, 0.5f));
 	showProductionPanelBg->setPosition(Vec2(showProductionPanel->getContentSize().width / 2, showProductionPanel->getContentSize().height / 2));
 	this->showProductionPanel->addChild(showProductionPanelBg, -1);
 
-	// ʾ˿ڷ尴ť
+	// 显示人口分配面板按钮
 	this->showPopulationPanel = ui::Button::create();
 	this->showPopulationPanel->setTitleText("[ Population Distribution ]");
-	this->showPopulationPanel->setTitleColor(Color3B(204, 204, 0)); // ɫ
+	this->showPopulationPanel->setTitleColor(Color3B(204, 204, 0)); // 黄色文字
 	this->showPopulationPanel->setTitleFontSize(24);
-	this->showPopulationPanel->setPosition(Vec2(-showPopulationPanel->getContentSize().width / 2, 300)); // ʼλ
+	this->showPopulationPanel->setPosition(Vec2(-showPopulationPanel->getContentSize().width / 2, 300)); // 初始位置在面板外
 	this->showPopulationPanel->addClickEventListener([=](Ref* sender) {
 		if (currentShownPanel != populationPanel)
 		{
-			// е˿ڷ
+			// 切到人口分配面板
 			currentShownPanel = populationPanel;
 			this->populationPanel->setVisible(true);
 			this->productionPanel->setVisible(false);
@@ -114,10 +157,10 @@ bool CityProductionPanel::init()
 	});
 	PanelBG->addChild(this->showPopulationPanel);
 
-	// ʾ˿ڷ尴ť
+	// 显示人口分配面板按钮背景
 	auto showPopulationPanelBg = ui::Layout::create();
 	showPopulationPanelBg->setContentSize(Size(showPopulationPanel->getContentSize().width + 10, showPopulationPanel->getContentSize().height + 10));
-	showPopulationPanelBg->setBackGroundColor(Color3B(0, 76, 153)); // ɫ
+	showPopulationPanelBg->setBackGroundColor(Color3B(0, 76, 153)); // 深蓝色背景
 	showPopulationPanelBg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
 	showPopulationPanelBg->setAnchorPoint(Vec2(0.5f, 0.5f));
 	showPopulationPanelBg->setPosition(Vec2(showPopulationPanel->getContentSize().width / 2, showPopulationPanel->getContentSize().height / 2));
@@ -125,7 +168,8 @@ bool CityProductionPanel::init()
 	return true;
 }
 
-void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentCity, std::vector<ProductionProgram*> programs[3])
+void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentCity, const std::vector<ProductionProgram*>& districts,
+	const std::vector<ProductionProgram*>& buildings, const std::vector<ProductionProgram*>& units)
 {
 	this->productionPanel->clear();
 	currentPlayerID = playerID;
@@ -133,15 +177,15 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 		return;
 	// Districts
 	bool firstPurchase = false;
-	if (!programs[0].empty())
+	if (!districts.empty())
 	{
 		productionPanel->createNewLabelItem(playerID, currentCity, "       Districts      ", PanelItem::ItemType::PRODUCT);
-		for (auto d: programs[0])
+		for (auto d: districts)
 		{
 			if (currentCity)
 			{
 				bool isAlreadyExisting = false;
-				for (auto currentDistrict : currentCity->districts)
+				for (auto currentDistrict : currentCity->getDistricts())
 				{
 					if (d->getID() == currentDistrict->getID())
 					{
@@ -149,7 +193,7 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 						break;
 					}
 				}
-				for (auto underProduction : currentCity->suspendedProductions)
+				for (auto underProduction : currentCity->getSuspendedProductions())
 				{
 					if (d->getID() == underProduction->getID())
 					{
@@ -157,16 +201,16 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 						break;
 					}
 				}
-				if (currentCity->currentProduction && d->getID() == currentCity->currentProduction->getID())
+				if (currentCity->getCurrentProduction() && d->getID() == currentCity->getCurrentProduction()->getID())
 				{
 					isAlreadyExisting = true;
 				}
 				if (isAlreadyExisting)
 					continue;
 			}
-			auto district = new District(playerID, Hex(), District::DistrictType::TO_BE_DEFINED, d->getName());
+			ProgramInfo district = ProgramInfo::describe(d);
 			productionPanel->createNewButtonItem(playerID, currentCity, PanelItem::ItemType::PRODUCT, district);
-			if(district->getCanPurchase())
+			if (district.canPurchase)
 			{
 				if (!firstPurchase)
 				{
@@ -178,15 +222,15 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 		}
 	}
 	firstPurchase = false;
-	if (!programs[1].empty())
+	if (!buildings.empty())
 	{
 		productionPanel->createNewLabelItem(playerID, currentCity, "       Buildings      ", PanelItem::ItemType::PRODUCT);
-		for (auto b : programs[1])
+		for (auto b : buildings)
 		{
 			if (currentCity)
 			{
 				bool isAlreadyExisting = false;
-				for (auto currentDistrict : currentCity->districts)
+				for (auto currentDistrict : currentCity->getDistricts())
 				{
 					for (auto currentBuilding : currentDistrict->getBuildings())
 					{
@@ -199,7 +243,7 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 					if (isAlreadyExisting)
 						break;
 				}
-				for (auto underProduction : currentCity->suspendedProductions)
+				for (auto underProduction : currentCity->getSuspendedProductions())
 				{
 					if (b->getID() == underProduction->getID())
 					{
@@ -207,7 +251,7 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 						break;
 					}
 				}
-				if (currentCity->currentProduction && b->getID() == currentCity->currentProduction->getID())
+				if (currentCity->getCurrentProduction() && b->getID() == currentCity->getCurrentProduction()->getID())
 				{
 					isAlreadyExisting = true;
 				}
@@ -215,24 +259,20 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 					continue;
 				
 			}
-			auto building = new Building(playerID, b->getName());
+			ProgramInfo building = ProgramInfo::describe(b);
 			bool prereqDistrictExist = false;
-			for (auto district : currentCity->districts)
+			for (auto district : currentCity->getDistricts())
 			{
-				if (district->getName() == building->getDistrictName())
+				if (district->getName() == building.districtName)
 				{
 					prereqDistrictExist = true;
 					break;
 				}
 			}
 			if (!prereqDistrictExist)
-			{
-				delete building;
-				building = nullptr;
 				continue;
-			}
 			productionPanel->createNewButtonItem(playerID, currentCity, PanelItem::ItemType::PRODUCT, building);
-			if (building->getCanPurchase())
+			if (building.canPurchase)
 			{
 				if (!firstPurchase)
 				{
@@ -244,14 +284,14 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 		}
 	}
 	firstPurchase = false;
-	if (!programs[2].empty())
+	if (!units.empty())
 	{
 		productionPanel->createNewLabelItem(playerID, currentCity, "         Units         ", PanelItem::ItemType::PRODUCT);
-		for (auto u : programs[2])
+		for (auto u : units)
 		{
-			auto unit = new AbstractUnit(u->getName());
+			ProgramInfo unit = ProgramInfo::describe(u);
 			productionPanel->createNewButtonItem(playerID, currentCity, PanelItem::ItemType::PRODUCT, unit);
-			if (unit->getCanPurchase())
+			if (unit.canPurchase)
 			{
 				if (!firstPurchase)
 				{
@@ -263,10 +303,10 @@ void CityProductionPanel::updateProductionPanel(int playerID, BaseCity* currentC
 		}
 	}
 	productionPanel->updateCurrentPanel(currentCity);
-	populationPanel->updatePanel(currentCity->populationDistribution, currentCity->population);
+	populationPanel->updatePanel(currentCity);
 }
 
-//// =============== PopulationDistributionPanel ʵ =============== ////
+//// =============== PopulationDistributionPanel 类实现 =============== ////
 bool PopulationDistributionPanel::init()
 {
 	if (!ui::Layout::init())
@@ -276,25 +316,26 @@ bool PopulationDistributionPanel::init()
 	auto visibleSize = Director::getInstance()->getVisibleSize();
 	auto panelSize = Size(visibleSize.width / 5, visibleSize.height - 100);
 
-	// ʼ˿ڷ߼
-	visible = false; // ʼΪ״̬
+	// 初始化人口分配面板的逻辑
+	visible = false; // 初始为隐藏状态
+	selected = false;
 
 	this->workedTilesList = ui::ScrollView::create();
-	this->workedTilesList->setDirection(ui::ScrollView::Direction::VERTICAL); // ֱ
+	this->workedTilesList->setDirection(ui::ScrollView::Direction::VERTICAL); // 垂直滚动
 	this->workedTilesList->setBounceEnabled(true);
-	this->workedTilesList->setContentSize(panelSize); // productionPanelСͬ
+	this->workedTilesList->setContentSize(panelSize); // 和productionPanel大小相同
 	this->workedTilesList->setContentSize(Size(panelSize.width - 20, panelSize.height - 80));
 	this->workedTilesList->setScrollBarWidth(5);
 	this->addChild(this->workedTilesList);
 
-	// 
+	// 标题
 	this->title = Label::createWithSystemFont("      Population Distribution    ", "Arial", 24);
 	this->title->setTextColor(Color4B(Color3B(0, 76, 153)));
 	this->title->setContentSize(Size(panelSize.width, 40));
 	this->title->setPosition(Vec2(panelSize.width / 2, panelSize.height - title->getContentSize().height / 2));
 	this->addChild(this->title);
 
-	// Ϊӱ
+	// 为标题添加背景
 	auto titleBg = ui::Layout::create();
 	titleBg->setContentSize(Size(panelSize.width, title->getContentSize().height + 10));
 	titleBg->setBackGroundColor(Color3B(153, 204, 255));
@@ -306,28 +347,46 @@ bool PopulationDistributionPanel::init()
 	return true;
 }
 
-void PopulationDistributionPanel::updatePanel(std::map<Hex, int> populationDistribution, int population)
+void PopulationDistributionPanel::updatePanel(BaseCity* city)
 {
-	int unallocated = population;
-	// յǰб
+	// 同一城市且领土没有变化：列表项不变，只刷新状态
+	if (city == _city && _items.size() == city->getPopulationDistribution().size())
+	{
+		refreshItemStates();
+		return;
+	}
+
+	// 清空当前列表
 	this->workedTilesList->removeAllChildren();
-	currentDistribution = populationDistribution;
-	// ӵؿϢ
-	for (auto& tile : currentDistribution)
+	_items.clear();
+	_city = city;
+	selected = false;
+	// 重新添加地块信息
+	for (auto& tile : city->getPopulationDistribution())
 	{
-		bool isWorked = (currentDistribution[tile.first] > 0);
-		createNewItem(tile.first, isWorked);
-		if (isWorked)
-			unallocated--;
+		createNewItem(tile.first, tile.second > 0);
 	}
-	// ±ʾ˿Ϣ
+	refreshItemStates();
+}
+
+void PopulationDistributionPanel::refreshItemStates()
+{
+	if (!_city)
+		return;
+	for (auto& entry : _items)
+	{
+		auto it = _city->getPopulationDistribution().find(entry.first);
+		bool isWorked = it != _city->getPopulationDistribution().end() && it->second > 0;
+		entry.second->setTitleColor(isWorked ? Color3B::BLUE : Color3B(128, 128, 128)); // 已耕作为蓝色，未耕作为灰色
+	}
+	// 更新标题显示人口信息
 	this->title->setString(
-		"         Unallocated: " + std::to_string(unallocated) + "/ Total: " + std::to_string(population));
+		"         Unallocated: " + std::to_string(_city->getUnallocated()) + "/ Total: " + std::to_string(_city->getPopulation()));
 }
 
 void PopulationDistributionPanel::manualDistribute(Hex tileIndex)
 {
-	// ֶ˿ڵָؿ߼
+	// 手动分配人口到指定地块的逻辑
 
 }
 
@@ -335,30 +394,30 @@ void PopulationDistributionPanel::addListItem(Node* item)
 {
 	auto innerContainer = workedTilesList->getInnerContainer();
 	float itemHeight = item->getContentSize().height;
-	float spacing = 15.f; // item֮ļ
+	float spacing = 15.f; // item之间的间距
 
-	// itemܸ߶ȣࣩ
+	// 计算所有已有item的总高度（包括间距）
 	float totalChildrenHeight = 0;
 	auto children = innerContainer->getChildren();
 	for (auto child : children) {
 		totalChildrenHeight += child->getContentSize().height + spacing;
 	}
 
-	// itemYλãĶʼУ
+	// 计算新item的Y位置（从容器的顶部开始往下排列）
 	float yPos = innerContainer->getContentSize().height - itemHeight / 2 - spacing - totalChildrenHeight;
 
-	// λ
+	// 设置位置
 	item->setPosition(Vec2(workedTilesList->getContentSize().width / 2, yPos));
 
-	// СҪ
-	float newTotalHeight = totalChildrenHeight + itemHeight + spacing * 2; // ͵ײļ
+	// 更新容器大小（如果需要）
+	float newTotalHeight = totalChildrenHeight + itemHeight + spacing * 2; // 顶部和底部的间距
 	if (newTotalHeight > innerContainer->getContentSize().height) {
 		innerContainer->setContentSize(Size(
 			innerContainer->getContentSize().width,
 			newTotalHeight
 		));
 
-		// itemλãΪ߶ȱ
+		// 调整所有item的位置，因为容器高度变了
 		float heightDiff = newTotalHeight - innerContainer->getContentSize().height;
 		for (auto child : children) {
 			child->setPositionY(child->getPosition().y + heightDiff);
@@ -369,68 +428,59 @@ void PopulationDistributionPanel::addListItem(Node* item)
 	innerContainer->addChild(item);
 }
 
-void PopulationDistributionPanel::createNewItem(Hex tile, bool isWorked) // µĵؿĿ
+void PopulationDistributionPanel::createNewItem(Hex tile, bool isWorked) // 创建新的地块项目
 {
 	auto item = ui::Button::create();
 	item->setTitleText("Tile (" + std::to_string(tile.q) + ", " + std::to_string(tile.r) + ")");
-	item->setTitleColor(isWorked ? Color3B::BLUE : Color3B(128, 128, 128)); // ѸΪɫδΪɫ
+	item->setTitleColor(isWorked ? Color3B::BLUE : Color3B(128, 128, 128)); // 已耕作为蓝色，未耕作为灰色
 	item->setTitleFontSize(18);
 	item->setContentSize(Size(this->workedTilesList->getContentSize().width - 20, 40));
-	// Ϊťӱ
+	// 为按钮添加背景
 	auto bg = ui::Layout::create();
 	bg->setContentSize(Size(item->getContentSize().width + 20, item->getContentSize().height + 10));
-	bg->setBackGroundColor(Color3B(153, 204, 255)); // ǳɫ
+	bg->setBackGroundColor(Color3B(153, 204, 255)); // 浅蓝色背景
 	bg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
 	bg->setAnchorPoint(Vec2(0.5f, 0.5f));
 	bg->setPosition(Vec2(item->getContentSize().width / 2, item->getContentSize().height / 2));
 	item->addChild(bg, -1);
-	// ťʱֶ˿
+	// 点击按钮时手动分配人口
 	item->addClickEventListener([=](Ref* sender) {
 		if (selected)
 		{
 			if (selectedTile == tile)
 			{
-				// ȡѡõؿ
+				// 取消选择该地块
 				selected = false;
-				bg->setBackGroundColor(Color3B(153, 204, 255)); // ָɫ
+				bg->setBackGroundColor(Color3B(153, 204, 255)); // 恢复背景颜色
 			}
 			else
 			{
-				// ˿ڴselectedTiletile
-				if (currentDistribution[selectedTile] == 1 && currentDistribution[tile] == 0) // ״̬
-				{
-					currentDistribution[tile] = 1;
-					item->setTitleColor(Color3B::BLUE); // ΪѸɫ
-					currentDistribution[selectedTile] = 0;
-					selectedItem->setTitleColor(Color3B(128, 128, 128)); // ֮ǰѡеĵؿΪδɫ
-				}
-				else if (currentDistribution[selectedTile] == 0 && currentDistribution[tile] == 1)
+				// 在两个地块之间调动人口（写回城市，只刷新列表项状态）
+				if (_city && (_city->moveCitizen(selectedTile, tile) || _city->moveCitizen(tile, selectedTile)))
 				{
-					currentDistribution[tile] = 0;
-					item->setTitleColor(Color3B(128, 128, 128)); // Ϊδɫ
-					currentDistribution[selectedTile] = 1;
-					selectedItem->setTitleColor(Color3B::BLUE); // ֮ǰѡеĵؿΪѸɫ
+					refreshItemStates();
 				}
-				selectedItemBg->setBackGroundColor(Color3B(153, 204, 255)); // ָɫ
+				selectedItemBg->setBackGroundColor(Color3B(153, 204, 255)); // 恢复背景颜色
 				bg->setPosition(Vec2(item->getContentSize().width / 2, item->getContentSize().height / 2));
 				selected = false;
 			}
 		}
 		else
 		{
-			// ѡõؿ
+			// 选择该地块
 			selected = true;
 			selectedTile = tile;
 			selectedItem = item;
 			selectedItemBg = bg;
-			bg->setBackGroundColor(Color3B::YELLOW); // ɫʾѡ
+			bg->setBackGroundColor(Color3B::YELLOW); // 黄色背景表示选中
 		}
 	});
 	
+	_items[tile] = item;
 	addListItem(item);
 }
 
-//// ===================== ProductionPanel ʵ ===================== ////
+//// ===================== ProductionPanel 类实现 ===================== ////
 bool ProductionPanel::init()
 {
 	if (!ui::Layout::init())
@@ -443,10 +493,10 @@ bool ProductionPanel::init()
 	auto visibleSize = Director::getInstance()->getVisibleSize();
 	auto panelSize = Size(visibleSize.width / 5, visibleSize.height);
 	
-	// ťл: 
+	// 按钮切换: 生产
 	this->ProductButton = ui::Button::create();
 	this->ProductButton->setTitleText("[ Product ]");
-	this->ProductButton->setTitleColor(Color3B(204, 204, 0)); // ɫ
+	this->ProductButton->setTitleColor(Color3B(204, 204, 0)); // 黄色文字
 	this->ProductButton->setTitleFontSize(20);
 	this->ProductButton->setPosition(Vec2(70, panelSize.height - 80));
 	this->ProductButton->addClickEventListener([=](Ref* sender) {
@@ -455,10 +505,10 @@ bool ProductionPanel::init()
 		});
 	this->addChild(this->ProductButton);
 
-	// ťл: 
+	// 按钮切换: 购买
 	this->PurchaseButton = ui::Button::create();
 	this->PurchaseButton->setTitleText("[ Purchase ]");
-	this->PurchaseButton->setTitleColor(Color3B(255, 255, 51)); // ǳɫ
+	this->PurchaseButton->setTitleColor(Color3B(255, 255, 51)); // 浅黄色文字
 	this->PurchaseButton->setTitleFontSize(20);
 	this->PurchaseButton->setPosition(Vec2(60 + panelSize.width / 2, panelSize.height - 80));
 	this->PurchaseButton->addClickEventListener([=](Ref* sender) {
@@ -467,35 +517,35 @@ bool ProductionPanel::init()
 		});
 	this->addChild(this->PurchaseButton);
 
-	// б
+	// 生产列表
 	this->ProductList = ui::ScrollView::create();
-	this->ProductList->setDirection(ui::ScrollView::Direction::VERTICAL); // ֱ
+	this->ProductList->setDirection(ui::ScrollView::Direction::VERTICAL); // 垂直滚动
 	this->ProductList->setBounceEnabled(true);
 	this->ProductList->setContentSize(Size(panelSize.width - 20, panelSize.height - 100));
 	this->ProductList->setPosition(Vec2(10, 10));
-	this->ProductList->setInnerContainerSize(Size(panelSize.width - 20, 0)); // ʼݴС
-	this->ProductList->setVisible(true); // Ĭʾб
+	this->ProductList->setInnerContainerSize(Size(panelSize.width - 20, 0)); // 初始内容大小
+	this->ProductList->setVisible(true); // 默认显示生产列表
 	this->addChild(this->ProductList);
 
-	// б
+	// 购买列表
 	this->PurchaseList = ui::ScrollView::create();
-	this->PurchaseList->setDirection(ui::ScrollView::Direction::VERTICAL); // ֱ
+	this->PurchaseList->setDirection(ui::ScrollView::Direction::VERTICAL); // 垂直滚动
 	this->PurchaseList->setBounceEnabled(true);
 	this->PurchaseList->setContentSize(Size(panelSize.width - 20, panelSize.height - 100));
 	this->PurchaseList->setPosition(Vec2(10, 10));
-	this->PurchaseList->setInnerContainerSize(Size(panelSize.width - 20, 0)); // ʼݴС
-	this->PurchaseList->setVisible(false); // Ĭعб
+	this->PurchaseList->setInnerContainerSize(Size(panelSize.width - 20, 0)); // 初始内容大小
+	this->PurchaseList->setVisible(false); // 默认隐藏购买列表
 	this->addChild(this->PurchaseList);
 
-	// ǰ
+	// 当前生产
 	currentProductionInfo = Label::createWithSystemFont("No Production Program Now.", "Arial", 20);
-	currentProductionInfo->setColor(Color3B::BLACK); // ɫ
+	currentProductionInfo->setColor(Color3B::BLACK); // 白色文字
 	currentProductionInfo->setPosition(0, 0);
 	currentProductionInfo->setAnchorPoint(Vec2(0, 0));
 	currentProductionInfo->setContentSize(Size(this->ProductList->getContentSize().width - 20, 50));
 	auto bg = ui::Layout::create();
 	bg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
-	bg->setBackGroundColor(Color3B(153, 204, 255)); // ǳɫ
+	bg->setBackGroundColor(Color3B(153, 204, 255)); // 浅蓝色背景
 	bg->setContentSize(Size(panelSize.width, currentProductionInfo->getContentSize().height));
 	currentProductionInfo->addChild(bg, -1);
 	this->addChild(currentProductionInfo, 50);
@@ -506,30 +556,30 @@ void ProductionPanel::addListItem(cocos2d::ui::ScrollView* listView, Node* item)
 {
 	auto innerContainer = listView->getInnerContainer();
 	float itemHeight = item->getContentSize().height;
-	float spacing = 10.f; // item֮ļ
+	float spacing = 10.f; // item之间的间距
 
-	// itemܸ߶ȣࣩ
+	// 计算所有已有item的总高度（包括间距）
 	float totalChildrenHeight = 0;
 	auto children = innerContainer->getChildren();
 	for (auto child : children) {
 		totalChildrenHeight += child->getContentSize().height + spacing;
 	}
 
-	// itemYλãĶʼУ
+	// 计算新item的Y位置（从容器的顶部开始往下排列）
 	float yPos = innerContainer->getContentSize().height - itemHeight / 2 - spacing - totalChildrenHeight;
 
-	// λ
+	// 设置位置
 	item->setPosition(Vec2(listView->getContentSize().width / 2, yPos));
 
-	// СҪ
-	float newTotalHeight = totalChildrenHeight + itemHeight + spacing * 2; // ͵ײļ
+	// 更新容器大小（如果需要）
+	float newTotalHeight = totalChildrenHeight + itemHeight + spacing * 2; // 顶部和底部的间距
 	if (newTotalHeight > innerContainer->getContentSize().height) {
 		innerContainer->setContentSize(Size(
 			innerContainer->getContentSize().width,
 			newTotalHeight
 		));
 
-		// itemλãΪ߶ȱ
+		// 调整所有item的位置，因为容器高度变了
 		float heightDiff = newTotalHeight - innerContainer->getContentSize().height;
 		for (auto child : children) {
 			child->setPositionY(child->getPosition().y + heightDiff);
@@ -540,7 +590,7 @@ void ProductionPanel::addListItem(cocos2d::ui::ScrollView* listView, Node* item)
 	innerContainer->addChild(item, 50);
 }
 
-void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, PanelItem::ItemType toWhichList, ProductionProgram* program)
+void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, PanelItem::ItemType toWhichList, const ProgramInfo& program)
 {
 	auto player = GameManager::getInstance()->getPlayer(playerID);
 	auto visibleSize = Director::getInstance()->getVisibleSize();
@@ -548,48 +598,45 @@ void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, P
 	auto newItem = ui::Button::create();
 	if(toWhichList == PanelItem::ItemType::PRODUCT)
 	{
-		newItem->setTitleText(program->getName() +
+		newItem->setTitleText(program.name +
 			"     cost:" +
-			std::to_string(program->getCost() / currentCity->getCityYield().productionYield + 1) +
+			std::to_string(program.cost / currentCity->getCityYield().productionYield + 1) +
 			" turns");
 	}
 	else
 	{
-		newItem->setTitleText(program->getName() +
+		newItem->setTitleText(program.name +
 			"     cost:" +
-			std::to_string(program->getPurchaseCost()) +
+			std::to_string(program.goldCost) +
 			" golds");
 	}
 	newItem->setTitleColor(Color3B::WHITE);
 	newItem->setTitleFontSize(22);
-	newItem->setContentSize(Size(this->ProductList->getContentSize().width - 20, (program->getType() == ProductionProgram::ProductionType::BUILDING) ? 120 : 50));
+	newItem->setContentSize(Size(this->ProductList->getContentSize().width - 20, (program.type == ProductionProgram::ProductionType::BUILDING) ? 120 : 50));
 	newItem->addClickEventListener([=](Ref* sender) {
-		// ֱʹ currentCityҪг
-		if (program->getType() == ProductionProgram::ProductionType::DISTRICT)
+		// 直接使用 currentCity，不需要遍历所有城市
+		if (program.type == ProductionProgram::ProductionType::DISTRICT)
 		{
-			auto newProgram = new District(currentPlayer, 
-				Hex(),
-				District::DistrictType::TO_BE_DEFINED, 
-				program->getName());
+			District::DistrictType districtType = DistrictRegistry::findByName(program.name);
 			auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
 			if (!gameScene) return;
 
 			auto _mapLayer = gameScene->getMapLayer();
 			if (!_mapLayer) return;
 
-			// ǷѾѡģʽ
+			// 检查是否已经在选择模式中
 			bool isSelecting = _mapLayer->isSelectingTile();
 
 			if (!isSelecting)
 			{
-				// ȡеĿɽؿ飨ųˮɽȣ
-				auto allTerritory = currentCity->getTerritory();
+				// 获取城市的可建造地块（排除水域、山脉等）
+				const auto& allTerritory = currentCity->getTerritory();
 				std::vector<Hex> allowedTiles;
 
-				for (Hex& hex : allTerritory)
+				for (const Hex& hex : allTerritory)
 				{
-					// ؿǷʺϽ
-					if (newProgram->canErectDistrict(hex))
+					// 检查地块是否适合建造区域
+					if (District::canErectAt(districtType, currentPlayer, hex))
 					{
 						allowedTiles.push_back(hex);
 					}
@@ -601,15 +648,15 @@ void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, P
 					return;
 				}
 
-				// õؿѡģʽ
+				// 启用地块选择模式
 				_mapLayer->enableTileSelection(allowedTiles,
 					[this, currentCity, toWhichList, program, gameScene](Hex selectedHex) {
-						// µ
+						// 创建新的区域对象
 						District* newDistrict = new District(
 							currentPlayer,
 							selectedHex,
 							District::DistrictType::TO_BE_DEFINED,
-							program->getName()
+							program.name
 						);
 
 						if (newDistrict)
@@ -626,28 +673,27 @@ void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, P
 					},
 					[this, gameScene]() {
 						CCLOG("Building location selection cancelled");
-						// ȡѡ
+						// 这里可以添加取消选择后的清理工作
 					}
 				);
 			}
 			else
 			{
-				// Ѿѡģʽȡ
+				// 如果已经在选择模式，取消它
 				gameScene->cancelTileSelection(true);
 			}
-			delete newProgram;
 		}
-		// ͵ĽҪѡλã
+		// 处理其他类型的建筑（不需要选择位置）
 		else
 		{
-			// ֱӵУҪѡλ
+			// 直接添加到城市，不需要选择位置
 			if (toWhichList == PanelItem::ItemType::PRODUCT)
 			{
-				currentCity->addNewProduction(new ProductionProgram(*program));
+				currentCity->addNewProduction(ProductionProgram::acquire(program.type, program.name, Hex(), program.cost, program.canPurchase, program.goldCost));
 			}
 			else
 			{
-				currentCity->purchaseDirectly(new ProductionProgram(*program));
+				currentCity->purchaseDirectly(ProductionProgram::acquire(program.type, program.name, Hex(), program.cost, program.canPurchase, program.goldCost));
 			}
 		}
 		this->updateCurrentPanel(currentCity);
@@ -657,45 +703,45 @@ void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, P
 
 	auto bg = ui::Layout::create();
 	bg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
-	bg->setBackGroundColor(Color3B(0, 102, 204)); // ǳɫ
-	bg->setContentSize(Size(panelSize.width - 80, (program->getType() == ProductionProgram::ProductionType::BUILDING) ? 100 : 50));
+	bg->setBackGroundColor(Color3B(0, 102, 204)); // 浅蓝色背景
+	bg->setContentSize(Size(panelSize.width - 80, (program.type == ProductionProgram::ProductionType::BUILDING) ? 100 : 50));
 	bg->setAnchorPoint(Vec2(0.5f, 0.5f));
-	newItem->setPosition(Vec2(bg->getContentSize().width / 2, bg->getContentSize().height / 2 - (program->getType() == ProductionProgram::ProductionType::BUILDING) ? 20 : 0));
+	newItem->setPosition(Vec2(bg->getContentSize().width / 2, bg->getContentSize().height / 2 - (program.type == ProductionProgram::ProductionType::BUILDING) ? 20 : 0));
 	bg->addChild(newItem, 10);
 
-	if (program->getType() == ProductionProgram::ProductionType::BUILDING)
+	if (program.type == ProductionProgram::ProductionType::BUILDING)
 	{
-		// ȡƣʵʽ
-		std::string districtName = dynamic_cast<Building*>(program)->getDistrictName();
+		// 获取建筑所属区域名称（不创建实际建筑对象）
+		const std::string& districtName = program.districtName;
 
-		// 
+		// 创建顶部条
 		auto topBar = ui::Layout::create();
 		topBar->setContentSize(Size(panelSize.width - 80, 30));
 		topBar->setBackGroundColorType(Layout::BackGroundColorType::SOLID);
-		topBar->setBackGroundColor(Color3B(204, 204, 0)); // ɫ
+		topBar->setBackGroundColor(Color3B(204, 204, 0)); // 土黄色
 
-		// Ʊǩ - ȷĳߴ
+		// 添加区域名称标签 - 设置正确的尺寸和属性
 		auto districtLabel = Label::createWithSystemFont(
 			"For: " + districtName, "Arial", 18);
 
-		// ؼ޸ñǩߴ
-		districtLabel->setDimensions(topBar->getContentSize().width - 20, 30); // ұ߾
-		districtLabel->setOverflow(Label::Overflow::SHRINK); // ıʱԶС
+		// 关键修复：设置标签尺寸和溢出处理
+		districtLabel->setDimensions(topBar->getContentSize().width - 20, 30); // 留出左右边距
+		districtLabel->setOverflow(Label::Overflow::SHRINK); // 文本过长时自动缩小
 		districtLabel->setHorizontalAlignment(TextHAlignment::LEFT);
 		districtLabel->setVerticalAlignment(TextVAlignment::CENTER);
 		districtLabel->setTextColor(Color4B::BLUE);
 
-		// êλ
-		districtLabel->setAnchorPoint(Vec2::ZERO); // ϽǶ
-		districtLabel->setPosition(Vec2(10, 0)); // 10px
+		// 设置锚点和位置
+		districtLabel->setAnchorPoint(Vec2::ZERO); // 左上角对齐
+		districtLabel->setPosition(Vec2(10, 0)); // 距离左边10px
 
 		topBar->addChild(districtLabel);
 
-		// ӵ
+		// 将顶部条添加到背景
 		topBar->setPosition(Vec2(0, bg->getContentSize().height - 30));
 		bg->addChild(topBar);
 
-		// ťλ
+		// 调整按钮位置
 		newItem->setPosition(Vec2(bg->getContentSize().width / 2,
 			bg->getContentSize().height / 2 - 15));
 	}
@@ -715,11 +761,11 @@ void ProductionPanel::createNewButtonItem(int playerID, BaseCity* currentCity, P
 void ProductionPanel::createNewLabelItem(int player, BaseCity* currentCity, std::string text, PanelItem::ItemType toWhichList)
 {
 	auto newItem = Label::createWithSystemFont(text, "Arial", 22);
-	newItem->setColor(Color3B(0, 76, 153)); // ɫ
+	newItem->setColor(Color3B(0, 76, 153)); // 蓝色文字
 	newItem->setContentSize(Size(this->ProductList->getContentSize().width - 20, 50));
 	auto bg = ui::Layout::create();
 	bg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
-	bg->setBackGroundColor(Color3B(153, 204, 255)); // ǳɫ
+	bg->setBackGroundColor(Color3B(153, 204, 255)); // 浅蓝色背景
 	bg->setContentSize(newItem->getContentSize());
 	newItem->addChild(bg, -1);
 	if (toWhichList == PanelItem::ItemType::PRODUCT)
@@ -734,7 +780,7 @@ void ProductionPanel::createNewLabelItem(int player, BaseCity* currentCity, std:
 
 void ProductionPanel::updateCurrentPanel(BaseCity* currentCity)
 {
-	// Ƴɵıǩֹظӣ
+	// 移除旧的标签（防止重复添加）
 	if (currentProductionInfo) {
 		currentProductionInfo->removeFromParent();
 		currentProductionInfo = nullptr;
@@ -745,34 +791,34 @@ void ProductionPanel::updateCurrentPanel(BaseCity* currentCity)
 
 	std::string productionInfo;
 
-	// Ƿеǰ
-	if (currentCity->currentProduction)
+	// 检查是否有当前生产
+	if (currentCity->getCurrentProduction())
 	{
-		int cost = currentCity->currentProduction->getCost();
-		int progress = currentCity->currentProduction->getProgress();
+		int cost = currentCity->getCurrentProduction()->getCost();
+		int progress = currentCity->getCurrentProduction()->getProgress();
 		int productionPerTurn = currentCity->getCityYield().productionYield;
 
-		// ʣغʹȡ
+		// 计算剩余回合数（使用向上取整）
 		int remainingCost = cost - progress;
 		int remainingTurns = 0;
 
 		if (productionPerTurn > 0) {
-			// ȡ(a + b - 1) / b
+			// 向上取整除法：(a + b - 1) / b
 			remainingTurns = (remainingCost + productionPerTurn - 1) / productionPerTurn;
 		}
 		else {
-			remainingTurns = 999; // Ϊ0ʾֵ
+			remainingTurns = 999; // 生产为0，显示极大值
 		}
 
-		// ʣغΪ0˵Ѿɣ򼴽ɣ
+		// 如果剩余回合为0，说明已经完成（或即将完成）
 		if (remainingTurns <= 0) {
 			productionInfo = "Program Producing: " +
-				currentCity->currentProduction->getName() +
+				currentCity->getCurrentProduction()->getName() +
 				", completing this turn";
 		}
 		else {
 			productionInfo = "Program Producing: " +
-				currentCity->currentProduction->getName() +
+				currentCity->getCurrentProduction()->getName() +
 				", " + std::to_string(remainingTurns) +
 				" turns left";
 		}
@@ -782,7 +828,7 @@ void ProductionPanel::updateCurrentPanel(BaseCity* currentCity)
 		productionInfo = "No Production Program Now.";
 	}
 
-	// ±ǩ
+	// 创建新标签
 	currentProductionInfo = Label::createWithSystemFont(productionInfo, "Arial", 20);
 	currentProductionInfo->setColor(Color3B::BLACK);
 	currentProductionInfo->setPosition(0, 0);
@@ -793,28 +839,28 @@ void ProductionPanel::updateCurrentPanel(BaseCity* currentCity)
 
 	auto bg = ui::Layout::create();
 	bg->setBackGroundColorType(ui::Layout::BackGroundColorType::SOLID);
-	bg->setBackGroundColor(Color3B(153, 204, 255)); // ǳɫ
+	bg->setBackGroundColor(Color3B(153, 204, 255)); // 浅蓝色背景
 	bg->setContentSize(Size(panelSize.width, 50));
 	bg->setAnchorPoint(Vec2(0, 0));
 	bg->setPosition(Vec2(0, 0));
 
-	// ӵthisǱǩӵ
+	// 将背景添加到this，而不是标签添加到背景
 	this->addChild(bg, -1);
 	this->addChild(currentProductionInfo, 50);
 }
 
 void ProductionPanel::clear() {
-	// Ƴ
+	// 遍历移除
 	auto container1 = ProductList->getInnerContainer();
-	container1->removeAllChildrenWithCleanup(true); // trueʾͬʱڴ
+	container1->removeAllChildrenWithCleanup(true); // true表示同时清理内存
 	
-	// ʹԶ岼֣ҪݴС
+	// 如果使用了自定义布局，需要重置内容大小
 	container1->setContentSize(ProductList->getContentSize());
 
-	// Ƴ
+	// 遍历移除
 	auto container2 = PurchaseList->getInnerContainer();
-	container2->removeAllChildrenWithCleanup(true); // trueʾͬʱڴ
+	container2->removeAllChildrenWithCleanup(true); // true表示同时清理内存
 
-	// ʹԶ岼֣ҪݴС
+	// 如果使用了自定义布局，需要重置内容大小
 	container2->setContentSize(PurchaseList->getContentSize());
 }
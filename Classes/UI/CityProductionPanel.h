@@ -17,27 +17,34 @@ public:
 	bool init();
 	CREATE_FUNC(PopulationDistributionPanel);
 
-	void updatePanel(std::map<Hex, int> populationDistribution, int population);
-	void manualDistribute(Hex tileIndex); // ֶ˿ڵָؿ
-	void addListItem(Node* item); // бĿ
-	void createNewItem(Hex tile, bool isWorked); // µĵؿĿ
-	std::map<Hex, int> currentDistribution; // ǰ״̬
-	ui::ScrollView* workedTilesList; // ʾؿб
+	void updatePanel(BaseCity* city); // 同一城市且领土未变时只刷新状态，否则重建列表
+	void manualDistribute(Hex tileIndex); // 手动分配人口到指定地块
+	void addListItem(Node* item); // 向列表中添加项目
+	void createNewItem(Hex tile, bool isWorked); // 创建新的地块项目
+	void refreshItemStates(); // 按城市当前分配刷新各项颜色与标题
+	ui::ScrollView* workedTilesList; // 显示耕作地块的列表
 private:
+	BaseCity* _city = nullptr; // 当前显示的城市
+	std::map<Hex, ui::Button*> _items; // 地块 -> 列表项
 	bool visible;
-	bool selected; // еؿ鱻ѡн˿ڣΪfalseselectedTileʹ
-	Hex selectedTile; // ѡеĵؿ(ֶʱõ)
-	ui::Button* selectedItem; // ѡеĵؿӦİť
-	ui::Layout* selectedItemBg; // ѡеؿ鰴ťı
-	Label* title; // (˿Ϣ)
+	bool selected; // 有地块被选中将调走人口，否则为false，与selectedTile配合使用
+	Hex selectedTile; // 选中的地块(当手动调整时用到)
+	ui::Button* selectedItem; // 选中的地块对应的按钮
+	ui::Layout* selectedItemBg; // 选中地块按钮的背景
+	Label* title; // 标题(带有人口信息)
 };
 
+// 生产面板条目的显示数据：直接从单位/区域/建筑的类型定义读取，不为每个条目创建对象
 struct ProgramInfo {
 	std::string name;
+	ProductionProgram::ProductionType type;
 	int cost;
 	bool canPurchase;
 	int goldCost;
-	ProgramInfo() : name(""), cost(0), canPurchase(true), goldCost(0) {}
+	std::string districtName; // 建筑所属区域（仅建筑有效）
+	ProgramInfo() : name(""), type(ProductionProgram::ProductionType::TO_BE_DEFINED), cost(0), canPurchase(true), goldCost(0) {}
+
+	static ProgramInfo describe(const ProductionProgram* program); // 按项目ID/名称查类型定义
 };
 
 class PanelItem : public cocos2d::ui::Button {
@@ -96,7 +103,7 @@ public:
 	bool init();
 	CREATE_FUNC(ProductionPanel);
 	void addListItem(cocos2d::ui::ScrollView* listView, Node* item);
-	void createNewButtonItem(int player, BaseCity* currentCity, PanelItem::ItemType toWhichList, ProductionProgram* program);
+	void createNewButtonItem(int player, BaseCity* currentCity, PanelItem::ItemType toWhichList, const ProgramInfo& program);
 	void createNewLabelItem(int player, BaseCity* currentCity, std::string text, PanelItem::ItemType toWhichList);
 	void updateCurrentPanel(BaseCity* currentCity);
 	void clear();
@@ -119,18 +126,19 @@ class CityProductionPanel : public cocos2d::Layer {
 public:
 	bool init();
 	CREATE_FUNC(CityProductionPanel);
-	void updateProductionPanel(int playerID, BaseCity* currrentCity, std::vector<ProductionProgram*> programs[3]);
-	PopulationDistributionPanel* populationPanel; // ˿ڷ
-	ProductionPanel* productionPanel; // 
+	void updateProductionPanel(int playerID, BaseCity* currrentCity, const std::vector<ProductionProgram*>& districts,
+		const std::vector<ProductionProgram*>& buildings, const std::vector<ProductionProgram*>& units);
+	PopulationDistributionPanel* populationPanel; // 人口分配面板
+	ProductionPanel* productionPanel; // 生产面板
 private:
 	bool visible;
 	int currentPlayerID;
 	cocos2d::ui::Layout* PanelBG;
 	
-	cocos2d::ui::Button* Pull; // ȡť
-	cocos2d::ui::Button* showProductionPanel; // ʾ尴ť
-	cocos2d::ui::Button* showPopulationPanel; // ʾ˿ڷ尴ť
-	cocos2d::Node* currentShownPanel; // ǰʾ
+	cocos2d::ui::Button* Pull; // 拉取按钮
+	cocos2d::ui::Button* showProductionPanel; // 显示生产面板按钮
+	cocos2d::ui::Button* showPopulationPanel; // 显示人口分配面板按钮
+	cocos2d::Node* currentShownPanel; // 当前显示的面板
 };
 
 
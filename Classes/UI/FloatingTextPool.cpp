@@ -0,0 +1,87 @@
+#include "FloatingTextPool.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+FloatingTextPool* FloatingTextPool::s_instance = nullptr;
+
+FloatingTextPool* FloatingTextPool::getInstance() {
+    if (!s_instance) {
+        s_instance = new FloatingTextPool();
+    }
+    return s_instance;
+}
+
+Label* FloatingTextPool::acquire(Node* parent, const std::string& text, float fontSize,
+                                 const Color3B& color, int zOrder) {
+    Label* label = nullptr;
+    if (!_free.empty() || reclaimOrphans()) {
+        label = _free.back();
+        _free.pop_back();
+        label->setSystemFontSize(fontSize);
+        label->setString(text);
+        _stats.hits++;
+    }
+    else {
+        label = Label::createWithSystemFont(text, "Arial", fontSize);
+        label->retain();
+        _stats.misses++;
+    }
+
+    label->setColor(color);
+    parent->addChild(label, zOrder);
+    _active.push_back(label);
+    return label;
+}
+
+void FloatingTextPool::release(Label* label) {
+    auto it = std::find(_active.begin(), _active.end(), label);
+    if (it == _active.end())
+        return;
+    *it = _active.back();
+    _active.pop_back();
+
+    label->removeFromParentAndCleanup(true);
+    reset(label);
+    _free.push_back(label);
+}
+
+FiniteTimeAction* FloatingTextPool::releaseAction() {
+    return CallFuncN::create([this](Node* node) {
+        release(static_cast<Label*>(node));
+    });
+}
+
+PoolStats FloatingTextPool::getStats() const {
+    PoolStats stats = _stats;
+    stats.live = (int)_active.size();
+    stats.free = (int)_free.size();
+    return stats;
+}
+
+void FloatingTextPool::reset(Label* label) {
+    label->stopAllActions();
+    label->disableEffect();
+    label->setOpacity(255);
+    label->setScale(1.0f);
+    label->setRotation(0.0f);
+    label->setVisible(true);
+    label->setPosition(Vec2::ZERO);
+}
+
+// 父节点已销毁、动作没能播到归还的 Label 直接收回
+bool FloatingTextPool::reclaimOrphans() {
+    for (size_t i = 0; i < _active.size();) {
+        Label* label = _active[i];
+        if (label->getParent() == nullptr) {
+            _active[i] = _active.back();
+            _active.pop_back();
+            reset(label);
+            _free.push_back(label);
+        }
+        else {
+            i++;
+        }
+    }
+    return !_free.empty();
+}
@@ -0,0 +1,52 @@
+#ifndef __FLOATING_TEXT_POOL_H__
+#define __FLOATING_TEXT_POOL_H__
+
+#include "cocos2d.h"
+#include "Utils/ObjectPool.h"
+#include <string>
+#include <vector>
+
+/**
+ * @class FloatingTextPool
+ * @brief 飘字 / 提示 Label 对象池
+ *
+ * 伤害、回血飘字与地块序号等短暂显示的文字不再每次 create 新 Label，
+ * 而是从池中取出重置后挂到父节点上，播放结束后摘下归还。
+ * 池对所有 Label 各 retain 一次，摘下后不会被释放。
+ *
+ * 父节点先于飘字被销毁（如单位阵亡）时飘字动作不会播到归还那一步，
+ * 空闲链表用尽时会先回收这些已经没有父节点的 Label。
+ */
+class FloatingTextPool {
+public:
+    static FloatingTextPool* getInstance();
+
+    /**
+     * @brief 取一个 Label 并挂到 parent 上
+     * 取出的 Label 已重置：不透明、无缩放、无动作、无描边，坐标为原点
+     */
+    cocos2d::Label* acquire(cocos2d::Node* parent, const std::string& text, float fontSize,
+                            const cocos2d::Color3B& color, int zOrder);
+
+    // 从父节点摘下并归还
+    void release(cocos2d::Label* label);
+
+    // 放在动作序列末尾代替 RemoveSelf：播放到此处时把 Label 归还池中
+    cocos2d::FiniteTimeAction* releaseAction();
+
+    PoolStats getStats() const;
+
+private:
+    FloatingTextPool() {}
+
+    void reset(cocos2d::Label* label);  // 归还与复用前的重置钩子
+    bool reclaimOrphans();
+
+    static FloatingTextPool* s_instance;
+
+    std::vector<cocos2d::Label*> _free;     // 空闲
+    std::vector<cocos2d::Label*> _active;   // 使用中
+    PoolStats _stats;
+};
+
+#endif // __FLOATING_TEXT_POOL_H__
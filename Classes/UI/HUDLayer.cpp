@@ -5,7 +5,7 @@
 USING_NS_CC;
 using namespace cocos2d::ui;
 
-// ꣺ڿðťʽȷɵ
+// 辅助宏：用于快速设置按钮样式，确保其可点击
 #define SETUP_BUTTON(btn, size) \
     btn->ignoreContentAdaptWithSize(false); \
     btn->setContentSize(size); \
@@ -22,7 +22,7 @@ bool HUDLayer::init() {
 
     CCLOG("HUDLayer::init - Creating HUD layer...");
 
-    // 1. ʼ
+    // 1. 初始化变量
     _techTreePanel = nullptr;
     _techTree = nullptr;
     _isTechTreeOpen = false;
@@ -32,13 +32,14 @@ bool HUDLayer::init() {
     _policyPanel = nullptr;
     _policyManager = nullptr;
     _isPolicyPanelOpen = false;
+    _perfOverlay = nullptr;
 
-    // 2.  UI ģ
+    // 2. 创建各 UI 模块
     createCiv6StyleResourceDisplay();
     createCiv6StyleNextTurnButton();
     createCiv6StyleFunctionButtons();
 
-    // 3. λ (½)
+    // 3. 单位详情面板 (左下角)
     _unitPanel = LayerColor::create(Color4B(20, 30, 50, 230), 260, 160);
     _unitPanel->setPosition(Vec2(20, 20));
     _unitPanel->setVisible(false);
@@ -58,14 +59,14 @@ bool HUDLayer::init() {
     _unitStatLabel->setTextColor(Color4B(200, 230, 255, 255));
     _unitPanel->addChild(_unitStatLabel);
 
-    // 4. ǰť (޸)
+    // 4. 建城按钮 (修复交互核心)
     _btnBuildCity = Button::create();
     SETUP_BUTTON(_btnBuildCity, Size(160, 45));
     _btnBuildCity->setPosition(Vec2(visibleSize.width / 2, 100));
     _btnBuildCity->setVisible(false);
     _btnBuildCity->setLocalZOrder(20);
 
-    // ťȾ
+    // 按钮背景渲染
     auto buildCityBg = LayerColor::create(Color4B(50, 100, 50, 255), 160, 45);
     buildCityBg->setIgnoreAnchorPointForPosition(false);
     buildCityBg->setAnchorPoint(Vec2(0.5, 0.5));
@@ -82,7 +83,7 @@ bool HUDLayer::init() {
         });
     this->addChild(_btnBuildCity);
 
-    // 5. ¼ UI ر
+    // 5. 事件监听：处理 UI 面板关闭
     auto dispatcher = Director::getInstance()->getEventDispatcher();
     dispatcher->addEventListenerWithSceneGraphPriority(
         EventListenerCustom::create("tech_tree_closed", [this](EventCustom*) { this->closeTechTree(); }), this);
@@ -91,21 +92,42 @@ bool HUDLayer::init() {
     dispatcher->addEventListenerWithSceneGraphPriority(
         EventListenerCustom::create("policy_panel_closed", [this](EventCustom*) { this->closePolicyPanel(); }), this);
 
+    // 6. 快捷键：F3 切换性能浮层
+    auto keyboardListener = EventListenerKeyboard::create();
+    keyboardListener->onKeyPressed = [this](EventKeyboard::KeyCode keyCode, Event*) {
+        if (keyCode == EventKeyboard::KeyCode::KEY_F3) {
+            this->togglePerfOverlay();
+        }
+        };
+    dispatcher->addEventListenerWithSceneGraphPriority(keyboardListener, this);
+
     return true;
 }
 
+void HUDLayer::togglePerfOverlay() {
+    if (!_perfOverlay) {
+        auto visibleSize = Director::getInstance()->getVisibleSize();
+        _perfOverlay = PerfOverlay::create();
+        // 右上角，顶部资源栏下方
+        _perfOverlay->setPosition(Vec2(visibleSize.width - _perfOverlay->getContentSize().width - 10,
+            visibleSize.height - 45 - _perfOverlay->getContentSize().height - 10));
+        this->addChild(_perfOverlay, 200);
+    }
+    _perfOverlay->setActive(!_perfOverlay->isActive());
+}
+
 void HUDLayer::createCiv6StyleResourceDisplay() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 6ͨ/ɫ͸ϸ
+    // 顶部背景条：文明6风格通常是深蓝/黑色半透明，带细金边
     _topBar = LayerColor::create(Color4B(15, 20, 30, 240), visibleSize.width, 45);
     _topBar->setPosition(Vec2(0, visibleSize.height - 45));
     _topBar->setLocalZOrder(5);
     this->addChild(_topBar);
 
-    // װߣһϸϸĽɫ߿
+    // 装饰线：顶部一条细细的金色边框
     auto goldLine = LayerColor::create(Color4B(180, 160, 80, 200), visibleSize.width, 2);
-    goldLine->setPosition(0, 0); // ڶ±Ե
+    goldLine->setPosition(0, 0); // 放在顶部条的下边缘
     _topBar->addChild(goldLine);
 
     float startX = 40;
@@ -128,53 +150,53 @@ void HUDLayer::createCiv6StyleResourceDisplay() {
             container->addChild(placeholder);
         }
 
-        // ʼʱֱӦͳһĸʽ߼
+        // 初始化时直接应用统一的格式逻辑
         label = Label::createWithSystemFont(initialText, "Arial-BoldMT", 18);
         label->setAnchorPoint(Vec2(0, 0.5));
         label->setPosition(Vec2(25, 0));
         container->addChild(label);
         };
 
-    // ͳһʼ߼
+    // 统一初始化文字逻辑
     createResourceItem(_goldContainer, _goldLabel, "res/icon_gold.png", startX, "Gold: 0");
     createResourceItem(_scienceContainer, _scienceLabel, "res/icon_science.png", startX + spacing, "Science: 0");
     createResourceItem(_cultureContainer, _cultureLabel, "res/icon_culture.png", startX + spacing * 2, "Culture: 0");
 
-    // غʼɫ͸Ϊ 255 (ԭ 0)
+    // 回合数初始化：修正颜色透明度为 255 (原本是 0)
     _turnLabel = Label::createWithSystemFont("Turn 1", "Arial-BoldMT", 18);
     _turnLabel->setAnchorPoint(Vec2(1, 0.5));
     _turnLabel->setPosition(Vec2(visibleSize.width - 40, 22.5));
-    _turnLabel->setTextColor(Color4B(255, 255, 200, 255)); // ȷ͸Ϊ 255
+    _turnLabel->setTextColor(Color4B(255, 255, 200, 255)); // 确保透明度为 255
     _topBar->addChild(_turnLabel);
 }
 
 void HUDLayer::createCiv6StyleNextTurnButton() {
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 1. ťָ״̬ͼƬ·
-    // ·res/next_turn_normal.png, res/next_turn_pressed.png, res/next_turn_disabled.png
+    // 1. 创建按钮，指定三种状态的图片路径
+    // 路径：res/next_turn_normal.png, res/next_turn_pressed.png, res/next_turn_disabled.png
     _btnNextTurn = Button::create("res/next_turn_normal.png",
         "res/next_turn_pressed.png",
         "res/next_turn_disabled.png");
 
-    // 2. 
+    // 2. 基础属性设置
     _btnNextTurn->ignoreContentAdaptWithSize(false);
-    _btnNextTurn->setContentSize(Size(100, 100)); //  200x200 ˴
+    _btnNextTurn->setContentSize(Size(100, 100)); // 建议美术按 200x200 制作，此处缩放
     _btnNextTurn->setPosition(Vec2(visibleSize.width - 80, 80));
     _btnNextTurn->setLocalZOrder(20);
     _btnNextTurn->setTouchEnabled(true);
     _btnNextTurn->setSwallowTouches(true);
 
-    // 3. ֱǩ (лƫ)
+    // 3. 添加文字标签 (居中或偏下)
     auto nextTurnLabel = Label::createWithSystemFont("NEXT TURN", "Arial-BoldMT", 14);
-    nextTurnLabel->setPosition(Vec2(50, -10)); // Բť·
+    nextTurnLabel->setPosition(Vec2(50, -10)); // 放在圆钮下方
     nextTurnLabel->setTextColor(Color4B(255, 255, 200, 255));
     nextTurnLabel->enableOutline(Color4B::BLACK, 1);
     _btnNextTurn->addChild(nextTurnLabel);
 
-    // 4. ¼
+    // 4. 点击事件
     _btnNextTurn->addClickEventListener([this](Ref* sender) {
-        // 򵥵ĵ΢
+        // 简单的点击反馈：轻微缩放
         auto scale = Sequence::create(ScaleTo::create(0.05f, 0.9f), ScaleTo::create(0.1f, 1.0f), nullptr);
         _btnNextTurn->runAction(scale);
 
@@ -184,7 +206,7 @@ void HUDLayer::createCiv6StyleNextTurnButton() {
 
     this->addChild(_btnNextTurn);
 
-    // ʼ״̬ûͼƬļʱɫ鸨
+    // 初始状态：如果没有图片文件，暂时用颜色块辅助调试
     if (_btnNextTurn->getRendererNormal()->getContentSize().width == 0) {
         auto debugCircle = DrawNode::create();
         debugCircle->drawSolidCircle(Vec2(50, 50), 45, 0, 32, Color4F(0.2f, 0.5f, 0.2f, 1.0f));
@@ -197,17 +219,17 @@ void HUDLayer::createCiv6StyleFunctionButtons() {
     float startY = visibleSize.height - 100;
     float startX = 45;
 
-    // ʹ [=, &this] ȷܷ startX ĳԱ
-    //  btn ĲΪⲿָĵַô
+    // 使用 [=, &this] 确保能访问 startX 和类的成员变量
+    // 这里 btn 的参数改为由外部指针的地址或引用传入
     auto createCiv6Btn = [=](Button*& btn, const std::string& iconText, Color4F themeColor, float y, std::function<void()> cb) {
         btn = Button::create();
         SETUP_BUTTON(btn, Size(64, 64));
-        btn->setPosition(Vec2(startX, y)); //  startX 
+        btn->setPosition(Vec2(startX, y)); // 现在 startX 可以正常访问了
 
         auto drawNode = DrawNode::create();
         Vec2 center(32, 32);
 
-        // 6񱳾
+        // 绘制文明6风格背景
         drawNode->drawSolidCircle(center, 30, 0, 32, Color4F(0, 0, 0, 0.6f));
         drawNode->drawSolidCircle(center, 26, 0, 32, themeColor);
         drawNode->drawCircle(center, 30, 0, 32, false, Color4F(0.8f, 0.7f, 0.3f, 1.0f));
@@ -218,7 +240,7 @@ void HUDLayer::createCiv6StyleFunctionButtons() {
         btn->setTitleFontSize(28);
         btn->setTitleFontName("Arial-BoldMT");
 
-        // 
+        // 点击反馈动画
         btn->addTouchEventListener([btn](Ref* sender, Widget::TouchEventType type) {
             if (type == Widget::TouchEventType::BEGAN) btn->runAction(ScaleTo::create(0.05f, 0.9f));
             else if (type == Widget::TouchEventType::ENDED || type == Widget::TouchEventType::CANCELED)
@@ -229,7 +251,7 @@ void HUDLayer::createCiv6StyleFunctionButtons() {
         this->addChild(btn, 15);
         };
 
-    // ʱֱӴԱ
+    // 调用时直接传入成员变量引用
     createCiv6Btn(_btnTechTree, "S", Color4F(0.1f, 0.4f, 0.7f, 0.8f), startY, [this]() { this->openTechTree(); });
     createCiv6Btn(_btnCultureTree, "C", Color4F(0.5f, 0.2f, 0.6f, 0.8f), startY - 75, [this]() { this->openCultureTree(); });
     createCiv6Btn(_btnPolicySystem, "G", Color4F(0.2f, 0.5f, 0.2f, 0.8f), startY - 150, [this]() { this->openPolicyPanel(); });
@@ -241,7 +263,7 @@ void HUDLayer::updateResources(int gold, int science, int culture, int turn) {
     _scienceLabel->setString("Science: " + std::to_string(science));
     _cultureLabel->setString("Culture: " + std::to_string(culture));
 
-    // ͬ
+    // 同步更新子面板数据
     updateSciencePerTurn(science / 10 + 1);
     updateCulturePerTurn(culture / 10 + 1);
 }
@@ -267,7 +289,7 @@ void HUDLayer::hideUnitInfo() {
     _btnBuildCity->setVisible(false);
 }
 
-// --- ص ---
+// --- 回调与面板管理 ---
 
 void HUDLayer::setNextTurnCallback(const std::function<void()>& cb) { _onNextTurn = cb; }
 void HUDLayer::setBuildCityCallback(const std::function<void()>& cb) { _onBuildCity = cb; }
@@ -347,21 +369,21 @@ void HUDLayer::setNextTurnButtonEnabled(bool enabled) {
     _btnNextTurn->setCascadeOpacityEnabled(true);
 
     _btnNextTurn->setEnabled(enabled);
-    _btnNextTurn->setBright(enabled); // ʽ״̬
+    _btnNextTurn->setBright(enabled); // 显式设置明亮状态
 
     if (enabled) {
-        // ָָԭɫ (ɫȾɫ)
+        // 恢复：恢复原色 (白色代表不染色)
         _btnNextTurn->setColor(Color3B::WHITE);
         _btnNextTurn->setOpacity(255);
 
-        // ָʱ۶
+        // 恢复时的显眼动画
         _btnNextTurn->stopAllActions();
         auto scaleUp = ScaleTo::create(0.1f, 1.15f);
         auto scaleBack = ScaleTo::create(0.1f, 1.0f);
         _btnNextTurn->runAction(Sequence::create(scaleUp, scaleBack, nullptr));
     }
     else {
-        // 
+        // 禁用
         _btnNextTurn->setColor(Color3B(120, 40, 40));
         _btnNextTurn->setOpacity(150);
         _btnNextTurn->setScale(0.95f);
@@ -0,0 +1,222 @@
+#include "PerfOverlay.h"
+#include "Core/GameManager.h"
+#include "Core/Player.h"
+#include "Scene/GameScene.h"
+#include "Map/GameMapLayer.h"
+#include "Development/ProductionProgram.h"
+#include "UI/FloatingTextPool.h"
+#include "Utils/EventBus.h"
+#include "Utils/PerfCounters.h"
+#include "Utils/ScopeProfiler.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    const float kTextRefreshInterval = 0.25f;   // 文字刷新间隔（秒）
+    const float kLabelCountInterval = 1.0f;     // Label 计数间隔（秒），需要遍历地图层节点树
+    const float kPanelWidth = 330.0f;
+    const float kPanelHeight = 210.0f;
+
+    float nsToMs(uint64_t ns) {
+        return (float)((double)ns / 1000000.0);
+    }
+}
+
+bool PerfOverlay::init() {
+    if (!Node::init()) {
+        return false;
+    }
+
+    _active = false;
+    _frameTimes.assign(kFrameWindow, 0.0f);
+    _sortBuffer.reserve(kFrameWindow);
+    _frameCursor = 0;
+    _frameCount = 0;
+    _lastFrameEndNs = 0;
+    _updateStartNs = 0;
+    _updateNs = 0;
+    _drawStartNs = 0;
+    _drawNs = 0;
+    _drawCalls = 0;
+    _drawVertices = 0;
+    _textTimer = 0.0f;
+    _labelTimer = kLabelCountInterval;
+    _cachedLabelCount = 0;
+    _lastPublishCount = EventBus::getInstance()->getPublishCount();
+    _eventsPerSecond = 0.0f;
+    _eventTimer = 0.0f;
+
+    _background = LayerColor::create(Color4B(0, 0, 0, 170), kPanelWidth, kPanelHeight);
+    this->addChild(_background);
+
+    _label = Label::createWithSystemFont("", "Courier New", 15);
+    _label->setAnchorPoint(Vec2(0, 1));
+    _label->setPosition(Vec2(10, kPanelHeight - 8));
+    _label->setTextColor(Color4B(180, 255, 180, 255));
+    this->addChild(_label);
+
+    this->setContentSize(Size(kPanelWidth, kPanelHeight));
+    this->setVisible(false);
+    return true;
+}
+
+void PerfOverlay::onExit() {
+    removeListeners();
+    Node::onExit();
+}
+
+void PerfOverlay::setActive(bool active) {
+    if (_active == active) return;
+    _active = active;
+    this->setVisible(active);
+
+    if (active) {
+        _frameCursor = 0;
+        _frameCount = 0;
+        _lastFrameEndNs = 0;
+        _labelTimer = kLabelCountInterval;
+        _lastPublishCount = EventBus::getInstance()->getPublishCount();
+        addListeners();
+        refreshText();
+    }
+    else {
+        removeListeners();
+    }
+}
+
+void PerfOverlay::addListeners() {
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    _listeners.push_back(dispatcher->addCustomEventListener(Director::EVENT_BEFORE_UPDATE, [this](EventCustom*) { onBeforeUpdate(); }));
+    _listeners.push_back(dispatcher->addCustomEventListener(Director::EVENT_AFTER_UPDATE, [this](EventCustom*) { onAfterUpdate(); }));
+    _listeners.push_back(dispatcher->addCustomEventListener(Director::EVENT_BEFORE_DRAW, [this](EventCustom*) { onBeforeDraw(); }));
+    _listeners.push_back(dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [this](EventCustom*) { onAfterDraw(); }));
+}
+
+void PerfOverlay::removeListeners() {
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    for (auto listener : _listeners) {
+        dispatcher->removeEventListener(listener);
+    }
+    _listeners.clear();
+}
+
+void PerfOverlay::onBeforeUpdate() {
+    _updateStartNs = ScopeProfiler::nowNs();
+}
+
+void PerfOverlay::onAfterUpdate() {
+    _updateNs = ScopeProfiler::nowNs() - _updateStartNs;
+}
+
+void PerfOverlay::onBeforeDraw() {
+    _drawStartNs = ScopeProfiler::nowNs();
+}
+
+void PerfOverlay::onAfterDraw() {
+    uint64_t now = ScopeProfiler::nowNs();
+    _drawNs = now - _drawStartNs;
+
+    // 渲染器统计在 render 结束后才完整
+    auto renderer = Director::getInstance()->getRenderer();
+    _drawCalls = renderer->getDrawnBatches();
+    _drawVertices = renderer->getDrawnVertices();
+
+    if (_lastFrameEndNs == 0) {
+        _lastFrameEndNs = now;
+        return;
+    }
+
+    float frameMs = nsToMs(now - _lastFrameEndNs);
+    _lastFrameEndNs = now;
+
+    _frameTimes[_frameCursor] = frameMs;
+    _frameCursor = (_frameCursor + 1) % kFrameWindow;
+    if (_frameCount < kFrameWindow) _frameCount++;
+
+    float frameSec = frameMs / 1000.0f;
+    _textTimer += frameSec;
+    _labelTimer += frameSec;
+    _eventTimer += frameSec;
+
+    if (_eventTimer >= 1.0f) {
+        unsigned long long published = EventBus::getInstance()->getPublishCount();
+        _eventsPerSecond = (float)(published - _lastPublishCount) / _eventTimer;
+        _lastPublishCount = published;
+        _eventTimer = 0.0f;
+    }
+
+    if (_textTimer >= kTextRefreshInterval) {
+        _textTimer = 0.0f;
+        refreshText();
+    }
+}
+
+float PerfOverlay::percentile(std::vector<float>& sorted, float p) const {
+    if (sorted.empty()) return 0.0f;
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5f);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+int PerfOverlay::countActiveUnits() const {
+    int count = 0;
+    for (auto player : GameManager::getInstance()->getAllPlayers()) {
+        if (player) count += (int)player->getUnits().size();
+    }
+    return count;
+}
+
+int PerfOverlay::countMapLabels() const {
+    auto gameScene = dynamic_cast<GameScene*>(Director::getInstance()->getRunningScene());
+    if (!gameScene || !gameScene->getMapLayer()) return 0;
+
+    // 非递归遍历地图层节点树
+    int count = 0;
+    std::vector<Node*> stack;
+    stack.push_back(gameScene->getMapLayer());
+    while (!stack.empty()) {
+        Node* node = stack.back();
+        stack.pop_back();
+        if (dynamic_cast<Label*>(node)) count++;
+        for (auto child : node->getChildren()) {
+            stack.push_back(child);
+        }
+    }
+    return count;
+}
+
+void PerfOverlay::refreshText() {
+    if (_labelTimer >= kLabelCountInterval) {
+        _labelTimer = 0.0f;
+        _cachedLabelCount = countMapLabels();
+    }
+
+    _sortBuffer.assign(_frameTimes.begin(), _frameTimes.begin() + _frameCount);
+    float p50 = percentile(_sortBuffer, 0.50f);
+    float p95 = percentile(_sortBuffer, 0.95f);
+    float p99 = percentile(_sortBuffer, 0.99f);
+
+    auto counters = PerfCounters::getInstance();
+    PoolStats programPool = ProductionProgram::getPoolStats();
+    PoolStats textPool = FloatingTextPool::getInstance()->getStats();
+    char text[512];
+    snprintf(text, sizeof(text),
+        "frame ms  p50 %5.2f  p95 %5.2f  p99 %5.2f\n"
+        "update    %5.2f ms (game %5.2f ms)\n"
+        "render    %5.2f ms\n"
+        "draws     %d  verts %d\n"
+        "units     %d  map labels %d\n"
+        "paths     %d this turn / %d last\n"
+        "pools     prod %d/%d  text %d/%d (hit/miss)\n"
+        "events    %.0f /s",
+        p50, p95, p99,
+        nsToMs(_updateNs), nsToMs(counters->getGameUpdateNs()),
+        nsToMs(_drawNs),
+        (int)_drawCalls, (int)_drawVertices,
+        countActiveUnits(), _cachedLabelCount,
+        counters->getPathQueriesThisTurn(), counters->getPathQueriesLastTurn(),
+        programPool.hits, programPool.misses, textPool.hits, textPool.misses,
+        _eventsPerSecond);
+    _label->setString(text);
+}
@@ -0,0 +1,81 @@
+#ifndef __PERF_OVERLAY_H__
+#define __PERF_OVERLAY_H__
+
+#include "cocos2d.h"
+#include <vector>
+
+/**
+ * @class PerfOverlay
+ * @brief 性能浮层
+ *
+ * 显示内容：
+ * 1. 滚动窗口内帧时间的 p50 / p95 / p99
+ * 2. 调度器 update、GameScene::update 与渲染（visit + draw）各自耗时
+ * 3. 渲染器的 draw call 与顶点数
+ * 4. 活跃单位数、地图层 Label 数、每回合寻路次数、事件派发次数
+ * 5. 生产项目与飘字对象池的命中 / 未命中次数
+ *
+ * 每帧只记录几个时间戳；文字每 0.25 秒刷新一次，Label 计数每秒遍历一次。
+ * 隐藏时注销所有 Director 事件监听，不产生任何开销。
+ */
+class PerfOverlay : public cocos2d::Node {
+public:
+    CREATE_FUNC(PerfOverlay);
+
+    virtual bool init() override;
+    virtual void onExit() override;
+
+    /**
+     * @brief 开启/关闭浮层（关闭时停止采样）
+     */
+    void setActive(bool active);
+    bool isActive() const { return _active; }
+
+private:
+    static const int kFrameWindow = 240;    // 滚动窗口帧数（约 4 秒）
+
+    void onBeforeUpdate();
+    void onAfterUpdate();
+    void onBeforeDraw();
+    void onAfterDraw();
+
+    void refreshText();
+    int countMapLabels() const;
+    int countActiveUnits() const;
+    float percentile(std::vector<float>& sorted, float p) const;
+
+    void addListeners();
+    void removeListeners();
+
+    cocos2d::LayerColor* _background;
+    cocos2d::Label* _label;
+    std::vector<cocos2d::EventListenerCustom*> _listeners;
+    bool _active;
+
+    // 帧时间环形缓冲区（毫秒）
+    std::vector<float> _frameTimes;
+    std::vector<float> _sortBuffer;
+    int _frameCursor;
+    int _frameCount;
+
+    // 本帧时间戳（纳秒）
+    uint64_t _lastFrameEndNs;
+    uint64_t _updateStartNs;
+    uint64_t _updateNs;
+    uint64_t _drawStartNs;
+    uint64_t _drawNs;
+
+    // 渲染统计
+    ssize_t _drawCalls;
+    ssize_t _drawVertices;
+
+    // 刷新节流
+    float _textTimer;
+    float _labelTimer;
+    int _cachedLabelCount;
+    unsigned long long _lastPublishCount;
+    float _eventsPerSecond;
+    float _eventTimer;
+};
+
+#endif // __PERF_OVERLAY_H__
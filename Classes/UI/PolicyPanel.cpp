@@ -1,7 +1,7 @@
 #include "PolicyPanel.h"
 
 // =========================================================
-// ʼ
+// 初始化与基础设置
 // =========================================================
 
 bool PolicyPanel::init() {
@@ -9,23 +9,23 @@ bool PolicyPanel::init() {
 
     auto vs = Director::getInstance()->getVisibleSize();
 
-    // 1. 
+    // 1. 背景
     auto bg = LayerColor::create(Color4B(20, 25, 30, 250), vs.width, vs.height);
     this->addChild(bg);
 
-    // 2. ɵ
+    // 2. 吞噬点击
     auto listener = EventListenerTouchOneByOne::create();
     listener->setSwallowTouches(true);
     listener->onTouchBegan = [](Touch*, Event*) { return true; };
     _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, bg);
 
-    // 3. رհť
+    // 3. 关闭按钮
     auto btnClose = Button::create();
-    btnClose->setTitleText(u8"ر");
+    btnClose->setTitleText(u8"关闭");
     btnClose->setTitleFontSize(24);
     btnClose->setPosition(Vec2(vs.width - 60, vs.height - 40));
     btnClose->addClickEventListener([this](Ref*) {
-        // ͹ر¼
+        // 发送关闭事件
         cocos2d::EventCustom event("policy_panel_closed");
         _eventDispatcher->dispatchEvent(&event);
         });
@@ -40,28 +40,28 @@ void PolicyPanel::initLayout() {
     auto vs = Director::getInstance()->getVisibleSize();
     float midX = vs.width * 0.4f;
 
-    // ---  ---
+    // --- 左侧面板 ---
     _leftPanel = Node::create();
     this->addChild(_leftPanel);
 
-    // ౳
+    // 左侧背景
     auto leftBg = LayerColor::create(Color4B(40, 40, 50, 100), midX, vs.height);
     _leftPanel->addChild(leftBg, -1);
 
-    // 
-    _govLabel = Label::createWithSystemFont(u8"ǰ", "Arial", 28);
+    // 政体标题
+    _govLabel = Label::createWithSystemFont(u8"当前政体", "Arial", 28);
     _govLabel->setPosition(midX / 2, vs.height - 50);
     _govLabel->setColor(Color3B(255, 220, 100));
     _leftPanel->addChild(_govLabel);
 
-    // רŷŲλ
+    // 创建专门放槽位的容器
     _leftSlotsContainer = Node::create();
     _leftSlotsContainer->setPosition(0, 0);
     _leftPanel->addChild(_leftSlotsContainer);
 
-    // 尴ť
+    // 更换政体按钮
     auto btnChange = Button::create();
-    btnChange->setTitleText(u8"塿");
+    btnChange->setTitleText(u8"【更换政体】");
     btnChange->setTitleFontSize(20);
     btnChange->setTitleColor(Color3B(100, 255, 100));
     btnChange->setPosition(Vec2(midX / 2, vs.height - 90));
@@ -70,13 +70,13 @@ void PolicyPanel::initLayout() {
         });
     _leftPanel->addChild(btnChange);
 
-    // --- Ҳ ---
+    // --- 右侧面板 ---
     _rightPanel = Node::create();
     _rightPanel->setPosition(midX, 0);
     this->addChild(_rightPanel);
 
-    // Ҳ
-    auto listLabel = Label::createWithSystemFont(u8"ѡ߿ (קװ/)", "Arial", 24);
+    // 右侧标题
+    auto listLabel = Label::createWithSystemFont(u8"可选政策库 (拖拽装备/点击详情)", "Arial", 24);
     listLabel->setPosition((vs.width - midX) / 2, vs.height - 50);
     _rightPanel->addChild(listLabel);
 }
@@ -93,7 +93,7 @@ void PolicyPanel::setCultureTree(CultureTree* tree) {
 void PolicyPanel::refreshUI() {
     if (!_policyManager) return;
 
-    // 
+    // 更新政体名称
     const auto& govConfig = _policyManager->getCurrentGovConfig();
     if (_govLabel) {
         _govLabel->setString(govConfig.name);
@@ -104,63 +104,63 @@ void PolicyPanel::refreshUI() {
 }
 
 // =========================================================
-// ģͨÿۻ
+// 核心：通用卡牌外观绘制
 // =========================================================
 Node* PolicyPanel::createCardVisual(const PolicyCard& card, bool isGhost) {
     auto node = Node::create();
     node->setContentSize(Size(CARD_W, CARD_H));
     node->setAnchorPoint(Vec2::ANCHOR_MIDDLE);
 
-    // 1. װ
+    // 1. 背景底板
     auto bg = DrawNode::create();
     Color4F colorF;
     Color3B c3b = getTypeColor(card.type);
     colorF = Color4F(c3b.r / 255.f, c3b.g / 255.f, c3b.b / 255.f, isGhost ? 0.6f : 1.0f);
 
-    // ʵľ
+    // 绘制实心矩形
     bg->drawSolidRect(Vec2::ZERO, Vec2(CARD_W, CARD_H), colorF);
-    // Ʊ߿
+    // 绘制边框
     bg->drawRect(Vec2::ZERO, Vec2(CARD_W, CARD_H), Color4F(1, 1, 1, 0.5f));
     node->addChild(bg);
 
-    // 2.  (װ)
+    // 2. 顶部类型条 (装饰)
     auto topBar = DrawNode::create();
     topBar->drawSolidRect(Vec2(5, CARD_H - 35), Vec2(CARD_W - 5, CARD_H - 5), Color4F(0, 0, 0, 0.2f));
     node->addChild(topBar);
 
-    // 3. ͼ/
+    // 3. 类型图标/文字
     std::string typeIcon = getTypeName(card.type);
     auto typeLabel = Label::createWithSystemFont(typeIcon, "Arial", 16);
     typeLabel->setPosition(CARD_W / 2, CARD_H - 20);
     typeLabel->setColor(Color3B(255, 255, 255));
     node->addChild(typeLabel);
 
-    // 4.  (УԶ)
+    // 4. 卡牌名称 (居中，自动换行)
     auto nameLabel = Label::createWithSystemFont(card.name, "Arial", 22);
-    nameLabel->setPosition(CARD_W / 2, CARD_H * 0.5f); // ΢һ
-    nameLabel->setDimensions(CARD_W - 20, 0); // ƿֻ֧
+    nameLabel->setPosition(CARD_W / 2, CARD_H * 0.5f); // 稍微居中一点
+    nameLabel->setDimensions(CARD_W - 20, 0); // 限制宽度支持换行
     nameLabel->setHorizontalAlignment(TextHAlignment::CENTER);
     nameLabel->setColor(Color3B::WHITE);
-    // Ӱ
+    // 加阴影
     nameLabel->enableShadow(Color4B::BLACK, Size(2, -2), 1);
     node->addChild(nameLabel);
 
-    // ɾײʾ "㰴\nקװ"
+    // 【已删除】：底部提示文字 "点按详情\n拖拽装备"
 
     return node;
 }
 
 // =========================================================
-// Ҳбק
+// 右侧列表：创建可拖拽卡牌
 // =========================================================
 Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
-    // 1. 
+    // 1. 创建外观
     Node* cardNode = createCardVisual(card, false);
     cardNode->setUserData((void*)(intptr_t)card.id);
 
-    // 2. ӸӵĴ (ֵק)
+    // 2. 添加复杂的触摸监听 (区分点击和拖拽)
     auto listener = EventListenerTouchOneByOne::create();
-    listener->setSwallowTouches(false); //  ScrollView 
+    listener->setSwallowTouches(false); // 允许 ScrollView 滚动
 
     struct TouchState {
         Vec2 startPos;
@@ -174,10 +174,10 @@ Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
         Rect bbox = cardNode->getBoundingBox();
 
         if (bbox.containsPoint(p)) {
-            state->startPos = touch->getLocation(); // ¼
+            state->startPos = touch->getLocation(); // 记录世界坐标
             state->isDragging = false;
             state->validStart = true;
-            return true; // δʼ׷
+            return true; // 吞噬这次触摸，开始追踪
         }
         return false;
         };
@@ -188,7 +188,7 @@ Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
         Vec2 currentPos = touch->getLocation();
         float dist = currentPos.distance(state->startPos);
 
-        // ƶ 10 أжΪק
+        // 如果移动超过 10 像素，判定为拖拽
         if (dist > 10.0f && !state->isDragging) {
             state->isDragging = true;
             this->onCardDragBegan(card.id, card.type, currentPos);
@@ -203,11 +203,11 @@ Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
         if (!state->validStart) return;
 
         if (state->isDragging) {
-            // ק
+            // 拖拽结束
             this->onCardDragEnded(touch->getLocation());
         }
         else {
-            // 
+            // 点击
             this->onCardClicked(card.id, card);
         }
 
@@ -215,9 +215,9 @@ Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
         state->isDragging = false;
         };
 
-    //  true غ Move/EndΪ ScrollViewͨҪ
-    // Ϊ true Լ onTouchMoved жǷ񴫵ݿܱȽϸ
-    // 򵥵Ϊ trueԼ
+    // 必须设置 true 才能拦截后续 Move/End，但为了 ScrollView，通常需要处理
+    // 这里设为 true 并自己在 onTouchMoved 判断是否传递可能比较复杂
+    // 简单的做法是设为 true，自己处理。
     listener->setSwallowTouches(true);
 
     _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, cardNode);
@@ -226,7 +226,7 @@ Node* PolicyPanel::createDraggableCard(const PolicyCard& card) {
 }
 
 // =========================================================
-// ࣺλ벼
+// 左侧：槽位与布局
 // =========================================================
 void PolicyPanel::createLeftSlots() {
     if (_leftSlotsContainer) _leftSlotsContainer->removeAllChildren();
@@ -237,27 +237,27 @@ void PolicyPanel::createLeftSlots() {
 
     auto vs = Director::getInstance()->getVisibleSize();
 
-    float startY = vs.height - 120; // ʼ߶
-    float categoryGap = 30.0f;     // ֮Ĵֱ
-    float cardGapX = 15.0f;        // λ֮ˮƽ
+    float startY = vs.height - 120; // 初始高度
+    float categoryGap = 30.0f;     // 类别之间的垂直间距
+    float cardGapX = 15.0f;        // 槽位之间的水平间距
 
-    // һвλ
+    // 辅助函数：构建一行槽位
     auto buildRow = [&](PolicyType type, int count, const std::string& title) {
         if (count <= 0) return;
 
-        // 1. 
+        // 1. 标题
         auto label = Label::createWithSystemFont(title, "Arial", 20);
         label->setAnchorPoint(Vec2::ANCHOR_MIDDLE_LEFT);
         label->setPosition(30, startY);
         label->setColor(getTypeColor(type));
         _leftSlotsContainer->addChild(label);
 
-        startY -= 30; // ߶ռλ
+        startY -= 30; // 标题高度占位
 
-        // 2. ʼ X
+        // 2. 计算起始 X
         float currentX = 50.0f + CARD_W / 2;
 
-        // 3. ɲλ
+        // 3. 生成槽位
         for (int i = 0; i < count; ++i) {
             int equippedId = -1;
             for (const auto& eq : equipped) {
@@ -271,9 +271,9 @@ void PolicyPanel::createLeftSlots() {
             slotNode->setPosition(currentX, startY - CARD_H / 2);
             _leftSlotsContainer->addChild(slotNode);
 
-            // ¼ײϢ
+            // 记录碰撞信息
             Vec2 worldPos = _leftSlotsContainer->convertToWorldSpace(slotNode->getPosition());
-            // ײ΢һ㣬ʹñϵĲ
+            // 碰撞盒稍微收缩一点，使得必须拖到中心才算
             Rect bbox(worldPos.x - CARD_W / 2, worldPos.y - CARD_H / 2, CARD_W, CARD_H);
 
             SlotTarget target;
@@ -283,33 +283,33 @@ void PolicyPanel::createLeftSlots() {
             target.isOccupied = (equippedId != -1);
             _slotTargets.push_back(target);
 
-            // ƶ X 
+            // 移动 X 坐标
             currentX += (CARD_W + cardGapX);
         }
 
-        // ƶ Y 굽һ
+        // 移动 Y 坐标到下一行
         startY -= (CARD_H + categoryGap);
         };
 
-    buildRow(PolicyType::MILITARY, govConfig.militarySlots, u8"");
-    buildRow(PolicyType::ECONOMIC, govConfig.economicSlots, u8"");
-    buildRow(PolicyType::WILDCARD, govConfig.wildcardSlots, u8"ͨ");
+    buildRow(PolicyType::MILITARY, govConfig.militarySlots, u8"军事政策");
+    buildRow(PolicyType::ECONOMIC, govConfig.economicSlots, u8"经济政策");
+    buildRow(PolicyType::WILDCARD, govConfig.wildcardSlots, u8"通用政策");
 }
 
 Node* PolicyPanel::createSlotUI(PolicyType type, int index, int equippedCardId) {
     auto container = Node::create();
 
-    // 1. ղλ
+    // 1. 空槽位背景
     auto bg = DrawNode::create();
     bg->drawSolidRect(Vec2(-CARD_W / 2, -CARD_H / 2), Vec2(CARD_W / 2, CARD_H / 2), Color4F(0.15f, 0.15f, 0.18f, 0.8f));
     bg->drawRect(Vec2(-CARD_W / 2, -CARD_H / 2), Vec2(CARD_W / 2, CARD_H / 2), Color4F(0.5f, 0.5f, 0.5f, 0.3f));
     container->addChild(bg);
 
-    auto label = Label::createWithSystemFont(u8"ղλ", "Arial", 18);
+    auto label = Label::createWithSystemFont(u8"空槽位", "Arial", 18);
     label->setColor(Color3B::GRAY);
     container->addChild(label);
 
-    // 2. װǿ
+    // 2. 如果已装备，覆盖卡牌
     if (equippedCardId != -1) {
         label->setVisible(false);
 
@@ -319,7 +319,7 @@ Node* PolicyPanel::createSlotUI(PolicyType type, int index, int equippedCardId)
             cardNode->setPosition(0, 0);
             container->addChild(cardNode);
 
-            // --- жק ---
+            // --- 卸载拖拽 ---
             auto listener = EventListenerTouchOneByOne::create();
             listener->setSwallowTouches(true);
 
@@ -364,7 +364,7 @@ Node* PolicyPanel::createSlotUI(PolicyType type, int index, int equippedCardId)
 }
 
 // =========================================================
-// ק߼ʵ
+// 拖拽逻辑实现
 // =========================================================
 
 void PolicyPanel::onCardDragBegan(int cardId, PolicyType type, Vec2 touchPos) {
@@ -377,7 +377,7 @@ void PolicyPanel::onCardDragBegan(int cardId, PolicyType type, Vec2 touchPos) {
     auto cardPtr = _policyManager->getPolicyCard(cardId);
     if (!cardPtr) return;
 
-    // 
+    // 创建替身
     _draggedNode = createCardVisual(*cardPtr, true);
     _draggedNode->setOpacity(200);
     _draggedNode->setScale(1.1f);
@@ -399,7 +399,7 @@ void PolicyPanel::onCardDragEnded(Vec2 touchPos) {
 
     bool success = false;
 
-    // ĸλ
+    // 检查落在哪个槽位
     for (const auto& slot : _slotTargets) {
         if (slot.worldBoundingBox.containsPoint(touchPos)) {
             bool isCompatible = false;
@@ -440,7 +440,7 @@ void PolicyPanel::onEquippedCardDragEnded(Touch* touch) {
     for (const auto& slot : _slotTargets) {
         if (slot.worldBoundingBox.containsPoint(pos)) {
             hitSlot = true;
-            // ֧װŻԭλ
+            // 支持重新装备（即交换或放回原位）
             if (_policyManager->equipPolicy(_draggedCardId, slot.type, slot.index)) {
                 refreshUI();
             }
@@ -448,7 +448,7 @@ void PolicyPanel::onEquippedCardDragEnded(Touch* touch) {
         }
     }
 
-    // ϵҲհ״ж
+    // 拖到右侧或空白处卸载
     if (!hitSlot) {
         if (pos.x > leftPanelWidth) {
             _policyManager->unequipPolicy(_draggedCardId);
@@ -463,7 +463,7 @@ void PolicyPanel::onEquippedCardDragEnded(Touch* touch) {
 }
 
 // =========================================================
-// Ҳ࿨б
+// 右侧卡牌列表
 // =========================================================
 
 void PolicyPanel::createRightList() {
@@ -482,16 +482,14 @@ void PolicyPanel::createRightList() {
     scrollView->setName("cards_scroll");
     _rightPanel->addChild(scrollView);
 
-    std::vector<PolicyCard> allCards;
-    auto militaryCards = _policyManager->getUnlockedCards(PolicyType::MILITARY);
-    auto economicCards = _policyManager->getUnlockedCards(PolicyType::ECONOMIC);
-    auto wildcardCards = _policyManager->getUnlockedCards(PolicyType::WILDCARD);
-
-    for (const auto& c : militaryCards) if (!c.isActive) allCards.push_back(c);
-    for (const auto& c : economicCards) if (!c.isActive) allCards.push_back(c);
-    for (const auto& c : wildcardCards) if (!c.isActive) allCards.push_back(c);
+    std::vector<const PolicyCard*> allCards;
+    for (PolicyType type : { PolicyType::MILITARY, PolicyType::ECONOMIC, PolicyType::WILDCARD }) {
+        for (const PolicyCard* c : _policyManager->getUnlockedCards(type)) {
+            if (!_policyManager->isPolicyActive(c->id)) allCards.push_back(c);
+        }
+    }
 
-    // 
+    // 网格计算
     int colCount = floor((panelW - 20) / (CARD_W + 10));
     if (colCount < 1) colCount = 1;
 
@@ -513,14 +511,14 @@ void PolicyPanel::createRightList() {
         int r = i / colCount;
         int c = i % colCount;
 
-        auto cardNode = createDraggableCard(allCards[i]);
+        auto cardNode = createDraggableCard(*allCards[i]);
         cardNode->setPosition(startX + c * (CARD_W + paddingX), startY - r * (CARD_H + paddingY));
         scrollView->addChild(cardNode);
     }
 }
 
 // =========================================================
-// 
+// 辅助函数与政体界面
 // =========================================================
 
 Color3B PolicyPanel::getTypeColor(PolicyType type) {
@@ -534,34 +532,34 @@ Color3B PolicyPanel::getTypeColor(PolicyType type) {
 
 std::string PolicyPanel::getTypeName(PolicyType type) {
     switch (type) {
-    case PolicyType::MILITARY: return u8"";
-    case PolicyType::ECONOMIC: return u8"";
-    case PolicyType::WILDCARD: return u8"ͨ";
+    case PolicyType::MILITARY: return u8"军事";
+    case PolicyType::ECONOMIC: return u8"经济";
+    case PolicyType::WILDCARD: return u8"通用";
     }
     return "";
 }
 
-// 
+// 简介面板相关
 void PolicyPanel::createDescriptionPanel() {
     _descriptionPanel = Node::create();
 
-    // װ
+    // 背景底板
     auto background = DrawNode::create();
-    // ʹøĺɫ (0,0,0, 0.95) ߿ɶ
+    // 使用更深的黑色背景 (0,0,0, 0.95) 提高可读性
     background->drawSolidRect(Vec2(0, 0), Vec2(300, 200), Color4F(0.1f, 0.1f, 0.1f, 0.95f));
-    // һɫ߿
+    // 加一个白色边框
     background->drawRect(Vec2(0, 0), Vec2(300, 200), Color4F::WHITE);
     _descriptionPanel->addChild(background);
 
-    // ... 벻 (Title, Text, CloseBtn) ...
+    // ... 其余代码不变 (Title, Text, CloseBtn) ...
 
     _descriptionTitle = Label::createWithSystemFont("", "Arial", 18);
     _descriptionTitle->setAnchorPoint(Vec2(0, 1));
     _descriptionTitle->setPosition(10, 190);
-    _descriptionTitle->setColor(Color3B(255, 220, 100)); // ĳɽɫÿ
+    _descriptionTitle->setColor(Color3B(255, 220, 100)); // 标题改成金色更好看
     _descriptionPanel->addChild(_descriptionTitle);
 
-    _descriptionText = Label::createWithSystemFont("", "Arial", 16); // ΢һ
+    _descriptionText = Label::createWithSystemFont("", "Arial", 16); // 字体稍微大一点
     _descriptionText->setAnchorPoint(Vec2(0, 1));
     _descriptionText->setPosition(10, 160);
     _descriptionText->setColor(Color3B(220, 220, 220));
@@ -575,7 +573,7 @@ void PolicyPanel::createDescriptionPanel() {
     closeBtn->setContentSize(Size(30, 30));
     closeBtn->setPosition(Vec2(285, 185));
     closeBtn->setTitleFontSize(20);
-    closeBtn->setTitleText(u8"");
+    closeBtn->setTitleText(u8"×");
     closeBtn->setTitleColor(Color3B::WHITE);
     closeBtn->addClickEventListener([this](Ref*) {
         this->hidePolicyDescription();
@@ -583,7 +581,7 @@ void PolicyPanel::createDescriptionPanel() {
     _descriptionPanel->addChild(closeBtn);
 
     _descriptionPanel->setVisible(false);
-    this->addChild(_descriptionPanel, 100); // ȷϲ
+    this->addChild(_descriptionPanel, 100); // 确保在最上层
 }
 
 void PolicyPanel::showPolicyDescription(const PolicyCard& card) {
@@ -591,19 +589,19 @@ void PolicyPanel::showPolicyDescription(const PolicyCard& card) {
         createDescriptionPanel();
     }
     _descriptionTitle->setString(card.name);
-    std::string descText = u8": " + getTypeName(card.type) + "\n\n" + card.desc;
+    std::string descText = u8"类型: " + getTypeName(card.type) + "\n\n" + card.desc;
     _descriptionText->setString(descText);
 
-    // ȡĻߴ
+    // 获取屏幕尺寸
     auto vs = Director::getInstance()->getVisibleSize();
 
-    // ̶С 300x200 ( createDescriptionPanel ж)
+    // 面板固定大小是 300x200 (在 createDescriptionPanel 中定义的)
     float panelW = 300.0f;
     float panelH = 200.0f;
-    float margin = 20.0f; // ߾
+    float margin = 20.0f; // 边距
 
-    // λΪ½
-    // ԭ½ǣ x = Ļ -  - ߾, y = ߾
+    // 设置位置为右下角
+    // 坐标原点在左下角，所以 x = 屏幕宽 - 面板宽 - 边距, y = 边距
     _descriptionPanel->setPosition(Vec2(vs.width - panelW - margin, margin));
 
     _descriptionPanel->setVisible(true);
@@ -619,7 +617,7 @@ void PolicyPanel::onCardClicked(int cardId, const PolicyCard& card) {
     showPolicyDescription(card);
 }
 
-// ѡ
+// 政体选择界面相关
 void PolicyPanel::onChangeGovClicked() {
     showGovSelectLayer();
 }
@@ -634,13 +632,13 @@ void PolicyPanel::showGovSelectLayer() {
     _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, layer);
     this->addChild(layer, 999);
 
-    auto title = Label::createWithSystemFont(u8"ѡ", "Arial", 36);
+    auto title = Label::createWithSystemFont(u8"选择政体", "Arial", 36);
     title->setPosition(vs.width / 2, vs.height - 50);
     title->setColor(Color3B::YELLOW);
     layer->addChild(title);
 
     auto btnClose = Button::create();
-    btnClose->setTitleText(u8"");
+    btnClose->setTitleText(u8"返回");
     btnClose->setTitleFontSize(28);
     btnClose->setPosition(Vec2(vs.width - 80, vs.height - 50));
     btnClose->addClickEventListener([layer](Ref*) {
@@ -694,7 +692,7 @@ void PolicyPanel::showGovSelectLayer() {
             else {
                 itemNode->setOpacity(100);
                 if (auto lbl = dynamic_cast<Label*>(itemNode->getChildByName("status"))) {
-                    lbl->setString(u8"δ");
+                    lbl->setString(u8"未解锁");
                     lbl->setColor(Color3B::RED);
                 }
             }
@@ -722,10 +720,10 @@ Node* PolicyPanel::createGovOptionUI(GovernmentType type) {
     nameLabel->setColor(Color3B::WHITE);
     container->addChild(nameLabel);
 
-    // ʾλ
-    std::string info = u8":" + std::to_string(config.militarySlots) +
-        u8" :" + std::to_string(config.economicSlots) +
-        u8" ͨ:" + std::to_string(config.wildcardSlots);
+    // 简易显示槽位
+    std::string info = u8"军事:" + std::to_string(config.militarySlots) +
+        u8" 经济:" + std::to_string(config.economicSlots) +
+        u8" 通用:" + std::to_string(config.wildcardSlots);
     auto slotInfo = Label::createWithSystemFont(info, "Arial", 20);
     slotInfo->setAnchorPoint(Vec2::ANCHOR_MIDDLE_LEFT);
     slotInfo->setPosition(-280, -20);
@@ -1,56 +1,35 @@
 #include "TechTreePanel.h"
 #include <sstream>
 
-// TechTreePanelEventListener ʵ
-void TechTreePanelEventListener::onTechActivated(int techId, const std::string& techName,
-    const std::string& effect) {
-    if (_owner) {
-        _owner->handleTechActivated(techId, techName, effect);
-    }
-}
-
-void TechTreePanelEventListener::onResearchProgress(int techId, int currentProgress, int totalCost) {
-    if (_owner) {
-        _owner->handleResearchProgress(techId, currentProgress, totalCost);
-    }
-}
-
-void TechTreePanelEventListener::onEurekaTriggered(int techId, const std::string& techName) {
-    if (_owner) {
-        _owner->handleEurekaTriggered(techId, techName);
-    }
-}
-
 bool TechTreePanel::init() {
     if (!Layer::init()) {
         return false;
     }
 
-    // ôȷܴ¼
+    // 设置触摸监听器，确保我们能处理触摸事件
     auto listener = EventListenerTouchOneByOne::create();
     listener->setSwallowTouches(false);
     listener->onTouchBegan = [this](Touch* touch, Event* event) -> bool {
-        // falseô¼
+        // 返回false，让触摸事件继续传递
         return false;
         };
     _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
 
-    _eventListener = new TechTreePanelEventListener(this);
-    // ȡĻߴ
+    // 获取屏幕尺寸
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    // 
+    // 创建背景
     _background = LayerColor::create(Color4B(15, 15, 25, 240));
     _background->setContentSize(visibleSize);
     this->addChild(_background, -1);
 
-    // 
-    auto title = Label::createWithSystemFont(u8"Ƽ", "Arial", 40);
+    // 创建标题
+    auto title = Label::createWithSystemFont(u8"科技树", "Arial", 40);
     title->setPosition(Vec2(visibleSize.width / 2, visibleSize.height - 50));
     title->setColor(Color3B(255, 230, 100));
     this->addChild(title);
 
-    // ͼ
+    // 创建滚动视图
     _scrollView = ScrollView::create();
     _scrollView->setContentSize(Size(visibleSize.width - 40, visibleSize.height - 100));
     _scrollView->setPosition(Vec2(20, 120));
@@ -59,32 +38,32 @@ bool TechTreePanel::init() {
     _scrollView->setSwallowTouches(true);
     this->addChild(_scrollView);
 
-    // ݽڵ
+    // 创建内容节点
     _contentNode = Node::create();
     _contentNode->setAnchorPoint(Vec2::ANCHOR_BOTTOM_LEFT);
     _scrollView->addChild(_contentNode);
 
-    // ù - ɸУٸ߶¹
-    _scrollView->setInnerContainerSize(Size(ERA_SPACING * 10, visibleSize.height - 150)); // ڲ߶
+    // 设置滚动区域 - 增大宽度以容纳更多列，减少高度以限制上下滚动
+    _scrollView->setInnerContainerSize(Size(ERA_SPACING * 10, visibleSize.height - 150)); // 减少内部高度
     _contentNode->setPosition(0, 0);
 
-    // ײ
-    _controlPanel = LayerColor::create(Color4B(30, 30, 40, 220), visibleSize.width - 40, 120); // Ӹ߶
+    // 创建底部控制面板
+    _controlPanel = LayerColor::create(Color4B(30, 30, 40, 220), visibleSize.width - 40, 120); // 增加高度
     _controlPanel->setPosition(Vec2(20, 20));
     this->addChild(_controlPanel);
 
-    // ǰоǩ - 
-    _currentResearchLabel = Label::createWithSystemFont(u8"ǰо", "Arial", 26);
+    // 当前研究标签 - 增大字体
+    _currentResearchLabel = Label::createWithSystemFont(u8"当前研究：无", "Arial", 26);
     _currentResearchLabel->setPosition(Vec2(visibleSize.width / 2, 85));
     _currentResearchLabel->setColor(Color3B(255, 255, 200));
     _controlPanel->addChild(_currentResearchLabel);
 
-    // о - ߴ
+    // 研究进度条背景 - 增大尺寸
     auto progressBg = LayerColor::create(Color4B(40, 40, 40, 255), 500, 30);
     progressBg->setPosition(Vec2(visibleSize.width / 2 - 250, 45));
     _controlPanel->addChild(progressBg);
 
-    // о
+    // 研究进度条
     auto progressSprite = Sprite::create();
     auto progressDrawNode = DrawNode::create();
     progressDrawNode->drawSolidRect(Vec2::ZERO, Vec2(500, 30), Color4F(0.1f, 0.6f, 0.1f, 1.0f));
@@ -98,32 +77,32 @@ bool TechTreePanel::init() {
     _researchProgressBar->setPosition(Vec2(visibleSize.width / 2, 60));
     _controlPanel->addChild(_researchProgressBar);
 
-    // ÿغϿбǩ - 
-    /*_sciencePerTurnLabel = Label::createWithSystemFont(u8"ÿغϿУ0", "Arial", 22);
+    // 每回合科研标签 - 增大字体
+    /*_sciencePerTurnLabel = Label::createWithSystemFont(u8"每回合科研：0", "Arial", 22);
     _sciencePerTurnLabel->setPosition(Vec2(visibleSize.width / 2, 25));
     _sciencePerTurnLabel->setColor(Color3B(150, 220, 255));
     _controlPanel->addChild(_sciencePerTurnLabel);*/
 
-    // رհť - ʹLayoutΪťť
+    // 创建关闭按钮 - 使用Layout作为按钮，增大按钮
     auto closeButton = Layout::create();
-    closeButton->setContentSize(Size(120, 50)); // ť
+    closeButton->setContentSize(Size(120, 50)); // 增大按钮
     closeButton->setBackGroundColorType(Layout::BackGroundColorType::SOLID);
     closeButton->setBackGroundColor(Color3B(180, 60, 60));
     closeButton->setBackGroundColorOpacity(200);
     closeButton->setTouchEnabled(true);
-    closeButton->setPosition(Vec2(visibleSize.width - 140, visibleSize.height - 50)); // λ
+    closeButton->setPosition(Vec2(visibleSize.width - 140, visibleSize.height - 50)); // 调整位置
 
-    // ӹرհť - 
-    auto closeLabel = Label::createWithSystemFont(u8"ر", "Arial", 28);
+    // 添加关闭按钮文字 - 增大字体
+    auto closeLabel = Label::createWithSystemFont(u8"关闭", "Arial", 28);
     closeLabel->setPosition(Vec2(60, 25));
     closeLabel->setColor(Color3B::WHITE);
     closeButton->addChild(closeLabel);
 
 
-    // رհť¼
+    // 关闭按钮事件
     closeButton->addTouchEventListener([this](Ref* sender, Widget::TouchEventType type) {
         if (type == Widget::TouchEventType::ENDED) {
-            // ͹ر¼
+            // 发送关闭事件
             auto event = EventCustom("tech_tree_closed");
             this->getEventDispatcher()->dispatchEvent(&event);
         }
@@ -134,24 +113,51 @@ bool TechTreePanel::init() {
 }
 
 void TechTreePanel::setTechTree(TechTree* tree) {
-    if (_techTree) {
-        // Ƴɵ¼
-        _techTree->removeEventListener(_eventListener);
-    }
+    // 移除旧的事件监听器
+    unsubscribeTechEvents();
 
     _techTree = tree;
 
     if (_techTree) {
-        // µ¼
-        _techTree->addEventListener(_eventListener);
+        // 添加新的事件监听器
+        subscribeTechEvents();
         refreshUI();
         updateControlPanel();
     }
 }
 
+void TechTreePanel::subscribeTechEvents() {
+    EventBus* bus = EventBus::getInstance();
+
+    _techActivatedListener = bus->subscribe<TechActivatedEvent>([this](const TechActivatedEvent& event) {
+        if (event.tree != _techTree) return;
+        const TechNode* node = _techTree->getTechInfo(event.techId);
+        if (node) handleTechActivated(event.techId, node->name, node->effectDescription);
+        });
+
+    _researchProgressListener = bus->subscribe<ResearchProgressEvent>([this](const ResearchProgressEvent& event) {
+        if (event.tree != _techTree) return;
+        handleResearchProgress(event.techId, event.currentProgress, event.totalCost);
+        });
+
+    _eurekaListener = bus->subscribe<EurekaTriggeredEvent>([this](const EurekaTriggeredEvent& event) {
+        if (event.tree != _techTree) return;
+        const TechNode* node = _techTree->getTechInfo(event.techId);
+        if (node) handleEurekaTriggered(event.techId, node->name);
+        });
+}
+
+void TechTreePanel::unsubscribeTechEvents() {
+    EventBus* bus = EventBus::getInstance();
+    bus->unsubscribe<TechActivatedEvent>(_techActivatedListener);
+    bus->unsubscribe<ResearchProgressEvent>(_researchProgressListener);
+    bus->unsubscribe<EurekaTriggeredEvent>(_eurekaListener);
+    _techActivatedListener = _researchProgressListener = _eurekaListener = 0;
+}
+
 void TechTreePanel::setSciencePerTurn(int science) {
     /*if (_sciencePerTurnLabel) {
-        std::string text = "ÿغϿУ" + std::to_string(science);
+        std::string text = "每回合科研：" + std::to_string(science);
         _sciencePerTurnLabel->setString(text);
     }*/
 }
@@ -159,26 +165,26 @@ void TechTreePanel::setSciencePerTurn(int science) {
 Node* TechTreePanel::createTechNodeUI(const TechNode* techData) {
     if (!techData) return nullptr;
 
-    // ڵ
+    // 创建容器节点
     auto container = Node::create();
     container->setContentSize(Size(NODE_WIDTH, NODE_HEIGHT));
 
-    // Layout
+    // 创建背景Layout
     auto background = Layout::create();
     background->setBackGroundColorType(Layout::BackGroundColorType::SOLID);
     background->setBackGroundColor(Color3B(64, 64, 89));
     background->setBackGroundColorOpacity(255);
     background->setContentSize(Size(NODE_WIDTH, NODE_HEIGHT));
-    background->setTouchEnabled(false);  // ȷش
+    background->setTouchEnabled(false);  // 确保背景不拦截触摸
     background->setTag(100);
     container->addChild(background, -1);
 
-    //  MenuItem ȷܽմ¼
+    // 创建 MenuItem 并确保它能接收触摸事件
     auto menuItem = MenuItem::create();
     menuItem->setContentSize(Size(NODE_WIDTH, NODE_HEIGHT));
     menuItem->setTag(techData->id);
 
-    // Ҫûصɵ
+    // 重要：设置回调，让整个区域可点击
     menuItem->setCallback([this, techId = techData->id](Ref* sender) {
         CCLOG("Tech node clicked: %d", techId);
 
@@ -195,59 +201,59 @@ Node* TechTreePanel::createTechNodeUI(const TechNode* techData) {
         }
         });
 
-    //  Menu - Ҫ position ģȷȷ
+    // 创建 Menu - 重要：设置 position 在中心，确保触摸区域正确
     auto menu = Menu::create(menuItem, nullptr);
     menu->setPosition(Vec2(NODE_WIDTH / 2, NODE_HEIGHT / 2));
     menuItem->setPosition(Vec2::ZERO);
     container->addChild(menu);
 
-    // ӱ߿ʹDrawNode
+    // 添加边框（使用DrawNode）
     auto border = DrawNode::create();
     border->drawRect(Vec2(0, 0), Vec2(NODE_WIDTH, NODE_HEIGHT),
         Color4F(1.0f, 1.0f, 1.0f, 0.5f));
     border->setTag(106);
     container->addChild(border);
 
-    // Ƽƣʾ
-    // Բͬ
+    // 科技名称（居中显示）
+    // 尝试不同的字体和设置
     auto nameLabel = Label::create();
 
-    // 1ʹϵͳ壨ȷ֧ģ
+    // 方法1：使用系统字体（确保支持中文）
     nameLabel = Label::createWithSystemFont(techData->name, "Arial", 20);
 
-    // 1УԷ2ʹTTF
+    // 如果方法1不行，尝试方法2：使用TTF字体
     // nameLabel = Label::createWithTTF(techData->name, "fonts/arial.ttf", 20);
 
-    // 2УԷ3һ򵥵Ĳı
-    // nameLabel = Label::createWithSystemFont("", "Arial", 20);
+    // 如果方法2不行，尝试方法3：创建一个简单的测试文本
+    // nameLabel = Label::createWithSystemFont("测试", "Arial", 20);
 
-    // λúɫ
+    // 设置位置和颜色
     nameLabel->setPosition(Vec2(NODE_WIDTH / 2, NODE_HEIGHT / 2 + 15));
-    nameLabel->setColor(Color3B::RED);  // ʹúɫ׿
+    nameLabel->setColor(Color3B::RED);  // 使用红色，更容易看到
     nameLabel->setTag(101);
 
-    // ʱƳԶãȷʾ
+    // 暂时移除自动换行设置，先确保能显示
     // nameLabel->setDimensions(NODE_WIDTH - 20, 50);
     // nameLabel->setHorizontalAlignment(TextHAlignment::CENTER);
     // nameLabel->setVerticalAlignment(TextVAlignment::CENTER);
     // nameLabel->setOverflow(Label::Overflow::SHRINK);
 
-    container->addChild(nameLabel, 10);  // ȷǩڽϸ߲㼶
+    container->addChild(nameLabel, 10);  // 确保标签在较高层级
 
-    // һõıȷǩλȷ
+    // 添加一个调试用的背景，确保标签位置正确
     auto debugBg = LayerColor::create(Color4B(255, 0, 0, 50), NODE_WIDTH - 20, 30);
     debugBg->setPosition(Vec2(10, NODE_HEIGHT / 2));
-    debugBg->setTag(999);  // ʹһصtagʶ
+    debugBg->setTag(999);  // 使用一个独特的tag，便于识别
     container->addChild(debugBg, 5);
 
-    // Ƽɱʾڵײ
+    // 科技成本（显示在底部）
     auto costLabel = Label::createWithSystemFont(std::to_string(techData->cost), "Arial", 16);
     costLabel->setPosition(Vec2(NODE_WIDTH / 2, 20));
     costLabel->setColor(Color3B(180, 180, 255));
     costLabel->setTag(103);
     container->addChild(costLabel, 10);
 
-    // 
+    // 进度条背景
     auto progressBg = DrawNode::create();
     progressBg->drawSolidRect(Vec2(5, NODE_HEIGHT - 12),
         Vec2(NODE_WIDTH - 5, NODE_HEIGHT - 4),
@@ -255,7 +261,7 @@ Node* TechTreePanel::createTechNodeUI(const TechNode* techData) {
     progressBg->setTag(104);
     container->addChild(progressBg, 5);
 
-    // 
+    // 进度条
     auto progressBar = DrawNode::create();
     progressBar->setTag(105);
     container->addChild(progressBar, 6);
@@ -273,7 +279,7 @@ void TechTreePanel::drawRoundedRect(DrawNode* drawNode, const Rect& rect, float
     float width = rect.size.width;
     float height = rect.size.height;
 
-    // ĸԲ
+    // 绘制四个圆角
     drawNode->drawSolidCircle(Vec2(x + radius, y + radius), radius,
         CC_DEGREES_TO_RADIANS(360), 16, color);
     drawNode->drawSolidCircle(Vec2(x + width - radius, y + radius), radius,
@@ -283,7 +289,7 @@ void TechTreePanel::drawRoundedRect(DrawNode* drawNode, const Rect& rect, float
     drawNode->drawSolidCircle(Vec2(x + width - radius, y + height - radius), radius,
         CC_DEGREES_TO_RADIANS(360), 16, color);
 
-    // ĸ
+    // 绘制四个矩形区域
     drawNode->drawSolidRect(Vec2(x + radius, y),
         Vec2(x + width - radius, y + height), color);
     drawNode->drawSolidRect(Vec2(x, y + radius),
@@ -293,7 +299,7 @@ void TechTreePanel::drawRoundedRect(DrawNode* drawNode, const Rect& rect, float
 void TechTreePanel::refreshUI() {
     if (!_techTree) return;
 
-    // UI
+    // 清除旧UI
     _contentNode->removeAllChildren();
     _nodeUIMap.clear();
     _techPositions.clear();
@@ -301,16 +307,16 @@ void TechTreePanel::refreshUI() {
     _techRow.clear();
     _techByDepth.clear();
 
-    // һ
+    // 第一步：拓扑排序
     std::vector<int> sortedTechs = topologicalSort();
 
-    // ڶƼ
+    // 第二步：计算科技深度
     calculateTechDepths();
 
-    // 㷨
+    // 第三步：布局算法
     layoutTechTree();
 
-    // Ĳڵ
+    // 第四步：创建节点
     for (int techId : sortedTechs) {
         auto techInfo = _techTree->getTechInfo(techId);
         if (techInfo) {
@@ -319,17 +325,17 @@ void TechTreePanel::refreshUI() {
                 _nodeUIMap[techId] = nodeUI;
                 _contentNode->addChild(nodeUI);
 
-                // üõλ
+                // 设置计算好的位置
                 Vec2 pos = _techPositions[techId];
                 nodeUI->setPosition(pos);
             }
         }
     }
 
-    // 岽б
+    // 第五步：绘制列背景
     drawColumnBackgrounds();
 
-    // 
+    // 第六步：创建连接线
     for (const auto& pair : _nodeUIMap) {
         int fromTechId = pair.first;
         auto techInfo = _techTree->getTechInfo(fromTechId);
@@ -340,8 +346,7 @@ void TechTreePanel::refreshUI() {
         }
     }
 
-    // ߲½ڵ״̬
-    auto researchableTechs = _techTree->getResearchableTechList();
+    // 第七步：更新节点状态
     int currentResearch = _techTree->getCurrentResearch();
 
     for (const auto& pair : _nodeUIMap) {
@@ -357,7 +362,7 @@ void TechTreePanel::refreshUI() {
         else if (_techTree->getTechProgress(techId) > 0) {
             state = TechNodeState::IN_PROGRESS;
         }
-        else if (std::find(researchableTechs.begin(), researchableTechs.end(), techId) != researchableTechs.end()) {
+        else if (_techTree->isResearchable(techId)) {
             state = TechNodeState::RESEARCHABLE;
         }
 
@@ -365,15 +370,15 @@ void TechTreePanel::refreshUI() {
     }
 }
 
-// === Ƽȣ ===
+// === 计算科技深度（列数） ===
 void TechTreePanel::calculateTechDepths() {
     if (!_techTree) return;
 
-    // ÿƼȣȾ·ȣ
+    // 计算每个科技的深度（最大先决路径长度）
     bool changed = true;
     int maxIterations = 20;
 
-    // ʼڵΪ0Ϊ-1
+    // 初始化：根节点深度为0，其他为-1
     for (int i = 1; i <= 24; i++) {
         auto techInfo = _techTree->getTechInfo(i);
         if (techInfo && techInfo->srcTechList.empty()) {
@@ -381,11 +386,11 @@ void TechTreePanel::calculateTechDepths() {
             _techByDepth[0].push_back(i);
         }
         else if (techInfo) {
-            _techDepth[i] = -1; // δ
+            _techDepth[i] = -1; // 未计算
         }
     }
 
-    // 
+    // 迭代计算深度
     for (int iter = 0; iter < maxIterations && changed; iter++) {
         changed = false;
 
@@ -393,7 +398,7 @@ void TechTreePanel::calculateTechDepths() {
             auto techInfo = _techTree->getTechInfo(i);
             if (!techInfo || _techDepth[i] != -1) continue;
 
-            // ȾƼǷ
+            // 检查所有先决科技是否都有深度
             bool allParentsHaveDepth = true;
             int maxParentDepth = -1;
 
@@ -413,30 +418,30 @@ void TechTreePanel::calculateTechDepths() {
         }
     }
 
-    // ȷпƼ
+    // 确保所有科技都有深度
     for (int i = 1; i <= 24; i++) {
         if (_techDepth.find(i) == _techDepth.end() || _techDepth[i] == -1) {
-            // ҲȾϵĹڵ㣬ڵһ
+            // 找不到先决关系的孤立节点，放在第一列
             _techDepth[i] = 0;
             _techByDepth[0].push_back(i);
         }
     }
 }
 
-// === 6Ĳ㷨 ===
+// === 文明6风格的布局算法 ===
 void TechTreePanel::layoutTechTree() {
-    const float COLUMN_SPACING = 280.0f;   // ERA_SPACINGһ
-    const float ROW_SPACING = 150.0f;      // мԱص
-    const float BASE_X = 100.0f;           // ʼXƫ
+    const float COLUMN_SPACING = 280.0f;   // 与ERA_SPACING保持一致
+    const float ROW_SPACING = 150.0f;      // 增大行间距以避免重叠
+    const float BASE_X = 100.0f;           // 增加起始X坐标偏移
     const float BASE_Y = 350.0f;
 
-    // ȡʵʸ߶ȣͼڲ߶ȣ
+    // 获取内容区域的实际高度（滚动视图的内部高度）
     float contentHeight = _scrollView->getInnerContainerSize().height;
 
-    // һȷÿеĿƼ
+    // 第一步：确定每列的科技并排序
     std::unordered_map<int, std::vector<int>> columnTechs = _techByDepth;
 
-    // ȾϵÿеĿƼ
+    // 按先决关系对每列的科技进行排序
     for (auto& columnPair : columnTechs) {
         std::sort(columnPair.second.begin(), columnPair.second.end(),
             [this](int a, int b) {
@@ -444,14 +449,14 @@ void TechTreePanel::layoutTechTree() {
                 auto infoB = _techTree->getTechInfo(b);
                 if (!infoA || !infoB) return a < b;
 
-                // Ȱӽڵӽڵϣ
+                // 优先按子节点数量排序（子节点多的在上）
                 int childrenA = infoA->dstTechList.size();
                 int childrenB = infoB->dstTechList.size();
                 if (childrenA != childrenB) {
                     return childrenA > childrenB;
                 }
 
-                // ΰڵ򣨸ڵ£
+                // 其次按父节点数量排序（父节点多的在下）
                 int parentsA = infoA->srcTechList.size();
                 int parentsB = infoB->srcTechList.size();
                 if (parentsA != parentsB) {
@@ -462,38 +467,38 @@ void TechTreePanel::layoutTechTree() {
             });
     }
 
-    // ڶΪÿƼк
+    // 第二步：为每个科技分配行号
     for (const auto& columnPair : columnTechs) {
         int column = columnPair.first;
         const auto& techsInColumn = columnPair.second;
 
         if (techsInColumn.empty()) continue;
 
-        // ʹ߶ȼõĴֱռ
-        float availableHeight = contentHeight - 200.0f;  // ±߾
+        // 使用内容区域高度计算可用的垂直空间
+        float availableHeight = contentHeight - 200.0f;  // 留出上下边距
         float totalRequiredHeight = techsInColumn.size() * (NODE_HEIGHT + 60.0f);
 
-        // ̬м࣬ȷᳬÿռ
+        // 动态调整行间距，确保不会超出可用空间
         float dynamicRowSpacing = ROW_SPACING;
         if (totalRequiredHeight > availableHeight) {
             dynamicRowSpacing = availableHeight / techsInColumn.size() - 40.0f;
             dynamicRowSpacing = std::max(dynamicRowSpacing, NODE_HEIGHT + 40.0f);
         }
 
-        // 
+        // 计算中心行
         float centerRow = (techsInColumn.size() - 1) / 2.0f;
 
         for (size_t i = 0; i < techsInColumn.size(); i++) {
             int techId = techsInColumn[i];
 
-            // ƫ
+            // 计算行偏移
             float rowOffset = static_cast<float>(i) - centerRow;
 
-            // λ
+            // 计算基础位置
             float x = BASE_X + column * COLUMN_SPACING;
             float y = BASE_Y + rowOffset * dynamicRowSpacing;
 
-            // ȷYںΧڣ
+            // 确保Y坐标在合理范围内（基于内容区域）
             float minY = 100.0f;
             float maxY = contentHeight - 100.0f;
             y = std::max(minY, std::min(y, maxY));
@@ -502,26 +507,26 @@ void TechTreePanel::layoutTechTree() {
         }
     }
 
-    // λñصŻ
+    // 第三步：调整位置避免重叠并优化连接线
     adjustPositionsForConnections();
 }
 
-// === λŻ ===
+// === 调整位置优化连接线 ===
 void TechTreePanel::adjustPositionsForConnections() {
     if (!_techTree) return;
 
-    // ȡʵʸ߶
+    // 获取内容区域的实际高度
     float contentHeight = _scrollView->getInnerContainerSize().height;
 
     const float MAX_ADJUSTMENT = 50.0f;
     const int MAX_ITERATIONS = 30;
-    const float MIN_Y = 120.0f;    // СY꣬ӱ߾
-    const float MAX_Y = contentHeight - 120.0f;  // Y
+    const float MIN_Y = 120.0f;    // 最小Y坐标，增加边距
+    const float MAX_Y = contentHeight - 120.0f;  // 基于内容区域的最大Y坐标
 
     for (int iter = 0; iter < MAX_ITERATIONS; iter++) {
         bool adjusted = false;
 
-        // ռ
+        // 收集所有连接线
         std::vector<std::pair<int, int>> connections;
         for (const auto& pair : _nodeUIMap) {
             int fromTechId = pair.first;
@@ -533,13 +538,13 @@ void TechTreePanel::adjustPositionsForConnections() {
             }
         }
 
-        // ߽
+        // 调整连接线交叉
         for (size_t i = 0; i < connections.size(); i++) {
             for (size_t j = i + 1; j < connections.size(); j++) {
                 auto& conn1 = connections[i];
                 auto& conn2 = connections[j];
 
-                // ͬһе
+                // 跳过不是同一列的连接线
                 if (_techDepth[conn1.first] != _techDepth[conn2.first] ||
                     _techDepth[conn1.second] != _techDepth[conn2.second]) {
                     continue;
@@ -550,24 +555,24 @@ void TechTreePanel::adjustPositionsForConnections() {
                 Vec2 start2 = _techPositions[conn2.first];
                 Vec2 end2 = _techPositions[conn2.second];
 
-                // Ƿ񽻲棨ȷļ飩
+                // 检查连接线是否交叉（更精确的检查）
                 if (doLinesCross(start1, end1, start2, end2)) {
-                    // һӵĽڵλ
+                    // 调整后一个连接的节点位置
                     int adjustTech = conn2.second;
                     Vec2 pos = _techPositions[adjustTech];
 
-                    // ߵλþ
+                    // 根据连接线的相对位置决定调整方向
                     float y1 = (start1.y + end1.y) / 2.0f;
                     float y2 = (start2.y + end2.y) / 2.0f;
 
                     if (y2 > y1) {
-                        pos.y += MAX_ADJUSTMENT * 0.7f;  // µ
+                        pos.y += MAX_ADJUSTMENT * 0.7f;  // 向下调整
                     }
                     else {
-                        pos.y -= MAX_ADJUSTMENT * 0.7f;  // ϵ
+                        pos.y -= MAX_ADJUSTMENT * 0.7f;  // 向上调整
                     }
 
-                    // ȷλںΧ
+                    // 确保调整后的位置在合理范围内
                     pos.y = std::max(MIN_Y, std::min(pos.y, MAX_Y));
 
                     _techPositions[adjustTech] = pos;
@@ -576,25 +581,25 @@ void TechTreePanel::adjustPositionsForConnections() {
             }
         }
 
-        // ûеﵽޣ˳
+        // 如果没有调整或调整次数达到上限，退出
         if (!adjusted) break;
     }
 
-    // ĲȷͬһеĽڵ㲻ص
+    // 第四步：确保同一列中的节点不会重叠
     for (const auto& columnPair : _techByDepth) {
         int column = columnPair.first;
         const auto& techsInColumn = columnPair.second;
 
         if (techsInColumn.size() <= 1) continue;
 
-        // Y
+        // 按Y坐标排序
         std::vector<int> sortedTechs = techsInColumn;
         std::sort(sortedTechs.begin(), sortedTechs.end(),
             [this](int a, int b) {
                 return _techPositions[a].y < _techPositions[b].y;
             });
 
-        // 鲢صĽڵ
+        // 检查并调整重叠的节点
         for (size_t i = 1; i < sortedTechs.size(); i++) {
             int prevId = sortedTechs[i - 1];
             int currId = sortedTechs[i];
@@ -602,25 +607,25 @@ void TechTreePanel::adjustPositionsForConnections() {
             Vec2 prevPos = _techPositions[prevId];
             Vec2 currPos = _techPositions[currId];
 
-            // ڵ̫ӽλ
-            float minSpacing = NODE_HEIGHT + 60.0f; // С
+            // 如果两个节点太接近，调整位置
+            float minSpacing = NODE_HEIGHT + 60.0f; // 增加最小间距
             float currentSpacing = currPos.y - prevPos.y;
 
             if (currentSpacing < minSpacing) {
-                // Ҫƶܾ
+                // 计算需要移动的总距离
                 float neededSpace = minSpacing - currentSpacing;
 
-                // ƽռ䣬ƶǰһڵ㣬ƶһڵ
+                // 平均分配空间，向上移动前一个节点，向下移动后一个节点
                 float moveDistance = neededSpace / 2.0f;
 
                 float newPrevY = prevPos.y - moveDistance;
                 float newCurrY = currPos.y + moveDistance;
 
-                // ȷ߽
+                // 确保不超出边界
                 newPrevY = std::max(MIN_Y, std::min(newPrevY, MAX_Y - minSpacing));
                 newCurrY = std::max(MIN_Y + minSpacing, std::min(newCurrY, MAX_Y));
 
-                // λ
+                // 更新位置
                 _techPositions[prevId].y = newPrevY;
                 _techPositions[currId].y = newCurrY;
             }
@@ -628,30 +633,30 @@ void TechTreePanel::adjustPositionsForConnections() {
     }
 }
 
-// === ߶Ƿཻ ===
+// === 检查两条线段是否相交 ===
 bool TechTreePanel::doLinesCross(const Vec2& p1, const Vec2& p2, const Vec2& q1, const Vec2& q2) {
-    // 㷽
+    // 计算方向向量
     Vec2 r = p2 - p1;
     Vec2 s = q2 - q1;
 
-    // 
+    // 计算叉积
     float rxs = r.cross(s);
     float qpxr = (q1 - p1).cross(r);
 
-    // ߶ƽ
+    // 如果两线段平行
     if (abs(rxs) < 0.0001f) {
         return false;
     }
 
-    // 㽻
+    // 计算交点参数
     float t = (q1 - p1).cross(s) / rxs;
     float u = (q1 - p1).cross(r) / rxs;
 
-    // 齻Ƿ߶
+    // 检查交点是否在两线段上
     return (t >= 0.0f && t <= 1.0f && u >= 0.0f && u <= 1.0f);
 }
 
-// ===  ===
+// === 创建样条曲线连接 ===
 void TechTreePanel::createSplineConnection(int fromTechId, int toTechId) {
     auto fromNode = _nodeUIMap[fromTechId];
     auto toNode = _nodeUIMap[toTechId];
@@ -663,41 +668,41 @@ void TechTreePanel::createSplineConnection(int fromTechId, int toTechId) {
 
     auto drawNode = DrawNode::create();
 
-    // 6ߣˮƽ-ֱ-ˮƽ 
+    // 文明6风格的连线：水平-垂直-水平 折线
     float midX = (startPos.x + endPos.x) / 2;
 
-    // ״̬ɫ
-    Color4F lineColor = Color4F(0.3f, 0.3f, 0.4f, 0.6f); // Ĭϻɫ
+    // 根据状态决定连线颜色
+    Color4F lineColor = Color4F(0.3f, 0.3f, 0.4f, 0.6f); // 默认灰色
 
     bool fromActivated = _techTree->isActivated(fromTechId);
     bool toActivated = _techTree->isActivated(toTechId);
     int currentResearch = _techTree->getCurrentResearch();
 
     if (fromActivated && toActivated) {
-        lineColor = Color4F(0.0f, 0.8f, 0.0f, 0.8f); // ɫѼ
+        lineColor = Color4F(0.0f, 0.8f, 0.0f, 0.8f); // 绿色：都已激活
     }
     else if ((fromActivated && toTechId == currentResearch) ||
         (fromTechId == currentResearch && toActivated)) {
-        lineColor = Color4F(0.9f, 0.7f, 0.1f, 0.9f); // ɫ뵱ǰо
+        lineColor = Color4F(0.9f, 0.7f, 0.1f, 0.9f); // 金色：与当前研究相关
     }
     else if (_techTree->getTechProgress(toTechId) > 0) {
-        lineColor = Color4F(0.2f, 0.6f, 0.2f, 0.7f); // ǳ̣н
+        lineColor = Color4F(0.2f, 0.6f, 0.2f, 0.7f); // 浅绿：有进度
     }
 
-    // ߣˮƽ-ֱ-ˮƽ
+    // 绘制三段线：水平-垂直-水平
     drawNode->drawSegment(startPos, Vec2(midX, startPos.y), 2.0f, lineColor);
     drawNode->drawSegment(Vec2(midX, startPos.y), Vec2(midX, endPos.y), 2.0f, lineColor);
     drawNode->drawSegment(Vec2(midX, endPos.y), endPos, 2.0f, lineColor);
 
-    // ڹսǴԲ
+    // 在拐角处添加圆点
     drawNode->drawSolidCircle(Vec2(midX, startPos.y), 4.0f,
         CC_DEGREES_TO_RADIANS(360), 8, lineColor);
     drawNode->drawSolidCircle(Vec2(midX, endPos.y), 4.0f,
         CC_DEGREES_TO_RADIANS(360), 8, lineColor);
 
-    //// Ӽͷָӽڵ㣩
+    //// 添加箭头（指向子节点）
     //Vec2 dir = (endPos - Vec2(midX, endPos.y)).getNormalized();
-    //Vec2 arrowTip = endPos - dir * 10.0f; // ΢һ
+    //Vec2 arrowTip = endPos - dir * 10.0f; // 稍微回退一点
     //Vec2 wing1 = arrowTip - dir * 8.0f + Vec2(-dir.y, dir.x) * 5.0f;
     //Vec2 wing2 = arrowTip - dir * 8.0f + Vec2(dir.y, -dir.x) * 5.0f;
     //drawNode->drawSolidTriangle(arrowTip, wing1, wing2, lineColor);
@@ -705,19 +710,19 @@ void TechTreePanel::createSplineConnection(int fromTechId, int toTechId) {
     _contentNode->addChild(drawNode, -5);
 }
 
-// === б ===
+// === 绘制列背景 ===
 void TechTreePanel::drawColumnBackgrounds() {
-    //// ҵ
+    //// 找到最大列数
     //int maxColumn = 0;
     //for (const auto& pair : _techDepth) {
     //    maxColumn = std::max(maxColumn, pair.second);
     //}
 
-    //// б
+    //// 绘制列背景
     //const float COLUMN_WIDTH = 180.0f;
     //const float PADDING = 20.0f;
-    //const float BACKGROUND_HEIGHT = 700.0f; // ӱ߶
-    //const float BACKGROUND_BOTTOM = 50.0f;   // ײλ
+    //const float BACKGROUND_HEIGHT = 700.0f; // 增加背景高度
+    //const float BACKGROUND_BOTTOM = 50.0f;   // 背景底部位置
 
     //for (int col = 0; col <= maxColumn; col++) {
     //    float x = 60 + col * 200 - PADDING;
@@ -726,21 +731,21 @@ void TechTreePanel::drawColumnBackgrounds() {
     //    auto columnBg = DrawNode::create();
     //    Color4F bgColor = Color4F(0.05f, 0.05f, 0.08f, 0.3f);
 
-    //    // ԲǾб
+    //    // 绘制圆角矩形列背景
     //    Rect columnRect(x, BACKGROUND_BOTTOM, width, BACKGROUND_HEIGHT);
     //    drawRoundedRect(columnBg, columnRect, 10.0f, bgColor);
 
     //    _contentNode->addChild(columnBg, -10);
 
-    //    // бǩʱƣ
+    //    // 添加列标签（时代名称）
     //    std::string columnLabel;
-    //    if (col == 0) columnLabel = u8"Զʱ";
-    //    else if (col == 1) columnLabel = u8"ŵʱ";
-    //    else if (col == 2) columnLabel = u8"";
-    //    else if (col == 3) columnLabel = u8"ո";
-    //    else if (col == 4) columnLabel = u8"ҵʱ";
-    //    else if (col == 5) columnLabel = u8"ִ";
-    //    else columnLabel = u8"δʱ";
+    //    if (col == 0) columnLabel = u8"远古时代";
+    //    else if (col == 1) columnLabel = u8"古典时代";
+    //    else if (col == 2) columnLabel = u8"中世纪";
+    //    else if (col == 3) columnLabel = u8"文艺复兴";
+    //    else if (col == 4) columnLabel = u8"工业时代";
+    //    else if (col == 5) columnLabel = u8"现代";
+    //    else columnLabel = u8"未来时代";
 
     //    auto label = Label::createWithSystemFont(columnLabel, "Arial", 18);
     //    label->setPosition(Vec2(x + width / 2, BACKGROUND_BOTTOM + BACKGROUND_HEIGHT + 20));
@@ -749,12 +754,12 @@ void TechTreePanel::drawColumnBackgrounds() {
     //}
 }
 
-// === ޸Ż棩 ===
+// === 修改拓扑排序函数（优化版） ===
 std::vector<int> TechTreePanel::topologicalSort() {
     std::vector<int> result;
     if (!_techTree) return result;
 
-    // ռпƼID
+    // 收集所有科技ID
     std::vector<int> allTechs;
     for (int i = 1; i <= 24; i++) {
         if (_techTree->getTechInfo(i)) {
@@ -762,7 +767,7 @@ std::vector<int> TechTreePanel::topologicalSort() {
         }
     }
 
-    // 
+    // 计算入度
     std::unordered_map<int, int> inDegree;
     std::queue<int> zeroInDegree;
 
@@ -776,7 +781,7 @@ std::vector<int> TechTreePanel::topologicalSort() {
         }
     }
 
-    // Kahn㷨
+    // 拓扑排序（Kahn算法）
     while (!zeroInDegree.empty()) {
         int current = zeroInDegree.front();
         zeroInDegree.pop();
@@ -802,17 +807,17 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
         return;
     }
 
-    // ƳԱ
+    // 移除调试背景
     auto debugBg = container->getChildByTag(999);
     if (debugBg) {
         debugBg->removeFromParent();
     }
 
-    // ȡȷĲ˵
+    // 获取正确的菜单项
     Menu* menu = nullptr;
     MenuItem* menuItem = nullptr;
 
-    //  Menu
+    // 查找 Menu
     for (auto child : container->getChildren()) {
         menu = dynamic_cast<Menu*>(child);
         if (menu) break;
@@ -822,7 +827,7 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
         menuItem = dynamic_cast<MenuItem*>(menu->getChildren().at(0));
     }
 
-    // ״̬ MenuItem
+    // 根据状态设置 MenuItem
     if (menuItem) {
         switch (state) {
             case TechNodeState::LOCKED:
@@ -834,12 +839,12 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
                 menuItem->setEnabled(true);
                 break;
             case TechNodeState::ACTIVATED:
-                menuItem->setEnabled(false); // ѼĿƼɵ
+                menuItem->setEnabled(false); // 已激活的科技不可点击
                 break;
         }
     }
 
-    // ȡLayout
+    // 获取背景（Layout）
     auto background = dynamic_cast<Layout*>(container->getChildByTag(100));
     auto nameLabel = dynamic_cast<Label*>(container->getChildByTag(101));
     auto costLabel = dynamic_cast<Label*>(container->getChildByTag(103));
@@ -860,7 +865,7 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
     Color3B costColor = Color3B(180, 180, 255);
     Color4F borderColor = Color4F(1.0f, 1.0f, 1.0f, 0.3f);
 
-    // ״̬ɫ
+    // 根据状态设置颜色
     switch (state) {
         case TechNodeState::LOCKED:
             bgColor = Color3B(64, 64, 89);
@@ -887,21 +892,21 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
             break;
     }
 
-    // ±ɫ
+    // 更新背景颜色
     background->setBackGroundColor(bgColor);
 
-    // ±߿
+    // 更新边框
     border->clear();
     border->drawRect(Vec2(2, 2), Vec2(NODE_WIDTH - 2, NODE_HEIGHT - 2), borderColor);
 
-    // ıɫ
+    // 更新文本颜色
     nameLabel->setColor(nameColor);
     costLabel->setColor(costColor);
 
     CCLOG("Updated UI state for tech %d: name color = (%d, %d, %d)",
         techId, nameColor.r, nameColor.g, nameColor.b);
 
-    // ½У
+    // 更新进度条（如果有）
     if (progressBar && _techTree) {
         int progress = _techTree->getTechProgress(techId);
         int cost = _techTree->getTechCost(techId);
@@ -924,13 +929,13 @@ void TechTreePanel::updateNodeUIState(int techId, TechNodeState state) {
             progressBar->drawSolidRect(Vec2(5, NODE_HEIGHT - 12),
                 Vec2(5 + width, NODE_HEIGHT - 4), progressColor);
 
-            // ³ɱʾΪ
+            // 更新成本显示为进度
             std::string progressText = std::to_string(progress) + "/" + std::to_string(cost);
             costLabel->setString(progressText);
         }
         else {
             progressBar->clear();
-            // ûнȣʾԭʼɱ
+            // 如果没有进度，显示原始成本
             auto techInfo = _techTree->getTechInfo(techId);
             if (techInfo) {
                 costLabel->setString(std::to_string(techInfo->cost));
@@ -953,7 +958,7 @@ void TechTreePanel::onTechNodeClicked(Ref* sender, Widget::TouchEventType type)
     //CCLOG("Button clicked for tech ID: %d", techId);
     //CCLOG("Calling showTechDetail...");
 
-    //// һֱӵĲԣȷ
+    //// 添加一个直接的测试，确保函数被调用
     //auto testLabel = Label::createWithTTF("TEST DIRECT - Before showDetail",
     //    "fonts/arial.ttf", 20);
     //testLabel->setPosition(Vec2(200, 300));
@@ -966,10 +971,10 @@ void TechTreePanel::onTechNodeClicked(Ref* sender, Widget::TouchEventType type)
     //    nullptr
     //));
 
-    //// Ȼ showDetail
+    //// 然后调用 showDetail
     //this->showTechDetail(techId);
 
-    //// һԱǩ
+    //// 再添加一个测试标签
     //auto testLabel2 = Label::createWithTTF("TEST DIRECT - After showDetail",
     //    "fonts/arial.ttf", 20);
     //testLabel2->setPosition(Vec2(200, 250));
@@ -1005,25 +1010,25 @@ void TechTreePanel::showTechDetail(int techId) {
 
     CCLOG("Tech name: %s", techInfo->name.c_str());
 
-    // ؾɵ
+    // 隐藏旧的详情面板
     hideTechDetail();
 
-    // ȷ̴߳UI
+    // 确保在主线程创建UI
     auto visibleSize = Director::getInstance()->getVisibleSize();
 
-    //  - ȷλڿɼ
-    _detailPanel = LayerColor::create(Color4B(0, 0, 0, 220), 400, 320); // Ӹ߶ɸ
+    // 创建详情面板 - 确保位置在可见区域内
+    _detailPanel = LayerColor::create(Color4B(0, 0, 0, 220), 400, 320); // 增加高度以容纳更多内容
 
-    // λãȷĻ
+    // 计算位置，确保不超出屏幕
     float panelX = visibleSize.width - 420;
     float panelY = 150;
 
-    // ұ߽磬λ
+    // 如果超出右边界，调整位置
     if (panelX < 20) {
         panelX = 20;
     }
 
-    // ϱ߽磬λ
+    // 如果超出上边界，调整位置
     if (panelY + 320 > visibleSize.height - 100) {
         panelY = visibleSize.height - 420;
     }
@@ -1031,16 +1036,16 @@ void TechTreePanel::showTechDetail(int techId) {
     _detailPanel->setPosition(Vec2(panelX, panelY));
     _detailPanel->setName("detail_panel");
 
-    // 嵽TechTreePanel
+    // 添加详情面板到TechTreePanel
     this->addChild(_detailPanel, 10);
 
-    // Ƽ
+    // 科技名称
     auto nameLabel = Label::createWithSystemFont(techInfo->name, "Arial", 28);
     nameLabel->setPosition(Vec2(200, 280));
     nameLabel->setColor(Color3B::YELLOW);
     _detailPanel->addChild(nameLabel);
 
-    // ƼЧ
+    // 科技效果
     auto effectLabel = Label::createWithSystemFont(techInfo->effectDescription, "Arial", 18);
     effectLabel->setPosition(Vec2(200, 200));
     effectLabel->setDimensions(360, 120);
@@ -1049,12 +1054,12 @@ void TechTreePanel::showTechDetail(int techId) {
     effectLabel->setColor(Color3B::WHITE);
     _detailPanel->addChild(effectLabel);
 
-    // === ǰʾ ===
+    // === 新增：当前进度显示 ===
     int progress = _techTree->getTechProgress(techId);
     int cost = _techTree->getTechCost(techId);
     int percent = (cost > 0) ? (progress * 100 / cost) : 0;
 
-    std::string progressText = u8"ǰȣ" + std::to_string(progress) + "/" +
+    std::string progressText = u8"当前进度：" + std::to_string(progress) + "/" +
         std::to_string(cost) + " (" + std::to_string(percent) + "%)";
 
     auto progressLabel = Label::createWithSystemFont(progressText, "Arial", 18);
@@ -1062,21 +1067,21 @@ void TechTreePanel::showTechDetail(int techId) {
     progressLabel->setColor(Color3B(255, 200, 100));
     _detailPanel->addChild(progressLabel);
 
-    // === ɱʾ ===
-    std::string costText = u8"ֵ" + std::to_string(cost);
+    // === 新增：成本显示 ===
+    std::string costText = u8"所需科研值：" + std::to_string(cost);
     auto costLabel = Label::createWithSystemFont(costText, "Arial", 16);
     costLabel->setPosition(Vec2(200, 110));
     costLabel->setColor(Color3B(180, 180, 255));
     _detailPanel->addChild(costLabel);
 
-    // === ǰÿƼʾ ===
+    // === 新增：前置科技显示 ===
     if (!techInfo->srcTechList.empty()) {
-        std::string prereqText = u8"ǰÿƼ";
+        std::string prereqText = u8"前置科技：";
         bool first = true;
         for (int prereqId : techInfo->srcTechList) {
             auto prereqInfo = _techTree->getTechInfo(prereqId);
             if (prereqInfo) {
-                if (!first) prereqText += "";
+                if (!first) prereqText += "，";
                 prereqText += prereqInfo->name;
                 first = false;
             }
@@ -1091,20 +1096,20 @@ void TechTreePanel::showTechDetail(int techId) {
         _detailPanel->addChild(prereqLabel);
     }
 
-    // о״̬
+    // 研究状态
     std::string statusText;
     if (_techTree->isActivated(techId)) {
-        statusText = u8"о";
+        statusText = u8"已研究完成";
     }
     else if (_techTree->getCurrentResearch() == techId) {
-        statusText = u8"о";
+        statusText = u8"正在研究中";
     }
     else if (_techTree->getTechProgress(techId) > 0) {
-        statusText = u8"н (" + std::to_string(percent) + "%)";
+        statusText = u8"已有进度 (" + std::to_string(percent) + "%)";
 
-        // оť
+        // 添加研究按钮
         auto researchButton = ui::Button::create();
-        researchButton->setTitleText(u8"Ϊǰо");
+        researchButton->setTitleText(u8"设为当前研究");
         researchButton->setTitleFontSize(18);
         researchButton->setTitleColor(Color3B::WHITE);
         researchButton->setContentSize(Size(150, 40));
@@ -1122,11 +1127,11 @@ void TechTreePanel::showTechDetail(int techId) {
         _detailPanel->addChild(researchButton);
     }
     else if (_techTree->isResearchable(techId)) {
-        statusText = u8"о";
+        statusText = u8"可研究";
 
-        // оť
+        // 添加研究按钮
         auto researchButton = ui::Button::create();
-        researchButton->setTitleText(u8"Ϊǰо");
+        researchButton->setTitleText(u8"设为当前研究");
         researchButton->setTitleFontSize(18);
         researchButton->setTitleColor(Color3B::WHITE);
         researchButton->setContentSize(Size(150, 40));
@@ -1144,12 +1149,12 @@ void TechTreePanel::showTechDetail(int techId) {
         _detailPanel->addChild(researchButton);
     }
     else {
-        statusText = u8"ҪǰÿƼ";
+        statusText = u8"锁定（需要前置科技）";
     }
 
     if (_techTree->getCurrentResearch() != techId && !_techTree->isActivated(techId) &&
         _techTree->isResearchable(techId)) {
-        // ѾӹťҪ״̬ǩ
+        // 已经添加过按钮，不需要再添加状态标签
     }
     else {
         auto statusLabel = Label::createWithSystemFont(statusText, "Arial", 18);
@@ -1172,7 +1177,7 @@ void TechTreePanel::setAsCurrentResearch(int techId) {
     if (!_techTree) return;
 
     if (_techTree->setCurrentResearch(techId)) {
-        // óɹˢUI
+        // 设置成功，刷新UI
         refreshUI();
         updateControlPanel();
 
@@ -1188,7 +1193,7 @@ void TechTreePanel::updateControlPanel() {
     if (currentResearch > 0) {
         auto techInfo = _techTree->getTechInfo(currentResearch);
         if (techInfo) {
-            std::string researchText = u8"ǰо" + techInfo->name;
+            std::string researchText = u8"当前研究：" + techInfo->name;
             _currentResearchLabel->setString(researchText);
 
             int progress = _techTree->getTechProgress(currentResearch);
@@ -1198,16 +1203,16 @@ void TechTreePanel::updateControlPanel() {
         }
     }
     else {
-        _currentResearchLabel->setString(u8"ǰо");
+        _currentResearchLabel->setString(u8"当前研究：无");
         _researchProgressBar->setPercentage(0);
     }
 }
 
-// ״̬
+// 更新连接线状态
 void TechTreePanel::updateConnectionLines() {
     if (!_techTree) return;
 
-    // оɵ
+    // 清除所有旧的连接线
     std::vector<Node*> toRemove;
     for (auto child : _contentNode->getChildren()) {
         if (child->getName().find("line_") == 0) {
@@ -1219,7 +1224,7 @@ void TechTreePanel::updateConnectionLines() {
         node->removeFromParent();
     }
 
-    // ´
+    // 重新创建所有连接线
     for (const auto& pair : _nodeUIMap) {
         int fromTechId = pair.first;
         auto techInfo = _techTree->getTechInfo(fromTechId);
@@ -1231,28 +1236,28 @@ void TechTreePanel::updateConnectionLines() {
     }
 }
 
-// ￨Ч
+// 创建尤里卡特效
 void TechTreePanel::createEurekaEffect(int techId) {
     auto node = _nodeUIMap[techId];
     if (!node) return;
 
-    // ȡڵλ
+    // 获取节点位置
     Vec2 nodePos = node->getPosition();
     Vec2 centerPos = nodePos + Vec2(NODE_WIDTH / 2, NODE_HEIGHT / 2);
 
-    // Ч
+    // 创建闪光效果
     auto flash = Sprite::create();
 
-    // ʹDrawNodeԲ
+    // 使用DrawNode创建圆形闪光
     auto drawNode = DrawNode::create();
     drawNode->drawSolidCircle(Vec2::ZERO, NODE_WIDTH / 2 + 10,
         CC_DEGREES_TO_RADIANS(360), 30,
-        Color4F(1.0f, 1.0f, 0.5f, 0.8f)); // ɫ
+        Color4F(1.0f, 1.0f, 0.5f, 0.8f)); // 金色闪光
     flash->addChild(drawNode);
     flash->setPosition(centerPos);
     flash->setScale(0.5f);
 
-    // Ŵ󲢵
+    // 动画：放大并淡出
     auto scaleUp = ScaleTo::create(0.3f, 1.8f);
     auto fadeOut = FadeOut::create(0.3f);
     auto spawn = Spawn::create(scaleUp, fadeOut, nullptr);
@@ -1261,14 +1266,14 @@ void TechTreePanel::createEurekaEffect(int techId) {
 
     _contentNode->addChild(flash, 5);
 
-    // "￨!"Ч
-    auto eurekaLabel = Label::createWithTTF("￨!", "fonts/arial.ttf", 28);
-    eurekaLabel->setColor(Color3B(255, 255, 0)); // ɫ
+    // 创建"尤里卡!"文字效果
+    auto eurekaLabel = Label::createWithTTF("尤里卡!", "fonts/arial.ttf", 28);
+    eurekaLabel->setColor(Color3B(255, 255, 0)); // 金色文字
     eurekaLabel->enableShadow(Color4B(0, 0, 0, 128), Size(2, -2));
     eurekaLabel->setPosition(centerPos + Vec2(0, 80));
     eurekaLabel->setOpacity(0);
 
-    // ֶ롢ϸ
+    // 文字动画：淡入、上浮、淡出
     auto fadeIn = FadeIn::create(0.2f);
     auto moveUp = MoveBy::create(0.8f, Vec2(0, 50));
     auto fadeOut2 = FadeOut::create(0.3f);
@@ -1277,7 +1282,7 @@ void TechTreePanel::createEurekaEffect(int techId) {
 
     _contentNode->addChild(eurekaLabel, 10);
 
-    // Ч֧֣
+    // 创建粒子效果（如果支持）
     /*
     if (ParticleSystemQuad::create("particles/eureka.plist")) {
         auto particles = ParticleSystemQuad::create("particles/eureka.plist");
@@ -1287,24 +1292,31 @@ void TechTreePanel::createEurekaEffect(int techId) {
     }
     */
 
-    // ЧʾƵϵͳ
+    // 添加音效提示（如果有音频系统）
     // SimpleAudioEngine::getInstance()->playEffect("sounds/eureka.mp3");
 }
 
 void TechTreePanel::handleTechActivated(int techId, const std::string& techName, const std::string& effect) {
-    // ½ڵ״̬
+    // 更新节点状态
     updateNodeUIState(techId, TechNodeState::ACTIVATED);
 
-    // 
+    // 只刷新因本次激活而开放的后继节点
+    for (int researchableId : _techTree->getNewlyResearchableTechList()) {
+        if (_techTree->getTechProgress(researchableId) == 0) {
+            updateNodeUIState(researchableId, TechNodeState::RESEARCHABLE);
+        }
+    }
+
+    // 更新连接线
     updateConnectionLines();
 
-    // ¿
+    // 更新控制面板
     updateControlPanel();
 
-    // żЧ￨Ч򵥣
+    // 播放激活特效（比尤里卡特效更简单）
     auto node = _nodeUIMap[techId];
     if (node) {
-        // Ч
+        // 简单闪光效果
         auto flash = LayerColor::create(Color4B(100, 255, 100, 100), NODE_WIDTH, NODE_HEIGHT);
         flash->setPosition(node->getPosition());
         flash->setOpacity(0);
@@ -1318,13 +1330,13 @@ void TechTreePanel::handleTechActivated(int techId, const std::string& techName,
     }
 }
 
-// о¼
+// 处理研究进度事件
 void TechTreePanel::handleResearchProgress(int techId, int currentProgress, int totalCost) {
-    // ½ڵ
+    // 更新节点进度条
     auto container = _nodeUIMap[techId];
     if (!container) return;
 
-    // ֱӻȡҪͨButton
+    // 直接获取进度条，不需要通过Button
     auto progressBar = dynamic_cast<DrawNode*>(container->getChildByTag(105));
     auto costLabel = dynamic_cast<Label*>(container->getChildByTag(103));
 
@@ -1334,34 +1346,34 @@ void TechTreePanel::handleResearchProgress(int techId, int currentProgress, int
 
         Color4F progressColor;
         if (_techTree && _techTree->getCurrentResearch() == techId) {
-            progressColor = Color4F(0.9f, 0.7f, 0.1f, 1.0f); // ɫ
+            progressColor = Color4F(0.9f, 0.7f, 0.1f, 1.0f); // 金色进度条
         }
         else {
-            progressColor = Color4F(0.2f, 0.6f, 0.2f, 1.0f); // ɫ
+            progressColor = Color4F(0.2f, 0.6f, 0.2f, 1.0f); // 绿色进度条
         }
 
         progressBar->drawSolidRect(Vec2(5, NODE_HEIGHT - 8),
             Vec2(5 + width, NODE_HEIGHT - 4), progressColor);
 
-        // ³ɱǩʾ
+        // 更新成本标签显示进度
         if (costLabel) {
             std::string progressText = std::to_string(currentProgress) + "/" + std::to_string(totalCost);
             costLabel->setString(progressText);
         }
     }
 
-    // ǵǰо¿
+    // 如果是当前研究，更新控制面板
     if (_techTree && _techTree->getCurrentResearch() == techId) {
         updateControlPanel();
     }
 }
 
-// ￨¼
+// 处理尤里卡事件
 void TechTreePanel::handleEurekaTriggered(int techId, const std::string& techName) {
-    // ￨Ч
+    // 播放尤里卡特效
     createEurekaEffect(techId);
 
-    // ½ڵ״̬нȱ仯
+    // 更新节点状态（可能有进度变化）
     if (_techTree) {
         TechNodeState state = TechNodeState::LOCKED;
         if (_techTree->isActivated(techId)) {
@@ -1384,15 +1396,8 @@ void TechTreePanel::handleEurekaTriggered(int techId, const std::string& techNam
 void TechTreePanel::onExit() {
     hideTechDetail();
 
-    if (_techTree && _eventListener) {
-        _techTree->removeEventListener(_eventListener);
-    }
-
-    // ¼
-    if (_eventListener) {
-        delete _eventListener;
-        _eventListener = nullptr;
-    }
+    // 清理事件监听器
+    unsubscribeTechEvents();
 
     Layer::onExit();
 }
\ No newline at end of file
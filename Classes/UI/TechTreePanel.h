@@ -4,93 +4,81 @@
 #include "cocos2d.h"
 #include "ui/CocosGUI.h"
 #include "./Development/TechSystem.h"
+#include "Utils/EventBus.h"
 
 USING_NS_CC;
 using namespace ui;
 
 class TechTreePanel;
 
-// ƼڵUI״̬
+// 科技节点UI状态
 enum class TechNodeState {
-    LOCKED,          // δ
-    RESEARCHABLE,    // о
-    RESEARCHING,     // оУǰо
-    IN_PROGRESS,     // нȵδΪǰо
-    ACTIVATED        // Ѽ
+    LOCKED,          // 未解锁
+    RESEARCHABLE,    // 可研究
+    RESEARCHING,     // 研究中（当前正在研究）
+    IN_PROGRESS,     // 有进度但未设为当前研究
+    ACTIVATED        // 已激活
 };
 
-// ڲ¼ࣨΪTechTreePanelĳԱ
-class TechTreePanelEventListener : public TechEventListener {
-private:
-    TechTreePanel* _owner;  // ָⲿTechTreePanelָ
-
-public:
-    TechTreePanelEventListener(TechTreePanel* owner) : _owner(owner) {}
-
-    // TechEventListenerӿʵ
-    virtual void onTechActivated(int techId, const std::string& techName,
-        const std::string& effect) override;
-
-    virtual void onResearchProgress(int techId, int currentProgress, int totalCost) override;
-
-    virtual void onEurekaTriggered(int techId, const std::string& techName) override;
-};
-
-// Ƽ
+// 科技树面板
 class TechTreePanel : public Layer {
-    friend class TechTreePanelEventListener;  // ¼˽гԱ
-
 public:
     CREATE_FUNC(TechTreePanel);
 
     virtual bool init() override;
     virtual void onExit() override;
 
-    // ÿƼϵͳ
+    // 设置科技系统
     void setTechTree(TechTree* tree);
 
-    // UI
+    // 更新UI
     void refreshUI();
 
-    // ÿغϿֵ
+    // 设置每回合科研值
     void setSciencePerTurn(int science);
 
-    // ʾƼ
+    // 显示科技详情
     void showTechDetail(int techId);
 
-    // ؿƼ
+    // 隐藏科技详情
     void hideTechDetail();
 
-    // ṩ¼õĹ
+    // 提供给事件监听器调用的公共方法
     void handleTechActivated(int techId, const std::string& techName, const std::string& effect);
     void handleResearchProgress(int techId, int currentProgress, int totalCost);
     void handleEurekaTriggered(int techId, const std::string& techName);
 
 private:
-    // Ƽϵͳ
+    // 科技系统引用
     TechTree* _techTree = nullptr;
 
-    // ¼
-    TechTreePanelEventListener* _eventListener = nullptr;
+    // 事件监听器
+    EventBus::ListenerId _techActivatedListener = 0;
+    EventBus::ListenerId _researchProgressListener = 0;
+    EventBus::ListenerId _eurekaListener = 0;
+
+    // 订阅/注销当前科技树的事件
+    void subscribeTechEvents();
+    void unsubscribeTechEvents();
 
-    // UIԪ
+    // UI元素
     LayerColor* _background = nullptr;
     ScrollView* _scrollView = nullptr;
     Node* _contentNode = nullptr;
 
-    // ײ
+    // 底部控制面板
     Node* _controlPanel = nullptr;
     Label* _currentResearchLabel = nullptr;
     ProgressTimer* _researchProgressBar = nullptr;
     Label* _sciencePerTurnLabel = nullptr;
 
-    // 
+    // 详情面板
     LayerColor* _detailPanel = nullptr;
 
-    // ڵӳ
+    // 节点映射
     std::unordered_map<int, Node*> _nodeUIMap;
 
-    // UI
+    // UI常量
     const float NODE_WIDTH = 180.0f;
     const float NODE_HEIGHT = 110.0f;
     const float NODE_CORNER_RADIUS = 10.0f;
@@ -98,7 +86,7 @@ private:
     const float NODE_SPACING = 120.0f;
     const float LINE_WIDTH = 4.0f;
 
-    // ˽з
+    // 私有方法
     Node* createTechNodeUI(const TechNode* techData);
     void updateNodeUIState(int techId, TechNodeState state);
     void updateControlPanel();
@@ -107,9 +95,9 @@ private:
     void onTechNodeClicked(Ref* sender, Widget::TouchEventType type);
     void setAsCurrentResearch(int techId);
     void createEurekaEffect(int techId);
-    void drawColumnBackgrounds();  // 
+    void drawColumnBackgrounds();  // 添加这个声明
 
-    // ص·ȷcppеʵƥ䣩
+    // 布局相关的新方法（确保与cpp中的实现匹配）
     std::vector<int> topologicalSort();
     void calculateTechDepths();
     void layoutTechTree();
@@ -117,11 +105,11 @@ private:
     void adjustPositionsForConnections();
     bool doLinesCross(const Vec2& p1, const Vec2& p2, const Vec2& q1, const Vec2& q2);
 
-    // ݽṹ
-    std::unordered_map<int, int> _techDepth;      // ƼȣУ
-    std::unordered_map<int, int> _techRow;        // Ƽк
-    std::unordered_map<int, Vec2> _techPositions; // λ
-    std::unordered_map<int, std::vector<int>> _techByDepth; // ȷĿƼ
+    // 布局数据结构
+    std::unordered_map<int, int> _techDepth;      // 科技深度（列）
+    std::unordered_map<int, int> _techRow;        // 科技行号
+    std::unordered_map<int, Vec2> _techPositions; // 最终位置
+    std::unordered_map<int, std::vector<int>> _techByDepth; // 按深度分组的科技
 };
 
 #endif // TECH_TREE_PANEL_H
\ No newline at end of file
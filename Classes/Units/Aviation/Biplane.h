@@ -5,117 +5,33 @@
 
 /**
  * @file Biplane.h
- * @brief ˫ɻλ
+ * @brief 双翼飞机单位类
  * 
- * ˫ɻһִоµλ
- * ߵƶٶȺԶ̹
+ * 双翼飞机是一种现代飞行军事单位
+ * 具有最高的移动速度和远程攻击能力
  */
 
 /**
  * @class Biplane
- * @brief ˫ɻλ
+ * @brief 双翼飞机单位
  * 
- * ˫ɻص㣺
- * - Ϊ60ǿ
- * - ֵ120
- * - ƶ6/غϣƶٶȣ
- * - ΧΪ3Զ̺ը
- * - ܷУԽеϰ
- * - ҰΧ4Ұ
- * - ܽ
+ * 双翼飞机的特点：
+ * - 攻击力为60（最强攻击力）
+ * - 生命值120
+ * - 移动力6格/回合（最快移动速度）
+ * - 攻击范围为3（远程轰炸）
+ * - 能飞行（可越过所有地形障碍）
+ * - 视野范围4（最广视野）
+ * - 不能建立城市
  * 
- * ˫ɻǿĿеλʺϽԶ̺ըͿ
+ * 双翼飞机是最强大的空中单位，适合进行远程轰炸和快速侦察
  */
 class Biplane : public AbstractUnit {
 public:
 
-    Biplane() : AbstractUnit() { cost = 60; purchaseCost = 1000;  prereqTechID = 18; } // ǰÿƼ(ID 18)
+    Biplane() : AbstractUnit(UnitName::BIPLANE) {}
 
-    /**
-     * @brief ȡλ
-     * @return ˫ɻ
-     */
-    std::string getUnitName() const override { 
-        return "Biplane"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return оµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::AVIATION; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/biplane.png"; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 5;
-    }
-
-
-    bool ismilitary() const override {
-        return true; 
-	}
-    /**
-     * @brief ȡֵ
-     * @return 120 ֵ
-     */
-    int getMaxHp() const override { 
-        return 120; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 60ǿԶ̹
-     */
-    int getBaseAttack() const override { 
-        return 60; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 6 /غϣƶٶȣ
-     */
-    int getMaxMoves() const override { 
-        return 6; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 3Զ̺ը̣
-     */
-    int getAttackRange() const override { 
-        return 3; 
-    }
-
-    /**
-     * @brief 鵥λǷܷ
-     * @return true˫ɻܷУ
-     * 
-     * ʹɽˮȵϰ
-     */
-    bool canFly() const override { 
-        return true; 
-    }
-
-    /**
-     * @brief ȡҰΧ
-     * @return 4ĿҰ
-     * 
-     * еλӵиҰ
-     */
-    int getVisionRange() const override { 
-        return 4; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Biplane);
 };
 
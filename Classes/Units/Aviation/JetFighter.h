@@ -5,128 +5,35 @@
 
 /**
  * @file JetFighter.h
- * @brief սλ
+ * @brief 喷气战斗机单位类
  * 
- * սһֳִоµλ
- * ӵߵĹֵۺս
+ * 喷气战斗机是一种超现代飞行军事单位
+ * 拥有最高的攻击力、生命值和综合作战能力
  */
 
 /**
  * @class JetFighter
- * @brief սλ
+ * @brief 喷气战斗机单位
  * 
- * սص㣺
- * - Ϊ120ߵĹ
- * - ֵ200ߵֵ
- * - ƶ10/غϣƶٶȣ
- * - ΧΪ5ԶḶ́
- * - ܷУԽеϰ
- * - ҰΧ6Ұ
- * - ܽ
+ * 喷气战斗机的特点：
+ * - 攻击力为120（最高的攻击力）
+ * - 生命值200（最高的生命值）
+ * - 移动力10格/回合（最快的移动速度）
+ * - 攻击范围为5（最远的攻击射程）
+ * - 能飞行（可越过所有地形障碍）
+ * - 视野范围6（最广阔的视野）
+ * - 不能建立城市
  * 
- * սϷǿĵλ
- * Զͬ൥λеֵ
- * 졢һռս
+ * 喷气战斗机是游戏中最强大的单位
+ * 各项属性都是同类单位中的最高值
+ * 集侦察、攻击、防御于一身，是终极战争兵器
  */
 class JetFighter : public AbstractUnit {
 public:
 
-    JetFighter() : AbstractUnit() { cost = 80; purchaseCost = 10600; prereqTechID = 20; } // ǰÿƼ߼(ID 20)
-    /**
-     * @brief ȡλ
-     * @return ս
-     */
-    std::string getUnitName() const override { 
-        return "JetFighter"; 
-    }
+    JetFighter() : AbstractUnit(UnitName::JET_FIGHTER) {}
 
-    /**
-     * @brief ȡλ
-     * @return оµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::AVIATION; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/jetFighter.png"; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 8;
-	}
-
-    bool ismilitary() const override {
-        return true;
-	}
-
-    /**
-     * @brief ȡֵ
-     * @return 200 ֵߣ
-     * 
-     * սӵǿ
-     */
-    int getMaxHp() const override { 
-        return 200; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 120ǿԶ̺ը
-     * 
-     * սӵߵĹ˺
-     */
-    int getBaseAttack() const override { 
-        return 120; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 10 /غϣƶٶȣ
-     * 
-     * սԿٴԽս
-     */
-    int getMaxMoves() const override { 
-        return 10; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 5ԶԶ̺ը̣
-     * 
-     * սԴԶĿ
-     */
-    int getAttackRange() const override { 
-        return 5; 
-    }
-
-    /**
-     * @brief 鵥λǷܷ
-     * @return trueսܷУ
-     * 
-     * ʹеϰ
-     * ɽˮ򡢴ֵ
-     */
-    bool canFly() const override { 
-        return true; 
-    }
-
-    /**
-     * @brief ȡҰΧ
-     * @return 6ĿҰ
-     * 
-     * սӵ췶Χ
-     * սľ
-     */
-    int getVisionRange() const override { 
-        return 6; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(JetFighter);
 };
 
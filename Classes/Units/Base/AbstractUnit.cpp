@@ -1,203 +1,99 @@
 #include "AbstractUnit.h"
+#include "UnitActionLog.h"
+#include "UnitRegistry.h"
+#include "UnitStateTable.h"
 #include " ../../Map/GameMapLayer.h"
 #include "Core/GameManager.h"
 #include "../../Core/Player.h"
+#include "../../Utils/GameLog.h"
+#include "../../Core/GameRules.h"
 
 USING_NS_CC;
 
-// 캯
-AbstractUnit::AbstractUnit()
-    : ProductionProgram(ProductionProgram::ProductionType::UNIT, "", Hex(), true, 0)
-    , _ownerId(-1)
-    , _currentHp(0)
-    , _currentMoves(0)
-    , _state(UnitState::IDLE)
+namespace {
+    UnitStateTable& units() { return *UnitStateTable::getInstance(); }
+}
+
+// 构造函数：只记录共享的类型定义，名称与生产成本从定义读取
+AbstractUnit::AbstractUnit(UnitName id)
+    : ProductionProgram(ProductionProgram::ProductionType::UNIT, UnitRegistry::info(id).name, Hex(),
+        UnitRegistry::info(id).cost, true, UnitRegistry::info(id).purchaseCost)
+    , _type(id)
+    , _def(&UnitRegistry::info(id))
+    , _handle(UnitStateTable::getInstance()->add(this, id))
     , _unitSprite(nullptr)
     , _selectionRing(nullptr)
     , _hpBarNode(nullptr)
-    , _hasActed(false) // ޸ġʼж
-    , prereqTechID(-1)
+    , _rangeNode(nullptr)
 {
-    switch (_type)
-    {
-    case UnitName::SETTLER:
-        ProductionProgram::_name = "Settler";
-        cost = 80;
-        purchaseCost = 400;
-        break;
-    case UnitName::BUILDER:
-        ProductionProgram::_name = "Builder";
-        cost = 50;
-        purchaseCost = 200;
-        break;
-    case UnitName::WARRIOR:
-        ProductionProgram::_name = "Warrior";
-        cost = 30;
-        purchaseCost = 200;
-        break;
-    case UnitName::SWORDSMAN:
-        ProductionProgram::_name = "Swordsman";
-        cost = 40;
-        purchaseCost = 500;
-        break;
-    case UnitName::LINE_INFANTRY:
-        ProductionProgram::_name = "LineInfantry";
-        cost = 60;
-        purchaseCost = 600;
-        break;
-    case UnitName::ARCHER:
-        ProductionProgram::_name = "Archer";
-        cost = 30;
-        purchaseCost = 400;
-        break;
-    case UnitName::CROSSBOWMAN:
-        ProductionProgram::_name = "CrossBowman";
-        cost = 50;
-        purchaseCost = 500;
-        break;
-    case UnitName::MUSKETEERS:
-        ProductionProgram::_name = "Settler";
-        cost = 80;
-        purchaseCost = 600;
-        break;
-    case UnitName::CATAPULT:
-        ProductionProgram::_name = "Settler";
-        cost = 30;
-        purchaseCost = 200;
-        break;
-    case UnitName::CANNON:
-        ProductionProgram::_name = "Settler";
-        cost = 50;
-        purchaseCost = 400;
-        break;
-    case UnitName::BIPLANE:
-        ProductionProgram::_name = "Settler";
-        cost = 60;
-        purchaseCost = 1000;
-        break;
-    case UnitName::JET_FIGHTER:
-        ProductionProgram::_name = "Settler";
-        cost = 80;
-        purchaseCost = 10600;
-        break;
-    default:
-        break;
-    }
 }
 
-AbstractUnit::AbstractUnit(std::string unitName)
-    : ProductionProgram(ProductionProgram::ProductionType::UNIT, unitName, Hex(), true, 0)
-    , _ownerId(-1)
-    , _currentHp(0)
-    , _currentMoves(0)
-    , _state(UnitState::IDLE)
-    , _unitSprite(nullptr)
-    , _selectionRing(nullptr)
-    , _hpBarNode(nullptr)
-    , _hasActed(false) // ޸ġʼж
-    , prereqTechID(-1)
+// 按名称构造（生产面板等字符串边界使用），未注册的名称按开拓者处理
+AbstractUnit::AbstractUnit(const std::string& unitName)
+    : AbstractUnit(lookupUnitName(unitName))
 {
-    if (ProductionProgram::_name == "Settler")
-    {
-        _type = UnitName::SETTLER;
-        cost = 80;
-        purchaseCost = 400;
-    }
-    else if (ProductionProgram::_name == "Builder")
-    {
-        _type = UnitName::BUILDER;
-        cost = 50;
-        purchaseCost = 200;
-    }
-    else if (ProductionProgram::_name == "Warrior")
-    {
-        _type = UnitName::WARRIOR;
-        cost = 30;
-        purchaseCost = 200;
-    }
-    else if (ProductionProgram::_name == "Swordsman")
-    {
-        _type = UnitName::SWORDSMAN;
-        cost = 40;
-        purchaseCost = 500;
-    }
-    else if (ProductionProgram::_name == "LineInfantry")
-    {
-        _type = UnitName::LINE_INFANTRY;
-        cost = 60;
-        purchaseCost = 600;
-    }
-    else if (ProductionProgram::_name == "Archer")
-    {
-        _type = UnitName::ARCHER;
-        cost = 30;
-        purchaseCost = 400;
-    }
-    else if (ProductionProgram::_name == "CrossBowman")
-    {
-        _type = UnitName::CROSSBOWMAN;
-        cost = 50;
-        purchaseCost = 500;
-    }
-    else if (ProductionProgram::_name == "Musketeers")
-    {
-        _type = UnitName::MUSKETEERS;
-        cost = 80;
-        purchaseCost = 600;
-    }
-    else if (ProductionProgram::_name == "Catapult")
-    {
-        _type = UnitName::CATAPULT;
-        cost = 30;
-        purchaseCost = 200;
-    }
-    else if (ProductionProgram::_name == "Cannon")
-    {
-        _type = UnitName::CANNON;
-        cost = 50;
-        purchaseCost = 400;
-    }
-    else if (ProductionProgram::_name == "Biplane")
-    {
-        _type = UnitName::BIPLANE;
-        cost = 60;
-        purchaseCost = 1000;
-    }
-    else if (ProductionProgram::_name == "JetFighter")
-    {
-        _type = UnitName::JET_FIGHTER;
-        cost = 80;
-        purchaseCost = 10600;
-    }
-    else
-    {
-        // Ĭϴ_typeĵǰֵΪĬֵ
-        // Ҫ_type = UnitName::DEFAULT; 
-    }
 }
 
+UnitName AbstractUnit::lookupUnitName(const std::string& unitName)
+{
+    UnitName id = UnitName::SETTLER;
+    if (!UnitRegistry::findByName(unitName, id))
+        CCLOG("AbstractUnit: unknown unit name %s", unitName.c_str());
+    return id;
+}
+
+std::string AbstractUnit::getUnitName() const { return _def->name; }
+UnitType AbstractUnit::getUnitType() const { return _def->category; }
+std::string AbstractUnit::getSpritePath() const { return _def->spritePath; }
+
+int AbstractUnit::getMaxHp() const { return _def->maxHp; }
+int AbstractUnit::getBaseAttack() const { return _def->baseAttack; }
+int AbstractUnit::getMaxMoves() const { return _def->maxMoves; }
+int AbstractUnit::getAttackRange() const { return _def->attackRange; }
+int AbstractUnit::getVisionRange() const { return _def->visionRange; }
+int AbstractUnit::getMaintenanceCost() const { return _def->maintenanceCost; }
+int AbstractUnit::getPrereqTechID() const { return _def->prereqTechID; }
+
+bool AbstractUnit::ismilitary() const { return _def->isMilitary; }
+bool AbstractUnit::canFoundCity() const { return _def->canFoundCity; }
+bool AbstractUnit::canFly() const { return _def->canFly; }
+bool AbstractUnit::canMoveAfterAttack() const { return _def->canMoveAfterAttack; }
+
 AbstractUnit::~AbstractUnit() {
+    UnitStateTable::getInstance()->remove(_handle);
 }
 
-// ʼ
+bool AbstractUnit::isAlive() const { return units().hp(_handle) > 0; }
+bool AbstractUnit::canAct() const { return units().moves(_handle) > 0 && isAlive(); }
+int AbstractUnit::getOwnerId() const { return units().owner(_handle); }
+Hex AbstractUnit::getGridPos() const { return units().pos(_handle); }
+int AbstractUnit::getCurrentHp() const { return units().hp(_handle); }
+int AbstractUnit::getCurrentMoves() const { return units().moves(_handle); }
+UnitState AbstractUnit::getState() const { return units().state(_handle); }
+
+void AbstractUnit::setActed(bool acted) { units().setFlag(_handle, UnitStateTable::FLAG_ACTED, acted); }
+bool AbstractUnit::hasActed() const { return units().hasFlag(_handle, UnitStateTable::FLAG_ACTED); }
+
+// 初始化
 bool AbstractUnit::initUnit(int ownerId, Hex startPos) {
     if (!Node::init()) return false;
 
 	assert(ownerId >= 0 && "Invalid ownerId for AbstractUnit");
-    _ownerId = ownerId;
-    _gridPos = startPos;
-    _currentHp = getMaxHp();
-    _currentMoves = getMaxMoves();
-    _state = UnitState::IDLE;
-    _hasActed = false;
-
-    // 1. ԼͼƬ
+    UnitStateTable& table = units();
+    table.owner(_handle) = ownerId;
+    table.setPos(_handle, startPos);
+    table.hp(_handle) = getMaxHp();
+    table.moves(_handle) = getMaxMoves();
+    table.state(_handle) = UnitState::IDLE;
+    table.setFlag(_handle, UnitStateTable::FLAG_ACTED, false);
+
+    // 1. 尝试加载图片
     std::string path = getSpritePath();
     if (!path.empty() && FileUtils::getInstance()->isFileExist(path)) {
         _unitSprite = Sprite::create(path);
     }
 
-    // 2. ģʽ
+    // 2. 文字模式回退
     if (!_unitSprite) {
         _unitSprite = Sprite::create();
         auto bgNode = DrawNode::create();
@@ -217,7 +113,7 @@ bool AbstractUnit::initUnit(int ownerId, Hex startPos) {
 
     this->addChild(_unitSprite, 50);
 
-    // 3. ѡйȦ
+    // 3. 选中光圈
     auto ringDraw = DrawNode::create();
     ringDraw->drawCircle(Vec2::ZERO, 30, 0, 30, false, 1.0f, 3.0f, Color4F::GREEN);
     _selectionRing = Sprite::create();
@@ -225,184 +121,115 @@ bool AbstractUnit::initUnit(int ownerId, Hex startPos) {
     _selectionRing->setVisible(false);
     this->addChild(_selectionRing, -1);
 
-    // 4. Ѫ
+    // 4. 血条
     _hpBarNode = DrawNode::create();
     _hpBarNode->setPosition(Vec2(0, 35));
     this->addChild(_hpBarNode, 10);
     updateHpBar();
 
-    // 5. Χָʾ
+    // 5. 范围指示器
     _rangeNode = DrawNode::create();
     this->addChild(_rangeNode, -10);
 
-    // Player ע
+    // Player 注册
     if (GameManager::getInstance()) {
-        auto player = GameManager::getInstance()->getPlayer(_ownerId);
+        auto player = GameManager::getInstance()->getPlayer(getOwnerId());
         if (player) {
             player->addUnit(this);
-            CCLOG("Unit %s registered to Player %d", getUnitName().c_str(), _ownerId);
+            CCLOG("Unit %s registered to Player %d", getUnitName().c_str(), getOwnerId());
         } else {
-            CCLOG("Warning: AbstractUnit initialized for non-existent player %d", _ownerId);
+            CCLOG("Warning: AbstractUnit initialized for non-existent player %d", getOwnerId());
         }
     }
     return true;
 }
 
-// ˲䴫
+// 瞬间传送
 void AbstractUnit::teleportTo(Hex pos, HexLayout* layout) {
-    _gridPos = pos;
+    units().setPos(_handle, pos);
     if (layout) {
         this->setPosition(layout->hexToPixel(pos));
     }
 }
 
-// ============================================================
-// غϿʼ߼ָƶѪ
-// ============================================================
-void AbstractUnit::onTurnStart() {
-    if (!isAlive()) return;
-
-    CCLOG("Unit %s onTurnStart: hasActed=%d, currentMoves=%d->%d", 
-          getUnitName().c_str(), _hasActed, _currentMoves, getMaxMoves());
-
-    // 1. Ѫ߼ϻغûжѪ
-    if (!_hasActed && _currentHp < getMaxHp()) {
-        bool isInCity = false;
-        if (onCheckCity) {
-            isInCity = onCheckCity(_gridPos);
-        }
-
-        int healAmount = isInCity ? (getMaxHp() / 4) : (getMaxHp() / 10);
-        int oldHp = _currentHp;
-        _currentHp += healAmount;
-        if (_currentHp > getMaxHp()) {
-            _currentHp = getMaxHp();
-        }
-
-        int actualHeal = _currentHp - oldHp;
-
-        // ŻѪƮ (ɫ)
-        if (actualHeal > 0) {
-            auto label = Label::createWithSystemFont("+" + std::to_string(actualHeal), "Arial", 18);
-            label->setColor(Color3B::GREEN);
-            label->enableOutline(Color4B::BLACK, 1);
-            label->setPosition(Vec2(0, 40));
-            this->addChild(label, 20);
-            label->runAction(Sequence::create(
-                MoveBy::create(0.8f, Vec2(0, 30)),
-                RemoveSelf::create(), nullptr
-            ));
-
-            updateHpBar();
-        }
-    }
+// 回合开始回血飘字：数值已在 UnitStateTable::beginTurn 中批量结算
+void AbstractUnit::playHealEffect(int healAmount) {
+    if (!isAlive() || healAmount <= 0) return;
 
-    // 2. ָƶؼ޸㣩
-    _currentMoves = getMaxMoves();
-    _state = UnitState::IDLE;
-    _hasActed = false;
-
-    // ָɫ
-    if (_unitSprite) {
-        updateVisualColor();
-    }
+    UnitActionLog::getInstance()->record({ UnitActionEventType::HEAL, this,
+        getPosition(), getPosition(), healAmount, false, false });
 }
 
-// ƶ߼޸·ɱ
+// 移动逻辑（修复：接受路径成本参数）
 void AbstractUnit::moveTo(Hex targetPos, HexLayout* layout, int pathCost) {
-    if (_state != UnitState::IDLE) return;
+    if (getState() != UnitState::IDLE) return;
     if (!layout) return;
-    if (_currentMoves <= 0) return;
+    if (getCurrentMoves() <= 0) return;
 
-    // ûд·ɱʹֱ߾Ϊ
-    int actualCost = (pathCost > 0) ? pathCost : _gridPos.distance(targetPos);
+    // 如果没有传入路径成本，使用直线距离作为后备
+    int actualCost = (pathCost > 0) ? pathCost : getGridPos().distance(targetPos);
     
-    // ƶǷ㹻
-    if (_currentMoves < actualCost) {
-        CCLOG("Unit %s: Insufficient movement points. Need %d, have %d", 
-              getUnitName().c_str(), actualCost, _currentMoves);
+    // 检查移动力是否足够
+    if (getCurrentMoves() < actualCost) {
+        GLOG_VERBOSE(UNIT, "Unit %s: Insufficient movement points. Need %d, have %d", 
+              getUnitName().c_str(), actualCost, getCurrentMoves());
         return;
     }
 
-    _state = UnitState::MOVING;
-    _gridPos = targetPos;
-
-    // ۳ʵ·ɱ
-    _currentMoves = std::max(0, _currentMoves - actualCost);
-    _hasActed = true;
+    Vec2 fromPos = layout->hexToPixel(getGridPos());
+    units().setPos(_handle, targetPos);
 
-    CCLOG("Unit %s moved. Cost: %d, Remaining moves: %d", 
-          getUnitName().c_str(), actualCost, _currentMoves);
+    // 扣除实际路径成本
+    units().moves(_handle) = std::max(0, getCurrentMoves() - actualCost);
+    setActed(true);
 
-    Vec2 pixelPos = layout->hexToPixel(targetPos);
-    auto moveAction = MoveTo::create(0.3f, pixelPos);
-    auto ease = EaseSineOut::create(moveAction);
+    GLOG_TRACE(UNIT, "Unit %s moved. Cost: %d, Remaining moves: %d", 
+          getUnitName().c_str(), actualCost, getCurrentMoves());
 
-    auto callback = CallFunc::create([this]() {
-        _state = UnitState::IDLE;
-        if (_currentMoves <= 0) {
-            if (_unitSprite) _unitSprite->setColor(Color3B::GRAY);
-        }
-    });
-
-    this->runAction(Sequence::create(ease, callback, nullptr));
+    // 逻辑已结算，动画交给表现日志播放
+    UnitActionLog::getInstance()->record({ UnitActionEventType::MOVE, this,
+        fromPos, layout->hexToPixel(targetPos), actualCost, getCurrentMoves() <= 0, false });
 }
 
-// ս
+// 计算战斗力
 int AbstractUnit::getCombatPower() const {
-    float hpRatio = (float)_currentHp / (float)getMaxHp();
-    return std::max(1, (int)(getBaseAttack() * (0.5f + 0.5f * hpRatio)));
+    return GameRules::calculateCombatPower(getBaseAttack(), getCurrentHp(), getMaxHp());
 }
 
 // ============================================================
-// ߼
+// 攻击逻辑
 // ============================================================
 void AbstractUnit::attack(AbstractUnit* target, HexLayout* layout) {
-    if (_state != UnitState::IDLE) return;
+    if (getState() != UnitState::IDLE) return;
     if (!target || !isAlive()) return;
 
-    _state = UnitState::ATTACKING;
-    
     if (!canMoveAfterAttack()) {
-        _currentMoves = 0;
+        units().moves(_handle) = 0;
     }
     
-    _hasActed = true;
-
-    // --- ƽ²߼ ---
-    if (target->getUnitType() == UnitType::CIVILIAN) {
-        Vec2 offset = (target->getPosition() - this->getPosition()).getNormalized() * 20.0f;
-        auto seq = Sequence::create(
-            MoveBy::create(0.1f, offset),
-            CallFunc::create([this, target]() { target->capture(this->_ownerId); }),
-            MoveBy::create(0.2f, -offset),
-            CallFunc::create([this]() {
-                _state = UnitState::IDLE;
-                if (_unitSprite) _unitSprite->setColor(Color3B::GRAY);
-                }),
-            nullptr
-        );
-        this->runAction(seq);
-        return;
-    }
-
-    // --- սֵ ---
-    int myDamage = getCombatPower();
-    int distance = this->_gridPos.distance(target->getGridPos());
-    int enemyRange = target->getAttackRange();
-    bool willReceiveCounter = (distance <= enemyRange);
+    setActed(true);
 
-    // ---  ---
-    Vec2 myPos = this->getPosition();
-    Vec2 targetPos = target->getPosition();
-    Vec2 direction = (targetPos - myPos).getNormalized();
+    int distance = getGridPos().distance(target->getGridPos());
+    Vec2 myPos = layout ? layout->hexToPixel(getGridPos()) : this->getPosition();
+    Vec2 targetPos = layout ? layout->hexToPixel(target->getGridPos()) : target->getPosition();
+    bool isCapture = (target->getUnitType() == UnitType::CIVILIAN);
 
-    float lungeDist = (distance > 1) ? 10.0f : 25.0f;
-    Vec2 lungeOffset = direction * lungeDist;
+    // 攻击冲刺、受伤、死亡在同一批次内播放，保证受伤表现排在命中之后
+    UnitActionLog* actionLog = UnitActionLog::getInstance();
+    actionLog->beginBatch();
+    actionLog->record({ UnitActionEventType::ATTACK, this, myPos, targetPos,
+        distance, isCapture || getCurrentMoves() <= 0, false });
 
-    auto forward = MoveBy::create(0.1f, lungeOffset);
+    // --- 平民俘虏逻辑 ---
+    if (isCapture) {
+        target->capture(getOwnerId());
+    }
+    else {
+        // --- 战斗数值计算 ---
+        int myDamage = getCombatPower();
+        int enemyRange = target->getAttackRange();
+        bool willReceiveCounter = (distance <= enemyRange);
 
-    auto hitCallback = CallFunc::create([this, target, myDamage, willReceiveCounter]() {
         target->takeDamage(myDamage);
 
         if (target->isAlive() && willReceiveCounter) {
@@ -410,54 +237,35 @@ void AbstractUnit::attack(AbstractUnit* target, HexLayout* layout) {
             this->takeDamage(enemyDamage);
         }
         else if (target->isAlive() && !willReceiveCounter) {
-            CCLOG("Ranged Attack! No counter-attack.");
+            GLOG_TRACE(UNIT, "Ranged Attack! No counter-attack.");
         }
-        });
-
-    auto backward = MoveBy::create(0.2f, -lungeOffset);
-    auto finishCallback = CallFunc::create([this]() {
-        _state = UnitState::IDLE;
-        if (_currentMoves <= 0) {
-            if (_unitSprite) _unitSprite->setColor(Color3B::GRAY);
-        }
-        });
+    }
 
-    this->runAction(Sequence::create(forward, hitCallback, backward, finishCallback, nullptr));
+    actionLog->endBatch(false, 1.0f);
 }
 
-// ߼
+// 受伤逻辑
 int AbstractUnit::takeDamage(int damage) {
     int actualDamage = std::max(1, damage);
-    _currentHp -= actualDamage;
+    units().hp(_handle) -= actualDamage;
 
-    auto label = Label::createWithSystemFont("-" + std::to_string(actualDamage), "Arial", 20);
-    label->setColor(Color3B::RED);
-    label->enableOutline(Color4B::BLACK, 1);
-    label->setPosition(Vec2(0, 40));
-    this->addChild(label, 20);
+    UnitActionLog::getInstance()->record({ UnitActionEventType::DAMAGE, this,
+        getPosition(), getPosition(), actualDamage, false, true });
 
-    label->runAction(Sequence::create(
-        Spawn::create(MoveBy::create(0.5f, Vec2(0, 40)), FadeOut::create(0.5f), nullptr),
-        RemoveSelf::create(),
-        nullptr
-    ));
-
-    updateHpBar();
-
-    if (_currentHp <= 0) {
+    if (getCurrentHp() <= 0) {
         onDeath();
     }
 
     return actualDamage;
 }
 
-// ˢɫ߼
+// 刷新颜色逻辑
 void AbstractUnit::updateVisualColor() {
     if (!_unitSprite) return;
 
     if (_unitSprite->getChildrenCount() == 0) {
-        if (_ownerId == 0) _unitSprite->setColor(Color3B(100, 150, 255));
-        else if (_ownerId == 1) _unitSprite->setColor(Color3B(255, 100, 100));
+        if (getOwnerId() == 0) _unitSprite->setColor(Color3B(100, 150, 255));
+        else if (getOwnerId() == 1) _unitSprite->setColor(Color3B(255, 100, 100));
         else _unitSprite->setColor(Color3B::WHITE);
         return;
     }
@@ -466,8 +274,8 @@ void AbstractUnit::updateVisualColor() {
     if (drawNode) {
         drawNode->clear();
         Color4F teamColor;
-        if (_ownerId == 0) teamColor = Color4F(0.2f, 0.6f, 1.0f, 0.9f);
-        else if (_ownerId == 1) teamColor = Color4F(1.0f, 0.4f, 0.4f, 0.9f);
+        if (getOwnerId() == 0) teamColor = Color4F(0.2f, 0.6f, 1.0f, 0.9f);
+        else if (getOwnerId() == 1) teamColor = Color4F(1.0f, 0.4f, 0.4f, 0.9f);
         else teamColor = Color4F::GRAY;
 
         drawNode->drawDot(Vec2::ZERO, 25, teamColor);
@@ -475,25 +283,25 @@ void AbstractUnit::updateVisualColor() {
     }
 }
 
-// ²߼
+// 俘虏逻辑
 void AbstractUnit::capture(int newOwnerId) {
-    if (_ownerId == newOwnerId) return;
+    if (getOwnerId() == newOwnerId) return;
 
-    CCLOG("Unit Captured! %s changed owner from %d to %d", getUnitName().c_str(), _ownerId, newOwnerId);
+    GLOG_INFO(UNIT, "Unit Captured! %s changed owner from %d to %d", getUnitName().c_str(), getOwnerId(), newOwnerId);
 
-    // ӾƳ
+    // 从旧玩家移除
     if (GameManager::getInstance()) {
-        auto oldPlayer = GameManager::getInstance()->getPlayer(_ownerId);
+        auto oldPlayer = GameManager::getInstance()->getPlayer(getOwnerId());
         if (oldPlayer) {
             oldPlayer->removeUnit(this);
         }
     }
 
-    _ownerId = newOwnerId;
-    _currentMoves = 0;
+    units().owner(_handle) = newOwnerId;
+    units().moves(_handle) = 0;
     updateVisualColor();
 
-    // ӵ
+    // 添加到新玩家
     if (GameManager::getInstance()) {
         auto newPlayer = GameManager::getInstance()->getPlayer(newOwnerId);
         if (newPlayer) {
@@ -501,50 +309,36 @@ void AbstractUnit::capture(int newOwnerId) {
         }
     }
 
-    auto scaleAnim = Sequence::create(
-        ScaleTo::create(0.1f, 1.2f),
-        ScaleTo::create(0.1f, 1.0f),
-        nullptr
-    );
-    this->runAction(scaleAnim);
+    UnitActionLog::getInstance()->record({ UnitActionEventType::CAPTURE, this,
+        getPosition(), getPosition(), 0, false, true });
 }
 
-// 
+// 死亡处理
 void AbstractUnit::onDeath() {
-    _currentHp = 0;
-    _state = UnitState::DEAD;
-
-    if (_hpBarNode) _hpBarNode->setVisible(false);
-    if (_selectionRing) _selectionRing->setVisible(false);
-    if (_rangeNode) _rangeNode->clear();
-
-    auto fade = FadeOut::create(0.5f);
-    auto scale = ScaleTo::create(0.5f, 0.1f);
-
-    auto removeCallback = CallFunc::create([this]() {
-        // бƳͷ
-        if (GameManager::getInstance()) {
-            auto player = GameManager::getInstance()->getPlayer(_ownerId);
-            if (player) {
-                player->removeUnit(this);
-            }
+    if (getState() == UnitState::DEAD) return;
+
+    units().hp(_handle) = 0;
+    units().state(_handle) = UnitState::DEAD;
+
+    GLOG_VERBOSE(UNIT, "Unit %s died at (%d, %d)", getUnitName().c_str(), getGridPos().q, getGridPos().r);
+
+    // 立即从玩家列表移除，后续结算不会再选中该单位
+    if (GameManager::getInstance()) {
+        auto player = GameManager::getInstance()->getPlayer(getOwnerId());
+        if (player) {
+            player->removeUnit(this);
         }
-        // release Ӧ addUnit ʱ retain
-        this->release();
-    });
-
-    // ʹ RemoveSelf(false)  cleanup removeCallback ִ
-    this->runAction(Sequence::create(
-        Spawn::create(fade, scale, nullptr),
-        removeCallback,
-        RemoveSelf::create(true),
-        nullptr
-    ));
-
-    CCLOG("Unit %s died at (%d, %d)", getUnitName().c_str(), _gridPos.q, _gridPos.r);
+    }
+
+    // 淡出与移除节点由表现日志负责
+    UnitActionLog::getInstance()->record({ UnitActionEventType::DEATH, this,
+        getPosition(), getPosition(), 0, false, true });
+
+    // 对应 addUnit 时的 retain；延迟到帧末释放，保证本帧内的结算代码仍可安全访问
+    this->autorelease();
 }
 
-// Ѫ
+// 更新血条
 void AbstractUnit::updateHpBar() {
     if (!_hpBarNode) return;
 
@@ -556,7 +350,7 @@ void AbstractUnit::updateHpBar() {
 
     _hpBarNode->drawSolidRect(Vec2(x, 0), Vec2(x + width, height), Color4F(0.2f, 0.2f, 0.2f, 0.8f));
 
-    float hpPercent = (float)_currentHp / (float)getMaxHp();
+    float hpPercent = (float)getCurrentHp() / (float)getMaxHp();
     if (hpPercent > 0) {
         Color4F barColor = Color4F::GREEN;
         if (hpPercent < 0.3f) barColor = Color4F::RED;
@@ -566,7 +360,7 @@ void AbstractUnit::updateHpBar() {
     }
 }
 
-// ѡ
+// 设置选中
 void AbstractUnit::setSelected(bool selected) {
     if (_selectionRing) {
         _selectionRing->setVisible(selected);
@@ -579,17 +373,17 @@ void AbstractUnit::setSelected(bool selected) {
     }
 }
 
-// ʾΧ޸ȷ getReachableHexes ߼һ£
+// 显示范围（修复：确保与 getReachableHexes 的逻辑一致）
 void AbstractUnit::showMoveRange(HexLayout* layout, std::function<int(Hex)> getCost) {
     if (!_rangeNode) return;
     _rangeNode->clear();
 
-    // ޸ʹɴﷶΧͬ߼
-    auto reachableHexes = PathFinder::getReachableHexes(_gridPos, _currentMoves, getCost);
-    Vec2 myPixelPos = layout->hexToPixel(_gridPos);
+    // 【修复】使用与可达范围计算相同的逻辑
+    auto reachableHexes = PathFinder::getReachableHexes(getGridPos(), getCurrentMoves(), getCost);
+    Vec2 myPixelPos = layout->hexToPixel(getGridPos());
 
     for (const auto& hex : reachableHexes) {
-        if (hex == _gridPos) continue; // ǰλ
+        if (hex == getGridPos()) continue; // 跳过当前位置
 
         Vec2 targetPixelPos = layout->hexToPixel(hex);
         Vec2 localPos = targetPixelPos - myPixelPos;
@@ -610,7 +404,7 @@ void AbstractUnit::showMoveRange(HexLayout* layout, std::function<int(Hex)> getC
     }
 }
 
-// طΧ
+// 隐藏范围
 void AbstractUnit::hideMoveRange() {
     if (_rangeNode) {
         _rangeNode->clear();
@@ -619,7 +413,8 @@ void AbstractUnit::hideMoveRange() {
 
 bool AbstractUnit::canErectUnit()
 {
-    if (prereqTechID == -1 || GameManager::getInstance()->getPlayer(_ownerId)->getTechTree()->isActivated(prereqTechID))
+    int prereqTechID = _def->prereqTechID;
+    if (prereqTechID == -1 || GameManager::getInstance()->getPlayer(getOwnerId())->getTechTree()->isActivated(prereqTechID))
     {
         return true;
     }
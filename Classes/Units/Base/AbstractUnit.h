@@ -7,16 +7,18 @@
 #include "Development/ProductionProgram.h"
 #include <functional>
 
+struct UnitTypeInfo;
+
 /**
- * @brief λö
- * AIжȹĿUI
+ * @brief 单位类型枚举
+ * 用于AI判断优先攻击目标或UI分类
  */
 enum class UnitType {
-    CIVILIAN, // ƽս繤ˡ
-    MELEE,    // ս
-    RANGED,   // Զ
-    SIEGE,     // 
-	AVIATION   // 
+    CIVILIAN, // 平民（无战斗力，如工人、移民）
+    MELEE,    // 近战
+    RANGED,   // 远程
+    SIEGE,     // 攻城
+	AVIATION   // 航空
 };
 
 enum class UnitName {
@@ -39,197 +41,201 @@ enum class UnitName {
 };
 
 /**
- * @brief λ״̬ö
+ * @brief 单位状态枚举
  */
 enum class UnitState {
-    IDLE,       // 
-    MOVING,     // ƶ
-    ATTACKING,  // ڹ
-    DEAD        // 
+    IDLE,       // 闲置
+    MOVING,     // 正在移动（逻辑已改为同步结算，当前未使用）
+    ATTACKING,  // 正在攻击（逻辑已改为同步结算，当前未使用）
+    DEAD        // 已死亡
 };
 
 /**
  * @class AbstractUnit
- * @brief Ϸλĳ
+ * @brief 所有游戏单位的抽象基类
+ *
+ * 职责：
+ * 1. 作为 UnitStateTable 中一行模拟状态（血量、位置、归属）的表现层
+ * 2. 处理通用视觉表现（移动动画、血条更新、选中高亮）
+ * 3. 攻击力、移动力等配置从共享的单位类型定义读取，子类只负责登记类型ID
  *
- * ְ
- * 1. λĺݣѪλá
- * 2. ͨӾ֣ƶѪ¡ѡи
- * 3. ʵֵĽӿڣƶã
+ * 移动、攻击、受伤在调用时立即结算，动画通过 UnitActionLog 记录后播放
  */
 class AbstractUnit : public cocos2d::Node, public ProductionProgram {
+    friend class UnitActionLog;
 public:
-    AbstractUnit();
-    AbstractUnit(std::string unitName);
+    explicit AbstractUnit(UnitName id);
+    explicit AbstractUnit(const std::string& unitName);
     virtual ~AbstractUnit();
 
-    using CheckCityCallback = std::function<bool(Hex)>;
-    CheckCityCallback onCheckCity;
-
     // ==========================================
-    // 1. ʼ
+    // 1. 初始化与生命周期
     // ==========================================
 
      /**
-     * @brief ׼ Cocos ʼ ( CREATE_FUNC )
+     * @brief 标准 Cocos 初始化 (由 CREATE_FUNC 调用)
      */
     virtual bool init() override { return Node::init(); }
 
     /**
-     * @brief ʼλ
-     * @param ownerId ID (0:, 1:, etc.)
-     * @param startPos ʼ
-     * @return true ʼɹ
+     * @brief 初始化单位
+     * @param ownerId 玩家ID (0:玩家, 1:敌人, etc.)
+     * @param startPos 初始网格坐标
+     * @return true 初始化成功
      */
     virtual bool initUnit(int ownerId, Hex startPos);
 
     /**
-     * @brief غϿʼʱ߼
-     * ָƶ״̬ɫ
+     * @brief 播放回合开始的回血飘字
+     * 移动力与回血数值已由 UnitStateTable::beginTurn 批量结算
+     * @param healAmount 本回合回血量
      */
-    virtual void onTurnStart();
+    void playHealEffect(int healAmount);
 
     /**
-	*  @brief Ƿж
+	*  @brief 设置是否已行动
     */
-    void setActed(bool acted) { _hasActed = acted; }
+    void setActed(bool acted);
 
     /**
-	* @brief ѯǷж
+	* @brief 查询是否已行动
     */
-    bool hasActed() const { return _hasActed; }
+    bool hasActed() const;
 
     // ==========================================
-    // 2. 麯 (ʵ - )
+    // 2. 类型定义 (同类单位共享一份，见 UnitRegistry)
     // ==========================================
 
-    virtual std::string getUnitName() const { return ""; };    // λ
-    virtual UnitType getUnitType() const { return UnitType::CIVILIAN; };       // λ
-    virtual std::string getSpritePath() const { return ""; };  // ͼƬ·
+    const UnitTypeInfo& getDefinition() const { return *_def; }
+
+    // 类型信息：按类型ID从单位类型表读取
+    UnitName getUnitId() const { return _type; }               // 单位类型ID（逻辑判断一律用它）
+    std::string getUnitName() const;                           // 单位名称（仅用于显示与日志）
+    UnitType getUnitType() const;                              // 单位分类
+    std::string getSpritePath() const;                         // 图片路径
 
-    // ---  ---
-    virtual int getMaxHp() const { return 100; }       // ֵ
-    virtual int getBaseAttack() const { return 20; };  // 
-    virtual int getMaxMoves() const { return 2; };    // ƶ
-    virtual int getAttackRange() const { return 1; }; //  (1=ս)
-    virtual int getVisionRange() const { return 2; } // ҰΧ (Ĭ2)
-    virtual int getMaintenanceCost() const { return 2; }; // ά
-    virtual int getPrereqTechID() const { return prereqTechID; }    // ǰÿƼ
+    // --- 基础属性 ---
+    int getMaxHp() const;           // 最大生命值
+    int getBaseAttack() const;      // 基础攻击力
+    int getMaxMoves() const;        // 最大移动力
+    int getAttackRange() const;     // 攻击距离 (1=近战)
+    int getVisionRange() const;     // 视野范围
+    int getMaintenanceCost() const; // 维护费用
+    int getPrereqTechID() const;    // 前置科技
 
     // ==========================================
-    // 3.  (麯ĬΪ false)
+    // 3. 特殊能力开关
     // ==========================================
-    virtual bool ismilitary() const { return true; } // ǷΪ
-    virtual bool canFoundCity() const { return false; } // ܷ񽨳
-    virtual bool canFly() const { return false; }       // ܷ
-    virtual bool canMoveAfterAttack() const { return false; } // ܷƶ
+    bool ismilitary() const;          // 是否为军队
+    bool canFoundCity() const;        // 能否建城
+    bool canFly() const;              // 能否飞行
+    bool canMoveAfterAttack() const;  // 攻击后能否移动
 
     // ==========================================
-    // 4. Ϊ߼
+    // 4. 核心行为逻辑
     // ==========================================
 
     /**
-     * @brief ƶĿλ
-     * @param targetPos Ŀ
-     * @param layout ڽHexתΪĻĲ
-     * @param pathCost ·ĵƶĬ-1ʾʹֱ߾룩
+     * @brief 移动到目标位置
+     * @param targetPos 目标六边形坐标
+     * @param layout 用于将Hex转换为屏幕坐标的布局
+     * @param pathCost 路径消耗的移动力（默认-1表示使用直线距离）
      */
     void moveTo(Hex targetPos, HexLayout* layout, int pathCost = -1);
 
     /**
-     * @brief ܵ˺
-     * @param damage ˺ֵ
-     * @return ʵʿ۳Ѫ
+     * @brief 受到伤害
+     * @param damage 伤害数值
+     * @return 实际扣除的血量
      */
     int takeDamage(int damage);
 
     /**
-     * @brief ²λ (ǿƱȨ)
-     * @param newOwnerId µID
+     * @brief 俘虏单位 (强制变更所属权)
+     * @param newOwnerId 新的所属玩家ID
      */
     void capture(int newOwnerId);
 
     /**
-     * @brief ˢɫ (ڳʼ򱻷²)
+     * @brief 刷新外观颜色 (用于初始化或被俘虏后)
      */
     void updateVisualColor();
 
     /**
-     * @brief Ŀ굥λ
-     * @param target Ŀָ
-     * @param layout ڼ㶯
+     * @brief 攻击目标单位（伤害与反击立即结算）
+     * @param target 目标指针
+     * @param layout 用于计算动画方向
      */
 
     void attack(AbstractUnit* target, HexLayout* layout);
 
     /**
-     * @brief ˲䴫 (޶ֱ)
+     * @brief 瞬间传送 (无动画，直接设置坐标)
      */
     void teleportTo(Hex pos, HexLayout* layout);
 
     /**
-     * @brief ѡ״̬ (ʾȦ)
+     * @brief 设置选中状态 (显示光圈)
      */
     void setSelected(bool selected);
 
     // ==========================================
-    // 5. ״̬ѯ (Getters)
+    // 5. 状态查询 (Getters)
     // ==========================================
 
-    bool isAlive() const { return _currentHp > 0; }
-    bool canAct() const { return _currentMoves > 0 && isAlive(); }
+    // 模拟状态存放在 UnitStateTable 中，按句柄读取
+    uint32_t getHandle() const { return _handle; }
 
-    int getOwnerId() const { return _ownerId; }
-    Hex getGridPos() const { return _gridPos; }
-    int getCurrentHp() const { return _currentHp; }
-    int getCurrentMoves() const { return _currentMoves; }
-    UnitState getState() const { return _state; }
+    bool isAlive() const;
+    bool canAct() const;
 
-    // ۺս (Ѫ)
+    int getOwnerId() const;
+    Hex getGridPos() const;
+    int getCurrentHp() const;
+    int getCurrentMoves() const;
+    UnitState getState() const;
+
+    // 计算综合战斗力 (考虑血量损耗)
     int getCombatPower() const;
 
 
     // ==========================================
-    // 6. ɴﷶΧ (range)
+    // 6. 可达范围 (range)
     // ==========================================
     /**
-     * @brief ʾƶΧ
-     * @param layout ֹ
-     * @param getCost Ļص
+     * @brief 显示移动范围
+     * @param layout 布局工具
+     * @param getCost 地形消耗回调
      */
     void showMoveRange(HexLayout* layout, std::function<int(Hex)> getCost);
 
     /**
-     * @brief ƶΧ
+     * @brief 隐藏移动范围
      */
     void hideMoveRange();
 
     // ==========================================
-    // 7. 
+    // 7. 生产条件
     // ==========================================
     bool canErectUnit();
 
 protected:
-    // --- ڲ ---
-    void updateHpBar();     // ˢѪUI
-    void onDeath();         // 
+    // --- 内部辅助 ---
+    static UnitName lookupUnitName(const std::string& unitName);
+    void updateHpBar();     // 刷新血条UI
+    void onDeath();         // 死亡处理
 
-    // --- Ա ---
-    int _ownerId;           // 
+    // --- 成员变量 ---
     UnitName _type;
-    Hex _gridPos;           // ߼
-    int _currentHp;         // ǰѪ
-    int _currentMoves;      // ǰƶ
-    UnitState _state;       // ״̬
-    bool _hasActed;
-    int prereqTechID;       // ǰÿƼ
-
-    // --- Ӿڵ ---
-    cocos2d::Sprite* _unitSprite;    // λ
-    cocos2d::Sprite* _selectionRing; // ѡйȦ
-    cocos2d::DrawNode* _hpBarNode;       // Ѫƽڵ
-
-    cocos2d::DrawNode* _rangeNode; // ɴ߿
+    const UnitTypeInfo* _def; // 共享的类型定义
+    uint32_t _handle;         // UnitStateTable 中的代际句柄（所属玩家、坐标、血量、移动力等存放在表中）
+
+    // --- 视觉节点 ---
+    cocos2d::Sprite* _unitSprite;    // 单位外观
+    cocos2d::Sprite* _selectionRing; // 选中光圈
+    cocos2d::DrawNode* _hpBarNode;       // 血条绘制节点
+
+    cocos2d::DrawNode* _rangeNode; // 可达边框
 
 };
 
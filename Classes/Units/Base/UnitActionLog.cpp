@@ -0,0 +1,262 @@
+#include "UnitActionLog.h"
+#include "AbstractUnit.h"
+#include "UI/FloatingTextPool.h"
+#include <map>
+#include <algorithm>
+
+USING_NS_CC;
+
+namespace {
+    const int kUnitActionTag = 0x5A11;        // 位移类表现动作的标签，用于打断上一次尚未播完的动画
+    const float kOffscreenMargin = 100.0f;    // 判断是否在屏幕内时留出的余量（约一个六边形）
+}
+
+UnitActionLog* UnitActionLog::s_instance = nullptr;
+
+UnitActionLog* UnitActionLog::getInstance() {
+    if (!s_instance) {
+        s_instance = new UnitActionLog();
+    }
+    return s_instance;
+}
+
+UnitActionLog::UnitActionLog()
+    : _batchDepth(0)
+    , _skipOffscreen(true) {
+}
+
+void UnitActionLog::record(const UnitActionEvent& event) {
+    if (!event.unit) return;
+
+    _pending.push_back(event);
+    if (!_pendingUnits.contains(event.unit)) {
+        _pendingUnits.pushBack(event.unit);
+    }
+
+    // 非批处理状态下立即播放
+    if (_batchDepth == 0) {
+        flush(false, 1.0f);
+    }
+}
+
+void UnitActionLog::beginBatch() {
+    _batchDepth++;
+}
+
+float UnitActionLog::endBatch(bool skipAll, float speed) {
+    if (_batchDepth > 0) {
+        _batchDepth--;
+    }
+    if (_batchDepth > 0) {
+        return 0.0f;
+    }
+    return flush(skipAll, speed);
+}
+
+// 各类事件的基础时长（秒，1倍速）
+float UnitActionLog::getDuration(UnitActionEventType type) {
+    switch (type) {
+    case UnitActionEventType::MOVE:    return 0.3f;
+    case UnitActionEventType::ATTACK:  return 0.3f;
+    case UnitActionEventType::CAPTURE: return 0.2f;
+    case UnitActionEventType::DEATH:   return 0.5f;
+    default:                           return 0.0f;
+    }
+}
+
+// 攻击命中时刻相对事件开始的偏移，受伤表现从这里开始播放
+float UnitActionLog::getHitOffset(UnitActionEventType type) {
+    return (type == UnitActionEventType::ATTACK) ? 0.1f : 0.0f;
+}
+
+float UnitActionLog::flush(bool skipAll, float speed) {
+    if (_pending.empty()) return 0.0f;
+    if (speed <= 0.0f) speed = 1.0f;
+
+    // 1. 以单位为粒度决定播放还是跳过，避免同一单位的表现一半播放一半跳过
+    std::map<AbstractUnit*, bool> animated;
+    for (const auto& event : _pending) {
+        bool& play = animated[event.unit];
+        if (!skipAll && (!_skipOffscreen || isOnScreen(event))) {
+            play = true;
+        }
+    }
+
+    // 2. 为每个单位排出时间线
+    struct Track {
+        Vector<FiniteTimeAction*> actions;
+        float cursor = 0.0f;
+        bool positional = false;    // 是否包含位移类事件
+        Vec2 start;                 // 位移类事件开始前的逻辑坐标
+    };
+    std::map<AbstractUnit*, Track> tracks;
+    float lastHit = 0.0f;
+    float totalDuration = 0.0f;
+
+    for (const auto& event : _pending) {
+        if (!animated[event.unit]) {
+            applyInstant(event);
+            continue;
+        }
+
+        Track& track = tracks[event.unit];
+        bool positional = (event.type == UnitActionEventType::MOVE || event.type == UnitActionEventType::ATTACK);
+        if (positional && !track.positional) {
+            track.positional = true;
+            track.start = event.from;
+        }
+
+        float start = track.cursor;
+        if (event.followsHit) {
+            start = std::max(start, lastHit);
+        }
+        if (start > track.cursor) {
+            track.actions.pushBack(DelayTime::create(start - track.cursor));
+        }
+        track.actions.pushBack(createAction(event, speed));
+
+        if (event.type == UnitActionEventType::ATTACK) {
+            lastHit = start + getHitOffset(event.type) / speed;
+        }
+        track.cursor = start + getDuration(event.type) / speed;
+        totalDuration = std::max(totalDuration, track.cursor);
+    }
+
+    // 3. 启动动画
+    for (auto& pair : tracks) {
+        AbstractUnit* unit = pair.first;
+        Track& track = pair.second;
+        if (track.actions.empty()) continue;
+
+        auto sequence = Sequence::create(track.actions);
+        if (track.positional) {
+            // 打断上一段位移动画，从逻辑坐标重新开始
+            unit->stopActionByTag(kUnitActionTag);
+            unit->setPosition(track.start);
+            sequence->setTag(kUnitActionTag);
+        }
+        unit->runAction(sequence);
+    }
+
+    _pending.clear();
+    _pendingUnits.clear();
+    return totalDuration;
+}
+
+bool UnitActionLog::isOnScreen(const UnitActionEvent& event) const {
+    Node* parent = event.unit->getParent();
+    if (!parent) return false;
+
+    auto director = Director::getInstance();
+    Vec2 origin = director->getVisibleOrigin();
+    Size size = director->getVisibleSize();
+    Rect screen(origin.x - kOffscreenMargin, origin.y - kOffscreenMargin,
+        size.width + kOffscreenMargin * 2, size.height + kOffscreenMargin * 2);
+
+    return screen.containsPoint(parent->convertToWorldSpace(event.from)) ||
+        screen.containsPoint(parent->convertToWorldSpace(event.to));
+}
+
+// 跳过动画，直接应用事件的最终表现
+void UnitActionLog::applyInstant(const UnitActionEvent& event) {
+    AbstractUnit* unit = event.unit;
+
+    switch (event.type) {
+    case UnitActionEventType::MOVE:
+        unit->stopActionByTag(kUnitActionTag);
+        unit->setPosition(event.to);
+        break;
+    case UnitActionEventType::ATTACK:
+        unit->stopActionByTag(kUnitActionTag);
+        unit->setPosition(event.from);
+        break;
+    case UnitActionEventType::DAMAGE:
+    case UnitActionEventType::HEAL:
+        unit->updateHpBar();
+        break;
+    case UnitActionEventType::DEATH:
+        unit->removeFromParent();
+        break;
+    default:
+        break;
+    }
+
+    if (event.exhausted && unit->_unitSprite) {
+        unit->_unitSprite->setColor(Color3B::GRAY);
+    }
+}
+
+FiniteTimeAction* UnitActionLog::createAction(const UnitActionEvent& event, float speed) {
+    AbstractUnit* unit = event.unit;
+    bool exhausted = event.exhausted;
+    auto finish = CallFunc::create([unit, exhausted]() {
+        if (exhausted && unit->_unitSprite) {
+            unit->_unitSprite->setColor(Color3B::GRAY);
+        }
+        });
+
+    switch (event.type) {
+    case UnitActionEventType::MOVE: {
+        auto moveAction = MoveTo::create(0.3f / speed, event.to);
+        return Sequence::create(EaseSineOut::create(moveAction), finish, nullptr);
+    }
+    case UnitActionEventType::ATTACK: {
+        // 远程攻击冲刺距离较短
+        float lungeDist = (event.amount > 1) ? 10.0f : 25.0f;
+        Vec2 lungeOffset = (event.to - event.from).getNormalized() * lungeDist;
+        return Sequence::create(
+            MoveTo::create(0.1f / speed, event.from + lungeOffset),
+            MoveTo::create(0.2f / speed, event.from),
+            finish,
+            nullptr
+        );
+    }
+    case UnitActionEventType::CAPTURE:
+        return Sequence::create(
+            ScaleTo::create(0.1f / speed, 1.2f),
+            ScaleTo::create(0.1f / speed, 1.0f),
+            nullptr
+        );
+    case UnitActionEventType::DAMAGE: {
+        int amount = event.amount;
+        return CallFunc::create([this, unit, amount, speed]() {
+            showFloatingText(unit, "-" + std::to_string(amount), Color3B::RED, speed);
+            unit->updateHpBar();
+            });
+    }
+    case UnitActionEventType::HEAL: {
+        int amount = event.amount;
+        return CallFunc::create([this, unit, amount, speed]() {
+            showFloatingText(unit, "+" + std::to_string(amount), Color3B::GREEN, speed);
+            unit->updateHpBar();
+            });
+    }
+    case UnitActionEventType::DEATH:
+        return Sequence::create(
+            CallFunc::create([unit]() {
+                if (unit->_hpBarNode) unit->_hpBarNode->setVisible(false);
+                if (unit->_selectionRing) unit->_selectionRing->setVisible(false);
+                if (unit->_rangeNode) unit->_rangeNode->clear();
+                }),
+            Spawn::create(FadeOut::create(0.5f / speed), ScaleTo::create(0.5f / speed, 0.1f), nullptr),
+            RemoveSelf::create(true),
+            nullptr
+        );
+    default:
+        return finish;
+    }
+}
+
+// 飘字（伤害为红色，回血为绿色），Label 从对象池取用，播放完归还
+void UnitActionLog::showFloatingText(AbstractUnit* unit, const std::string& text, const Color3B& color, float speed) {
+    auto pool = FloatingTextPool::getInstance();
+    auto label = pool->acquire(unit, text, 20, color, 20);
+    label->enableOutline(Color4B::BLACK, 1);
+    label->setPosition(Vec2(0, 40));
+
+    label->runAction(Sequence::create(
+        Spawn::create(MoveBy::create(0.5f / speed, Vec2(0, 40)), FadeOut::create(0.5f / speed), nullptr),
+        pool->releaseAction(),
+        nullptr
+    ));
+}
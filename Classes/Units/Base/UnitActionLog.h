@@ -0,0 +1,100 @@
+#ifndef __UNIT_ACTION_LOG_H__
+#define __UNIT_ACTION_LOG_H__
+
+#include "cocos2d.h"
+#include <vector>
+
+class AbstractUnit;
+
+/**
+ * @brief 单位表现事件类型
+ * 逻辑结算在 moveTo / attack / takeDamage 中同步完成，这里只记录需要播放的表现
+ */
+enum class UnitActionEventType {
+    MOVE,       // 移动
+    ATTACK,     // 攻击冲刺
+    CAPTURE,    // 被俘虏
+    DAMAGE,     // 受伤飘字
+    HEAL,       // 回血飘字
+    DEATH       // 死亡淡出并移除
+};
+
+/**
+ * @brief 单条表现事件
+ */
+struct UnitActionEvent {
+    UnitActionEventType type;
+    AbstractUnit* unit;         // 播放表现的单位
+    cocos2d::Vec2 from;         // 事件开始时单位的像素坐标
+    cocos2d::Vec2 to;           // MOVE: 目标坐标；ATTACK: 目标单位坐标
+    int amount;                 // DAMAGE / HEAL 数值
+    bool exhausted;             // 事件结束后移动力是否耗尽（置灰）
+    bool followsHit;            // 是否需要等到上一次攻击命中后再播放
+};
+
+/**
+ * @class UnitActionLog
+ * @brief 单位表现事件日志
+ *
+ * 职责：
+ * 1. 收集单位行动产生的表现事件，与游戏逻辑解耦
+ * 2. 按单位排出时间线并播放，支持倍速
+ * 3. 对屏幕外单位或快速回合直接跳到最终表现，不占用回合时间
+ *
+ * 非批处理状态下（人类玩家操作）事件记录后立即播放；
+ * AI 回合用 beginBatch / endBatch 包住，结束时统一播放并返回总时长。
+ */
+class UnitActionLog {
+public:
+    static UnitActionLog* getInstance();
+
+    /**
+     * @brief 记录一条表现事件
+     */
+    void record(const UnitActionEvent& event);
+
+    /**
+     * @brief 开始批量收集事件
+     */
+    void beginBatch();
+
+    /**
+     * @brief 结束批量收集并播放
+     * @param skipAll 为 true 时跳过所有动画，直接应用最终表现
+     * @param speed 播放倍速
+     * @return 播放所需的总时长（秒）
+     */
+    float endBatch(bool skipAll, float speed);
+
+    /**
+     * @brief 是否跳过屏幕外单位的动画（默认开启）
+     */
+    void setSkipOffscreen(bool skip) { _skipOffscreen = skip; }
+    bool getSkipOffscreen() const { return _skipOffscreen; }
+
+private:
+    UnitActionLog();
+
+    /**
+     * @brief 播放当前所有待处理事件
+     * @return 播放所需的总时长（秒）
+     */
+    float flush(bool skipAll, float speed);
+
+    bool isOnScreen(const UnitActionEvent& event) const;
+    void applyInstant(const UnitActionEvent& event);
+    cocos2d::FiniteTimeAction* createAction(const UnitActionEvent& event, float speed);
+    void showFloatingText(AbstractUnit* unit, const std::string& text, const cocos2d::Color3B& color, float speed);
+
+    static float getDuration(UnitActionEventType type);
+    static float getHitOffset(UnitActionEventType type);
+
+    static UnitActionLog* s_instance;
+
+    std::vector<UnitActionEvent> _pending;           // 待播放事件
+    cocos2d::Vector<cocos2d::Node*> _pendingUnits;   // 持有待播放单位的引用，防止批处理期间被释放
+    int _batchDepth;
+    bool _skipOffscreen;
+};
+
+#endif // __UNIT_ACTION_LOG_H__
@@ -0,0 +1,76 @@
+#include "UnitRegistry.h"
+#include <unordered_map>
+
+// 单位类型表：顺序必须与 UnitName 枚举一致
+// 列：类型、名称、分类、项目ID、成本、购买价、前置科技 | 生命、攻击、移动、射程、视野、维护 | 军队、建城、飞行、攻击后移动 | 图片
+const UnitTypeInfo kUnitTypeTable[kUnitTypeCount] = {
+    { UnitName::SETTLER,       "Settler",      UnitType::CIVILIAN, 1,  80, 400,   -1,
+      100, 0,   2,  0, 2, 0,  false, true,  false, false, "units/settler.png" },
+    { UnitName::BUILDER,       "Builder",      UnitType::CIVILIAN, 2,  50, 200,   -1,
+      100, 0,   2,  0, 2, 0,  false, false, false, false, "units/builder.png" },
+    { UnitName::WARRIOR,       "Warrior",      UnitType::MELEE,    11, 30, 200,   -1,
+      100, 20,  2,  1, 2, 1,  true,  false, false, false, "units/warrior.png" },
+    { UnitName::SWORDSMAN,     "Swordsman",    UnitType::MELEE,    12, 40, 500,   7,  // 铁器
+      150, 30,  2,  1, 2, 2,  true,  false, false, false, "units/swordsman.png" },
+    { UnitName::LINE_INFANTRY, "LineInfantry", UnitType::MELEE,    13, 60, 600,   12, // 学徒制
+      200, 40,  2,  1, 2, 3,  true,  false, false, false, "units/lneInfantry.png" },
+    { UnitName::ARCHER,        "Archer",       UnitType::RANGED,   21, 30, 400,   3,  // 弓箭
+      80,  15,  2,  2, 2, 2,  true,  false, false, false, "units/archer.png" },
+    { UnitName::CROSSBOWMAN,   "Crossbowman",  UnitType::RANGED,   22, 50, 500,   11, // 机械
+      150, 35,  2,  2, 2, 4,  true,  false, false, false, "units/crossbowman.png" },
+    { UnitName::MUSKETEERS,    "Musketeers",   UnitType::RANGED,   23, 80, 600,   14, // 火药
+      200, 60,  2,  2, 2, 5,  true,  false, false, false, "units/musketeers.png" },
+    { UnitName::CATAPULT,      "Catapult",     UnitType::SIEGE,    31, 30, 200,   8,  // 工程学
+      60,  25,  1,  3, 2, 2,  true,  false, false, false, "units/catapult.png" },
+    { UnitName::CANNON,        "Cannon",       UnitType::SIEGE,    32, 50, 400,   14, // 火药
+      160, 90,  2,  3, 2, 4,  true,  false, false, false, "units/cannon.png" },
+    { UnitName::BIPLANE,       "Biplane",      UnitType::AVIATION, 41, 60, 1000,  18, // 飞行
+      120, 60,  6,  3, 4, 5,  true,  false, true,  false, "units/biplane.png" },
+    { UnitName::JET_FIGHTER,   "JetFighter",   UnitType::AVIATION, 42, 80, 10600, 20, // 高级飞行
+      200, 120, 10, 5, 6, 8,  true,  false, true,  false, "units/jetFighter.png" }
+};
+
+namespace {
+    // 单位项目ID都小于100，反查表直接按项目ID下标
+    const int kMaxUnitProgramId = 100;
+
+    struct ReverseIndex {
+        std::unordered_map<std::string, UnitName> byName;
+        int byProgramId[kMaxUnitProgramId];
+    };
+
+    const ReverseIndex& reverseIndex() {
+        static const ReverseIndex index = [] {
+            ReverseIndex built;
+            for (int i = 0; i < kMaxUnitProgramId; i++)
+                built.byProgramId[i] = -1;
+            for (int i = 0; i < kUnitTypeCount; i++) {
+                const UnitTypeInfo& info = kUnitTypeTable[i];
+                CCASSERT(static_cast<int>(info.id) == i, "kUnitTypeTable order must match UnitName");
+                built.byName[info.name] = info.id;
+                built.byProgramId[info.programId] = i;
+            }
+            return built;
+        }();
+        return index;
+    }
+}
+
+bool UnitRegistry::findByName(const std::string& name, UnitName& id) {
+    const auto& byName = reverseIndex().byName;
+    auto it = byName.find(name);
+    if (it == byName.end())
+        return false;
+    id = it->second;
+    return true;
+}
+
+bool UnitRegistry::findByProgramId(int programId, UnitName& id) {
+    if (programId < 0 || programId >= kMaxUnitProgramId)
+        return false;
+    int index = reverseIndex().byProgramId[programId];
+    if (index < 0)
+        return false;
+    id = static_cast<UnitName>(index);
+    return true;
+}
@@ -0,0 +1,69 @@
+#ifndef __UNIT_REGISTRY_H__
+#define __UNIT_REGISTRY_H__
+
+#include "AbstractUnit.h"
+#include <string>
+
+/**
+ * @brief 单位类型定义（只读常量，按 UnitName 下标存放）
+ * 所有同类单位共享一份，单位实例只保存指向它的指针与自身的可变状态
+ */
+struct UnitTypeInfo {
+    UnitName id;            // 类型ID（与下标一致）
+    const char* name;       // 显示/存档用名称，与生产项目名称一致
+    UnitType category;      // 单位分类
+    int programId;          // 生产项目ID（ProductionProgram::programs 的键）
+    int cost;               // 生产力成本
+    int purchaseCost;       // 金币购买成本
+    int prereqTechID;       // 前置科技（-1 表示无）
+
+    // 战斗与移动
+    int maxHp;              // 最大生命值
+    int baseAttack;         // 基础攻击力
+    int maxMoves;           // 最大移动力
+    int attackRange;        // 攻击距离（0 = 无法攻击，1 = 近战）
+    int visionRange;        // 视野范围
+    int maintenanceCost;    // 每回合维护费用
+
+    // 能力
+    bool isMilitary;        // 是否为军队
+    bool canFoundCity;      // 能否建城
+    bool canFly;            // 能否飞行
+    bool canMoveAfterAttack; // 攻击后能否移动
+
+    const char* spritePath; // 图片路径
+};
+
+static const int kUnitTypeCount = static_cast<int>(UnitName::JET_FIGHTER) + 1;
+
+// 单位类型表：顺序必须与 UnitName 枚举一致，定义在 UnitRegistry.cpp（全程序只有一份）
+extern const UnitTypeInfo kUnitTypeTable[kUnitTypeCount];
+
+/**
+ * @class UnitRegistry
+ * @brief 单位类型注册表
+ *
+ * 类型ID直接下标到 kUnitTypeTable，查询、分类与读取属性都是一次数组读取。
+ * 字符串只在界面显示与存档边界使用：按名称或生产项目ID反查类型ID各查一次后，
+ * 后续逻辑一律使用 UnitName。
+ */
+class UnitRegistry {
+public:
+    static const UnitTypeInfo& info(UnitName id) {
+        return kUnitTypeTable[static_cast<int>(id)];
+    }
+
+    /**
+     * @brief 按名称反查类型ID
+     * @return 名称未注册时返回 false
+     */
+    static bool findByName(const std::string& name, UnitName& id);
+
+    /**
+     * @brief 按生产项目ID反查类型ID
+     * @return 不是单位项目时返回 false
+     */
+    static bool findByProgramId(int programId, UnitName& id);
+};
+
+#endif // __UNIT_REGISTRY_H__
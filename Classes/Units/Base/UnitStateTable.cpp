@@ -0,0 +1,201 @@
+#include "UnitStateTable.h"
+#include "UnitRegistry.h"
+#include <algorithm>
+
+UnitStateTable* UnitStateTable::getInstance()
+{
+    static UnitStateTable instance;
+    return &instance;
+}
+
+UnitHandle UnitStateTable::add(AbstractUnit* view, UnitName type)
+{
+    uint32_t index;
+    if (!_freeSlots.empty()) {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else {
+        index = (uint32_t)_rowOf.size();
+        _rowOf.push_back(-1);
+        _generation.push_back(0);
+    }
+
+    UnitHandle handle = EntityHandles::make(index, _generation[index]);
+    _rowOf[index] = (int)_view.size();
+    _owner.push_back(-1);
+    _type.push_back(type);
+    _pos.push_back(Hex());
+    _hp.push_back(0);
+    _moves.push_back(0);
+    _state.push_back(UnitState::IDLE);
+    _flags.push_back(0);
+    _listIndex.push_back(-1);
+    _view.push_back(view);
+    _handleOf.push_back(handle);
+    _byHex.emplace(Hex(), handle);
+    return handle;
+}
+
+void UnitStateTable::remove(UnitHandle handle)
+{
+    if (!isValid(handle))
+        return;
+
+    unindexPos(handle, pos(handle));
+
+    // 最后一行换到空出的位置，再弹出末尾
+    uint32_t index = EntityHandles::indexOf(handle);
+    int row = _rowOf[index];
+    int last = (int)_view.size() - 1;
+    if (row != last) {
+        _owner[row] = _owner[last];
+        _type[row] = _type[last];
+        _pos[row] = _pos[last];
+        _hp[row] = _hp[last];
+        _moves[row] = _moves[last];
+        _state[row] = _state[last];
+        _flags[row] = _flags[last];
+        _listIndex[row] = _listIndex[last];
+        _view[row] = _view[last];
+        _handleOf[row] = _handleOf[last];
+        _rowOf[EntityHandles::indexOf(_handleOf[row])] = row;
+    }
+    _owner.pop_back();
+    _type.pop_back();
+    _pos.pop_back();
+    _hp.pop_back();
+    _moves.pop_back();
+    _state.pop_back();
+    _flags.pop_back();
+    _listIndex.pop_back();
+    _view.pop_back();
+    _handleOf.pop_back();
+
+    // 槽位代数加一，旧句柄从此失效
+    _rowOf[index] = -1;
+    _generation[index] = (_generation[index] + 1) & EntityHandles::kGenerationMask;
+    _freeSlots.push_back(index);
+}
+
+bool UnitStateTable::isValid(UnitHandle handle) const
+{
+    uint32_t index = EntityHandles::indexOf(handle);
+    return handle != kInvalidUnitHandle && index < _rowOf.size() && _rowOf[index] >= 0
+        && _generation[index] == EntityHandles::generationOf(handle);
+}
+
+AbstractUnit* UnitStateTable::get(UnitHandle handle) const
+{
+    return isValid(handle) ? _view[rowOf(handle)] : nullptr;
+}
+
+void UnitStateTable::setFlag(UnitHandle h, Flag flag, bool on)
+{
+    uint8_t& flags = _flags[rowOf(h)];
+    if (on) flags |= flag;
+    else flags &= ~flag;
+}
+
+void UnitStateTable::setPos(UnitHandle h, const Hex& pos)
+{
+    Hex& current = _pos[rowOf(h)];
+    if (current == pos)
+        return;
+    unindexPos(h, current);
+    current = pos;
+    _byHex.emplace(pos, h);
+}
+
+void UnitStateTable::unindexPos(UnitHandle h, const Hex& pos)
+{
+    auto range = _byHex.equal_range(pos);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == h) {
+            _byHex.erase(it);
+            return;
+        }
+    }
+}
+
+void UnitStateTable::beginTurn(int ownerId, const std::function<bool(Hex)>& isInCity,
+                               FrameVector<std::pair<AbstractUnit*, int>>& healed)
+{
+    const int count = size();
+    for (int row = 0; row < count; row++) {
+        if (_owner[row] != ownerId || !isActiveRow(row))
+            continue;
+
+        const UnitTypeInfo& def = UnitRegistry::info(_type[row]);
+
+        // 1. 回血：上回合没有行动且血不满，城市中回 1/4，野外回 1/10
+        if (!(_flags[row] & FLAG_ACTED) && _hp[row] < def.maxHp) {
+            bool inCity = isInCity && isInCity(_pos[row]);
+            int healAmount = inCity ? (def.maxHp / 4) : (def.maxHp / 10);
+            int oldHp = _hp[row];
+            _hp[row] = std::min(def.maxHp, _hp[row] + healAmount);
+            if (_hp[row] > oldHp)
+                healed.push_back(std::make_pair(_view[row], _hp[row] - oldHp));
+        }
+
+        // 2. 恢复移动力
+        _moves[row] = def.maxMoves;
+        _state[row] = UnitState::IDLE;
+        _flags[row] &= ~FLAG_ACTED;
+    }
+}
+
+int UnitStateTable::countMilitary(int ownerId) const
+{
+    int count = 0;
+    for (int row = 0; row < size(); row++) {
+        if (_owner[row] == ownerId && isActiveRow(row) && UnitRegistry::info(_type[row]).isMilitary)
+            count++;
+    }
+    return count;
+}
+
+int UnitStateTable::countOfType(int ownerId, UnitName type) const
+{
+    int count = 0;
+    for (int row = 0; row < size(); row++) {
+        if (_owner[row] == ownerId && _type[row] == type && isActiveRow(row))
+            count++;
+    }
+    return count;
+}
+
+AbstractUnit* UnitStateTable::findAt(const Hex& hex) const
+{
+    auto range = _byHex.equal_range(hex);
+    for (auto it = range.first; it != range.second; ++it) {
+        int row = rowOf(it->second);
+        if (isActiveRow(row))
+            return _view[row];
+    }
+    return nullptr;
+}
+
+AbstractUnit* UnitStateTable::findNearest(int ownerId, const Hex& from, int& distance) const
+{
+    AbstractUnit* nearest = nullptr;
+    distance = 9999;
+    for (int row = 0; row < size(); row++) {
+        if (_owner[row] != ownerId || !isActiveRow(row))
+            continue;
+        int dist = from.distance(_pos[row]);
+        if (dist < distance) {
+            distance = dist;
+            nearest = _view[row];
+        }
+    }
+    return nearest;
+}
+
+void UnitStateTable::collectPositions(FrameVector<Hex>& out) const
+{
+    for (int row = 0; row < size(); row++) {
+        if (isActiveRow(row))
+            out.push_back(_pos[row]);
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef __UNIT_STATE_TABLE_H__
+#define __UNIT_STATE_TABLE_H__
+
+#include "AbstractUnit.h"
+#include "Utils/FrameArena.h"
+#include "Utils/SlotMap.h"
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// 单位句柄：32 位代际句柄，单位死亡或被移除后旧句柄自动失效
+typedef EntityHandle UnitHandle;
+static const UnitHandle kInvalidUnitHandle = EntityHandles::kInvalid;
+
+/**
+ * @class UnitStateTable
+ * @brief 单位模拟状态表（按分量连续存放）
+ *
+ * 所属玩家、类型、坐标、血量、移动力与状态标志各自存放在一个紧凑数组中，
+ * 同一下标对应同一个单位。AbstractUnit 只是表现层（精灵、血条、选中光圈），
+ * 通过句柄读写自己的那一行。
+ *
+ * AI 扫描、胜利判定、回合开始重置等逻辑直接按下标线性遍历这些数组，
+ * 不再逐个追踪散落在堆上的 Node 指针。
+ *
+ * 删除单位时把最后一行换到空出的位置（O(1)），句柄经槽位表间接映射到行号，
+ * 因此行号会变化而句柄不会；槽位复用时代数加一，旧句柄经 isValid 可检测。
+ * 另按坐标维护索引，按格子查单位为 O(1)。
+ */
+class UnitStateTable {
+public:
+    static UnitStateTable* getInstance();
+
+    enum Flag : uint8_t {
+        FLAG_ACTED   = 1 << 0, // 本回合已行动
+        FLAG_IN_PLAY = 1 << 1  // 已登记到玩家（被移出游戏的单位不参与扫描）
+    };
+
+    // ==========================================
+    // 1. 登记与删除
+    // ==========================================
+    UnitHandle add(AbstractUnit* view, UnitName type);
+    void remove(UnitHandle handle); // 由 AbstractUnit 析构时调用
+    bool isValid(UnitHandle handle) const;
+    AbstractUnit* get(UnitHandle handle) const; // 句柄失效时返回 nullptr
+
+    // ==========================================
+    // 2. 按句柄读写（单个单位）
+    // ==========================================
+    // 以下接口要求句柄有效（单位自身持有的句柄在其存活期间总是有效）
+    int& owner(UnitHandle h) { return _owner[rowOf(h)]; }
+    UnitName type(UnitHandle h) const { return _type[rowOf(h)]; }
+    int& hp(UnitHandle h) { return _hp[rowOf(h)]; }
+    int& moves(UnitHandle h) { return _moves[rowOf(h)]; }
+    UnitState& state(UnitHandle h) { return _state[rowOf(h)]; }
+    int& listIndex(UnitHandle h) { return _listIndex[rowOf(h)]; }
+    bool hasFlag(UnitHandle h, Flag flag) const { return (_flags[rowOf(h)] & flag) != 0; }
+    void setFlag(UnitHandle h, Flag flag, bool on);
+    void setPos(UnitHandle h, const Hex& pos); // 同步更新坐标索引
+
+    int owner(UnitHandle h) const { return _owner[rowOf(h)]; }
+    Hex pos(UnitHandle h) const { return _pos[rowOf(h)]; }
+    int hp(UnitHandle h) const { return _hp[rowOf(h)]; }
+    int moves(UnitHandle h) const { return _moves[rowOf(h)]; }
+    UnitState state(UnitHandle h) const { return _state[rowOf(h)]; }
+
+    // ==========================================
+    // 3. 线性扫描
+    // ==========================================
+    int size() const { return (int)_view.size(); }
+
+    /**
+     * @brief 回合开始：为指定玩家的单位恢复移动力、按需回血
+     * @param isInCity 判断坐标是否在城市中（城市中回血更多），可为空
+     * @param healed 输出实际回血的单位及回血量，供表现层播放飘字
+     */
+    void beginTurn(int ownerId, const std::function<bool(Hex)>& isInCity,
+                   FrameVector<std::pair<AbstractUnit*, int>>& healed);
+
+    // 统计指定玩家在场存活的军队 / 指定类型单位数量
+    int countMilitary(int ownerId) const;
+    int countOfType(int ownerId, UnitName type) const;
+
+    // 指定坐标上在场存活的单位，没有时返回 nullptr（经坐标索引 O(1) 查询）
+    AbstractUnit* findAt(const Hex& hex) const;
+
+    // 指定玩家中离 from 最近的在场存活单位，distance 输出距离
+    AbstractUnit* findNearest(int ownerId, const Hex& from, int& distance) const;
+
+    // 所有在场存活单位的坐标
+    void collectPositions(FrameVector<Hex>& out) const;
+
+private:
+    UnitStateTable() {}
+
+    bool isActiveRow(int row) const { return (_flags[row] & FLAG_IN_PLAY) && _hp[row] > 0; }
+    int rowOf(UnitHandle h) const { return _rowOf[EntityHandles::indexOf(h)]; }
+    void unindexPos(UnitHandle h, const Hex& pos);
+
+    // --- 分量数组（同一下标为同一单位）---
+    std::vector<int> _owner;
+    std::vector<UnitName> _type;
+    std::vector<Hex> _pos;
+    std::vector<int> _hp;
+    std::vector<int> _moves;
+    std::vector<UnitState> _state;
+    std::vector<uint8_t> _flags;
+    std::vector<int> _listIndex;        // 在所属玩家单位列表中的下标
+    std::vector<AbstractUnit*> _view;   // 表现层节点
+    std::vector<UnitHandle> _handleOf;  // 行号 -> 句柄
+
+    // --- 句柄间接表 ---
+    std::vector<int> _rowOf;            // 槽位 -> 行号（空闲槽为 -1）
+    std::vector<uint32_t> _generation;  // 槽位代数
+    std::vector<uint32_t> _freeSlots;
+
+    // --- 坐标索引（同一格可能暂时叠放多个单位）---
+    std::unordered_multimap<Hex, UnitHandle> _byHex;
+};
+
+#endif // __UNIT_STATE_TABLE_H__
@@ -5,121 +5,49 @@
 
 /**
  * @file Builder.h
- * @brief ˵λ
+ * @brief 建筑工人单位类
  * 
- * һ乤λ
- * רڸؿͽʩ
+ * 建筑工人是一种民间工作单位
+ * 专门用于改良地块和建造基础设施
  */
 
 /**
  * @class Builder
- * @brief ˵λ
+ * @brief 建筑工人单位
  * 
- * ˵ص㣺
- * - Ϊ0޷ս
- * - Ըؿ飨ũɽ·ȣ
- * - ֵ100
- * - ƶ2/غ
- * - ܽУ߲ܽǣ
+ * 建筑工人的特点：
+ * - 攻击力为0，无法进行战斗
+ * - 可以改良地块（农田、矿山、道路等）
+ * - 生命值100
+ * - 移动力2格/回合
+ * - 不能建立城市（定居者才能建城）
  * 
- * 붨ߵ
- * - SettlerߣУһ
- * - Builderˣؿ飬ظʹ
+ * 与定居者的区别：
+ * - Settler（定居者）：建立城市，一次性消耗
+ * - Builder（建筑工人）：改良地块，可重复使用
  */
 class Builder : public AbstractUnit {
 public:
 
-    Builder() { cost = 50; purchaseCost = 200; }
+    Builder() : AbstractUnit(UnitName::BUILDER) {}
 
     /**
-     * @brief ȡλ
-     * @return 
-     */
-    std::string getUnitName() const override { 
-        return "Builder"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return 䵥λ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::CIVILIAN; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/builder.png"; 
-    }
-
-    int getCost() const {
-        return 200;
-    }
-
-    int getMaintenanceCost() const override {
-        return 0;
-	}
-
-    int getProductionCost() const {
-        return 50;
-    }
-
-    bool ismilitary() const override {
-        return false;
-	}
-
-    /**
-     * @brief ȡֵ
-     * @return 100 ֵ
-     */
-    int getMaxHp() const override { 
-        return 100; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 0ս
-     */
-    int getBaseAttack() const override { 
-        return 0; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 0޷
-     */
-    int getAttackRange() const override { 
-        return 0; 
-    }
-
-    /**
-     * @brief Ƿܸؿ
-     * @return true˿Ըؿ飩
+     * @brief 检查是否能改良地块
+     * @return true（建筑工人可以改良地块）
      * 
-     * ˿Խ¸
-     * - ũʳ
-     * - ɽ
-     * - ·ӿƶٶȣ
-     * - £
+     * 建筑工人可以进行以下改良：
+     * - 建造农田（提升食物产出）
+     * - 建造矿山（提升生产力）
+     * - 建造道路（加快移动速度）
+     * - 建造防御工事（防守提升）
      * 
-     * @note  AbstractUnit 麯 canBuildImprovements()
+     * @note 建议在 AbstractUnit 中添加虚函数 canBuildImprovements()
      */
     bool canBuildImprovements() const { 
         return true; 
     }
 
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Builder);
 };
 
@@ -5,93 +5,20 @@
 
 /**
  * @class Settler
- * @brief ߵλ
+ * @brief 定居者单位
  * 
- * ߵص㣺
- * - Ϊ0޷ս
- * - Խ
- * - ֵ100
- * - ƶ2/غ
+ * 定居者的特点：
+ * - 攻击力为0，无法进行战斗
+ * - 可以建立城市
+ * - 生命值100
+ * - 移动力2格/回合
  */
 class Settler : public AbstractUnit {
 public:
 
-    using AbstractUnit::AbstractUnit;
+    Settler() : AbstractUnit(UnitName::SETTLER) {}
 
-    Settler() { cost = 80; purchaseCost = 400; }
-
-    /**
-     * @brief ȡλ
-     * @return 
-     */
-    std::string getUnitName() const override {
-        return "Settler"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return 䵥λ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::CIVILIAN;
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/settler.png"; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 0;
-    }
-
-    bool ismilitary() const override {
-        return false;
-    }
-    /**
-     * @brief ȡֵ
-     * @return 100 ֵ
-     */
-    int getMaxHp() const override {
-        return 100; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 0޷
-     */
-    int getBaseAttack() const override { 
-        return 0; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2;
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 0޷
-     */
-    int getAttackRange() const override {
-        return 0; 
-    }
-
-    /**
-     * @brief Ƿܽ
-     * @return true߿Խǣ
-     */
-    bool canFoundCity() const override {
-        return true; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Settler);
 };
 
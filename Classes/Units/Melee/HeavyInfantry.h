@@ -16,7 +16,7 @@
 //    }
 //
 //    virtual std::string getUnitName() override {
-//        return "Ƥʿ";
+//        return "皮甲勇士";
 //    }
 //
 //    virtual int getBaseAttack() override {
@@ -5,108 +5,35 @@
 
 /**
  * @file LineInfantry.h
- * @brief бλ
+ * @brief 列兵单位类
  * 
- * бһִսµλ
- * иǿֵ͹սʿӼ
+ * 列兵是一种现代近战军事单位
+ * 具有更强的生命值和攻击力，相比战士更加坚韧
  */
 
 /**
  * @class LineInfantry
- * @brief бλ
+ * @brief 列兵单位
  * 
- * бص㣺
- * - Ϊ40ǿĽս˺
- * - ֵ200
- * - ƶ2/غ
- * - ΧΪ1սڹ
- * - ܽ
+ * 列兵的特点：
+ * - 攻击力为40（强大的近战伤害）
+ * - 生命值200（优秀的生存能力）
+ * - 移动力2格/回合
+ * - 攻击范围为1（仅近战相邻攻击）
+ * - 不能建立城市
  * 
- * սʿ
- * - Warriorսʿ20ֵ100ڵλ
- * - LineInfantryб40ֵ200ڵλ
+ * 与战士的区别：
+ * - Warrior（战士）：攻击力20，生命值100（早期单位）
+ * - LineInfantry（列兵）：攻击力40，生命值200（中期单位）
  * 
- * бսʿĽװ汾ʺΪ
+ * 列兵是战士的进阶版本，适合作为主力防线
  */
 class LineInfantry : public AbstractUnit {
 public:
 
-    LineInfantry() : AbstractUnit() { cost = 60; purchaseCost = 600; prereqTechID = 12;} // ǰÿƼѧͽ(ID 12)
+    LineInfantry() : AbstractUnit(UnitName::LINE_INFANTRY) {}
 
-    /**
-     * @brief ȡλ
-     * @return б
-     */
-    std::string getUnitName() const override { 
-        return "LineInfantry"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return սµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::MELEE; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 3;
-	}
-
-    bool ismilitary() const override {
-        return true;
-    }
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     * 
-     * @note ԭļΪ "lneInfantry.png"ƴд
-     *       Դļеʵļ
-     */
-    std::string getSpritePath() const override { 
-        return "units/lneInfantry.png"; 
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 200 ֵսʿ2
-     * 
-     * бķ
-     */
-    int getMaxHp() const override { 
-        return 200; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 40бǿĽս˺
-     * 
-     * бĹսʿ2
-     * ڽս˺
-     */
-    int getBaseAttack() const override { 
-        return 40; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 1սܹڸӣ
-     * 
-     * бǽսλֻܹڵĵ
-     */
-    int getAttackRange() const override { 
-        return 1; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(LineInfantry);
 };
 
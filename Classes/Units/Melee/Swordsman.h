@@ -5,107 +5,35 @@
 
 /**
  * @file Swordsman.h
- * @brief ʿλ
+ * @brief 剑士单位类
  * 
- * ʿһֹŴսµλ
- * оĹֵڵڵλ
+ * 剑士是一种古代近战军事单位
+ * 具有均衡的攻击力和生命值，是早期到中期的主力单位
  */
 
 /**
  * @class Swordsman
- * @brief ʿλ
+ * @brief 剑士单位
  * 
- * ʿص㣺
- * - Ϊ30еȵĽս˺
- * - ֵ150õ
- * - ƶ2/غ
- * - ΧΪ1սڹ
- * - ܽ
+ * 剑士的特点：
+ * - 攻击力为30（中等的近战伤害）
+ * - 生命值150（良好的生存能力）
+ * - 移动力2格/回合
+ * - 攻击范围为1（仅近战相邻攻击）
+ * - 不能建立城市
  * 
- * սλĶԱȣ
- * - Warriorսʿ20ֵ100
- * - Swordsmanʿ30ֵ150м⣩
- * - LineInfantryб40ֵ200߼̣
+ * 与其他近战单位的对比：
+ * - Warrior（战士）：攻击力20，生命值100（最初级）
+ * - Swordsman（剑士）：攻击力30，生命值150（中级，均衡）
+ * - LineInfantry（列兵）：攻击力40，生命值200（高级，坚固）
  * 
- * ʿսʿ汾ṩ˸õƽ
+ * 剑士是战士的升级版本，提供了更好的生存能力和输出平衡
  */
 class Swordsman : public AbstractUnit {
 public:
-    Swordsman() : AbstractUnit() { cost = 40; purchaseCost = 500; prereqTechID = 7; } // ǰÿƼ(ID 7)
+    Swordsman() : AbstractUnit(UnitName::SWORDSMAN) {}
 
-    /**
-     * @brief ȡλ
-     * @return ʿ
-     */
-    std::string getUnitName() const override { 
-        return "Swordsman"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return սµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::MELEE; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 2;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-
-    std::string getSpritePath() const override { 
-        return "units/swordsman.png"; 
-    }
-    
-    /**
-     * @brief ȡֵ
-     * @return 150 ֵ
-     * 
-     * ʿֵսʿб֮
-     * ṩķ
-     */
-    int getMaxHp() const override { 
-        return 150; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 30ʿƽĽս˺
-     * 
-     * ʿĹսʿб֮
-     * ṩȶ
-     */
-    int getBaseAttack() const override { 
-        return 30; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 1սܹڸӣ
-     * 
-     * ʿǽսλֻܹڵĵ
-     */
-    int getAttackRange() const override { 
-        return 1; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Swordsman);
 };
 
@@ -5,84 +5,21 @@
 
 /**
  * @class Warrior
- * @brief սʿλսλ
+ * @brief 战士单位（近战单位）
  * 
- * սʿص㣺
- * - Ϊ20
- * - ֵ100
- * - ƶ2/غ
- * - ΧΪ1ս
- * - ܽ
+ * 战士的特点：
+ * - 攻击力为20
+ * - 生命值100
+ * - 移动力2格/回合
+ * - 攻击范围为1（仅近战）
+ * - 不能建立城市
  */
 class Warrior : public AbstractUnit {
 public:
 
-    Warrior() { cost = 30; purchaseCost = 200; }
+    Warrior() : AbstractUnit(UnitName::WARRIOR) {}
 
-    /**
-     * @brief ȡλ
-     * @return սʿ
-     */
-    std::string getUnitName() const override { 
-        return "Warrior"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return սµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::MELEE; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 1;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/warrior.png"; 
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 100 ֵ
-     */
-    int getMaxHp() const override { 
-        return 100; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 20սʿǿĹ
-     */
-    int getBaseAttack() const override { 
-        return 20; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 1սɴ
-     */
-    int getAttackRange() const override { 
-        return 1; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Warrior);
 };
 
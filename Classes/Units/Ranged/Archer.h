@@ -5,85 +5,21 @@
 
 /**
  * @class Archer
- * @brief ֵλԶ̾µλ
+ * @brief 弓箭手单位（远程军事单位）
  * 
- * ֵص㣺
- * - Ϊ15
- * - ֵ80
- * - ƶ2/غ
- * - ΧΪ2Զ̣
- * - ܽ
+ * 弓箭手的特点：
+ * - 攻击力为15
+ * - 生命值80
+ * - 移动力2格/回合
+ * - 攻击范围为2（远程）
+ * - 不能建立城市
  */
 class Archer : public AbstractUnit {
 public:
 
-    Archer() : AbstractUnit() { cost = 30; purchaseCost = 400; prereqTechID = 3; } // ǰÿƼ(ID 3)
+    Archer() : AbstractUnit(UnitName::ARCHER) {}
 
-    /**
-     * @brief ȡλ
-     * @return 
-     */
-    std::string getUnitName() const override { 
-        return "Archer"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return Զ̾µλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::RANGED; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/archer.png"; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 2;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 80 ֵ
-     */
-    int getMaxHp() const override { 
-        return 80; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 15ֵԶ̹
-     */
-    int getBaseAttack() const override { 
-        return 15; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 2Զ̿ɴ
-     */
-    int getAttackRange() const override { 
-        return 2; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Archer);
 };
 
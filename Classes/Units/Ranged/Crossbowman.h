@@ -5,110 +5,37 @@
 
 /**
  * @file Crossbowman.h
- * @brief ֵλ
+ * @brief 弩手单位类
  * 
- * һԶ̾µλ
- * иǿĹֵڹֺͻǹ֮
+ * 弩手是一种中世纪远程军事单位
+ * 具有更强的攻击力和生命值，介于弓箭手和火枪手之间
  */
 
 /**
  * @class Crossbowman
- * @brief ֵλ
+ * @brief 弩手单位
  * 
- * ֵص㣺
- * - Ϊ35еԶ˺
- * - ֵ150
- * - ƶ2/غ
- * - ΧΪ2о
- * - ܽ
+ * 弩手的特点：
+ * - 攻击力为35（中等远程伤害）
+ * - 生命值150
+ * - 移动力2格/回合
+ * - 攻击范围为2（中距离射击）
+ * - 不能建立城市
  * 
- * Զ̵λĶԱȣ
- * - Archer֣15ֵ80Զ̣
- * - Crossbowman֣35ֵ150Զ̣
- * - Musketeersǹ֣60ֵ200Զ̣
+ * 与其他远程单位的对比：
+ * - Archer（弓箭手）：攻击力15，生命值80（早期远程）
+ * - Crossbowman（弩手）：攻击力35，生命值150（中期远程）
+ * - Musketeers（火枪手）：攻击力60，生命值200（晚期远程）
  * 
- * Զ̵λ汾
- * ṩȹָǿĻͷ
+ * 弩手是远程单位的中期升级版本
+ * 提供比弓箭手更强的火力和防御能力
  */
 class Crossbowman : public AbstractUnit {
 public:
 
-    Crossbowman() : AbstractUnit() { cost = 50; purchaseCost = 500; prereqTechID = 11; } // ǰÿƼе(ID 11)
+    Crossbowman() : AbstractUnit(UnitName::CROSSBOWMAN) {}
 
-    /**
-     * @brief ȡλ
-     * @return 
-     */
-    std::string getUnitName() const override { 
-        return "Crossbowman"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return Զ̾µλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::RANGED; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/crossbowman.png"; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 4;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 150 ֵ
-     * 
-     * ȹֵ50%
-     * Ȼǹֵ25%
-     */
-    int getMaxHp() const override { 
-        return 150; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 35еԶ˺
-     * 
-     * ֵĹǹֵ2.33
-     * ǹֵ60㹥
-     */
-    int getBaseAttack() const override { 
-        return 35; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 2оΧ
-     * 
-     * 빭ͬ2
-     * ǿ
-     */
-    int getAttackRange() const override { 
-        return 2; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Crossbowman);
 };
 
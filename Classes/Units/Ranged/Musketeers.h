@@ -5,108 +5,36 @@
 
 /**
  * @file Musketeers.h
- * @brief ǹֵλ
+ * @brief 火枪手单位类
  * 
- * ǹһִԶ̾µλ
- * и߹Զ̵ƽ
+ * 火枪手是一种现代远程军事单位
+ * 具有高攻击力和远程射程的平衡特性
  */
 
 /**
  * @class Musketeers
- * @brief ǹֵλ
+ * @brief 火枪手单位
  * 
- * ǹֵص㣺
- * - Ϊ60Զ̵λеǿ˺
- * - ֵ200
- * - ƶ2/غ
- * - ΧΪ2о
- * - ܽ
+ * 火枪手的特点：
+ * - 攻击力为60（远程单位中的强大伤害）
+ * - 生命值200
+ * - 移动力2格/回合
+ * - 攻击范围为2（中距离射击）
+ * - 不能建立城市
  * 
- * Զ̵λĶԱȣ
- * - Archer֣152Զ̣
- * - Crossbowman֣352Զ̣
- * - Musketeersǹ֣602Զ̣ǿ
+ * 与其他远程单位的对比：
+ * - Archer（弓箭手）：攻击力15，射程2（早期远程）
+ * - Crossbowman（弩手）：攻击力35，射程2（中期远程）
+ * - Musketeers（火枪手）：攻击力60，射程2（晚期远程，强火力）
  * 
- * ǹԶ̵λռ̬ṩǿԶ̻֧Ԯ
+ * 火枪手是远程单位的终极形态，提供最强大的远程火力支援
  */
 class Musketeers : public AbstractUnit {
 public:
 
-    Musketeers() : AbstractUnit() { cost = 80; purchaseCost = 600; prereqTechID = 14; } // ǰÿƼҩ(ID 14)
+    Musketeers() : AbstractUnit(UnitName::MUSKETEERS) {}
 
-    /**
-     * @brief ȡλ
-     * @return ǹ
-     */
-    std::string getUnitName() const override { 
-        return "Musketeers"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return Զ̾µλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::RANGED; 
-    }
-
-    int getMaintenanceCost() const override {
-        return 5;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/musketeers.png"; 
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 200 ֵ
-     * 
-     * ǹ־в
-     */
-    int getMaxHp() const override { 
-        return 200; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 60Զ̻ǹǿ
-     * 
-     * ע⣺ڴ˼򻯿УgetBaseAttack() ָԶ̵λҪ˺ֶ
-     * ǹֵĽսԶ̻ǿ
-     */
-    int getBaseAttack() const override { 
-        return 60; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 2 /غ
-     */
-    int getMaxMoves() const override { 
-        return 2; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 2ǹоΧ
-     * 
-     * ǹֿԸһӽ
-     * ȹ֣ǿͬ
-     */
-    int getAttackRange() const override { 
-        return 2; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Musketeers);
 };
 
@@ -6,43 +6,7 @@
 class Cannon : public AbstractUnit {
 public:
 
-    Cannon() : AbstractUnit() { cost = 50; purchaseCost = 400; prereqTechID = 14; } // ǰÿƼҩ(ID 14)
-
-    std::string getUnitName() const override { 
-        return "Cannon"; 
-    }
-    UnitType getUnitType() const override { 
-        return UnitType::SIEGE;
-    }
-    std::string getSpritePath() const override { 
-        return "units/cannon.png"; 
-    }
-    
-    int getMaintenanceCost() const override {
-        return 4;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-
-    int getMaxHp() const override {
-        return 160; 
-    }      // еȽϴ
-    int getBaseAttack() const override { 
-        return 90; 
-    } // ܸ
-    int getMaxMoves() const override { 
-        return 2;
-    }    // ƶ
-    int getAttackRange() const override { 
-        return 3; 
-    } //  2 
-
-    // ǵλͨƶ (ǻĬֵ)
-    bool canMoveAfterAttack() const override { 
-        return false; 
-    }
+    Cannon() : AbstractUnit(UnitName::CANNON) {}
 
     CREATE_FUNC(Cannon);
 };
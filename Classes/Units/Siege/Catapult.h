@@ -5,85 +5,21 @@
 
 /**
  * @class Catapult
- * @brief 󳵵λǾµλ
+ * @brief 弩车单位（攻城军事单位）
  * 
- * 󳵵ص㣺
- * - Ϊ25ػ
- * - ֵ60
- * - ƶ1/غϣأ
- * - ΧΪ3Զڻ
- * - ܽ
+ * 弩车的特点：
+ * - 攻击力为25（攻城特化）
+ * - 生命值60（脆弱）
+ * - 移动力1格/回合（笨重）
+ * - 攻击范围为3（远程炮击）
+ * - 不能建立城市
  */
 class Catapult : public AbstractUnit {
 public:
 
-    Catapult() : AbstractUnit() { cost = 30; purchaseCost = 200; prereqTechID = 8; } // ǰÿƼѧ(ID 8)
+    Catapult() : AbstractUnit(UnitName::CATAPULT) {}
 
-    /**
-     * @brief ȡλ
-     * @return 
-     */
-    std::string getUnitName() const override { 
-        return "Catapult"; 
-    }
-
-    /**
-     * @brief ȡλ
-     * @return Ǿµλ
-     */
-    UnitType getUnitType() const override { 
-        return UnitType::SIEGE; 
-    }
-
-    /**
-     * @brief ȡλͼƬ·
-     * @return ͼƬļ·
-     */
-    std::string getSpritePath() const override { 
-        return "units/catapult.png"; 
-    }
-    
-    int getMaintenanceCost() const override {
-        return 2;
-    }
-
-    bool ismilitary() const override {
-        return true;
-    }
-
-    /**
-     * @brief ȡֵ
-     * @return 60 ֵ
-     */
-    int getMaxHp() const override { 
-        return 60; 
-    }
-
-    /**
-     * @brief ȡ
-     * @return 25󳵵ǿ󹥳
-     */
-    int getBaseAttack() const override { 
-        return 25; 
-    }
-
-    /**
-     * @brief ȡƶ
-     * @return 1 /غϣƶ
-     */
-    int getMaxMoves() const override { 
-        return 1; 
-    }
-
-    /**
-     * @brief ȡΧ
-     * @return 3ڻ
-     */
-    int getAttackRange() const override { 
-        return 3; 
-    }
-
-    // Cocos2d-x ׼꣬Զʵ create() 
+    // Cocos2d-x 标准宏，自动实现 create() 工厂函数
     CREATE_FUNC(Catapult);
 };
 
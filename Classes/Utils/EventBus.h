@@ -0,0 +1,238 @@
+#ifndef __EVENT_BUS_H__
+#define __EVENT_BUS_H__
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <type_traits>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief 类型化游戏事件总线
+ *
+ * 事件是 POD 结构体，监听器按事件类型注册，派发时无需字符串查找和 ValueMap 装箱。
+ * 三种发布方式：
+ * 1. publish          立即同步派发（游戏逻辑依赖的事件，如科技激活）
+ * 2. publishDeferred  进入延迟队列，dispatchDeferred 时按顺序派发
+ * 3. publishCoalesced 按 key 合并，同一帧内只保留最新一次（如 HUD 资源快照）
+ *
+ * 队列缓冲区在派发后只清空不释放，稳定运行后发布不产生堆分配。
+ * 仅在游戏主线程使用。
+ */
+class EventBus {
+public:
+    using ListenerId = int;
+
+    /**
+     * @brief 获取事件总线单例
+     */
+    static EventBus* getInstance() {
+        static EventBus instance;
+        return &instance;
+    }
+
+    /**
+     * @brief 注册某类事件的监听器
+     * @return 监听器ID，用于注销
+     */
+    template <typename E>
+    ListenerId subscribe(std::function<void(const E&)> callback) {
+        ListenerId id = ++_nextListenerId;
+        getChannel<E>().add(id, std::move(callback));
+        return id;
+    }
+
+    /**
+     * @brief 注销监听器（派发过程中注销是安全的）
+     */
+    template <typename E>
+    void unsubscribe(ListenerId id) {
+        if (id > 0) {
+            getChannel<E>().remove(id);
+        }
+    }
+
+    /**
+     * @brief 立即派发事件
+     */
+    template <typename E>
+    void publish(const E& event) {
+        _publishCount++;
+        getChannel<E>().dispatch(event);
+    }
+
+    /**
+     * @brief 将事件放入延迟队列，在下一次 dispatchDeferred 时派发
+     */
+    template <typename E>
+    void publishDeferred(const E& event) {
+        _publishCount++;
+        getChannel<E>().deferred.push_back(event);
+    }
+
+    /**
+     * @brief 发布可合并事件：同一 key 在派发前只保留最后一次
+     * @param key 合并键（如玩家ID）
+     */
+    template <typename E>
+    void publishCoalesced(std::intptr_t key, const E& event) {
+        _publishCount++;
+        auto& channel = getChannel<E>();
+        for (auto& pending : channel.coalesced) {
+            if (pending.first == key) {
+                pending.second = event;
+                return;
+            }
+        }
+        channel.coalesced.emplace_back(key, event);
+    }
+
+    /**
+     * @brief 派发所有延迟事件与合并事件（每帧调用一次）
+     */
+    void dispatchDeferred() {
+        // 用下标遍历：监听器中首次发布新类型事件会扩容 _channels
+        for (size_t i = 0; i < _channels.size(); ++i) {
+            if (_channels[i]) {
+                _channels[i]->flush();
+            }
+        }
+    }
+
+    /**
+     * @brief 累计发布的事件数量（用于性能统计）
+     */
+    unsigned long long getPublishCount() const { return _publishCount; }
+
+private:
+    EventBus() : _nextListenerId(0), _publishCount(0) {}
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    struct ChannelBase {
+        virtual ~ChannelBase() {}
+        virtual void flush() = 0;
+    };
+
+    template <typename E>
+    struct Channel : public ChannelBase {
+        static_assert(std::is_trivially_copyable<E>::value, "EventBus events must be POD structs");
+
+        struct Listener {
+            ListenerId id;
+            std::function<void(const E&)> callback;
+            bool removed;       // 派发中被注销，等派发结束后再删除
+        };
+
+        std::vector<Listener> listeners;
+        std::vector<Listener> added;        // 派发过程中新注册的监听器，派发结束后合并
+        std::vector<E> deferred;
+        std::vector<E> dispatching;
+        std::vector<std::pair<std::intptr_t, E>> coalesced;
+        std::vector<std::pair<std::intptr_t, E>> coalescedDispatching;
+        int depth = 0;
+        bool needsCompact = false;
+
+        void add(ListenerId id, std::function<void(const E&)> callback) {
+            if (depth > 0) {
+                added.push_back({ id, std::move(callback), false });
+            }
+            else {
+                listeners.push_back({ id, std::move(callback), false });
+            }
+        }
+
+        void remove(ListenerId id) {
+            for (auto it = added.begin(); it != added.end(); ++it) {
+                if (it->id == id) {
+                    added.erase(it);
+                    return;
+                }
+            }
+            for (auto it = listeners.begin(); it != listeners.end(); ++it) {
+                if (it->id == id) {
+                    if (depth > 0) {
+                        // 派发中只做标记：既不破坏正在遍历的数组，
+                        // 也不能销毁 callback（监听器可能正在自己的回调里注销自己）
+                        it->removed = true;
+                        needsCompact = true;
+                    }
+                    else {
+                        listeners.erase(it);
+                    }
+                    return;
+                }
+            }
+        }
+
+        void dispatch(const E& event) {
+            depth++;
+            for (size_t i = 0; i < listeners.size(); ++i) {
+                if (!listeners[i].removed) {
+                    listeners[i].callback(event);
+                }
+            }
+            depth--;
+
+            if (depth == 0) {
+                if (needsCompact) {
+                    std::vector<Listener> alive;
+                    alive.reserve(listeners.size());
+                    for (auto& listener : listeners) {
+                        if (!listener.removed) alive.push_back(std::move(listener));
+                    }
+                    listeners.swap(alive);
+                    needsCompact = false;
+                }
+                if (!added.empty()) {
+                    for (auto& listener : added) listeners.push_back(std::move(listener));
+                    added.clear();
+                }
+            }
+        }
+
+        virtual void flush() override {
+            if (!deferred.empty()) {
+                dispatching.swap(deferred);
+                for (const auto& event : dispatching) dispatch(event);
+                dispatching.clear();
+            }
+            if (!coalesced.empty()) {
+                coalescedDispatching.swap(coalesced);
+                for (const auto& pending : coalescedDispatching) dispatch(pending.second);
+                coalescedDispatching.clear();
+            }
+        }
+    };
+
+    // 每种事件类型分配一个连续的下标
+    static int nextTypeIndex() {
+        static int counter = 0;
+        return counter++;
+    }
+
+    template <typename E>
+    static int typeIndex() {
+        static const int index = nextTypeIndex();
+        return index;
+    }
+
+    template <typename E>
+    Channel<E>& getChannel() {
+        int index = typeIndex<E>();
+        if (index >= (int)_channels.size()) {
+            _channels.resize(index + 1);
+        }
+        if (!_channels[index]) {
+            _channels[index].reset(new Channel<E>());
+        }
+        return *static_cast<Channel<E>*>(_channels[index].get());
+    }
+
+    std::vector<std::unique_ptr<ChannelBase>> _channels;
+    ListenerId _nextListenerId;
+    unsigned long long _publishCount;
+};
+
+#endif // __EVENT_BUS_H__
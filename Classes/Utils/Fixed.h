@@ -0,0 +1,89 @@
+#ifndef __FIXED_H__
+#define __FIXED_H__
+
+#include <cstdint>
+
+/**
+ * @class Fixed
+ * @brief 规则运算用的十进制定点数
+ *
+ * 以 1/10000 为最小单位存放在 int32 中（4 位小数），百分比加成、文明系数、
+ * 尤里卡比例等十进制常数都能精确表示。乘除法使用 int64 中间值，
+ * 结果一律向零取整，与原先 static_cast<int>(value * factor) 的截断方向一致。
+ *
+ * 全程不经过浮点，同样的输入在任何编译器、优化级别和平台上逐位一致，
+ * 产出、战斗与研究进度的结算因此可以回放，也可以与串行结果逐位比对。
+ * toFloat 只用于界面显示，不得回流到规则运算。
+ */
+class Fixed {
+public:
+    static const int32_t kScale = 10000;
+
+    constexpr Fixed() : _raw(0) {}
+
+    static constexpr Fixed fromRaw(int32_t raw) { return Fixed(raw, 0); }
+    static constexpr Fixed fromInt(int value) { return Fixed(value * kScale, 0); }
+    // 百分比：percent(115) 即 1.15
+    static constexpr Fixed percent(int pct) { return Fixed(pct * (kScale / 100), 0); }
+    // 有理数 num / den，向零取整到 1/10000
+    static constexpr Fixed ratio(int64_t num, int64_t den) { return Fixed((int32_t)(num * kScale / den), 0); }
+    static constexpr Fixed one() { return Fixed(kScale, 0); }
+
+    constexpr int32_t raw() const { return _raw; }
+    // 向零取整
+    constexpr int toInt() const { return _raw / kScale; }
+    float toFloat() const { return (float)_raw / kScale; }
+
+    // 整数乘以系数后向零取整：Fixed::percent(115).mulInt(100) == 115
+    constexpr int mulInt(int value) const { return (int)((int64_t)value * _raw / kScale); }
+
+    constexpr Fixed operator+(Fixed other) const { return Fixed(_raw + other._raw, 0); }
+    constexpr Fixed operator-(Fixed other) const { return Fixed(_raw - other._raw, 0); }
+    constexpr Fixed operator-() const { return Fixed(-_raw, 0); }
+    constexpr Fixed operator*(Fixed other) const { return Fixed((int32_t)((int64_t)_raw * other._raw / kScale), 0); }
+    constexpr Fixed operator/(Fixed other) const { return Fixed((int32_t)((int64_t)_raw * kScale / other._raw), 0); }
+    constexpr Fixed operator*(int value) const { return Fixed((int32_t)((int64_t)_raw * value), 0); }
+    constexpr Fixed operator/(int value) const { return Fixed(_raw / value, 0); }
+
+    Fixed& operator+=(Fixed other) { _raw += other._raw; return *this; }
+    Fixed& operator-=(Fixed other) { _raw -= other._raw; return *this; }
+    Fixed& operator*=(Fixed other) { return *this = *this * other; }
+
+    constexpr bool operator==(Fixed other) const { return _raw == other._raw; }
+    constexpr bool operator!=(Fixed other) const { return _raw != other._raw; }
+    constexpr bool operator<(Fixed other) const { return _raw < other._raw; }
+    constexpr bool operator<=(Fixed other) const { return _raw <= other._raw; }
+    constexpr bool operator>(Fixed other) const { return _raw > other._raw; }
+    constexpr bool operator>=(Fixed other) const { return _raw >= other._raw; }
+
+    /**
+     * @brief 平方根（向下取整到 1/10000），负数返回 0
+     * 逐位开方，只用整数运算
+     */
+    Fixed sqrt() const {
+        if (_raw <= 0) return Fixed();
+        // sqrt(raw / S) * S == sqrt(raw * S)
+        uint64_t n = (uint64_t)_raw * kScale;
+        uint64_t root = 0;
+        uint64_t bit = (uint64_t)1 << 62;
+        while (bit > n) bit >>= 2;
+        while (bit != 0) {
+            if (n >= root + bit) {
+                n -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return fromRaw((int32_t)root);
+    }
+
+private:
+    constexpr Fixed(int32_t raw, int) : _raw(raw) {}
+
+    int32_t _raw;
+};
+
+#endif // __FIXED_H__
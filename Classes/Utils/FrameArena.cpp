@@ -0,0 +1,161 @@
+#include "FrameArena.h"
+#include "GameLog.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    // 初始块大小，普通回合的临时数据都能放进一块
+    const size_t kInitialBlockSize = 256 * 1024;
+}
+
+FrameArena* FrameArena::getInstance() {
+    static FrameArena instance;
+    return &instance;
+}
+
+FrameArena::FrameArena()
+    : _current(0)
+    , _offset(0)
+    , _usedBefore(0)
+    , _peakBytes(0)
+    , _liveAllocations(0)
+    , _innermost(nullptr)
+    , _allocationsThisTurn(0)
+    , _allocationsLastTurn(0) {
+    _blocks.push_back({ new char[kInitialBlockSize], kInitialBlockSize });
+}
+
+FrameArena::~FrameArena() {
+    for (auto& block : _blocks)
+        delete[] block.data;
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    Block* block = &_blocks[_current];
+    uintptr_t base = reinterpret_cast<uintptr_t>(block->data);
+    uintptr_t aligned = (base + _offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+    if (aligned + bytes > base + block->size) {
+        nextBlock(bytes + alignment);
+        block = &_blocks[_current];
+        base = reinterpret_cast<uintptr_t>(block->data);
+        aligned = (base + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    }
+
+    _offset = aligned + bytes - base;
+    _liveAllocations++;
+    _allocationsThisTurn++;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::deallocate(void* ptr, size_t bytes) {
+    _liveAllocations--;
+
+    // 位于标记之前的分配被释放：计入每个在它之后的标记
+    // （外层标记位置更靠前，一旦不在某个标记之前，也就不在更外层标记之前）
+    for (Marker* marker = _innermost; marker && isBefore(ptr, *marker); marker = marker->outer)
+        marker->freedBefore++;
+
+    // 释放的恰好是最近一次分配（如 vector 扩容丢弃的旧缓冲）时直接退回指针，
+    // 但不退到最内层标记之前，保证标记之后的分配都位于标记之后
+    char* top = _blocks[_current].data + _offset;
+    if (static_cast<char*>(ptr) + bytes == top) {
+        bool belowMarker = _innermost && _innermost->block == _current && _offset - bytes < _innermost->offset;
+        if (!belowMarker)
+            _offset -= bytes;
+    }
+}
+
+bool FrameArena::isBefore(const void* ptr, const Marker& marker) const {
+    const char* p = static_cast<const char*>(ptr);
+    for (size_t i = 0; i <= marker.block && i < _blocks.size(); i++) {
+        const Block& block = _blocks[i];
+        if (p >= block.data && p < block.data + block.size)
+            return i < marker.block || p < block.data + marker.offset;
+    }
+    return false;
+}
+
+void FrameArena::nextBlock(size_t minBytes) {
+    _usedBefore += _offset;
+    _offset = 0;
+
+    // 复用之后已有的块，放不下时在当前块之后插入新块
+    if (_current + 1 < _blocks.size() && _blocks[_current + 1].size >= minBytes) {
+        _current++;
+        return;
+    }
+    size_t size = std::max(kInitialBlockSize, minBytes);
+    _blocks.insert(_blocks.begin() + _current + 1, Block{ new char[size], size });
+    _current++;
+}
+
+size_t FrameArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto& block : _blocks)
+        capacity += block.size;
+    return capacity;
+}
+
+void FrameArena::mark(Marker& marker) {
+    marker.block = _current;
+    marker.offset = _offset;
+    marker.usedBefore = _usedBefore;
+    marker.liveAllocations = _liveAllocations;
+    marker.freedBefore = 0;
+    marker.outer = _innermost;
+    _innermost = &marker;
+}
+
+bool FrameArena::rewind(Marker& marker) {
+    if (_innermost != &marker) {
+        GLOG_SEVERE(CORE, "FrameArena: rewind of a marker that is not the innermost one, rewind skipped");
+        return false;
+    }
+    _innermost = marker.outer;
+
+    // 标记之后分配、仍然存活的数量：总存活数减去标记之前仍存活的数量。
+    // 只比较总数不够：作用域外的容器在作用域内扩容时，新缓冲在标记之后、旧缓冲在标记之前，总数不变
+    int liveAfterMark = _liveAllocations - (marker.liveAllocations - marker.freedBefore);
+    if (liveAfterMark != 0) {
+        GLOG_WARNING(CORE, "FrameArena: %d allocations past the marker still alive at rewind, rewind skipped",
+            liveAfterMark);
+        return false;
+    }
+
+    _peakBytes = std::max(_peakBytes, getBytesInUse());
+    _current = marker.block;
+    _offset = marker.offset;
+    _usedBefore = marker.usedBefore;
+    return true;
+}
+
+bool FrameArena::reset() {
+    if (_liveAllocations != 0) {
+        GLOG_WARNING(CORE, "FrameArena: %d allocations still alive at turn end, reset skipped", _liveAllocations);
+        return false;
+    }
+    if (_innermost) {
+        GLOG_WARNING(CORE, "FrameArena: reset inside a FrameArenaScope, reset skipped");
+        return false;
+    }
+
+    _peakBytes = std::max(_peakBytes, getBytesInUse());
+    _allocationsLastTurn = _allocationsThisTurn;
+    _allocationsThisTurn = 0;
+
+    // 本回合跨了多块：合并成一整块，之后的回合只在一块连续内存上分配
+    if (_blocks.size() > 1) {
+        size_t capacity = getCapacity();
+        for (auto& block : _blocks)
+            delete[] block.data;
+        _blocks.clear();
+        _blocks.push_back({ new char[capacity], capacity });
+        GLOG_VERBOSE(CORE, "FrameArena: coalesced into one %u KB block", (unsigned)(capacity / 1024));
+    }
+
+    _current = 0;
+    _offset = 0;
+    _usedBefore = 0;
+    return true;
+}
@@ -0,0 +1,159 @@
+#ifndef __FRAME_ARENA_H__
+#define __FRAME_ARENA_H__
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief 回合内临时数据的线性分配器
+ *
+ * 回合结算中的邻域列表、寻路表、AI 占用集合、市民工作位等都只活到本回合结束。
+ * 这些数据从大块内存中顺序切分（只移动指针），释放时只有最近一次分配能退回，
+ * 其余内存要等 GameManager::endTurn 末尾统一 reset 才回收。
+ * 因此两次 reset 之间（一整个回合，包括玩家操作期间）的分配会一直累积；
+ * 回合外反复调用的查询（寻路、可达范围、市民分配等）应当用 FrameArenaScope
+ * 包住自己的临时容器，返回前把指针退回到进入时的位置。
+ *
+ * reset 时若本回合用到了多块内存，会合并成一块足够大的内存，
+ * 之后的回合通常只在一块连续内存上分配，不再向系统堆申请。
+ *
+ * 注意：用 Frame 容器保存的数据不能跨回合持有。reset 时仍有未释放的分配
+ * 会跳过回收并打印警告，避免留下悬空指针。仅在游戏主线程使用。
+ */
+class FrameArena {
+public:
+    static FrameArena* getInstance();
+
+    void* allocate(size_t bytes, size_t alignment);
+    void deallocate(void* ptr, size_t bytes);
+
+    // 分配位置标记，用于 rewind；嵌套的标记按后进先出串成链表
+    struct Marker {
+        size_t block;
+        size_t offset;
+        size_t usedBefore;
+        int liveAllocations;    // mark 时的存活分配数
+        int freedBefore;        // mark 之后释放的、位于标记之前的分配数
+        Marker* outer;
+    };
+
+    /**
+     * @brief 记录当前分配位置，marker 成为最内层标记，直到对它调用 rewind
+     */
+    void mark(Marker& marker);
+
+    /**
+     * @brief 退回到 mark 时的位置，回收其后的全部分配；marker 必须是最内层标记
+     * @return 标记之后仍有存活的分配时不回收、打印警告并返回 false
+     */
+    bool rewind(Marker& marker);
+
+    /**
+     * @brief 回收本回合的全部分配
+     * @return 仍有未释放的分配时不回收并返回 false
+     */
+    bool reset();
+
+    // ==================== 统计 ====================
+    size_t getBytesInUse() const { return _usedBefore + _offset; }
+    size_t getPeakBytes() const { return _peakBytes; }
+    size_t getCapacity() const;
+    int getAllocationsLastTurn() const { return _allocationsLastTurn; }
+
+private:
+    FrameArena();
+    ~FrameArena();
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    struct Block {
+        char* data;
+        size_t size;
+    };
+
+    void nextBlock(size_t minBytes);
+    bool isBefore(const void* ptr, const Marker& marker) const;
+
+    std::vector<Block> _blocks;
+    size_t _current;            // 当前分配所在的块
+    size_t _offset;             // 当前块内已用字节
+    size_t _usedBefore;         // 之前各块已用字节
+    size_t _peakBytes;          // 历史单回合最大用量
+    int _liveAllocations;       // 尚未释放的分配数
+    Marker* _innermost;         // 最内层的标记
+    int _allocationsThisTurn;
+    int _allocationsLastTurn;
+};
+
+/**
+ * @class FrameArenaScope
+ * @brief 作用域内的临时分配在离开作用域时退回
+ *
+ * 必须先于使用 FrameArena 的容器声明，保证容器先析构：
+ *     FrameArenaScope scratch;
+ *     FrameMap<Hex, int> costs;
+ *
+ * 作用域外声明的 Frame 容器不能在作用域内增长：扩容得到的新缓冲位于标记之后，
+ * 离开作用域时会被收回。出现这种情况时 rewind 会检测到标记之后仍有存活分配，
+ * 打印警告并放弃回收（内存留到回合末 reset），因此不会破坏数据，但临时内存会累积。
+ */
+class FrameArenaScope {
+public:
+    FrameArenaScope() { FrameArena::getInstance()->mark(_marker); }
+    ~FrameArenaScope() { FrameArena::getInstance()->rewind(_marker); }
+
+private:
+    FrameArenaScope(const FrameArenaScope&) = delete;
+    FrameArenaScope& operator=(const FrameArenaScope&) = delete;
+
+    FrameArena::Marker _marker;
+};
+
+/**
+ * @brief 从 FrameArena 分配内存的 STL 分配器
+ */
+template <typename T>
+class FrameAllocator {
+public:
+    typedef T value_type;
+
+    FrameAllocator() {}
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(FrameArena::getInstance()->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, size_t n) {
+        FrameArena::getInstance()->deallocate(ptr, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const FrameAllocator<T>&, const FrameAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const FrameAllocator<T>&, const FrameAllocator<U>&) { return false; }
+
+// 回合内临时容器
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+template <typename T, typename Compare = std::less<T>>
+using FrameSet = std::set<T, Compare, FrameAllocator<T>>;
+
+template <typename K, typename V, typename Compare = std::less<K>>
+using FrameMap = std::map<K, V, Compare, FrameAllocator<std::pair<const K, V>>>;
+
+template <typename T, typename Hash = std::hash<T>>
+using FrameHashSet = std::unordered_set<T, Hash, std::equal_to<T>, FrameAllocator<T>>;
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+using FrameHashMap = std::unordered_map<K, V, Hash, std::equal_to<K>, FrameAllocator<std::pair<const K, V>>>;
+
+#endif // __FRAME_ARENA_H__
@@ -0,0 +1,185 @@
+#include "GameLog.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    const char* kChannelNames[] = { "CORE", "AI", "PLAYER", "CITY", "UNIT", "MAP", "PATH" };
+    const char kLevelNames[] = { 'T', 'V', 'I', 'W', 'E' };
+
+    int64_t steadyMs() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+const size_t GameLog::kQueueSize;
+const size_t GameLog::kMessageSize;
+
+GameLog* GameLog::getInstance() {
+    static GameLog instance;
+    return &instance;
+}
+
+GameLog::GameLog()
+    : _slots(new Slot[kQueueSize])
+    , _enqueuePos(0)
+    , _dequeuePos(0)
+    , _dropped(0)
+    , _running(true) {
+    static_assert((kQueueSize & (kQueueSize - 1)) == 0, "GameLog queue size must be a power of two");
+
+    for (size_t i = 0; i < kQueueSize; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < (int)LogChannel::COUNT; ++i) {
+        _channelLevels[i].store(CIV_LOG_MIN_LEVEL, std::memory_order_relaxed);
+    }
+
+    _sink = [](const char* line) {
+        fputs(line, stdout);
+        fputc('\n', stdout);
+    };
+    _writer = std::thread(&GameLog::writerLoop, this);
+}
+
+GameLog::~GameLog() {
+    shutdown();
+}
+
+void GameLog::setChannelLevel(LogChannel channel, LogLevel level) {
+    _channelLevels[(int)channel].store((int)level, std::memory_order_relaxed);
+}
+
+void GameLog::setSink(const std::function<void(const char*)>& sink) {
+    std::lock_guard<std::mutex> lock(_sinkMutex);
+    _sink = sink;
+}
+
+// 有界多生产者队列（每个槽位带序号）：序号等于写入位置时可写，等于位置+1 时可读
+GameLog::Slot* GameLog::claimSlot() {
+    size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &_slots[pos & (kQueueSize - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return slot;
+            }
+        }
+        else if (diff < 0) {
+            return nullptr;     // 队列已满
+        }
+        else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void GameLog::publishSlot(Slot* slot) {
+    size_t pos = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+void GameLog::write(LogChannel channel, LogLevel level, int suppressed, const char* format, ...) {
+    char buffer[kMessageSize];
+    Slot* slot = nullptr;
+    char* text = buffer;
+
+    if (_running.load(std::memory_order_acquire)) {
+        slot = claimSlot();
+        if (!slot) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        text = slot->text;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, kMessageSize, format, args);
+    va_end(args);
+
+    if (suppressed > 0 && length >= 0 && (size_t)length < kMessageSize - 1) {
+        snprintf(text + length, kMessageSize - length, " (+%d suppressed)", suppressed);
+    }
+
+    if (slot) {
+        slot->channel = channel;
+        slot->level = level;
+        publishSlot(slot);
+    }
+    else {
+        // 后台线程已停止（退出阶段），同步输出
+        emit(channel, level, text);
+    }
+}
+
+void GameLog::emit(LogChannel channel, LogLevel level, const char* text) {
+    char line[kMessageSize + 32];
+    snprintf(line, sizeof(line), "[%s][%c] %s", kChannelNames[(int)channel], kLevelNames[(int)level], text);
+
+    std::lock_guard<std::mutex> lock(_sinkMutex);
+    if (_sink) _sink(line);
+}
+
+bool GameLog::drainOnce() {
+    bool wrote = false;
+    for (;;) {
+        Slot* slot = &_slots[_dequeuePos & (kQueueSize - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence != _dequeuePos + 1) {
+            break;
+        }
+
+        emit(slot->channel, slot->level, slot->text);
+        slot->sequence.store(_dequeuePos + kQueueSize, std::memory_order_release);
+        _dequeuePos++;
+        wrote = true;
+    }
+
+    unsigned int dropped = _dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        char text[64];
+        snprintf(text, sizeof(text), "log queue full, dropped %u messages", dropped);
+        emit(LogChannel::CORE, LogLevel::WARNING, text);
+        wrote = true;
+    }
+
+    if (wrote) fflush(stdout);
+    return wrote;
+}
+
+void GameLog::writerLoop() {
+    while (_running.load(std::memory_order_acquire)) {
+        if (!drainOnce()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    drainOnce();
+}
+
+void GameLog::shutdown() {
+    if (_running.exchange(false, std::memory_order_acq_rel)) {
+        if (_writer.joinable()) {
+            _writer.join();
+        }
+    }
+}
+
+bool GameLogRateLimiter::allow() {
+    int64_t now = steadyMs();
+    int64_t windowStart = _windowStartMs.load(std::memory_order_relaxed);
+    if (now - windowStart >= 1000) {
+        _windowStartMs.store(now, std::memory_order_relaxed);
+        _count.store(0, std::memory_order_relaxed);
+    }
+
+    if (_count.fetch_add(1, std::memory_order_relaxed) >= kMaxPerSecond) {
+        _suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
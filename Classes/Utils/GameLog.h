@@ -0,0 +1,158 @@
+#ifndef __GAME_LOG_H__
+#define __GAME_LOG_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief 日志级别（避开 ERROR / DEBUG 等平台宏）
+ */
+enum class LogLevel : int {
+    TRACE = 0,      // 逐单位、逐地块的细节
+    VERBOSE = 1,    // 调试信息
+    INFO = 2,       // 一般信息
+    WARNING = 3,    // 警告
+    SEVERE = 4      // 错误
+};
+
+/**
+ * @brief 日志子系统
+ */
+enum class LogChannel : int {
+    CORE = 0,       // 游戏流程
+    AI,             // AI 决策
+    PLAYER,         // 玩家资源、科技、文化
+    CITY,           // 城市
+    UNIT,           // 单位
+    MAP,            // 地图与输入
+    PATH,           // 寻路
+    COUNT
+};
+
+/**
+ * 编译期最低级别：低于该级别的日志调用整体被编译器剔除，参数也不会求值。
+ * 默认调试构建保留 VERBOSE 及以上，发布构建只保留 WARNING 及以上。
+ */
+#ifndef CIV_LOG_MIN_LEVEL
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define CIV_LOG_MIN_LEVEL 1
+#else
+#define CIV_LOG_MIN_LEVEL 3
+#endif
+#endif
+
+/**
+ * @class GameLog
+ * @brief 分级、异步日志
+ *
+ * 调用线程只在固定大小的槽位中格式化文本，然后放入无锁环形队列；
+ * 后台线程负责加前缀并写入输出（默认 stdout）。队列满时丢弃并计数，从不阻塞游戏线程。
+ */
+class GameLog {
+public:
+    static const size_t kQueueSize = 4096;      // 队列槽位数（2 的幂）
+    static const size_t kMessageSize = 256;     // 单条消息最大长度（含结尾 0）
+
+    static GameLog* getInstance();
+
+    /**
+     * @brief 运行时级别过滤（在编译期过滤之后生效）
+     */
+    void setChannelLevel(LogChannel channel, LogLevel level);
+    bool shouldLog(LogChannel channel, LogLevel level) const {
+        return (int)level >= _channelLevels[(int)channel].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 格式化并入队
+     * @param suppressed 该调用点此前因限流被丢弃的条数（附加在消息末尾）
+     */
+    void write(LogChannel channel, LogLevel level, int suppressed, const char* format, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 5, 6)))
+#endif
+        ;
+
+    /**
+     * @brief 设置输出函数（在后台线程调用，每次一行，不含换行符）
+     */
+    void setSink(const std::function<void(const char*)>& sink);
+
+    /**
+     * @brief 写完队列中剩余的日志并停止后台线程，之后的日志同步输出
+     */
+    void shutdown();
+
+private:
+    GameLog();
+    ~GameLog();
+    GameLog(const GameLog&) = delete;
+    GameLog& operator=(const GameLog&) = delete;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogChannel channel;
+        LogLevel level;
+        char text[kMessageSize];
+    };
+
+    Slot* claimSlot();
+    void publishSlot(Slot* slot);
+    bool drainOnce();
+    void writerLoop();
+    void emit(LogChannel channel, LogLevel level, const char* text);
+
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<size_t> _enqueuePos;
+    size_t _dequeuePos;                         // 只有后台线程访问
+    std::atomic<int> _channelLevels[(int)LogChannel::COUNT];
+    std::atomic<unsigned int> _dropped;         // 队列满时丢弃的条数
+
+    std::thread _writer;
+    std::atomic<bool> _running;
+    std::mutex _sinkMutex;                      // 保护 _sink 的替换以及同步输出
+    std::function<void(const char*)> _sink;
+};
+
+/**
+ * @brief 调用点限流：每个调用点每秒最多输出 kMaxPerSecond 条，其余只计数
+ */
+class GameLogRateLimiter {
+public:
+    static const int kMaxPerSecond = 20;
+
+    GameLogRateLimiter() : _windowStartMs(0), _count(0), _suppressed(0) {}
+
+    bool allow();
+
+    // 取出并清零累计被限流的条数
+    int takeSuppressed() { return _suppressed.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> _windowStartMs;
+    std::atomic<int> _count;
+    std::atomic<int> _suppressed;
+};
+
+#define GAME_LOG(channel, level, ...) \
+    do { \
+        if ((int)(level) >= CIV_LOG_MIN_LEVEL && GameLog::getInstance()->shouldLog(channel, level)) { \
+            static GameLogRateLimiter _gameLogLimiter; \
+            if (_gameLogLimiter.allow()) { \
+                GameLog::getInstance()->write(channel, level, _gameLogLimiter.takeSuppressed(), __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define GLOG_TRACE(channel, ...)   GAME_LOG(LogChannel::channel, LogLevel::TRACE, __VA_ARGS__)
+#define GLOG_VERBOSE(channel, ...) GAME_LOG(LogChannel::channel, LogLevel::VERBOSE, __VA_ARGS__)
+#define GLOG_INFO(channel, ...)    GAME_LOG(LogChannel::channel, LogLevel::INFO, __VA_ARGS__)
+#define GLOG_WARNING(channel, ...) GAME_LOG(LogChannel::channel, LogLevel::WARNING, __VA_ARGS__)
+#define GLOG_SEVERE(channel, ...)  GAME_LOG(LogChannel::channel, LogLevel::SEVERE, __VA_ARGS__)
+
+#endif // __GAME_LOG_H__
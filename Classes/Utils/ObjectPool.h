@@ -0,0 +1,80 @@
+#ifndef __OBJECT_POOL_H__
+#define __OBJECT_POOL_H__
+
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 对象池命中统计
+ */
+struct PoolStats {
+    int hits = 0;       // 从空闲链表取出
+    int misses = 0;     // 空闲链表为空，向系统堆申请
+    int live = 0;       // 已取出尚未归还
+    int free = 0;       // 空闲链表长度
+};
+
+/**
+ * @class ObjectPool
+ * @brief 按类型分配的空闲链表对象池
+ *
+ * acquire 在回收的内存上原地构造对象，release 析构后把内存挂回空闲链表，
+ * 稳态下反复创建销毁同类对象不再访问系统堆。对象状态由构造函数重新初始化，
+ * 因此 release / acquire 之间不会残留上一次使用的数据。
+ * 内存只在池析构时归还系统。仅在游戏主线程使用。
+ */
+template <typename T>
+class ObjectPool {
+public:
+    ObjectPool() {}
+    ~ObjectPool() {
+        for (void* block : _free)
+            ::operator delete(block);
+    }
+
+    template <typename... Args>
+    T* acquire(Args&&... args) {
+        void* block;
+        if (!_free.empty()) {
+            block = _free.back();
+            _free.pop_back();
+            _stats.hits++;
+        }
+        else {
+            block = ::operator new(sizeof(T));
+            _stats.misses++;
+        }
+        _stats.live++;
+        return new (block) T(std::forward<Args>(args)...);
+    }
+
+    void release(T* object) {
+        if (!object)
+            return;
+        object->~T();
+        _free.push_back(object);
+        _stats.live--;
+    }
+
+    // 预先申请 count 块空闲内存
+    void reserve(int count) {
+        for (int i = 0; i < count; i++)
+            _free.push_back(::operator new(sizeof(T)));
+    }
+
+    PoolStats getStats() const {
+        PoolStats stats = _stats;
+        stats.free = (int)_free.size();
+        return stats;
+    }
+
+private:
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    std::vector<void*> _free;
+    PoolStats _stats;
+};
+
+#endif // __OBJECT_POOL_H__
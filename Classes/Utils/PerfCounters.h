@@ -0,0 +1,49 @@
+#ifndef __PERF_COUNTERS_H__
+#define __PERF_COUNTERS_H__
+
+#include <cstdint>
+
+/**
+ * @brief 运行时性能计数器
+ *
+ * 只做整数累加，始终编译进来，供性能浮层读取。
+ * 仅在游戏主线程使用。
+ */
+class PerfCounters {
+public:
+    static PerfCounters* getInstance() {
+        static PerfCounters instance;
+        return &instance;
+    }
+
+    // ==================== 寻路 ====================
+    void addPathQuery() { _pathQueriesThisTurn++; }
+    int getPathQueriesThisTurn() const { return _pathQueriesThisTurn; }
+    int getPathQueriesLastTurn() const { return _pathQueriesLastTurn; }
+
+    /**
+     * @brief 新一轮回合开始时调用，保存上一轮的统计
+     */
+    void onNewTurn() {
+        _pathQueriesLastTurn = _pathQueriesThisTurn;
+        _pathQueriesThisTurn = 0;
+    }
+
+    // ==================== 帧内耗时 ====================
+    void setGameUpdateNs(uint64_t ns) { _gameUpdateNs = ns; }
+    uint64_t getGameUpdateNs() const { return _gameUpdateNs; }
+
+private:
+    PerfCounters()
+        : _pathQueriesThisTurn(0)
+        , _pathQueriesLastTurn(0)
+        , _gameUpdateNs(0) {}
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    int _pathQueriesThisTurn;       // 本轮寻路次数
+    int _pathQueriesLastTurn;       // 上一轮寻路次数
+    uint64_t _gameUpdateNs;         // 最近一帧 GameScene::update 耗时
+};
+
+#endif // __PERF_COUNTERS_H__
@@ -7,13 +7,13 @@
 #include <algorithm>
 #include <numeric>
 /**
-* @brief Perlin Noise ʵ
-* @details ṩ 2D Perlin Noise ɺͷβ˶ (FBM) 
+* @brief Perlin Noise 实现类
+* @details 提供 2D Perlin Noise 生成和分形布朗运动 (FBM) 功能
 */
 
 class PerlinNoise {
 public:
-    // ʼ
+    // 初始化种子
     PerlinNoise(unsigned int seed = 0) {
         p.resize(256);
         std::iota(p.begin(), p.end(), 0);
@@ -22,10 +22,10 @@ public:
         p.insert(p.end(), p.begin(), p.end());
     }
 
-    // ȡ 2D ֵ ( 0.0 ~ 1.0)
+    // 获取 2D 噪声值 (返回 0.0 ~ 1.0)
     double noise(double x, double y) {
-        // ʵǱ׼ Perlin Noise 㷨
-        // Ϊƪʹ˼򻯵Ĳұʵ
+        // 这里的实现是标准的 Perlin Noise 算法
+        // 为了篇幅，使用了简化的查找表实现
         int X = (int)floor(x) & 255;
         int Y = (int)floor(y) & 255;
         x -= floor(x);
@@ -38,11 +38,11 @@ public:
         double res = lerp(v, lerp(u, grad(p[AA], x, y), grad(p[BA], x - 1, y)),
             lerp(u, grad(p[AB], x, y - 1), grad(p[BB], x - 1, y - 1)));
 
-        // һ 0.0 ~ 1.0
+        // 归一化到 0.0 ~ 1.0
         return (res + 1.0) / 2.0;
     }
 
-    // ε (FBM) - õθϸ (߸)
+    // 分形叠加 (FBM) - 让地形更有细节 (海岸线更破碎)
     double octaveNoise(double x, double y, int octaves, double persistence) {
         double total = 0;
         double frequency = 1;
@@ -0,0 +1,115 @@
+#include "ScopeProfiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    // 当前线程的缓冲区（注册后由 ScopeProfiler 持有，线程退出后仍然有效）
+    thread_local void* t_threadBuffer = nullptr;
+
+    // 程序启动时刻，作为导出时间戳的零点（早于任何计时作用域）
+    const uint64_t s_processStartNs = ScopeProfiler::nowNs();
+
+    // 事件名大多是函数名字面量，这里只做最基本的 JSON 转义
+    void writeJsonString(std::ofstream& out, const char* text) {
+        out << '"';
+        for (const char* p = text; *p; ++p) {
+            if (*p == '"' || *p == '\\') out << '\\';
+            out << *p;
+        }
+        out << '"';
+    }
+}
+
+const size_t ScopeProfiler::kEventsPerThread;
+
+ScopeProfiler* ScopeProfiler::getInstance() {
+    static ScopeProfiler instance;
+    return &instance;
+}
+
+ScopeProfiler::ScopeProfiler()
+    : _enabled(true)
+    , _epochNs(s_processStartNs) {
+}
+
+ScopeProfiler::ThreadBuffer* ScopeProfiler::getThreadBuffer() {
+    if (!t_threadBuffer) {
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        _buffers.emplace_back(new ThreadBuffer((int)_buffers.size()));
+        t_threadBuffer = _buffers.back().get();
+    }
+    return static_cast<ThreadBuffer*>(t_threadBuffer);
+}
+
+void ScopeProfiler::record(const char* name, uint64_t startNs, uint64_t durationNs) {
+    if (!isEnabled()) return;
+
+    ThreadBuffer* buffer = getThreadBuffer();
+    uint64_t index = buffer->written.load(std::memory_order_relaxed);
+    buffer->events[index % kEventsPerThread] = { name, startNs, durationNs };
+    buffer->written.store(index + 1, std::memory_order_release);
+}
+
+size_t ScopeProfiler::getEventCount() const {
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    size_t count = 0;
+    for (const auto& buffer : _buffers) {
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        count += (size_t)std::min<uint64_t>(written, kEventsPerThread);
+    }
+    return count;
+}
+
+void ScopeProfiler::clear() {
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    for (auto& buffer : _buffers) {
+        buffer->written.store(0, std::memory_order_release);
+    }
+}
+
+bool ScopeProfiler::dumpChromeTrace(const std::string& path) const {
+    std::ofstream out(path.c_str(), std::ios::out | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    char number[64];
+    bool first = true;
+
+    out << "{\"traceEvents\":[\n";
+    for (const auto& buffer : _buffers) {
+        // 线程名元数据
+        if (!first) out << ",\n";
+        first = false;
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex
+            << ",\"args\":{\"name\":\"" << (buffer->threadIndex == 0 ? "main" : "worker") << "\"}}";
+
+        // 环形缓冲区中最近的 kEventsPerThread 条记录，按写入顺序输出
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t begin = written > kEventsPerThread ? written - kEventsPerThread : 0;
+        for (uint64_t i = begin; i < written; ++i) {
+            const ProfileEvent& event = buffer->events[i % kEventsPerThread];
+            if (!event.name) continue;
+
+            out << ",\n{\"name\":";
+            writeJsonString(out, event.name);
+            // Chrome trace 时间单位为微秒
+            snprintf(number, sizeof(number), "%.3f", (double)(event.startNs - _epochNs) / 1000.0);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"ts\":" << number;
+            snprintf(number, sizeof(number), "%.3f", (double)event.durationNs / 1000.0);
+            out << ",\"dur\":" << number << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    return out.good();
+}
+
+void ScopeProfiler::dumpAtExit() const {
+    if (_exitDumpPath.empty() || getEventCount() == 0) {
+        return;
+    }
+    dumpChromeTrace(_exitDumpPath);
+}
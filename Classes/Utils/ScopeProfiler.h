@@ -0,0 +1,176 @@
+#ifndef __SCOPE_PROFILER_H__
+#define __SCOPE_PROFILER_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * 编译期开关：默认只在调试构建中启用。
+ * 关闭时 PROFILE_* 宏展开为空，不产生任何运行时开销。
+ * 可在编译选项中显式定义 CIV_PROFILER_ENABLED=0/1 覆盖默认值。
+ */
+#ifndef CIV_PROFILER_ENABLED
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define CIV_PROFILER_ENABLED 1
+#else
+#define CIV_PROFILER_ENABLED 0
+#endif
+#endif
+
+/**
+ * @brief 一条计时记录（名称必须是字符串字面量或生命周期足够长的字符串）
+ */
+struct ProfileEvent {
+    const char* name;
+    uint64_t startNs;
+    uint64_t durationNs;
+};
+
+/**
+ * @class ScopeProfiler
+ * @brief 热路径计时器
+ *
+ * 每个线程写入自己的环形缓冲区，记录时无锁；缓冲区写满后覆盖最旧的记录。
+ * 可导出为 Chrome trace-event JSON，在 chrome://tracing 或 Perfetto 中查看。
+ * 导出应在游戏主线程空闲时进行（快捷键或退出时）。
+ */
+class ScopeProfiler {
+public:
+    static const size_t kEventsPerThread = 1 << 16;   // 每线程环形缓冲区容量
+
+    static ScopeProfiler* getInstance();
+
+    /**
+     * @brief 单调时钟，纳秒
+     */
+    static uint64_t nowNs() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief 写入一条记录到当前线程的缓冲区
+     */
+    void record(const char* name, uint64_t startNs, uint64_t durationNs);
+
+    /**
+     * @brief 运行时开关（编译期开启时才有意义）
+     */
+    void setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 导出 Chrome trace-event JSON
+     * @return 写入成功返回 true
+     */
+    bool dumpChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief 设置退出时的导出路径，dumpAtExit 使用
+     */
+    void setExitDumpPath(const std::string& path) { _exitDumpPath = path; }
+
+    /**
+     * @brief 退出时导出（没有记录或未设置路径时不写文件）
+     */
+    void dumpAtExit() const;
+
+    /**
+     * @brief 当前所有线程缓冲区中的记录数
+     */
+    size_t getEventCount() const;
+
+    /**
+     * @brief 清空所有记录
+     */
+    void clear();
+
+private:
+    ScopeProfiler();
+    ScopeProfiler(const ScopeProfiler&) = delete;
+    ScopeProfiler& operator=(const ScopeProfiler&) = delete;
+
+    struct ThreadBuffer {
+        int threadIndex;                        // 注册顺序，导出为 tid
+        std::vector<ProfileEvent> events;       // 环形缓冲区
+        std::atomic<uint64_t> written;          // 累计写入条数
+
+        explicit ThreadBuffer(int index)
+            : threadIndex(index), events(kEventsPerThread), written(0) {}
+    };
+
+    ThreadBuffer* getThreadBuffer();
+
+    mutable std::mutex _buffersMutex;           // 只在线程首次注册和导出时加锁
+    std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+    std::atomic<bool> _enabled;
+    uint64_t _epochNs;                          // 导出时间戳的零点
+    std::string _exitDumpPath;
+};
+
+/**
+ * @brief RAII 作用域计时
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : _name(name), _startNs(ScopeProfiler::nowNs()) {}
+    ~ProfileScope() {
+        ScopeProfiler::getInstance()->record(_name, _startNs, ScopeProfiler::nowNs() - _startNs);
+    }
+
+private:
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    const char* _name;
+    uint64_t _startNs;
+};
+
+/**
+ * @brief 顺序阶段计时：一个函数内多个连续阶段，next 结束当前阶段并开始下一个
+ * 用于不方便拆成独立作用域的长函数（如地图生成的各个步骤）
+ */
+class ProfileStages {
+public:
+    explicit ProfileStages(const char* firstStage) : _name(firstStage), _startNs(ScopeProfiler::nowNs()) {}
+    ~ProfileStages() { finish(); }
+
+    void next(const char* stage) {
+        finish();
+        _name = stage;
+        _startNs = ScopeProfiler::nowNs();
+    }
+
+private:
+    ProfileStages(const ProfileStages&) = delete;
+    ProfileStages& operator=(const ProfileStages&) = delete;
+
+    void finish() {
+        if (_name) {
+            ScopeProfiler::getInstance()->record(_name, _startNs, ScopeProfiler::nowNs() - _startNs);
+            _name = nullptr;
+        }
+    }
+
+    const char* _name;
+    uint64_t _startNs;
+};
+
+#if CIV_PROFILER_ENABLED
+#define CIV_PROFILE_CONCAT_INNER(a, b) a##b
+#define CIV_PROFILE_CONCAT(a, b) CIV_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope CIV_PROFILE_CONCAT(_profileScope, __LINE__)(name)
+#define PROFILE_STAGES(var, firstStage) ProfileStages var(firstStage)
+#define PROFILE_NEXT_STAGE(var, stage) var.next(stage)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_STAGES(var, firstStage) ((void)0)
+#define PROFILE_NEXT_STAGE(var, stage) ((void)0)
+#endif
+
+#endif // __SCOPE_PROFILER_H__
@@ -0,0 +1,130 @@
+#ifndef __SLOT_MAP_H__
+#define __SLOT_MAP_H__
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 32 位代际句柄
+ *
+ * 低 20 位为槽位下标，高 12 位为代数。槽位被释放后代数加一，
+ * 因此对象死亡或被移除后，旧句柄查询会失败而不会指向复用该槽位的新对象。
+ */
+typedef uint32_t EntityHandle;
+
+namespace EntityHandles {
+    static const EntityHandle kInvalid = 0xFFFFFFFFu;
+    static const int kIndexBits = 20;
+    static const uint32_t kIndexMask = (1u << kIndexBits) - 1;
+    static const uint32_t kGenerationMask = (1u << (32 - kIndexBits)) - 1;
+
+    inline EntityHandle make(uint32_t index, uint32_t generation) {
+        return ((generation & kGenerationMask) << kIndexBits) | (index & kIndexMask);
+    }
+    inline uint32_t indexOf(EntityHandle handle) { return handle & kIndexMask; }
+    inline uint32_t generationOf(EntityHandle handle) { return handle >> kIndexBits; }
+}
+
+/**
+ * @class SlotMap
+ * @brief 代际句柄注册表
+ *
+ * 值紧凑存放在 dense 数组中，可直接线性遍历；句柄经槽位表间接映射到 dense 下标。
+ * 插入、删除（与末尾交换后弹出）、按句柄查询均为 O(1)。
+ * 代际句柄的编码（EntityHandles）也供按分量存放的单位状态表复用。
+ */
+template <typename T>
+class SlotMap {
+public:
+    typedef typename std::vector<T>::iterator iterator;
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    EntityHandle insert(const T& value) {
+        uint32_t index;
+        if (!_freeSlots.empty()) {
+            index = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+        else {
+            index = (uint32_t)_slots.size();
+            _slots.push_back(Slot());
+        }
+
+        Slot& slot = _slots[index];
+        slot.dense = (int)_values.size();
+        _values.push_back(value);
+        _slotOf.push_back(index);
+        return EntityHandles::make(index, slot.generation);
+    }
+
+    // 删除句柄对应的值，句柄已失效时返回 false
+    bool erase(EntityHandle handle) {
+        if (!contains(handle))
+            return false;
+
+        uint32_t index = EntityHandles::indexOf(handle);
+        int dense = _slots[index].dense;
+        int last = (int)_values.size() - 1;
+        if (dense != last) {
+            _values[dense] = _values[last];
+            _slotOf[dense] = _slotOf[last];
+            _slots[_slotOf[dense]].dense = dense;
+        }
+        _values.pop_back();
+        _slotOf.pop_back();
+
+        _slots[index].dense = -1;
+        _slots[index].generation = (_slots[index].generation + 1) & EntityHandles::kGenerationMask;
+        _freeSlots.push_back(index);
+        return true;
+    }
+
+    bool contains(EntityHandle handle) const {
+        uint32_t index = EntityHandles::indexOf(handle);
+        return handle != EntityHandles::kInvalid && index < _slots.size()
+            && _slots[index].dense >= 0
+            && _slots[index].generation == EntityHandles::generationOf(handle);
+    }
+
+    // 按句柄取值，句柄失效时返回 nullptr
+    T* get(EntityHandle handle) {
+        return contains(handle) ? &_values[_slots[EntityHandles::indexOf(handle)].dense] : nullptr;
+    }
+    const T* get(EntityHandle handle) const {
+        return contains(handle) ? &_values[_slots[EntityHandles::indexOf(handle)].dense] : nullptr;
+    }
+
+    void clear() {
+        // 已发出的句柄全部作废：所有在用槽位代数加一后回收
+        for (uint32_t index = 0; index < _slots.size(); index++) {
+            if (_slots[index].dense >= 0) {
+                _slots[index].dense = -1;
+                _slots[index].generation = (_slots[index].generation + 1) & EntityHandles::kGenerationMask;
+                _freeSlots.push_back(index);
+            }
+        }
+        _values.clear();
+        _slotOf.clear();
+    }
+
+    int size() const { return (int)_values.size(); }
+    bool empty() const { return _values.empty(); }
+
+    iterator begin() { return _values.begin(); }
+    iterator end() { return _values.end(); }
+    const_iterator begin() const { return _values.begin(); }
+    const_iterator end() const { return _values.end(); }
+
+private:
+    struct Slot {
+        int dense = -1;          // dense 下标（空闲为 -1）
+        uint32_t generation = 0; // 代数
+    };
+
+    std::vector<T> _values;          // 紧凑存放的值
+    std::vector<uint32_t> _slotOf;   // dense 下标 -> 槽位
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _freeSlots;
+};
+
+#endif // __SLOT_MAP_H__
@@ -0,0 +1,143 @@
+#include "BenchHarness.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace {
+    double nowSeconds() {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    double timeRun(const BenchRunner::BenchFunc& func, uint64_t iterations) {
+        double start = nowSeconds();
+        func(iterations);
+        return nowSeconds() - start;
+    }
+
+    // 基准名称只含字母、数字和 / _ x，这里仍然转义引号和反斜杠以保证 JSON 合法
+    std::string jsonEscape(const std::string& text) {
+        std::string out;
+        for (char c : text) {
+            if (c == '"' || c == '\\') out.push_back('\\');
+            out.push_back(c);
+        }
+        return out;
+    }
+}
+
+void BenchRunner::add(const std::string& name, const BenchFunc& func, double itemsPerOp) {
+    _entries.push_back({ name, func, itemsPerOp });
+}
+
+BenchResult BenchRunner::measure(const Entry& entry, double minTime, int repetitions) const {
+    // 预热一次，同时倍增迭代次数直到单轮耗时足够长
+    uint64_t iterations = 1;
+    double elapsed = timeRun(entry.func, iterations);
+    while (elapsed < minTime && iterations < (1ull << 40)) {
+        double scale = elapsed > 0.0 ? minTime * 1.2 / elapsed : 10.0;
+        scale = std::min(std::max(scale, 2.0), 10.0);
+        iterations = (uint64_t)(iterations * scale);
+        elapsed = timeRun(entry.func, iterations);
+    }
+
+    std::vector<double> samples;
+    for (int i = 0; i < repetitions; ++i) {
+        samples.push_back(timeRun(entry.func, iterations) * 1e9 / (double)iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BenchResult result;
+    result.name = entry.name;
+    result.iterations = iterations;
+    result.repetitions = repetitions;
+    result.nsPerOpMedian = samples[samples.size() / 2];
+    result.nsPerOpMin = samples.front();
+    result.nsPerOpMax = samples.back();
+    result.itemsPerOp = entry.itemsPerOp;
+    return result;
+}
+
+bool BenchRunner::writeJson(const std::string& path, const std::vector<BenchResult>& results) const {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    fprintf(file, "{\n  \"context\": {\n");
+    fprintf(file, "    \"date\": \"%s\",\n", date);
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+    fprintf(file, "    \"build\": \"debug\"\n");
+#else
+    fprintf(file, "    \"build\": \"release\"\n");
+#endif
+    fprintf(file, "  },\n  \"benchmarks\": [\n");
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        fprintf(file, "    {\"name\": \"%s\", \"iterations\": %llu, \"repetitions\": %d, "
+            "\"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ns_per_op_max\": %.3f",
+            jsonEscape(r.name).c_str(), (unsigned long long)r.iterations, r.repetitions,
+            r.nsPerOpMedian, r.nsPerOpMin, r.nsPerOpMax);
+        if (r.itemsPerOp > 0.0) {
+            fprintf(file, ", \"items_per_second\": %.1f", r.itemsPerOp * 1e9 / r.nsPerOpMedian);
+        }
+        fprintf(file, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return true;
+}
+
+int BenchRunner::run(int argc, char** argv) {
+    std::string filter;
+    std::string outPath = "civ6-bench.json";
+    double minTime = 0.2;
+    int repetitions = 5;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--filter") == 0 && hasValue) filter = argv[++i];
+        else if (strcmp(arg, "--out") == 0 && hasValue) outPath = argv[++i];
+        else if (strcmp(arg, "--min-time") == 0 && hasValue) minTime = atof(argv[++i]);
+        else if (strcmp(arg, "--repetitions") == 0 && hasValue) repetitions = std::max(1, atoi(argv[++i]));
+        else if (strcmp(arg, "--list") == 0) listOnly = true;
+        else {
+            fprintf(stderr, "usage: %s [--filter s] [--out file] [--min-time sec] [--repetitions n] [--list]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 进度与可读结果写 stderr，stdout 留给游戏代码的日志
+    std::vector<BenchResult> results;
+    for (const Entry& entry : _entries) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos) continue;
+        if (listOnly) {
+            fprintf(stderr, "%s\n", entry.name.c_str());
+            continue;
+        }
+
+        BenchResult result = measure(entry, minTime, repetitions);
+        fprintf(stderr, "%-40s %14.1f ns/op  (min %.1f, max %.1f, %llu iters)\n",
+            result.name.c_str(), result.nsPerOpMedian, result.nsPerOpMin, result.nsPerOpMax,
+            (unsigned long long)result.iterations);
+        results.push_back(result);
+    }
+
+    if (listOnly) return 0;
+
+    if (!writeJson(outPath, results)) {
+        fprintf(stderr, "failed to write %s\n", outPath.c_str());
+        return 1;
+    }
+    fprintf(stderr, "results written to %s\n", outPath.c_str());
+    return 0;
+}
@@ -0,0 +1,77 @@
+#ifndef __BENCH_HARNESS_H__
+#define __BENCH_HARNESS_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 防止编译器把基准循环里的计算当作无用代码删除
+ */
+template <typename T>
+inline void benchKeep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief 单个基准的统计结果（时间单位：纳秒/次）
+ */
+struct BenchResult {
+    std::string name;
+    uint64_t iterations;        // 每轮迭代次数
+    int repetitions;            // 重复轮数
+    double nsPerOpMedian;
+    double nsPerOpMin;
+    double nsPerOpMax;
+    double itemsPerOp;          // 每次迭代处理的元素数（0 表示不统计）
+};
+
+/**
+ * @class BenchRunner
+ * @brief 最小化的基准运行器
+ *
+ * 每个基准函数接收迭代次数并自行循环。运行器先倍增迭代次数直到单轮耗时达到 minTime，
+ * 再重复 repetitions 轮取中位数，结果写成 JSON 以便跨版本对比。
+ *
+ * 命令行参数：
+ *   --filter <子串>     只运行名称包含该子串的基准
+ *   --out <文件>        JSON 输出路径（默认 civ6-bench.json）
+ *   --min-time <秒>     单轮最短时间（默认 0.2）
+ *   --repetitions <n>   重复轮数（默认 5）
+ *   --list              只列出基准名称
+ */
+class BenchRunner {
+public:
+    using BenchFunc = std::function<void(uint64_t iterations)>;
+
+    /**
+     * @brief 注册基准
+     * @param itemsPerOp 每次迭代处理的元素数，用于换算吞吐量
+     */
+    void add(const std::string& name, const BenchFunc& func, double itemsPerOp = 0.0);
+
+    /**
+     * @brief 解析命令行并运行，返回进程退出码
+     */
+    int run(int argc, char** argv);
+
+private:
+    struct Entry {
+        std::string name;
+        BenchFunc func;
+        double itemsPerOp;
+    };
+
+    BenchResult measure(const Entry& entry, double minTime, int repetitions) const;
+    bool writeJson(const std::string& path, const std::vector<BenchResult>& results) const;
+
+    std::vector<Entry> _entries;
+};
+
+#endif // __BENCH_HARNESS_H__
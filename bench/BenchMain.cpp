@@ -0,0 +1,324 @@
+/**
+ * 核心算法基准
+ *
+ * 不创建窗口、不初始化 Director，只调用纯逻辑代码：
+ * 六边形坐标、坐标换算、柏林噪声、地图生成、寻路、产出汇总以及科技/文化树。
+ * 这些代码只用到 cocos 的头文件，不链接 cocos2d 库；
+ * 需要 Ref / PoolManager 的玩家回合结算放在 BenchPlayer.cpp，由 CIV_BENCH_WITH_COCOS 单独开启。
+ */
+
+#include "BenchHarness.h"
+#include "Utils/HexUtils.h"
+#include "Utils/PerlinNoise.h"
+#include "Utils/PathFinder.h"
+#include "Utils/EventBus.h"
+#include "Utils/GameLog.h"
+#include "Map/MapGenerator.h"
+#include "City/Yield.h"
+#include "Development/TechSystem.h"
+#include "Development/CultureSystem.h"
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if CIV_BENCH_WITH_COCOS
+// BenchPlayer.cpp
+void registerPlayerBenchmarks(BenchRunner& runner);
+#endif
+
+namespace {
+    const uint32_t kFixedSeed = 20240601;   // 基准输入使用固定种子，保证每次运行的查询相同
+    const int kGameMapWidth = 120;          // 与 GameMapLayer 使用的地图尺寸一致
+    const int kGameMapHeight = 50;
+    const int kQueryCount = 256;            // 预先生成的寻路查询数
+
+    /**
+     * @brief 生成 width x height 的地图所覆盖的全部坐标（与 MapGenerator 的 offset -> axial 换算一致）
+     */
+    std::vector<Hex> makeGridHexes(int width, int height) {
+        std::vector<Hex> hexes;
+        hexes.reserve(width * height);
+        for (int r = 0; r < height; r++) {
+            for (int q = 0; q < width; q++) {
+                hexes.push_back(Hex(q - (r >> 1), r));
+            }
+        }
+        return hexes;
+    }
+
+    /**
+     * @brief 与 GameMapLayer::getTerrainCost 相同的通行规则
+     */
+    int terrainCost(const std::map<Hex, TileData>& mapData, Hex h) {
+        auto it = mapData.find(h);
+        if (it == mapData.end()) return -1;
+
+        TerrainType type = it->second.type;
+        if (type == TerrainType::OCEAN || type == TerrainType::COAST || type == TerrainType::MOUNTAIN) return -1;
+        if (type == TerrainType::JUNGLE || type == TerrainType::DESERT || type == TerrainType::SNOW) return 2;
+        return 1;
+    }
+
+    struct PathFixture {
+        std::map<Hex, TileData> mapData;
+        std::vector<std::pair<Hex, Hex>> queries;
+        std::vector<Hex> origins;
+    };
+
+    /**
+     * @brief 生成一张游戏尺寸的地图，并用固定种子挑选陆地上的寻路起止点
+     */
+    const PathFixture& pathFixture() {
+        static PathFixture fixture;
+        if (!fixture.queries.empty()) return fixture;
+
+        fixture.mapData = MapGenerator::generate(kGameMapWidth, kGameMapHeight);
+
+        std::vector<Hex> land;
+        for (const auto& pair : fixture.mapData) {
+            if (terrainCost(fixture.mapData, pair.first) >= 0) land.push_back(pair.first);
+        }
+        if (land.size() < 2) return fixture;
+
+        std::mt19937 gen(kFixedSeed);
+        std::uniform_int_distribution<size_t> pick(0, land.size() - 1);
+        for (int i = 0; i < kQueryCount; i++) {
+            fixture.queries.push_back({ land[pick(gen)], land[pick(gen)] });
+            fixture.origins.push_back(land[pick(gen)]);
+        }
+        return fixture;
+    }
+
+    void registerHexBenchmarks(BenchRunner& runner) {
+        const std::vector<Hex> hexes = makeGridHexes(kGameMapWidth, kGameMapHeight);
+        const double count = (double)hexes.size();
+
+        runner.add("hex/arithmetic", [hexes](uint64_t iterations) {
+            int sum = 0;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (size_t i = 1; i < hexes.size(); i++) {
+                    Hex h = hexes[i] + hexes[i - 1].getNeighbor((int)(i % 6));
+                    sum += h.distance(hexes[i - 1]);
+                }
+            }
+            benchKeep(sum);
+        }, count - 1);
+
+        runner.add("hex/hash", [hexes](uint64_t iterations) {
+            std::hash<Hex> hasher;
+            size_t acc = 0;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const Hex& h : hexes) acc += hasher(h);
+            }
+            benchKeep(acc);
+        }, count);
+
+        runner.add("hex/unordered_set_insert_find", [hexes](uint64_t iterations) {
+            for (uint64_t it = 0; it < iterations; it++) {
+                std::unordered_set<Hex> set(hexes.begin(), hexes.end());
+                size_t found = 0;
+                for (const Hex& h : hexes) found += set.count(h);
+                benchKeep(found);
+            }
+        }, count);
+
+        runner.add("hex/map_find", [hexes](uint64_t iterations) {
+            std::map<Hex, int> map;
+            for (const Hex& h : hexes) map[h] = h.q;
+            int sum = 0;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const Hex& h : hexes) sum += map.find(h)->second;
+            }
+            benchKeep(sum);
+        }, count);
+    }
+
+    void registerLayoutBenchmarks(BenchRunner& runner) {
+        const std::vector<Hex> hexes = makeGridHexes(kGameMapWidth, kGameMapHeight);
+        const double count = (double)hexes.size();
+
+        runner.add("layout/hexToPixel", [hexes](uint64_t iterations) {
+            HexLayout layout(40.0f);
+            float acc = 0.0f;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const Hex& h : hexes) acc += layout.hexToPixel(h).x;
+            }
+            benchKeep(acc);
+        }, count);
+
+        // 像素点取在格子中心附近，覆盖 hexRound 的各个分支
+        std::vector<cocos2d::Vec2> points;
+        HexLayout pointLayout(40.0f);
+        std::mt19937 gen(kFixedSeed);
+        std::uniform_real_distribution<float> jitter(-15.0f, 15.0f);
+        for (const Hex& h : hexes) {
+            cocos2d::Vec2 p = pointLayout.hexToPixel(h);
+            points.push_back(cocos2d::Vec2(p.x + jitter(gen), p.y + jitter(gen)));
+        }
+
+        runner.add("layout/pixelToHex", [points](uint64_t iterations) {
+            HexLayout layout(40.0f);
+            int acc = 0;
+            for (uint64_t it = 0; it < iterations; it++) {
+                for (const cocos2d::Vec2& p : points) acc += layout.pixelToHex(p).q;
+            }
+            benchKeep(acc);
+        }, (double)points.size());
+    }
+
+    void registerNoiseBenchmarks(BenchRunner& runner) {
+        const int samples = 4096;
+        for (int octaves : { 1, 4, 6 }) {
+            runner.add("perlin/octaveNoise/" + std::to_string(octaves), [octaves, samples](uint64_t iterations) {
+                PerlinNoise noise(kFixedSeed);
+                double acc = 0.0;
+                for (uint64_t it = 0; it < iterations; it++) {
+                    for (int i = 0; i < samples; i++) {
+                        acc += noise.octaveNoise(i * 0.037, i * 0.011, octaves, 0.5);
+                    }
+                }
+                benchKeep(acc);
+            }, samples);
+        }
+    }
+
+    void registerMapBenchmarks(BenchRunner& runner) {
+        const int sizes[][2] = { { 40, 20 }, { 80, 35 }, { kGameMapWidth, kGameMapHeight }, { 180, 80 } };
+        for (const auto& size : sizes) {
+            int width = size[0];
+            int height = size[1];
+            runner.add("mapgen/generate/" + std::to_string(width) + "x" + std::to_string(height), [width, height](uint64_t iterations) {
+                for (uint64_t it = 0; it < iterations; it++) {
+                    auto mapData = MapGenerator::generate(width, height);
+                    benchKeep(mapData.size());
+                }
+            }, (double)(width * height));
+        }
+    }
+
+    void registerPathBenchmarks(BenchRunner& runner) {
+        runner.add("path/findPath", [](uint64_t iterations) {
+            const PathFixture& fixture = pathFixture();
+            if (fixture.queries.empty()) return;
+
+            auto cost = [&fixture](Hex h) { return terrainCost(fixture.mapData, h); };
+            size_t total = 0;
+            for (uint64_t it = 0; it < iterations; it++) {
+                const auto& query = fixture.queries[it % fixture.queries.size()];
+                total += PathFinder::findPath(query.first, query.second, cost).size();
+            }
+            benchKeep(total);
+        }, 1.0);
+
+        for (int movement : { 2, 4 }) {
+            runner.add("path/getReachableHexes/" + std::to_string(movement), [movement](uint64_t iterations) {
+                const PathFixture& fixture = pathFixture();
+                if (fixture.origins.empty()) return;
+
+                auto cost = [&fixture](Hex h) { return terrainCost(fixture.mapData, h); };
+                size_t total = 0;
+                for (uint64_t it = 0; it < iterations; it++) {
+                    const Hex& origin = fixture.origins[it % fixture.origins.size()];
+                    total += PathFinder::getReachableHexes(origin, movement, cost).size();
+                }
+                benchKeep(total);
+            }, 1.0);
+        }
+    }
+
+    void registerYieldBenchmarks(BenchRunner& runner) {
+        // 一个大帝国的地块产出：每格取 0~5 的随机值
+        const int kTileCount = 4096;
+        std::mt19937 gen(kFixedSeed);
+        std::uniform_int_distribution<int> value(0, 5);
+        std::vector<Yield> tiles(kTileCount);
+        for (Yield& tile : tiles) {
+            tile = { value(gen), value(gen), value(gen), value(gen), value(gen) };
+        }
+
+        runner.add("yield/sum", [tiles](uint64_t iterations) {
+            Yield total;
+            for (uint64_t it = 0; it < iterations; it++) {
+                total += YieldBatch::sum(tiles.data(), tiles.size());
+            }
+            benchKeep(total);
+        }, (double)kTileCount);
+
+        runner.add("yield/scale_clamp", [tiles](uint64_t iterations) {
+            std::vector<Yield> work(tiles);
+            YieldScale scale;
+            scale.production = Fixed::percent(115);
+            scale.gold = Fixed::percent(110);
+            scale.science = Fixed::percent(125);
+            Yield lo;
+            Yield hi = { 1000, 1000, 1000, 1000, 1000 };
+            for (uint64_t it = 0; it < iterations; it++) {
+                YieldBatch::scale(work.data(), work.size(), scale);
+                YieldBatch::clamp(work.data(), work.size(), lo, hi);
+            }
+            benchKeep(work);
+        }, (double)kTileCount);
+    }
+
+    void registerDevelopmentBenchmarks(BenchRunner& runner) {
+        // 每次迭代从零研究完整棵树：构造 + 反复选择可研究节点并投入点数，事件按帧派发
+        runner.add("tech/research_full_tree", [](uint64_t iterations) {
+            auto bus = EventBus::getInstance();
+            for (uint64_t it = 0; it < iterations; it++) {
+                TechTree tree;
+                for (;;) {
+                    if (tree.getCurrentResearch() <= 0 || tree.isActivated(tree.getCurrentResearch())) {
+                        std::vector<int> researchable = tree.getResearchableTechList();
+                        if (researchable.empty()) break;
+                        tree.setCurrentResearch(researchable.front());
+                    }
+                    tree.updateProgress(30);
+                    bus->dispatchDeferred();
+                }
+                benchKeep(tree);
+            }
+        });
+
+        runner.add("culture/research_full_tree", [](uint64_t iterations) {
+            auto bus = EventBus::getInstance();
+            for (uint64_t it = 0; it < iterations; it++) {
+                CultureTree tree;
+                for (;;) {
+                    if (tree.getCurrentResearch() <= 0 || tree.isActivated(tree.getCurrentResearch())) {
+                        std::vector<int> unlockable = tree.getUnlockableCultureList();
+                        if (unlockable.empty()) break;
+                        tree.setCurrentResearch(unlockable.front());
+                    }
+                    tree.updateProgress(30);
+                    bus->dispatchDeferred();
+                }
+                benchKeep(tree);
+            }
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    // 游戏日志只保留错误，避免后台线程输出干扰计时
+    for (int i = 0; i < (int)LogChannel::COUNT; i++) {
+        GameLog::getInstance()->setChannelLevel((LogChannel)i, LogLevel::SEVERE);
+    }
+
+    BenchRunner runner;
+    registerHexBenchmarks(runner);
+    registerLayoutBenchmarks(runner);
+    registerNoiseBenchmarks(runner);
+    registerMapBenchmarks(runner);
+    registerPathBenchmarks(runner);
+    registerYieldBenchmarks(runner);
+    registerDevelopmentBenchmarks(runner);
+#if CIV_BENCH_WITH_COCOS
+    registerPlayerBenchmarks(runner);
+#endif
+
+    int result = runner.run(argc, argv);
+    GameLog::getInstance()->shutdown();
+    return result;
+}
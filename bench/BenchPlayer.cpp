@@ -0,0 +1,72 @@
+/**
+ * 玩家回合结算基准
+ *
+ * Player 继承自 cocos2d::Ref，需要链接 cocos2d 库和全部游戏源码，
+ * 因此只在 CIV_BENCH_WITH_COCOS 打开时编入 civ6-bench。
+ */
+
+#include "BenchHarness.h"
+#include "Utils/EventBus.h"
+#include "Utils/FrameArena.h"
+#include "Core/Player.h"
+#include <vector>
+
+namespace {
+    const int kTurnsPerGame = 250;          // 每局回合数，之后重新创建玩家
+    const int kSimulatedCities = 12;        // 产出结算基准中汇报产出变化的城市数
+}
+
+void registerPlayerBenchmarks(BenchRunner& runner) {
+    // 城市在 initCity 中创建标签与按钮，需要渲染上下文，因此这里的玩家没有城市，
+    // onTurnBegin 走无城市的分支；科技/文化收入直接注入，测的是研究推进与事件派发
+    runner.add("player/researchTurn", [](uint64_t iterations) {
+        auto bus = EventBus::getInstance();
+        Player* player = nullptr;
+        for (uint64_t it = 0; it < iterations; it++) {
+            if (it % kTurnsPerGame == 0) {
+                if (player) player->release();
+                cocos2d::PoolManager::getInstance()->getCurrentPool()->clear();
+                player = Player::create(0, CivilizationType::CHINA);
+                player->retain();
+            }
+
+            if (player->getCurrentResearchTechId() <= 0) {
+                std::vector<int> researchable = player->getTechTree()->getResearchableTechList();
+                if (!researchable.empty()) player->setCurrentResearch(researchable.front());
+            }
+            if (player->getCurrentResearchCivicId() <= 0) {
+                std::vector<int> unlockable = player->getCultureTree()->getUnlockableCultureList();
+                if (!unlockable.empty()) player->setCurrentCivic(unlockable.front());
+            }
+
+            player->onTurnBegin();
+            player->addScience(12);
+            player->addCulture(8);
+            player->onTurnEnd();
+            bus->dispatchDeferred();
+            FrameArena::getInstance()->reset(); // 与 GameManager::endTurn 一致，每回合回收临时数据
+        }
+        if (player) player->release();
+        cocos2d::PoolManager::getInstance()->getCurrentPool()->clear();
+    }, 1.0);
+
+    // 有城市时 onTurnBegin 的产出结算：各城市按 BaseCity::updateYield 的方式汇报产出变化量，
+    // 再读取总产出并应用文明与政策卡加成
+    runner.add("player/turnYield", [](uint64_t iterations) {
+        Player* player = Player::create(0, CivilizationType::CHINA);
+        player->retain();
+        for (int c = 0; c < kSimulatedCities; c++) {
+            player->onCityYieldChanged({ 4 + c % 3, 5 + c % 4, 3, 4 + c % 2, 2, 0, 0 });
+        }
+
+        for (uint64_t it = 0; it < iterations; it++) {
+            // 每回合有一座城市的地块或人口发生变化
+            int sign = (it & 1) ? -1 : 1;
+            player->onCityYieldChanged({ sign, 0, sign, 0, sign, 0, 0 });
+            Yield total = player->applyYieldBonuses(player->calculateTotalYield());
+            benchKeep(total);
+        }
+        player->release();
+        cocos2d::PoolManager::getInstance()->getCurrentPool()->clear();
+    });
+}
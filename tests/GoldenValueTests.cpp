@@ -0,0 +1,237 @@
+/**
+ * 规则运算黄金值测试
+ *
+ * 产出、战斗、研究进度等规则运算全部走 Fixed 定点数，同样的输入在任何平台上逐位一致。
+ * 这里把这些运算的结果固定成黄金值：表中的数值与改用定点数之前的浮点公式逐项核对过，
+ * 之后任何改动规则公式或取整方式的提交都会在这里失败。
+ *
+ * 只依赖核心逻辑源码，不链接 cocos2d。
+ * AbstractUnit::getCombatPower、BaseCiv::applyEurekaBonus / applyInspirationBonus、
+ * BaseCity 的人口增长阈值都直接调用 GameRules 中的公式，这里测试的就是它们。
+ */
+
+#include "Utils/Fixed.h"
+#include "City/Yield.h"
+#include "City/CitizenAssignment.h"
+#include "Core/GameConfig.h"
+#include "Core/GameRules.h"
+#include "Development/TechSystem.h"
+#include "Development/CultureSystem.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+    int g_checks = 0;
+    int g_failures = 0;
+
+    void checkEqual(long long actual, long long expected, const char* expr, const char* file, int line) {
+        g_checks++;
+        if (actual != expected) {
+            g_failures++;
+            std::printf("%s:%d: %s == %lld, expected %lld\n", file, line, expr, actual, expected);
+        }
+    }
+
+#define CHECK_EQ(actual, expected) checkEqual((long long)(actual), (long long)(expected), #actual, __FILE__, __LINE__)
+#define CHECK(condition) checkEqual((condition) ? 1 : 0, 1, #condition, __FILE__, __LINE__)
+
+    void checkYield(const Yield& actual, const Yield& expected, const char* expr, const char* file, int line) {
+        for (int i = 0; i < kYieldLanes; i++) {
+            checkEqual(actual.lanes()[i], expected.lanes()[i], expr, file, line);
+        }
+    }
+
+#define CHECK_YIELD(actual, expected) checkYield((actual), (expected), #actual, __FILE__, __LINE__)
+
+    void testFixedRounding() {
+        // 十进制常数精确表示
+        CHECK_EQ(Fixed::percent(115).raw(), 11500);
+        CHECK_EQ(Fixed::percent(75).raw(), 7500);
+        CHECK_EQ(Fixed::one().raw(), Fixed::kScale);
+
+        // 向零取整，负数同样朝零
+        CHECK_EQ(Fixed::ratio(3, 2).toInt(), 1);
+        CHECK_EQ(Fixed::ratio(-3, 2).toInt(), -1);
+        CHECK_EQ(Fixed::ratio(1, 3).raw(), 3333);
+        CHECK_EQ(Fixed::ratio(-1, 3).raw(), -3333);
+        CHECK_EQ(Fixed::ratio(2, 3).raw(), 6666);
+        CHECK_EQ(Fixed::fromInt(-3).toInt(), -3);
+        CHECK_EQ((Fixed::fromRaw(-5) / 2).raw(), -2);
+
+        // mulInt：整数乘系数后向零取整
+        CHECK_EQ(Fixed::percent(115).mulInt(100), 115);
+        CHECK_EQ(Fixed::percent(115).mulInt(7), 8);
+        CHECK_EQ(Fixed::percent(115).mulInt(-7), -8);
+        CHECK_EQ(Fixed::percent(-25).mulInt(10), -2);
+        CHECK_EQ(Fixed::percent(50).mulInt(1), 0);
+
+        // 定点乘除每一步都截断到 1/10000
+        CHECK_EQ((Fixed::ratio(1, 3) * Fixed::fromInt(3)).raw(), 9999);
+        CHECK_EQ((Fixed::fromInt(1) / Fixed::fromInt(3)).raw(), 3333);
+        CHECK_EQ((Fixed::fromInt(-1) / Fixed::fromInt(3)).raw(), -3333);
+        CHECK_EQ((Fixed::percent(150) * Fixed::percent(150)).raw(), 22500);
+        CHECK_EQ((Fixed::percent(75) / Fixed::percent(50)).raw(), 15000);
+        CHECK_EQ((Fixed::fromInt(7) * 3).raw(), 210000);
+
+        // 平方根向下取整，非正数为 0
+        CHECK_EQ(Fixed::fromInt(2).sqrt().raw(), 14142);
+        CHECK(Fixed::fromInt(4).sqrt() == Fixed::fromInt(2));
+        CHECK(Fixed::percent(25).sqrt() == Fixed::percent(50));
+        CHECK(Fixed::fromInt(10000).sqrt() == Fixed::fromInt(100));
+        CHECK(Fixed().sqrt() == Fixed());
+        CHECK(Fixed::fromInt(-4).sqrt() == Fixed());
+    }
+
+    void testFixedBounds() {
+        // int32 存储：整数部分上限 214748
+        CHECK_EQ(Fixed::fromInt(214748).raw(), 2147480000);
+        CHECK_EQ(Fixed::fromInt(214748).toInt(), 214748);
+        CHECK_EQ(Fixed::fromInt(-214748).toInt(), -214748);
+        CHECK_EQ(Fixed::fromInt(214748).sqrt().raw(), 4634091);
+
+        // 乘除使用 int64 中间值：raw 乘积超出 int32 时结果仍然正确
+        CHECK_EQ(Fixed::percent(150).mulInt(1000000000), 1500000000);
+        CHECK_EQ(Fixed::percent(-150).mulInt(1000000000), -1500000000);
+        CHECK_EQ(Fixed::percent(115).mulInt(2000000), 2300000);
+        CHECK(Fixed::fromInt(400) * Fixed::fromInt(400) == Fixed::fromInt(160000));
+        CHECK(Fixed::fromInt(200000) / Fixed::fromInt(4) == Fixed::fromInt(50000));
+        CHECK_EQ(Fixed::ratio(3000000000LL, 20000).raw(), 1500000000);
+    }
+
+    void testYieldScaled() {
+        // 文明系数（科技、文化 +20%）之后再叠加政策卡（生产 +15%、金币 +20%、科技 +10%、文化 +5%）
+        YieldScale civScale;
+        civScale.science = Fixed::percent(120);
+        civScale.culture = Fixed::percent(120);
+
+        YieldScale policyScale;
+        policyScale.production = Fixed::percent(115);
+        policyScale.gold = Fixed::percent(120);
+        policyScale.science = Fixed::percent(110);
+        policyScale.culture = Fixed::percent(105);
+
+        Yield base = { 11, 37, 23, 19, 9, 3, 2 };
+        Yield afterCiv = base.scaled(civScale);
+        Yield expectedCiv = { 11, 37, 27, 19, 10, 3, 2 };
+        CHECK_YIELD(afterCiv, expectedCiv);
+
+        Yield expectedPolicy = { 11, 42, 29, 22, 10, 3, 2 };
+        CHECK_YIELD(afterCiv.scaled(policyScale), expectedPolicy);
+
+        // 负值与大数：向零取整，int64 中间值不溢出
+        Yield deficit = { -3, 2000000, 0, -7, 1, 0, 0 };
+        Yield expectedDeficit = { -3, 2300000, 0, -8, 1, 0, 0 };
+        CHECK_YIELD(deficit.scaled(policyScale), expectedDeficit);
+
+        // 默认系数不改变产出
+        CHECK_YIELD(base.scaled(YieldScale()), base);
+
+        // 批量缩放与逐个缩放一致
+        std::vector<Yield> batch = { base, afterCiv, deficit };
+        YieldBatch::scale(batch.data(), batch.size(), policyScale);
+        CHECK_YIELD(batch[0], base.scaled(policyScale));
+        CHECK_YIELD(batch[1], expectedPolicy);
+        CHECK_YIELD(batch[2], expectedDeficit);
+    }
+
+    void testGrowthFood() {
+        const int expected[30] = {
+            15, 24, 34, 44, 55, 66, 78, 90, 102, 114,
+            127, 139, 153, 166, 179, 193, 207, 221, 235, 250,
+            264, 279, 294, 309, 325, 340, 356, 371, 387, 403
+        };
+        for (int population = 1; population <= 30; population++) {
+            CHECK_EQ(GameRules::calculateGrowthFood(population), expected[population - 1]);
+        }
+    }
+
+    void testCombatPower() {
+        const int attacks[] = { 1, 8, 20, 25, 36, 45, 70 };
+        const int hps[] = { 0, 1, 25, 33, 50, 67, 70, 99, 100 };
+        const int expected[7][9] = {
+            { 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+            { 4, 4, 5, 5, 6, 6, 6, 7, 8 },
+            { 10, 10, 12, 13, 15, 16, 17, 19, 20 },
+            { 12, 12, 15, 16, 18, 20, 21, 24, 25 },
+            { 18, 18, 22, 23, 27, 30, 30, 35, 36 },
+            { 22, 22, 28, 29, 33, 37, 38, 44, 45 },
+            { 35, 35, 43, 46, 52, 58, 59, 69, 70 }
+        };
+        for (int a = 0; a < 7; a++) {
+            for (int h = 0; h < 9; h++) {
+                CHECK_EQ(GameRules::calculateCombatPower(attacks[a], hps[h], 100), expected[a][h]);
+            }
+        }
+        // 血量上限不是 100 时按比例计算
+        CHECK_EQ(GameRules::calculateCombatPower(30, 75, 150), 22);
+        CHECK_EQ(GameRules::calculateCombatPower(30, 149, 150), 29);
+    }
+
+    void testBoostProgress() {
+        // 默认 50%（德国、俄罗斯）与中国的 75%，成本取自科技树
+        TechTree techTree;
+        const int techIds[] = { 1, 4, 5, 10, 12, 14, 17, 21, 22, 24 };
+        const int expectedDefault[] = { 12, 25, 40, 60, 100, 150, 200, 300, 400, 500 };
+        const int expectedChina[] = { 18, 37, 60, 90, 150, 225, 300, 450, 600, 750 };
+        for (int i = 0; i < 10; i++) {
+            int cost = techTree.getTechInfo(techIds[i])->cost;
+            CHECK_EQ(GameRules::calculateBoostProgress(cost, Fixed::percent(50)), expectedDefault[i]);
+            CHECK_EQ(GameRules::calculateBoostProgress(cost, GameConfig::Civilization::CHINA_EUREKA_BOOST), expectedChina[i]);
+        }
+
+        CultureTree cultureTree;
+        const int civicIds[] = { 101, 102, 104, 107, 108, 110, 111 };
+        const int expectedInspiration[] = { 18, 37, 60, 90, 150, 225, 300 };
+        for (int i = 0; i < 7; i++) {
+            int cost = cultureTree.getCultureInfo(civicIds[i])->cost;
+            CHECK_EQ(GameRules::calculateBoostProgress(cost, Fixed::percent(75)), expectedInspiration[i]);
+        }
+    }
+
+    void testDistrictCost() {
+        const int techCounts[] = { 0, 1, 2, 5, 10, 20, 24 };
+        const int expected[] = { 30, 31, 33, 38, 48, 79, 96 };
+        for (int i = 0; i < 7; i++) {
+            CHECK_EQ(GameConfig::calculateDistrictCost(GameConfig::BASE_DISTRICT_COST, techCounts[i]), expected[i]);
+        }
+    }
+
+    void testCitizenValue() {
+        Yield fed = { 10, 6, 5, 4, 3 };
+        Yield starving = { 5, 6, 5, 4, 3 };
+
+        // 均衡：1.0 / 1.0 / 0.8 / 0.6 / 0.8
+        CitizenAssignment balanced(CityFocus::BALANCED, 8);
+        CHECK_EQ(balanced.value(fed).raw(), 248000);
+        // 食物缺 3 点，每点惩罚 3
+        CHECK_EQ(balanced.value(starving).raw(), 108000);
+
+        CitizenAssignment food(CityFocus::FOOD, 8);
+        CHECK_EQ(food.value(fed).raw(), 366000);
+
+        CitizenAssignment production(CityFocus::PRODUCTION, 8);
+        CHECK_EQ(production.value(fed).raw(), 298000);
+
+        CitizenAssignment science(CityFocus::SCIENCE, 8);
+        CHECK_EQ(science.value(fed).raw(), 291000);
+
+        // 不需要食物时空产出的目标值为 0
+        CitizenAssignment noUpkeep(CityFocus::BALANCED, 0);
+        CHECK(noUpkeep.value(Yield()) == Fixed());
+    }
+}
+
+int main() {
+    testFixedRounding();
+    testFixedBounds();
+    testYieldScaled();
+    testGrowthFood();
+    testCombatPower();
+    testBoostProgress();
+    testDistrictCost();
+    testCitizenValue();
+
+    std::printf("%d checks, %d failures\n", g_checks, g_failures);
+    return g_failures == 0 ? 0 : 1;
+}